@@ -5,6 +5,7 @@ including commands for:
 - Running compliance runbooks
 - Listing available connectors, processors, exporters, and rulesets
 - Validating runbooks
+- Serving runs from a long-lived daemon
 - Testing LLM connectivity
 """
 
@@ -19,6 +20,7 @@ from dotenv import load_dotenv
 
 from wct.cli import (
     execute_runbook_command,
+    gc_runs_command,
     generate_schema_command,
     list_connectors_command,
     list_exporters_command,
@@ -26,8 +28,10 @@ from wct.cli import (
     list_rulesets_command,
     list_runs_command,
     poll_run_command,
+    serve_command,
     validate_runbook_command,
 )
+from wct.cli.daemon import SOCKET_ENV_VAR
 
 # Load environment variables from .env files
 # Priority: app-specific (.env in wct app dir) > workspace root (.env)
@@ -108,12 +112,61 @@ def run(  # noqa: PLR0913 - CLI entry point with many options
             rich_help_panel="Output",
         ),
     ] = None,
+    *,
+    server: Annotated[
+        Path | None,
+        typer.Option(
+            "--server",
+            envvar=SOCKET_ENV_VAR,
+            help="Submit the run to the 'wct serve' daemon listening on this socket",
+            dir_okay=False,
+            rich_help_panel="Execution",
+        ),
+    ] = None,
+    watch: Annotated[
+        bool,
+        typer.Option(
+            "--watch",
+            help="Keep running and re-execute affected artifacts when files read by the runbook change",
+            rich_help_panel="Execution",
+        ),
+    ] = False,
+    rerun_stale: Annotated[
+        bool,
+        typer.Option(
+            "--rerun-stale",
+            help="With --resume: replan the runbook and re-run only artifacts whose configuration changed, plus their dependents",
+            rich_help_panel="Execution",
+        ),
+    ] = False,
+    metrics: Annotated[
+        bool,
+        typer.Option(
+            "--metrics",
+            help="Save the run's metrics to .waivern/runs/<run-id>/_system/metrics.json",
+            rich_help_panel="Execution",
+        ),
+    ] = False,
+    metrics_port: Annotated[
+        int | None,
+        typer.Option(
+            "--metrics-port",
+            help="With --watch: serve Prometheus metrics on http://127.0.0.1:<port>/metrics",
+            min=1,
+            max=65535,
+            rich_help_panel="Execution",
+        ),
+    ] = None,
 ) -> None:
     """Execute a runbook with configurable output options and logging.
 
     Example:
         wct run compliance-runbook.yaml --output-dir ./results --output report.json -v
         wct run compliance-runbook.yaml --exporter json
+        wct run compliance-runbook.yaml --server .waivern/wct.sock
+        wct run compliance-runbook.yaml --watch --metrics-port 9464
+        wct run compliance-runbook.yaml --metrics
+        wct run compliance-runbook.yaml --resume <run-id> --rerun-stale
 
     """
     # Set default output directory if not provided
@@ -126,7 +179,18 @@ def run(  # noqa: PLR0913 - CLI entry point with many options
         output = Path(f"{timestamp}_analysis_results.json")
 
     execute_runbook_command(
-        runbook, output_dir, output, verbose, log_level, exporter, resume
+        runbook,
+        output_dir,
+        output,
+        verbose,
+        log_level,
+        exporter,
+        resume,
+        server_socket=server,
+        watch=watch,
+        rerun_stale=rerun_stale,
+        metrics=metrics,
+        metrics_port=metrics_port,
     )
 
 
@@ -212,6 +276,78 @@ def list_runs(
     list_runs_command(log_level, status)
 
 
+@app.command(name="gc")
+def gc(  # noqa: PLR0913 - CLI entry point with many options
+    *,
+    keep_last: Annotated[
+        int | None,
+        typer.Option(
+            "--keep-last",
+            help="Keep this many of the most recently started runs",
+            min=0,
+        ),
+    ] = None,
+    keep_days: Annotated[
+        float | None,
+        typer.Option(
+            "--keep-days",
+            help="Keep runs started less than this many days ago",
+            min=0,
+        ),
+    ] = None,
+    protect: Annotated[
+        list[Path] | None,
+        typer.Option(
+            "--protect",
+            help="Keep runs this runbook or its child runbooks reuse artifacts "
+            "from (repeatable)",
+            exists=True,
+            file_okay=True,
+            dir_okay=False,
+            readable=True,
+        ),
+    ] = None,
+    prune_running: Annotated[
+        bool,
+        typer.Option(
+            "--prune-running",
+            help="Also delete runs still marked as running (e.g. after a crash)",
+        ),
+    ] = False,
+    dry_run: Annotated[
+        bool,
+        typer.Option("--dry-run", help="Show what would be deleted, delete nothing"),
+    ] = False,
+    log_level: Annotated[
+        str,
+        typer.Option(
+            "--log-level",
+            help="Set logging level (DEBUG, INFO, WARNING, ERROR, CRITICAL)",
+            case_sensitive=False,
+        ),
+    ] = "INFO",
+) -> None:
+    """Delete old runs from the artifact store.
+
+    Runs are kept if they are among the --keep-last most recent, younger
+    than --keep-days, still running, or reused by a kept run or by a
+    --protect runbook. Everything else is deleted (artifacts, LLM cache,
+    batch jobs, prepared state), then unreferenced blobs are collected.
+
+    Example:
+        wct gc --keep-last 20 --keep-days 7 --protect runbooks/nightly.yaml
+
+    """
+    gc_runs_command(
+        keep_last,
+        keep_days,
+        protect or [],
+        prune_running=prune_running,
+        dry_run=dry_run,
+        log_level=log_level,
+    )
+
+
 @app.command(name="poll")
 def poll(
     run_id: Annotated[
@@ -239,6 +375,48 @@ def poll(
     poll_run_command(run_id, log_level)
 
 
+@app.command(name="serve")
+def serve(
+    socket: Annotated[
+        Path | None,
+        typer.Option(
+            "--socket",
+            envvar=SOCKET_ENV_VAR,
+            help="Unix socket to listen on, defaults to '.waivern/wct.sock'",
+            dir_okay=False,
+        ),
+    ] = None,
+    log_level: Annotated[
+        str,
+        typer.Option(
+            "--log-level",
+            help="Set logging level (DEBUG, INFO, WARNING, ERROR, CRITICAL)",
+            case_sensitive=False,
+        ),
+    ] = "INFO",
+    metrics_port: Annotated[
+        int | None,
+        typer.Option(
+            "--metrics-port",
+            help="Serve Prometheus metrics on http://127.0.0.1:<port>/metrics",
+            min=1,
+            max=65535,
+        ),
+    ] = None,
+) -> None:
+    """Run a long-lived daemon that executes runbooks for 'wct run --server'.
+
+    Components, schemas, rulesets and LLM provider clients are loaded once
+    and stay warm between runs. Runs are executed one at a time.
+
+    Example:
+        wct serve --socket .waivern/wct.sock
+        wct serve --metrics-port 9464
+
+    """
+    serve_command(socket, log_level, metrics_port=metrics_port)
+
+
 @app.command(name="validate-runbook")
 def validate_runbook(
     runbook: Annotated[
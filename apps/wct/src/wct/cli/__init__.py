@@ -1,6 +1,7 @@
 """CLI command implementations for WCT."""
 
 from wct.cli.errors import CLIError
+from wct.cli.gc import gc_runs_command
 from wct.cli.list import (
     list_connectors_command,
     list_exporters_command,
@@ -10,11 +11,13 @@ from wct.cli.list import (
 )
 from wct.cli.poll import poll_run_command
 from wct.cli.run import execute_runbook_command
+from wct.cli.serve import serve_command
 from wct.cli.validate import generate_schema_command, validate_runbook_command
 
 __all__ = [
     "CLIError",
     "execute_runbook_command",
+    "gc_runs_command",
     "generate_schema_command",
     "list_connectors_command",
     "list_exporters_command",
@@ -22,5 +25,6 @@ __all__ = [
     "list_rulesets_command",
     "list_runs_command",
     "poll_run_command",
+    "serve_command",
     "validate_runbook_command",
 ]
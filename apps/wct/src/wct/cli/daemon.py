@@ -0,0 +1,228 @@
+"""Wire protocol and client for the ``wct serve`` daemon.
+
+The daemon listens on a Unix domain socket. Messages are JSON objects, one
+per line. A client sends a single request and the server answers with a
+stream of events, ending with a ``result`` or ``error`` event:
+
+- ``{"type": "ping"}`` -> ``{"event": "pong", "runs_served": n}``
+- ``{"type": "run", ...}`` -> any number of ``log`` events, then
+  ``{"event": "result", "result": {...}}`` or ``{"event": "error", ...}``
+"""
+
+from __future__ import annotations
+
+import asyncio
+import contextlib
+import json
+import logging
+import os
+from collections.abc import Mapping
+from dataclasses import dataclass, field
+from pathlib import Path
+from typing import Any, cast
+
+from waivern_orchestration import ExecutionResult
+
+from wct.cli.errors import CLIError
+
+logger = logging.getLogger(__name__)
+
+SOCKET_ENV_VAR = "WCT_SERVER_SOCKET"
+"""Environment variable naming the daemon socket for ``wct serve`` and ``wct run``."""
+
+DEFAULT_SOCKET_PATH = Path(".waivern") / "wct.sock"
+"""Socket used by ``wct serve`` when neither ``--socket`` nor the env var is set."""
+
+STREAM_LIMIT = 16 * 1024 * 1024
+"""Maximum length of one protocol line (results of large runs are one line)."""
+
+
+@dataclass(frozen=True, slots=True)
+class RunRequest:
+    """A runbook submission sent to the daemon.
+
+    Paths are absolute because the daemon may run in another directory.
+    Runbooks also name files relative to the working directory and
+    substitute ``${VAR}`` from the environment, so the request carries the
+    client's working directory and environment (by default, this process's)
+    and the daemon runs against those.
+    """
+
+    runbook_path: Path
+    output_path: Path
+    exporter_override: str | None = None
+    resume_run_id: str | None = None
+    rerun_stale: bool = False
+    cwd: Path = field(default_factory=Path.cwd)
+    environment: Mapping[str, str] = field(default_factory=lambda: dict(os.environ))
+
+    def to_message(self) -> dict[str, Any]:
+        """Encode the request as a protocol message."""
+        return {
+            "type": "run",
+            "runbook": str(self.runbook_path),
+            "output": str(self.output_path),
+            "exporter": self.exporter_override,
+            "resume_run_id": self.resume_run_id,
+            "rerun_stale": self.rerun_stale,
+            "cwd": str(self.cwd),
+            "environment": dict(self.environment),
+        }
+
+    @classmethod
+    def from_message(cls, message: dict[str, Any]) -> RunRequest:
+        """Decode a ``run`` protocol message.
+
+        Raises:
+            ValueError: If a field is missing or has the wrong type.
+
+        """
+        runbook = message.get("runbook")
+        output = message.get("output")
+        if not isinstance(runbook, str) or not isinstance(output, str):
+            msg = "Run request requires 'runbook' and 'output' paths"
+            raise ValueError(msg)
+
+        exporter = message.get("exporter")
+        resume_run_id = message.get("resume_run_id")
+        for name, value in (("exporter", exporter), ("resume_run_id", resume_run_id)):
+            if value is not None and not isinstance(value, str):
+                msg = f"Run request field '{name}' must be a string"
+                raise ValueError(msg)
+        rerun_stale = message.get("rerun_stale", False)
+        if not isinstance(rerun_stale, bool):
+            msg = "Run request field 'rerun_stale' must be a boolean"
+            raise ValueError(msg)
+        cwd = message.get("cwd")
+        environment = message.get("environment")
+        if not isinstance(cwd, str) or not Path(cwd).is_absolute():
+            msg = "Run request requires an absolute 'cwd'"
+            raise ValueError(msg)
+        if not isinstance(environment, dict) or not all(
+            isinstance(value, str)
+            for value in environment.values()  # type: ignore[reportUnknownVariableType]
+        ):
+            msg = "Run request requires an 'environment' of strings"
+            raise ValueError(msg)
+
+        return cls(
+            runbook_path=Path(runbook),
+            output_path=Path(output),
+            exporter_override=exporter,
+            resume_run_id=resume_run_id,
+            rerun_stale=rerun_stale,
+            cwd=Path(cwd),
+            environment=cast(dict[str, str], environment),
+        )
+
+
+def resolve_socket_path(socket_path: Path | None) -> Path:
+    """Return the explicit socket path, else ``WCT_SERVER_SOCKET``, else the default."""
+    if socket_path is not None:
+        return socket_path
+    from_env = os.getenv(SOCKET_ENV_VAR)
+    return Path(from_env) if from_env else DEFAULT_SOCKET_PATH
+
+
+async def write_message(writer: asyncio.StreamWriter, message: dict[str, Any]) -> None:
+    """Send one protocol message."""
+    writer.write(json.dumps(message, default=str).encode("utf-8") + b"\n")
+    await writer.drain()
+
+
+async def read_message(reader: asyncio.StreamReader) -> dict[str, Any] | None:
+    """Receive one protocol message, or None when the peer closed the connection.
+
+    Raises:
+        ValueError: If the line is not a JSON object.
+
+    """
+    line = await reader.readline()
+    if not line:
+        return None
+    message = json.loads(line)
+    if not isinstance(message, dict):
+        msg = "Protocol message must be a JSON object"
+        raise ValueError(msg)
+    return message  # type: ignore[return-value]
+
+
+async def _close(writer: asyncio.StreamWriter) -> None:
+    writer.close()
+    with contextlib.suppress(OSError):
+        await writer.wait_closed()
+
+
+async def ping(socket_path: Path) -> bool:
+    """Check whether a daemon is answering on ``socket_path``."""
+    try:
+        reader, writer = await asyncio.open_unix_connection(str(socket_path))
+    except OSError:
+        return False
+    try:
+        await write_message(writer, {"type": "ping"})
+        reply = await read_message(reader)
+        return reply is not None and reply.get("event") == "pong"
+    except (OSError, ValueError):
+        return False
+    finally:
+        await _close(writer)
+
+
+def _emit_remote_log(message: dict[str, Any]) -> None:
+    """Re-log a forwarded record so local logging config decides what is shown."""
+    logging.getLogger(str(message.get("logger", __name__))).log(
+        int(message.get("levelno", logging.INFO)), "%s", message.get("message", "")
+    )
+
+
+async def submit_run(socket_path: Path, request: RunRequest) -> ExecutionResult:
+    """Submit a run to the daemon and relay its progress until it finishes.
+
+    Args:
+        socket_path: Socket the daemon listens on.
+        request: The run to submit.
+
+    Returns:
+        The execution result reported by the daemon.
+
+    Raises:
+        CLIError: If the daemon is unreachable or the run fails.
+
+    """
+    try:
+        reader, writer = await asyncio.open_unix_connection(
+            str(socket_path), limit=STREAM_LIMIT
+        )
+    except OSError as e:
+        raise CLIError(
+            f"Cannot connect to wct server at {socket_path}: {e}. "
+            "Start one with 'wct serve'.",
+            command="run",
+            original_error=e,
+        ) from e
+
+    try:
+        await write_message(writer, request.to_message())
+        while (message := await read_message(reader)) is not None:
+            match message.get("event"):
+                case "log":
+                    _emit_remote_log(message)
+                case "result":
+                    return ExecutionResult.model_validate(message["result"])
+                case "error":
+                    raise CLIError(str(message.get("message")), command="run")
+                case _:
+                    logger.debug("Ignoring unknown server event: %s", message)
+    except (OSError, ValueError) as e:
+        raise CLIError(
+            f"Lost connection to wct server at {socket_path}: {e}",
+            command="run",
+            original_error=e,
+        ) from e
+    finally:
+        await _close(writer)
+
+    raise CLIError(
+        "wct server closed the connection before the run finished", command="run"
+    )
@@ -10,8 +10,7 @@ from rich.console import Console
 from rich.panel import Panel
 from rich.table import Table
 from rich.tree import Tree
-from waivern_artifact_store import ArtifactStore
-from waivern_core import Message
+from waivern_artifact_store import ArtifactMetadata, ArtifactStore
 from waivern_core.component_factory import ComponentFactory
 from waivern_orchestration import ExecutionPlan, ExecutionResult
 
@@ -45,13 +44,13 @@ class OutputFormatter:
         )
 
     def _print_error_details(
-        self, failed_ids: set[str], messages: dict[str, Message]
+        self, failed_ids: set[str], messages: dict[str, ArtifactMetadata]
     ) -> None:
         """Print error panels for failed artifacts.
 
         Args:
             failed_ids: Set of failed artifact IDs.
-            messages: Loaded artifact messages keyed by artifact ID.
+            messages: Loaded artifact metadata keyed by artifact ID.
 
         """
         if not failed_ids:
@@ -70,14 +69,14 @@ class OutputFormatter:
     def _print_verbose_details(
         self,
         completed_ids: set[str],
-        messages: dict[str, Message],
+        messages: dict[str, ArtifactMetadata],
         plan: ExecutionPlan,
     ) -> None:
         """Print verbose details for successful artifacts.
 
         Args:
             completed_ids: Set of completed artifact IDs.
-            messages: Loaded artifact messages keyed by artifact ID.
+            messages: Loaded artifact metadata keyed by artifact ID.
             plan: ExecutionPlan with artifact definitions.
 
         """
@@ -105,7 +104,8 @@ class OutputFormatter:
     ) -> None:
         """Format and print execution results.
 
-        Loads artifact data from store to display duration and error details.
+        Loads artifact metadata (not content) from store to display duration
+        and error details.
 
         Args:
             result: ExecutionResult from DAGExecutor.
@@ -114,10 +114,12 @@ class OutputFormatter:
             verbose: Show detailed information.
 
         """
-        # Load artifact messages for completed and failed artifacts
-        messages: dict[str, Message] = {}
+        # Load artifact metadata for completed and failed artifacts
+        messages: dict[str, ArtifactMetadata] = {}
         for artifact_id in result.completed | result.failed:
-            messages[artifact_id] = await store.get_artifact(result.run_id, artifact_id)
+            messages[artifact_id] = await store.get_artifact_metadata(
+                result.run_id, artifact_id
+            )
 
         # Build summary table
         table = Table(
@@ -308,6 +310,14 @@ class OutputFormatter:
         else:
             console.print("\n[bold green]✅ Execution completed![/bold green]")
 
+    def show_watching(self) -> None:
+        """Show that watch mode is waiting for file changes."""
+        console.print("\n[dim]👀 Watching for changes (Ctrl+C to stop)...[/dim]")
+
+    def show_watch_stopped(self) -> None:
+        """Show that watch mode was stopped."""
+        console.print("\n[dim]Stopped watching.[/dim]")
+
     def show_file_save_success(self, file_path: Path) -> None:
         """Show successful file save message.
 
@@ -0,0 +1,128 @@
+"""CLI command implementation for pruning old runs from the artifact store."""
+
+from __future__ import annotations
+
+import asyncio
+import logging
+from datetime import timedelta
+from pathlib import Path
+
+from rich.console import Console
+from rich.panel import Panel
+from rich.table import Table
+from waivern_artifact_store import ArtifactStoreFactory
+from waivern_orchestration import parse_runbook
+from waivern_orchestration.retention import (
+    RetentionPlan,
+    RetentionPolicy,
+    apply_retention,
+    plan_retention,
+    reused_runs,
+)
+
+from wct.cli.errors import CLIError, cli_error_handler
+from wct.logging import setup_logging
+
+logger = logging.getLogger(__name__)
+console = Console()
+
+
+def gc_runs_command(  # noqa: PLR0913 - Matches CLI entry point signature
+    keep_last: int | None,
+    keep_days: float | None,
+    protect_runbooks: list[Path],
+    *,
+    prune_running: bool = False,
+    dry_run: bool = False,
+    log_level: str = "INFO",
+) -> None:
+    """CLI command implementation for deleting runs outside a retention policy.
+
+    Orchestrates the pruning flow:
+    1. Build the retention policy and resolve the artifact store
+    2. Protect runs that the given runbooks reuse artifacts from
+    3. Plan which runs to keep (shown as a table)
+    4. Delete the other runs and collect unreferenced blobs (unless dry run)
+
+    Args:
+        keep_last: Keep this many of the most recently started runs.
+        keep_days: Keep runs started less than this many days ago.
+        protect_runbooks: Runbooks whose ``reuse`` sources (including those of
+            their child runbooks) must be kept.
+        prune_running: Also delete runs still marked as running.
+        dry_run: Only show what would be deleted.
+        log_level: Logging level.
+
+    """
+    setup_logging(level=log_level)
+
+    with cli_error_handler("gc", "Run pruning failed"):
+        # 1. Policy and store
+        try:
+            policy = RetentionPolicy(
+                keep_last=keep_last,
+                max_age=timedelta(days=keep_days) if keep_days is not None else None,
+                keep_running=not prune_running,
+            )
+        except ValueError as e:
+            raise CLIError(
+                f"{e}. Pass --keep-last and/or --keep-days.",
+                command="gc",
+                original_error=e,
+            ) from e
+
+        store = ArtifactStoreFactory().create()
+        if store is None:
+            raise CLIError(
+                "Artifact store not configured. "
+                "Check WAIVERN_STORE_TYPE environment variable.",
+                command="gc",
+            )
+
+        # 2. Reuse sources of runbooks that will run again
+        protected: set[str] = set()
+        for runbook_path in protect_runbooks:
+            protected |= reused_runs(parse_runbook(runbook_path), runbook_path)
+
+        # 3. Plan
+        plan = asyncio.run(plan_retention(store, policy, protected_runs=protected))
+        _format_retention_plan(plan)
+
+        if dry_run or not plan.delete:
+            return
+
+        # 4. Delete and collect
+        result = asyncio.run(apply_retention(store, plan))
+        console.print(
+            Panel(
+                f"[bold green]Deleted {len(result.deleted_runs)} run(s)[/bold green]\n"
+                f"Removed {result.removed_items} unreferenced blob(s)",
+                title="🧹 Garbage Collection",
+                border_style="green",
+            )
+        )
+
+
+def _format_retention_plan(plan: RetentionPlan) -> None:
+    """Display kept runs with their reasons and the number of runs to delete.
+
+    Args:
+        plan: Retention plan to display.
+
+    """
+    if plan.keep:
+        table = Table(
+            title="📋 Kept Runs",
+            show_header=True,
+            header_style="bold magenta",
+        )
+        table.add_column("Run ID", style="cyan", no_wrap=True)
+        table.add_column("Reason", style="white")
+        for run_id, reason in plan.keep.items():
+            table.add_row(run_id, reason)
+        console.print(table)
+
+    console.print(
+        f"\n[dim]{len(plan.keep)} run(s) kept, "
+        f"{len(plan.delete)} run(s) to delete.[/dim]"
+    )
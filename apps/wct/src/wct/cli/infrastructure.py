@@ -2,16 +2,37 @@
 
 from __future__ import annotations
 
+import hashlib
 import logging
+import os
+import sys
+from pathlib import Path
 
 from waivern_artifact_store import ArtifactStore, ArtifactStoreFactory
+from waivern_core.metrics import MetricsRegistry, MetricsRegistryFactory
 from waivern_core.services import ComponentRegistry, ServiceContainer, ServiceDescriptor
+from waivern_orchestration import MemoryProfile, PlanCache
 
 from wct.exporters.json_exporter import JsonExporter
 from wct.exporters.registry import ExporterRegistry
 
 logger = logging.getLogger(__name__)
 
+COMPONENT_MANIFEST_ENV_VAR = "WAIVERN_COMPONENT_MANIFEST"
+"""Path of the component manifest; ``off`` disables it."""
+
+PLAN_CACHE_ENV_VAR = "WAIVERN_PLAN_CACHE"
+"""Directory of cached execution plans; ``off`` disables it."""
+
+MEMORY_PROFILE_ENV_VAR = "WAIVERN_MEMORY_PROFILE"
+"""Path of the per-component peak memory history; ``off`` disables it."""
+
+
+def _user_cache_dir() -> Path:
+    """Return the per-user cache directory for waivern (XDG layout)."""
+    cache_home = os.getenv("XDG_CACHE_HOME")
+    return (Path(cache_home) if cache_home else Path.home() / ".cache") / "waivern"
+
 
 def initialise_exporters() -> None:
     """Initialise and register all exporters.
@@ -23,39 +44,131 @@ def initialise_exporters() -> None:
     logger.debug("Registered JsonExporter")
 
 
-def build_service_container() -> ServiceContainer:
+def build_service_container(*, metrics: bool = False) -> ServiceContainer:
     """Build a ServiceContainer with required services.
 
     Creates and configures a ServiceContainer with:
+    - MetricsRegistry (singleton, only with ``metrics``) - operational metrics,
+      also saved with each run
     - ArtifactStore (singleton) - shared between executor and exporter
 
     LLM dispatch is wired separately by the executor via ``LLMDispatcherFactory``;
     processors themselves have no LLM service dependencies.
 
+    Args:
+        metrics: Record metrics, for ``--metrics`` or ``--metrics-port``.
+
     Returns:
         Configured ServiceContainer.
 
     """
     container = ServiceContainer()
 
+    registry: MetricsRegistry | None = None
+    if metrics:
+        registry = MetricsRegistry()
+        container.register(
+            ServiceDescriptor(
+                MetricsRegistry, MetricsRegistryFactory(registry), "singleton"
+            )
+        )
+
     # Register ArtifactStore as singleton (shared between executor and exporter)
     container.register(
-        ServiceDescriptor(ArtifactStore, ArtifactStoreFactory(), "singleton")
+        ServiceDescriptor(
+            ArtifactStore, ArtifactStoreFactory(metrics=registry), "singleton"
+        )
     )
 
-    logger.debug("ServiceContainer configured with ArtifactStore service")
+    logger.debug("ServiceContainer configured (metrics: %s)", metrics)
     return container
 
 
-def setup_infrastructure() -> ComponentRegistry:
+def resolve_metrics(container: ServiceContainer) -> MetricsRegistry | None:
+    """Return the container's metrics registry, if one is registered."""
+    try:
+        return container.get_service(MetricsRegistry)
+    except (KeyError, ValueError):
+        return None
+
+
+def component_manifest_path() -> Path | None:
+    """Resolve where the component entry point manifest is cached.
+
+    ``WAIVERN_COMPONENT_MANIFEST`` overrides the location (``off`` disables
+    the manifest). By default it lives in the user cache directory, one file
+    per Python environment.
+
+    Returns:
+        Manifest path, or None if the manifest is disabled.
+
+    """
+    configured = os.getenv(COMPONENT_MANIFEST_ENV_VAR)
+    if configured:
+        return None if configured.lower() == "off" else Path(configured)
+
+    environment = hashlib.sha256(sys.prefix.encode()).hexdigest()[:16]
+    return _user_cache_dir() / f"components-{environment}.json"
+
+
+def build_plan_cache() -> PlanCache | None:
+    """Create the execution plan cache used by ``wct run``.
+
+    ``WAIVERN_PLAN_CACHE`` overrides the directory (``off`` disables the
+    cache). By default plans are cached in the user cache directory.
+
+    Returns:
+        PlanCache, or None if plan caching is disabled.
+
+    """
+    configured = os.getenv(PLAN_CACHE_ENV_VAR)
+    if configured:
+        return None if configured.lower() == "off" else PlanCache(Path(configured))
+    return PlanCache(_user_cache_dir() / "plans")
+
+
+def build_memory_profile() -> MemoryProfile:
+    """Create the memory profile that ``config.memory_budget`` estimates from.
+
+    ``WAIVERN_MEMORY_PROFILE`` overrides the file (``off`` keeps observations
+    for the current run only). By default the profile is kept in the user
+    cache directory.
+
+    Returns:
+        MemoryProfile, persisted unless disabled.
+
+    """
+    configured = os.getenv(MEMORY_PROFILE_ENV_VAR)
+    if configured:
+        return MemoryProfile(None if configured.lower() == "off" else Path(configured))
+    return MemoryProfile(_user_cache_dir() / "memory-profile.json")
+
+
+def build_component_registry(container: ServiceContainer) -> ComponentRegistry:
+    """Create a ComponentRegistry that caches entry points in the manifest.
+
+    Args:
+        container: ServiceContainer for factory dependency injection.
+
+    Returns:
+        ComponentRegistry with lazy, manifest-backed discovery.
+
+    """
+    return ComponentRegistry(container, manifest_path=component_manifest_path())
+
+
+def setup_infrastructure(*, metrics: bool = False) -> ComponentRegistry:
     """Set up infrastructure for runbook execution.
 
+    Args:
+        metrics: Record metrics (see ``build_service_container``).
+
     Returns:
         Configured ComponentRegistry with services.
 
     """
     initialise_exporters()
-    container = build_service_container()
-    registry = ComponentRegistry(container)
+    container = build_service_container(metrics=metrics)
+    registry = build_component_registry(container)
     logger.debug("Infrastructure setup complete")
     return registry
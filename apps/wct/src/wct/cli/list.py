@@ -9,14 +9,17 @@ from rich.console import Console
 from rich.panel import Panel
 from rich.table import Table
 from waivern_artifact_store import ArtifactStoreFactory
-from waivern_core.services import ComponentRegistry
 from waivern_orchestration.run_metadata import RunMetadata
 from waivern_orchestration.state import ExecutionState
 from waivern_rulesets.core.registry import RulesetRegistry
 
 from wct.cli.errors import CLIError, cli_error_handler
 from wct.cli.formatting import OutputFormatter
-from wct.cli.infrastructure import build_service_container, initialise_exporters
+from wct.cli.infrastructure import (
+    build_component_registry,
+    build_service_container,
+    initialise_exporters,
+)
 from wct.exporters.registry import ExporterRegistry
 from wct.logging import setup_logging
 
@@ -32,7 +35,7 @@ def _list_registry_components(component_type: str) -> None:
 
     """
     container = build_service_container()
-    registry = ComponentRegistry(container)
+    registry = build_component_registry(container)
 
     match component_type:
         case "connectors":
@@ -181,10 +184,10 @@ def list_runs_command(
                 command="runs",
             )
 
-        # Get all run IDs
-        run_ids = asyncio.run(store.list_runs())
+        # Metadata of all runs, served from the store's run index
+        all_metadata = asyncio.run(store.list_run_metadata())
 
-        if not run_ids:
+        if not all_metadata:
             info_panel = Panel(
                 "[yellow]No runs recorded.[/yellow]\n\n"
                 "Execute a runbook with 'wct run <runbook.yaml>' to create a run.",
@@ -194,17 +197,18 @@ def list_runs_command(
             console.print(info_panel)
             return
 
-        # Load metadata for each run and collect data
+        # Validate metadata and load state for each listed run
         runs_data: list[dict[str, str | int]] = []
-        for run_id in run_ids:
+        for run_id, metadata_data in all_metadata.items():
             try:
-                metadata = asyncio.run(RunMetadata.load(store, run_id))
-                state = asyncio.run(ExecutionState.load(store, run_id))
+                metadata = RunMetadata.model_validate(metadata_data)
 
-                # Apply status filter
+                # Apply status filter before loading state
                 if status_filter and metadata.status != status_filter:
                     continue
 
+                state = asyncio.run(ExecutionState.load(store, run_id))
+
                 runs_data.append(
                     {
                         "run_id": run_id[:8] + "...",  # Truncate UUID for display
@@ -0,0 +1,97 @@
+"""Prometheus metrics endpoint for long-running ``wct`` modes.
+
+``wct serve`` and ``wct run --watch`` can expose the process's
+``MetricsRegistry`` over HTTP with ``--metrics-port``: ``GET /metrics``
+returns the Prometheus text exposition format. The endpoint is a minimal
+HTTP/1.0 responder on the running event loop; it serves scrapes, not
+browsers, and binds to localhost unless told otherwise.
+"""
+
+from __future__ import annotations
+
+import asyncio
+import logging
+from collections.abc import AsyncIterator
+from contextlib import asynccontextmanager
+
+from waivern_core.metrics import MetricsRegistry
+
+from wct.cli.errors import CLIError
+
+logger = logging.getLogger(__name__)
+
+CONTENT_TYPE = "text/plain; version=0.0.4; charset=utf-8"
+"""Content type of the Prometheus text exposition format."""
+
+
+async def _handle_scrape(
+    registry: MetricsRegistry,
+    reader: asyncio.StreamReader,
+    writer: asyncio.StreamWriter,
+) -> None:
+    """Answer one HTTP request and close the connection."""
+    try:
+        request_line = await reader.readline()
+        # Drain the headers; nothing in them changes the response
+        while await reader.readline() not in (b"\r\n", b"\n", b""):
+            pass
+        method, path, *_ = [*request_line.decode("latin-1").split(), "", ""]
+
+        if method not in ("GET", "HEAD"):
+            status, body = "405 Method Not Allowed", b""
+        elif path.split("?", 1)[0] != "/metrics":
+            status, body = "404 Not Found", b""
+        else:
+            status, body = "200 OK", registry.render_prometheus().encode()
+
+        head = (
+            f"HTTP/1.0 {status}\r\n"
+            f"Content-Type: {CONTENT_TYPE}\r\n"
+            f"Content-Length: {len(body)}\r\n"
+            "Connection: close\r\n\r\n"
+        )
+        writer.write(head.encode("latin-1") + (body if method == "GET" else b""))
+        await writer.drain()
+    except (OSError, ValueError) as e:
+        logger.debug("Dropped metrics connection: %s", e)
+    finally:
+        writer.close()
+
+
+@asynccontextmanager
+async def serving_metrics(
+    registry: MetricsRegistry, port: int | None, host: str = "127.0.0.1"
+) -> AsyncIterator[int | None]:
+    """Serve ``registry`` on ``host:port`` for the duration of the block.
+
+    Args:
+        registry: Metrics to expose.
+        port: TCP port (0 picks a free one), or None to serve nothing.
+        host: Interface to bind.
+
+    Yields:
+        The port bound, or None if nothing is served.
+
+    Raises:
+        CLIError: If the port cannot be bound.
+
+    """
+    if port is None:
+        yield None
+        return
+
+    try:
+        server = await asyncio.start_server(
+            lambda reader, writer: _handle_scrape(registry, reader, writer),
+            host=host,
+            port=port,
+        )
+    except OSError as e:
+        raise CLIError(
+            f"Cannot serve metrics on {host}:{port}: {e}", original_error=e
+        ) from e
+
+    bound_port: int = server.sockets[0].getsockname()[1]
+    logger.info("Serving Prometheus metrics on http://%s:%d/metrics", host, bound_port)
+    async with server:
+        yield bound_port
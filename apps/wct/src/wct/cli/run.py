@@ -3,6 +3,7 @@
 from __future__ import annotations
 
 import asyncio
+import itertools
 import json
 import logging
 from pathlib import Path
@@ -10,6 +11,8 @@ from typing import Any
 
 from waivern_artifact_store import ArtifactStore
 from waivern_artifact_store.errors import ArtifactNotFoundError
+from waivern_artifact_store.write_buffer import temporary_path
+from waivern_core.metrics import MetricsRegistry
 from waivern_core.services import ComponentRegistry
 from waivern_orchestration import (
     DAGExecutor,
@@ -18,10 +21,20 @@ from waivern_orchestration import (
     OrchestrationError,
     Planner,
 )
+from waivern_orchestration.state import ExecutionState
 
+from wct.cli.daemon import RunRequest, submit_run
 from wct.cli.errors import CLIError, cli_error_handler
 from wct.cli.formatting import OutputFormatter
-from wct.cli.infrastructure import setup_infrastructure
+from wct.cli.infrastructure import (
+    build_memory_profile,
+    build_plan_cache,
+    resolve_metrics,
+    setup_infrastructure,
+)
+from wct.cli.metrics_server import serving_metrics
+from wct.cli.watch import FileWatcher, affected_artifacts, watched_sources
+from wct.exporters.protocol import StreamingExporter
 from wct.exporters.registry import ExporterRegistry
 from wct.logging import setup_logging
 
@@ -42,7 +55,7 @@ def _plan_runbook(runbook_path: Path, registry: ComponentRegistry) -> ExecutionP
         CLIError: If planning fails.
 
     """
-    planner = Planner(registry)
+    planner = Planner(registry, plan_cache=build_plan_cache())
     try:
         plan = planner.plan(runbook_path)
         logger.info(
@@ -59,7 +72,7 @@ def _plan_runbook(runbook_path: Path, registry: ComponentRegistry) -> ExecutionP
         ) from e
 
 
-def _load_persisted_plan(store: ArtifactStore, run_id: str) -> ExecutionPlan:
+async def _load_persisted_plan(store: ArtifactStore, run_id: str) -> ExecutionPlan:
     """Load a persisted execution plan from the store.
 
     On resume, the plan is loaded from the store rather than re-planned
@@ -78,7 +91,7 @@ def _load_persisted_plan(store: ArtifactStore, run_id: str) -> ExecutionPlan:
 
     """
     try:
-        data: dict[str, Any] = asyncio.run(store.load_system_data(run_id, "plan"))
+        data: dict[str, Any] = await store.load_system_data(run_id, "plan")
         return ExecutionPlan.from_dict(data)
     except ArtifactNotFoundError as e:
         raise CLIError(
@@ -89,11 +102,13 @@ def _load_persisted_plan(store: ArtifactStore, run_id: str) -> ExecutionPlan:
         ) from e
 
 
-def _execute_plan(
+async def execute_plan(
     plan: ExecutionPlan,
     registry: ComponentRegistry,
     runbook_path: Path,
     resume_run_id: str | None = None,
+    *,
+    rerun_stale: bool = False,
 ) -> ExecutionResult:
     """Execute runbook plan.
 
@@ -102,6 +117,8 @@ def _execute_plan(
         registry: Component registry for factory lookup.
         runbook_path: Path to the runbook file (required for resume validation).
         resume_run_id: If provided, resume from this existing run.
+        rerun_stale: When resuming, adopt ``plan`` and re-execute only the
+            artifacts whose definitions changed, plus their dependents.
 
     Returns:
         Execution result with artifact outcomes.
@@ -110,14 +127,17 @@ def _execute_plan(
         CLIError: If execution fails.
 
     """
-    executor = DAGExecutor(registry)
+    executor = DAGExecutor(
+        registry,
+        memory_profile=build_memory_profile(),
+        metrics=resolve_metrics(registry.container),
+    )
     try:
-        result = asyncio.run(
-            executor.execute(
-                plan,
-                runbook_path=runbook_path,
-                resume_run_id=resume_run_id,
-            )
+        result = await executor.execute(
+            plan,
+            runbook_path=runbook_path,
+            resume_run_id=resume_run_id,
+            rerun_stale=rerun_stale,
         )
         total = len(result.completed) + len(result.failed) + len(result.skipped)
         logger.info(
@@ -135,6 +155,78 @@ def _execute_plan(
         ) from e
 
 
+async def plan_and_execute(
+    registry: ComponentRegistry,
+    runbook_path: Path,
+    *,
+    resume_run_id: str | None = None,
+    rerun_stale: bool = False,
+) -> tuple[ExecutionPlan, ExecutionResult]:
+    """Plan a runbook (or load its persisted plan on resume) and execute it.
+
+    This is the part of ``wct run`` shared with ``wct serve``, which calls it
+    with a long-lived registry on a long-lived event loop.
+
+    Args:
+        registry: Component registry for factory lookup.
+        runbook_path: Path to the runbook YAML file.
+        resume_run_id: If provided, resume from this existing run.
+        rerun_stale: When resuming, replan the runbook instead of loading the
+            persisted plan, and re-execute only what changed.
+
+    Returns:
+        The execution plan and the execution result.
+
+    Raises:
+        CLIError: If planning or execution fails.
+
+    """
+    plan = await load_or_plan(
+        registry, runbook_path, resume_run_id=resume_run_id, rerun_stale=rerun_stale
+    )
+    result = await execute_plan(
+        plan, registry, runbook_path, resume_run_id, rerun_stale=rerun_stale
+    )
+    return plan, result
+
+
+async def load_or_plan(
+    registry: ComponentRegistry,
+    runbook_path: Path,
+    *,
+    resume_run_id: str | None = None,
+    rerun_stale: bool = False,
+) -> ExecutionPlan:
+    """Plan a runbook, or load its persisted plan on a plain resume.
+
+    Args:
+        registry: Component registry for factory lookup.
+        runbook_path: Path to the runbook YAML file.
+        resume_run_id: If provided, the run being resumed.
+        rerun_stale: When resuming, replan the runbook instead of loading the
+            persisted plan.
+
+    Returns:
+        The execution plan.
+
+    Raises:
+        CLIError: If planning or loading the plan fails.
+
+    """
+    if resume_run_id is not None and not rerun_stale:
+        store = registry.container.get_service(ArtifactStore)
+        plan = await _load_persisted_plan(store, resume_run_id)
+        logger.info(
+            "Loaded persisted plan for run '%s' with %d artifacts",
+            resume_run_id,
+            len(plan.runbook.artifacts),
+        )
+        return plan
+
+    # Planning reads files and parses schemas; keep the event loop free
+    return await asyncio.to_thread(_plan_runbook, runbook_path, registry)
+
+
 def _framework_to_exporter(framework: str) -> str:
     """Map compliance framework to exporter name.
 
@@ -170,7 +262,28 @@ def _detect_exporter(plan: ExecutionPlan) -> str:
     return _framework_to_exporter(framework)
 
 
-def _export_results(
+async def _stream_export(
+    exporter: StreamingExporter,
+    result: ExecutionResult,
+    plan: ExecutionPlan,
+    output_path: Path,
+    store: ArtifactStore,
+) -> None:
+    """Write the export incrementally, replacing the output file on success.
+
+    The document is streamed to a sibling temporary file so a failure part
+    way through never leaves a truncated export at ``output_path``.
+    """
+    partial_path = temporary_path(output_path)
+    try:
+        with partial_path.open("w", encoding="utf-8") as f:
+            await exporter.export_to(result, plan, store, f)
+        partial_path.replace(output_path)
+    finally:
+        partial_path.unlink(missing_ok=True)
+
+
+async def export_results(
     result: ExecutionResult,
     plan: ExecutionPlan,
     output_path: Path,
@@ -210,10 +323,13 @@ def _export_results(
 
     # Export to file (exporter.export is async)
     try:
-        export_data = asyncio.run(exporter.export(result, plan, store))
         output_path.parent.mkdir(parents=True, exist_ok=True)
-        with output_path.open("w", encoding="utf-8") as f:
-            json.dump(export_data, f, indent=2, default=str)
+        if isinstance(exporter, StreamingExporter):
+            await _stream_export(exporter, result, plan, output_path, store)
+        else:
+            export_data = await exporter.export(result, plan, store)
+            with output_path.open("w", encoding="utf-8") as f:
+                json.dump(export_data, f, indent=2, default=str)
         logger.info("Results saved to JSON file: %s", output_path)
     except Exception as e:
         error_msg = f"Failed to save results to {output_path}: {e}"
@@ -221,6 +337,190 @@ def _export_results(
         raise CLIError(error_msg, command="run", original_error=e) from e
 
 
+async def _run_locally(
+    formatter: OutputFormatter,
+    request: RunRequest,
+    *,
+    verbose: bool,
+    metrics: bool = False,
+) -> None:
+    """Execute a run in this process and display its results.
+
+    Args:
+        formatter: Formatter for console output.
+        request: The run to execute.
+        verbose: Show verbose result details.
+        metrics: Save the run's metrics with it.
+
+    """
+    registry = setup_infrastructure(metrics=metrics)
+    store = registry.container.get_service(ArtifactStore)
+
+    plan, result = await plan_and_execute(
+        registry,
+        request.runbook_path,
+        resume_run_id=request.resume_run_id,
+        rerun_stale=request.rerun_stale,
+    )
+    await _show_and_export(formatter, request, plan, result, store, verbose=verbose)
+
+
+async def _show_and_export(  # noqa: PLR0913 - Keyword-only display option
+    formatter: OutputFormatter,
+    request: RunRequest,
+    plan: ExecutionPlan,
+    result: ExecutionResult,
+    store: ArtifactStore,
+    *,
+    verbose: bool,
+) -> None:
+    """Display the results of a run and export them."""
+    # Display results (load artifact data from store for duration/errors)
+    interrupted = len(result.pending) > 0
+    formatter.show_execution_completion(interrupted=interrupted)
+    await formatter.format_execution_result(result, plan, store, verbose)
+
+    # Export results
+    await export_results(
+        result, plan, request.output_path, store, request.exporter_override
+    )
+    formatter.show_file_save_success(request.output_path)
+    formatter.show_completion_summary(result, request.output_path)
+
+
+async def _rerun_affected(
+    registry: ComponentRegistry,
+    plan: ExecutionPlan,
+    runbook_path: Path,
+    *,
+    run_id: str,
+    affected: set[str],
+) -> ExecutionResult:
+    """Re-execute ``affected`` artifacts of a finished run, reusing the rest."""
+    store = registry.container.get_service(ArtifactStore)
+    state = await ExecutionState.load(store, run_id)
+    state.invalidate(affected)
+    await state.save(store)
+    return await execute_plan(plan, registry, runbook_path, run_id)
+
+
+async def _watch_locally(
+    formatter: OutputFormatter,
+    request: RunRequest,
+    *,
+    verbose: bool,
+    metrics: bool = False,
+    metrics_port: int | None = None,
+) -> None:
+    """Execute a run, then re-execute it incrementally whenever its files change.
+
+    Editing a file read by a connector re-executes only the affected
+    artifacts within the same run (see ``wct.cli.watch``). Editing the
+    runbook replans it and re-executes the artifacts whose definitions
+    changed, as ``--rerun-stale`` does. Failures are reported and watching
+    continues until interrupted.
+
+    Args:
+        formatter: Formatter for console output.
+        request: The run to execute.
+        verbose: Show verbose result details.
+        metrics: Save each run's metrics with it.
+        metrics_port: Serve Prometheus metrics on this port while watching
+            (implies ``metrics``).
+
+    """
+    registry = setup_infrastructure(metrics=metrics or metrics_port is not None)
+    registry_metrics = resolve_metrics(registry.container) or MetricsRegistry()
+    async with serving_metrics(registry_metrics, metrics_port):
+        await _watch(formatter, request, registry, verbose=verbose)
+
+
+async def _watch(
+    formatter: OutputFormatter,
+    request: RunRequest,
+    registry: ComponentRegistry,
+    *,
+    verbose: bool,
+) -> None:
+    """Run the watch loop of ``_watch_locally`` until cancelled."""
+    store = registry.container.get_service(ArtifactStore)
+    runbook_path = request.runbook_path
+    watcher = FileWatcher(ignored=(request.output_path,))
+    await watcher.watch([runbook_path])
+
+    plan: ExecutionPlan | None = None
+    sources: dict[str, tuple[Path, ...]] = {}
+    run_id = request.resume_run_id
+    rerun_stale = request.rerun_stale
+    changed: set[Path] = set()
+    while True:
+        try:
+            if plan is None or runbook_path in changed:
+                if plan is not None:
+                    logger.info("Runbook changed; re-running stale artifacts")
+                    plan, rerun_stale = None, True
+                replan = rerun_stale and run_id is not None
+                plan = await load_or_plan(
+                    registry, runbook_path, resume_run_id=run_id, rerun_stale=replan
+                )
+                # Snapshot before executing, so edits made during the run
+                # are picked up once it finishes
+                sources = watched_sources(plan)
+                await watcher.watch(
+                    [runbook_path, *itertools.chain.from_iterable(sources.values())]
+                )
+                result = await execute_plan(
+                    plan, registry, runbook_path, run_id, rerun_stale=replan
+                )
+            elif run_id is not None and (
+                affected := affected_artifacts(plan, sources, changed)
+            ):
+                logger.info(
+                    "%d file(s) changed; re-running %d artifact(s)",
+                    len(changed),
+                    len(affected),
+                )
+                result = await _rerun_affected(
+                    registry, plan, runbook_path, run_id=run_id, affected=affected
+                )
+            else:
+                changed = await watcher.wait_for_changes()
+                continue
+
+            run_id = result.run_id
+            await _show_and_export(
+                formatter, request, plan, result, store, verbose=verbose
+            )
+        except CLIError as e:
+            logger.error("%s", e)
+
+        formatter.show_watching()
+        changed = await watcher.wait_for_changes()
+
+
+def _run_on_server(
+    formatter: OutputFormatter, request: RunRequest, socket_path: Path
+) -> None:
+    """Submit a run to a ``wct serve`` daemon and display its outcome.
+
+    The daemon streams its log records while the run executes; the
+    per-artifact results table is not shown (use ``wct runs`` to inspect
+    the run in a shared store).
+
+    Args:
+        formatter: Formatter for console output.
+        request: The run to submit.
+        socket_path: Socket the daemon listens on.
+
+    """
+    logger.info("Submitting run to wct server at %s", socket_path)
+    result = asyncio.run(submit_run(socket_path, request))
+
+    formatter.show_execution_completion(interrupted=len(result.pending) > 0)
+    formatter.show_file_save_success(request.output_path)
+    formatter.show_completion_summary(result, request.output_path)
+
+
 def execute_runbook_command(  # noqa: PLR0913 - Matches CLI entry point signature
     runbook_path: Path,
     output_dir: Path,
@@ -229,6 +529,12 @@ def execute_runbook_command(  # noqa: PLR0913 - Matches CLI entry point signatur
     log_level: str = "INFO",
     exporter_override: str | None = None,
     resume_run_id: str | None = None,
+    *,
+    server_socket: Path | None = None,
+    watch: bool = False,
+    rerun_stale: bool = False,
+    metrics: bool = False,
+    metrics_port: int | None = None,
 ) -> None:
     """CLI command implementation for running analyses.
 
@@ -240,6 +546,14 @@ def execute_runbook_command(  # noqa: PLR0913 - Matches CLI entry point signatur
         log_level: Logging level
         exporter_override: Manual exporter selection (overrides auto-detection)
         resume_run_id: If provided, resume from this existing run
+        server_socket: If provided, submit the run to the ``wct serve`` daemon
+            listening on this socket instead of executing it in-process
+        watch: Keep running and re-execute affected artifacts when the
+            files read by the runbook change
+        rerun_stale: With ``resume_run_id``, replan the runbook and re-execute
+            only the artifacts whose definitions changed, plus dependents
+        metrics: Save the run's metrics with it (``_system/metrics.json``)
+        metrics_port: With ``watch``, serve Prometheus metrics on this port
 
     """
     effective_log_level = "DEBUG" if verbose else log_level
@@ -249,31 +563,46 @@ def execute_runbook_command(  # noqa: PLR0913 - Matches CLI entry point signatur
     formatter.show_startup_banner(runbook_path, output_dir, log_level, verbose)
 
     with cli_error_handler("run", "Execution failed"):
-        # Setup infrastructure
-        registry = setup_infrastructure()
-        store = registry.container.get_service(ArtifactStore)
+        final_output_path = output if output.is_absolute() else output_dir / output
+        request = RunRequest(
+            runbook_path=runbook_path.resolve(),
+            output_path=final_output_path.resolve(),
+            exporter_override=exporter_override,
+            resume_run_id=resume_run_id,
+            rerun_stale=rerun_stale,
+        )
 
-        # Plan: load persisted plan on resume, otherwise plan from runbook
-        if resume_run_id is not None:
-            plan = _load_persisted_plan(store, resume_run_id)
-            logger.info(
-                "Loaded persisted plan for run '%s' with %d artifacts",
-                resume_run_id,
-                len(plan.runbook.artifacts),
+        if rerun_stale and resume_run_id is None:
+            raise CLIError("--rerun-stale requires --resume <run-id>", command="run")
+        if watch and server_socket is not None:
+            raise CLIError("--watch cannot be combined with --server", command="run")
+        if metrics_port is not None and not watch:
+            raise CLIError(
+                "--metrics-port requires --watch (or pass it to 'wct serve')",
+                command="run",
             )
+        if metrics and server_socket is not None:
+            raise CLIError(
+                "--metrics cannot be combined with --server "
+                "(pass --metrics-port to 'wct serve')",
+                command="run",
+            )
+        if watch:
+            try:
+                asyncio.run(
+                    _watch_locally(
+                        formatter,
+                        request,
+                        verbose=verbose,
+                        metrics=metrics,
+                        metrics_port=metrics_port,
+                    )
+                )
+            except KeyboardInterrupt:
+                formatter.show_watch_stopped()
+        elif server_socket is not None:
+            _run_on_server(formatter, request, server_socket)
         else:
-            plan = _plan_runbook(runbook_path, registry)
-
-        # Execute
-        result = _execute_plan(plan, registry, runbook_path, resume_run_id)
-
-        # Display results (load artifact data from store for duration/errors)
-        interrupted = len(result.pending) > 0
-        formatter.show_execution_completion(interrupted=interrupted)
-        asyncio.run(formatter.format_execution_result(result, plan, store, verbose))
-
-        # Export results
-        final_output_path = output if output.is_absolute() else output_dir / output
-        _export_results(result, plan, final_output_path, store, exporter_override)
-        formatter.show_file_save_success(final_output_path)
-        formatter.show_completion_summary(result, final_output_path)
+            asyncio.run(
+                _run_locally(formatter, request, verbose=verbose, metrics=metrics)
+            )
@@ -0,0 +1,427 @@
+"""CLI command implementation for the long-lived ``wct serve`` daemon.
+
+Every ``wct run`` pays for entry-point discovery, schema registration,
+ruleset loading and LLM client setup before the first artifact executes.
+The daemon pays once: it keeps one component registry, the ruleset cache
+and the LLM provider clients alive on one event loop, and executes
+runbooks submitted by ``wct run --server``. Runs are executed one at a time.
+
+A served run executes in its client's working directory with its client's
+environment, so whatever is read while a run executes follows the client:
+``${VAR}`` references in runbooks, connector settings (``MYSQL_*``,
+``MONGODB_*``, ...), LLM provider, model and dispatch settings (``LLM_*``,
+``*_API_KEY``, ``WAIVERN_LLM_*``), ``WAIVERN_VALIDATION_POLICY``,
+``WAIVERN_PLAN_CACHE`` and ``WAIVERN_MEMORY_PROFILE``.
+
+The artifact store, component manifest and logging are set up once when the
+server starts, from the server's environment. The store is where a run's
+results land, so a run whose ``WAIVERN_STORE_*`` variables differ from the
+server's is rejected rather than silently written elsewhere. A relative
+``WAIVERN_STORE_PATH`` resolves against the server's starting directory.
+"""
+
+from __future__ import annotations
+
+import asyncio
+import logging
+import os
+from collections.abc import Iterator, Mapping
+from contextlib import contextmanager
+from pathlib import Path
+from typing import Any, override
+
+from rich.console import Console
+from rich.panel import Panel
+from waivern_analysers_shared.utilities import RulesetManager
+from waivern_artifact_store import ArtifactStore
+from waivern_artifact_store.in_memory import AsyncInMemoryStore
+from waivern_core.metrics import MetricsRegistry
+from waivern_core.services import ComponentRegistry
+from waivern_orchestration import ExecutionResult
+from waivern_rulesets.core.registry import RulesetRegistry
+
+from wct.cli.daemon import (
+    STREAM_LIMIT,
+    RunRequest,
+    ping,
+    read_message,
+    resolve_socket_path,
+    write_message,
+)
+from wct.cli.errors import CLIError, cli_error_handler
+from wct.cli.infrastructure import resolve_metrics, setup_infrastructure
+from wct.cli.metrics_server import serving_metrics
+from wct.cli.run import export_results, plan_and_execute
+from wct.logging import setup_logging
+
+logger = logging.getLogger(__name__)
+console = Console()
+
+type _Event = dict[str, Any]
+
+_STORE_ENV_PREFIX = "WAIVERN_STORE_"
+"""Prefix of the variables the artifact store is configured from."""
+
+
+def _store_environment(environment: Mapping[str, str]) -> dict[str, str]:
+    """Return the artifact store variables of ``environment``."""
+    return {
+        name: value
+        for name, value in environment.items()
+        if name.startswith(_STORE_ENV_PREFIX)
+    }
+
+
+class _ForwardingLogHandler(logging.Handler):
+    """Queues log records as protocol events for the client of the current run.
+
+    Records may come from worker threads (planning runs in one), so events
+    are handed to the event loop with ``call_soon_threadsafe``.
+    """
+
+    def __init__(
+        self, loop: asyncio.AbstractEventLoop, events: asyncio.Queue[_Event | None]
+    ) -> None:
+        super().__init__()
+        self._loop = loop
+        self._events = events
+
+    @override
+    def emit(self, record: logging.LogRecord) -> None:
+        try:
+            event: _Event = {
+                "event": "log",
+                "logger": record.name,
+                "levelno": record.levelno,
+                "message": record.getMessage(),
+            }
+            self._loop.call_soon_threadsafe(self._events.put_nowait, event)
+        except Exception:
+            self.handleError(record)
+
+
+@contextmanager
+def _private_umask() -> Iterator[None]:
+    """Create files readable and writable by this user only, then restore."""
+    previous = os.umask(0o077)
+    try:
+        yield
+    finally:
+        os.umask(previous)
+
+
+@contextmanager
+def _forwarding_logs(handler: logging.Handler) -> Iterator[None]:
+    """Attach ``handler`` wherever records end up.
+
+    That is the root logger plus every logger that does not propagate to it
+    (see ``wct/config/logging.yaml``).
+    """
+    targets = [logging.getLogger()] + [
+        candidate
+        for candidate in logging.root.manager.loggerDict.values()
+        if isinstance(candidate, logging.Logger) and not candidate.propagate
+    ]
+    for target in targets:
+        target.addHandler(handler)
+    try:
+        yield
+    finally:
+        for target in targets:
+            target.removeHandler(handler)
+
+
+@contextmanager
+def _client_environment(request: RunRequest) -> Iterator[None]:
+    """Run in the client's working directory with the client's environment.
+
+    Runs execute one at a time, so switching the process-wide state for the
+    duration of a run does not affect other runs.
+
+    Raises:
+        CLIError: If the client's working directory does not exist here.
+
+    """
+    previous_cwd = Path.cwd()
+    previous_environment = dict(os.environ)
+    try:
+        os.chdir(request.cwd)
+    except OSError as e:
+        raise CLIError(
+            f"Cannot run in the client's working directory {request.cwd}: {e}",
+            command="run",
+            original_error=e,
+        ) from e
+    os.environ.clear()
+    os.environ.update(request.environment)
+    try:
+        yield
+    finally:
+        os.environ.clear()
+        os.environ.update(previous_environment)
+        os.chdir(previous_cwd)
+
+
+class RunServer:
+    """Executes submitted runbooks with a long-lived component registry."""
+
+    def __init__(self, registry: ComponentRegistry) -> None:
+        """Initialise the server.
+
+        Args:
+            registry: Registry shared by every run the server executes.
+
+        """
+        self._registry = registry
+        self._run_lock = asyncio.Lock()
+        self._runs_served = 0
+        # The registry's store is configured from the environment at startup
+        self._store_environment = _store_environment(os.environ)
+
+    def warm_up(self) -> None:
+        """Load every component factory and registered ruleset up front.
+
+        Discovery also registers schemas. Factories are otherwise imported on
+        first use, so they are loaded explicitly here. Rulesets land in the
+        process-wide ``RulesetManager`` cache, where analysers find them on
+        every run.
+        """
+        registry = self._registry
+        component_counts = tuple(
+            len(dict(factories))
+            for factories in (
+                registry.connector_factories,
+                registry.processor_factories,
+                registry.dispatcher_factories,
+            )
+        )
+
+        rulesets = RulesetRegistry().list_registered()
+        for name, version, rule_type in rulesets:
+            RulesetManager.get_ruleset(f"local/{name}/{version}", rule_type)
+
+        logger.info(
+            "Warmed up %d connectors, %d processors, %d dispatchers and %d rulesets",
+            *component_counts,
+            len(rulesets),
+        )
+
+        if isinstance(
+            registry.container.get_service(ArtifactStore), AsyncInMemoryStore
+        ):
+            logger.warning(
+                "The in-memory artifact store keeps every run in server memory; "
+                "set WAIVERN_STORE_TYPE=filesystem for a long-lived server"
+            )
+
+    async def serve(
+        self, socket_path: Path, *, metrics_port: int | None = None
+    ) -> None:
+        """Listen on ``socket_path`` until cancelled.
+
+        Args:
+            socket_path: Unix socket to accept runs on.
+            metrics_port: Serve Prometheus metrics on this port as well.
+
+        Raises:
+            CLIError: If another server is already listening on the socket,
+                or the metrics port cannot be bound.
+
+        """
+        if socket_path.exists():
+            if await ping(socket_path):
+                raise CLIError(
+                    f"A wct server is already listening on {socket_path}",
+                    command="serve",
+                )
+            socket_path.unlink()  # Left behind by a server that did not exit cleanly
+        socket_path.parent.mkdir(parents=True, exist_ok=True)
+
+        # Runs read local files; only this user may submit. The umask closes
+        # the window between bind and chmod where the socket is world-writable.
+        with _private_umask():
+            server = await asyncio.start_unix_server(
+                self.handle_connection, path=str(socket_path), limit=STREAM_LIMIT
+            )
+        socket_path.chmod(0o600)
+
+        console.print(
+            Panel(
+                f"[bold green]Listening on {socket_path}[/bold green]\n"
+                f"Submit runbooks with 'wct run <runbook.yaml> --server {socket_path}'",
+                title="🛰️  WCT Server",
+                border_style="green",
+            )
+        )
+        metrics = resolve_metrics(self._registry.container) or MetricsRegistry()
+        try:
+            async with server, serving_metrics(metrics, metrics_port):
+                await server.serve_forever()
+        finally:
+            socket_path.unlink(missing_ok=True)
+
+    async def handle_connection(
+        self, reader: asyncio.StreamReader, writer: asyncio.StreamWriter
+    ) -> None:
+        """Answer one request on a client connection."""
+        try:
+            message = await read_message(reader)
+            match message.get("type") if message else None:
+                case "ping":
+                    await write_message(
+                        writer, {"event": "pong", "runs_served": self._runs_served}
+                    )
+                case "run":
+                    await self._serve_run(message or {}, writer)
+                case other:
+                    await write_message(
+                        writer,
+                        {"event": "error", "message": f"Unknown request type: {other}"},
+                    )
+        except (OSError, ValueError) as e:
+            logger.warning("Dropped client connection: %s", e)
+        finally:
+            writer.close()
+
+    async def _serve_run(
+        self, message: dict[str, Any], writer: asyncio.StreamWriter
+    ) -> None:
+        """Execute one run, streaming its log records to the client."""
+        try:
+            request = RunRequest.from_message(message)
+        except ValueError as e:
+            await write_message(writer, {"event": "error", "message": str(e)})
+            return
+
+        if mismatch := self._store_mismatch(request):
+            await write_message(writer, {"event": "error", "message": mismatch})
+            return
+
+        if self._run_lock.locked():
+            await write_message(
+                writer,
+                {
+                    "event": "log",
+                    "logger": __name__,
+                    "levelno": logging.WARNING,
+                    "message": "Waiting for the server's current run to finish",
+                },
+            )
+
+        async with self._run_lock:
+            events: asyncio.Queue[_Event | None] = asyncio.Queue()
+            forwarder = asyncio.create_task(self._forward(events, writer))
+            loop = asyncio.get_running_loop()
+            handler = _ForwardingLogHandler(loop, events)
+
+            with _forwarding_logs(handler):
+                try:
+                    result = await self._run(request)
+                    outcome: _Event = {
+                        "event": "result",
+                        "result": result.model_dump(mode="json"),
+                    }
+                except Exception as e:
+                    # Exception.__str__ drops CLIError's command prefix; the
+                    # client adds its own
+                    outcome = {"event": "error", "message": Exception.__str__(e)}
+
+            # Queue behind log events the handler has scheduled but not yet
+            # delivered, so the outcome is always the last event sent
+            loop.call_soon(events.put_nowait, outcome)
+            loop.call_soon(events.put_nowait, None)
+            await forwarder
+
+    def _store_mismatch(self, request: RunRequest) -> str | None:
+        """Explain why the server's store is not the one the client configured.
+
+        Only variable names are reported: values may hold credentials.
+
+        Returns:
+            An error message, or None if the store variables match.
+
+        """
+        client = _store_environment(request.environment)
+        server = self._store_environment
+        differing = sorted(
+            name
+            for name in client.keys() | server.keys()
+            if client.get(name) != server.get(name)
+        )
+        if not differing:
+            return None
+        return (
+            f"The client's store settings ({', '.join(differing)}) differ from "
+            "the server's, which writes to the artifact store it was started "
+            "with. Restart 'wct serve' with the client's WAIVERN_STORE_* "
+            "settings, or run without --server"
+        )
+
+    async def _run(self, request: RunRequest) -> ExecutionResult:
+        """Plan, execute and export one run with the warm registry.
+
+        Relative paths and ``${VAR}`` references in the runbook resolve
+        against the client's working directory and environment.
+        """
+        logger.info("Running %s in %s", request.runbook_path, request.cwd)
+        with _client_environment(request):
+            plan, result = await plan_and_execute(
+                self._registry,
+                request.runbook_path,
+                resume_run_id=request.resume_run_id,
+                rerun_stale=request.rerun_stale,
+            )
+            store = self._registry.container.get_service(ArtifactStore)
+            await export_results(
+                result, plan, request.output_path, store, request.exporter_override
+            )
+        self._runs_served += 1
+        return result
+
+    @staticmethod
+    async def _forward(
+        events: asyncio.Queue[_Event | None], writer: asyncio.StreamWriter
+    ) -> None:
+        """Write queued events to the client until the end-of-run marker.
+
+        A client that disconnects does not stop the run: its state is
+        persisted as usual and it can be inspected or resumed later.
+        """
+        connected = True
+        while (event := await events.get()) is not None:
+            if not connected:
+                continue
+            try:
+                await write_message(writer, event)
+            except OSError:
+                connected = False
+                logger.warning("Client disconnected; the run continues")
+
+
+def serve_command(
+    socket_path: Path | None,
+    log_level: str = "INFO",
+    *,
+    metrics_port: int | None = None,
+) -> None:
+    """CLI command implementation for running the wct daemon.
+
+    Args:
+        socket_path: Unix socket to listen on (defaults to ``WCT_SERVER_SOCKET``,
+            then ``.waivern/wct.sock``).
+        log_level: Logging level.
+        metrics_port: Serve Prometheus metrics on this port; runs then also
+            save their metrics.
+
+    """
+    setup_logging(level=log_level)
+
+    with cli_error_handler("serve", "Server failed"):
+        # Runs execute in their client's working directory
+        path = resolve_socket_path(socket_path).absolute()
+        server = RunServer(setup_infrastructure(metrics=metrics_port is not None))
+        server.warm_up()
+        try:
+            asyncio.run(server.serve(path, metrics_port=metrics_port))
+        except KeyboardInterrupt:
+            console.print("[dim]Server stopped.[/dim]")
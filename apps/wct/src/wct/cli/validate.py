@@ -6,12 +6,11 @@ import logging
 from pathlib import Path
 
 from rich.console import Console
-from waivern_core.services import ComponentRegistry
 from waivern_orchestration import Planner, RunbookSchemaGenerator
 
 from wct.cli.errors import cli_error_handler
 from wct.cli.formatting import OutputFormatter
-from wct.cli.infrastructure import build_service_container
+from wct.cli.infrastructure import build_component_registry, build_service_container
 from wct.logging import setup_logging
 
 logger = logging.getLogger(__name__)
@@ -30,7 +29,7 @@ def validate_runbook_command(runbook_path: Path, log_level: str = "INFO") -> Non
 
     with cli_error_handler("validate-runbook", "Runbook validation failed"):
         container = build_service_container()
-        registry = ComponentRegistry(container)
+        registry = build_component_registry(container)
 
         plan = Planner(registry).plan(runbook_path)
         OutputFormatter().format_plan_validation(plan)
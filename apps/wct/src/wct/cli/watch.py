@@ -0,0 +1,192 @@
+"""Change detection for ``wct run --watch``.
+
+Watch mode keeps the registry and execution plan resident and, when a file
+read by a file-backed connector changes, re-executes only the affected
+artifacts: the source artifacts reading that file and everything downstream
+of them. Every other artifact is reused from the same run in the store.
+
+Changes are detected by polling file modification times and sizes, which
+needs no platform-specific notification API. Hidden directories (``.git``,
+``.waivern``, virtual environments) are not watched.
+"""
+
+from __future__ import annotations
+
+import asyncio
+import glob
+import logging
+import os
+from collections.abc import Iterable, Mapping
+from fnmatch import fnmatchcase
+from pathlib import Path
+
+from waivern_orchestration import ExecutionPlan
+
+logger = logging.getLogger(__name__)
+
+WATCHED_PATH_PROPERTIES: Mapping[str, tuple[str, ...]] = {
+    "filesystem": ("path",),
+    "sqlite": ("database_path",),
+}
+"""Connector type -> properties naming the local files or directories it reads."""
+
+DEFAULT_POLL_INTERVAL = 0.25
+"""Seconds between polls; a change is acted on once it has been stable for one poll."""
+
+type FileSnapshot = dict[Path, tuple[int, int]]
+"""File path -> (modification time in nanoseconds, size in bytes)."""
+
+
+def watched_sources(plan: ExecutionPlan) -> dict[str, tuple[Path, ...]]:
+    """Map every source artifact that reads local files to the paths it reads.
+
+    Args:
+        plan: The execution plan.
+
+    Returns:
+        Artifact ID -> absolute paths (files or directories).
+
+    """
+    sources: dict[str, tuple[Path, ...]] = {}
+    for artifact_id, definition in plan.runbook.artifacts.items():
+        if definition.source is None:
+            continue
+        properties = definition.source.properties
+        paths = tuple(
+            Path(str(properties[name])).resolve()
+            for name in WATCHED_PATH_PROPERTIES.get(definition.source.type, ())
+            if properties.get(name)
+        )
+        if paths:
+            sources[artifact_id] = paths
+    return sources
+
+
+def affected_artifacts(
+    plan: ExecutionPlan,
+    sources: Mapping[str, tuple[Path, ...]],
+    changed: Iterable[Path],
+) -> set[str]:
+    """Find the artifacts to re-execute after ``changed`` files were modified.
+
+    Args:
+        plan: The execution plan.
+        sources: Watched paths by source artifact (see ``watched_sources``).
+        changed: Absolute paths of created, modified or deleted files.
+
+    Returns:
+        The source artifacts reading any changed file plus all their
+        downstream artifacts.
+
+    """
+    changed_files = list(changed)
+    stale = {
+        artifact_id
+        for artifact_id, roots in sources.items()
+        if any(path.is_relative_to(root) for path in changed_files for root in roots)
+    }
+    return stale | plan.dag.get_downstream(stale)
+
+
+def take_snapshot(roots: Iterable[Path]) -> FileSnapshot:
+    """Record the modification time and size of every file under ``roots``."""
+    snapshot: FileSnapshot = {}
+    for root in roots:
+        if not root.is_dir():
+            _record(snapshot, root)
+            continue
+        for dirpath, dirnames, filenames in os.walk(root):
+            dirnames[:] = [name for name in dirnames if not name.startswith(".")]
+            for filename in filenames:
+                _record(snapshot, Path(dirpath, filename))
+    return snapshot
+
+
+def _record(snapshot: FileSnapshot, path: Path) -> None:
+    try:
+        stat = path.stat()
+    except OSError:
+        return  # Missing or deleted between listing and stat
+    snapshot[path] = (stat.st_mtime_ns, stat.st_size)
+
+
+def changed_paths(before: FileSnapshot, after: FileSnapshot) -> set[Path]:
+    """Return the files created, modified or deleted between two snapshots."""
+    return {
+        path
+        for path in before.keys() | after.keys()
+        if before.get(path) != after.get(path)
+    }
+
+
+class FileWatcher:
+    """Polls the files under a set of roots for changes."""
+
+    def __init__(
+        self,
+        *,
+        poll_interval: float = DEFAULT_POLL_INTERVAL,
+        ignored: Iterable[Path] = (),
+    ) -> None:
+        """Initialise the watcher.
+
+        Args:
+            poll_interval: Seconds between polls.
+            ignored: Files whose changes are never reported, such as the
+                files the watched run itself writes. The temporary siblings
+                they are written through (``<name>.<pid>.<uuid>.partial``)
+                are ignored as well.
+
+        """
+        self._poll_interval = poll_interval
+        self._ignored = frozenset(ignored)
+        self._ignored_temporaries = frozenset(
+            (path.parent, f"{glob.escape(path.name)}.*.partial")
+            for path in self._ignored
+        )
+        self._roots: tuple[Path, ...] = ()
+        self._snapshot: FileSnapshot = {}
+
+    async def watch(self, roots: Iterable[Path]) -> None:
+        """Replace the watched roots and take a new baseline snapshot."""
+        self._roots = tuple(dict.fromkeys(roots))
+        self._snapshot = await self._take_snapshot()
+        logger.debug(
+            "Watching %d files under %d paths", len(self._snapshot), len(self._roots)
+        )
+
+    async def wait_for_changes(self) -> set[Path]:
+        """Wait until files change, then until they stop changing.
+
+        Editors often save in several writes, so changes are collected until
+        one poll passes without further change.
+
+        Returns:
+            Paths of the files created, modified or deleted since the last
+            baseline, which becomes the new baseline.
+
+        """
+        changed: set[Path] = set()
+        while True:
+            await asyncio.sleep(self._poll_interval)
+            current = await self._take_snapshot()
+            new_changes = changed_paths(self._snapshot, current)
+            self._snapshot = current
+            if new_changes:
+                changed |= new_changes
+            elif changed:
+                return changed
+
+    async def _take_snapshot(self) -> FileSnapshot:
+        snapshot = await asyncio.to_thread(take_snapshot, self._roots)
+        return {
+            path: state
+            for path, state in snapshot.items()
+            if not self._is_ignored(path)
+        }
+
+    def _is_ignored(self, path: Path) -> bool:
+        return path in self._ignored or any(
+            path.parent == parent and fnmatchcase(path.name, pattern)
+            for parent, pattern in self._ignored_temporaries
+        )
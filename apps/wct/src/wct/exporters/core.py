@@ -1,11 +1,19 @@
 """Core export functionality shared by all exporters."""
 
-from typing import Any, Literal
+import json
+from collections.abc import AsyncIterator
+from typing import Any, Literal, TextIO
 
 from pydantic import BaseModel, Field
-from waivern_artifact_store import ArtifactStore
+from waivern_artifact_store import ArtifactStore, artifact_items_field
+from waivern_core.schemas import SchemaRegistry
 from waivern_orchestration import ExecutionPlan, ExecutionResult
 
+_INDENT = "  "
+
+# Same encoder settings as json.dump(..., indent=2, default=str)
+_ENCODER = json.JSONEncoder(indent=len(_INDENT), default=str)
+
 
 class SchemaInfo(BaseModel):
     """Schema information for output entries."""
@@ -119,7 +127,7 @@ async def _build_error_entries(
 
     Args:
         result: Execution result with artifact outcomes.
-        store: Artifact store to load failed artifact messages.
+        store: Artifact store to load failed artifact metadata.
 
     Returns:
         List of ErrorEntry for failed artifacts.
@@ -127,11 +135,11 @@ async def _build_error_entries(
     """
     entries: list[ErrorEntry] = []
     for art_id in result.failed:
-        message = await store.get_artifact(result.run_id, art_id)
+        metadata = await store.get_artifact_metadata(result.run_id, art_id)
         entries.append(
             ErrorEntry(
                 artifact_id=art_id,
-                error=message.execution_error or "Unknown error",
+                error=metadata.execution_error or "Unknown error",
             )
         )
     return entries
@@ -175,21 +183,39 @@ def _calculate_summary(result: ExecutionResult) -> SummaryInfo:
     )
 
 
-async def _build_output_entries(
-    result: ExecutionResult, plan: ExecutionPlan, store: ArtifactStore
-) -> list[OutputEntry]:
-    """Build output entries for artifacts marked output:true.
+async def _iter_output_entries(
+    result: ExecutionResult,
+    plan: ExecutionPlan,
+    store: ArtifactStore,
+    *,
+    without_items: bool = False,
+) -> AsyncIterator[tuple[OutputEntry, str | None]]:
+    """Yield output entries for artifacts marked output:true.
+
+    Artifacts are loaded from the store one at a time, so a consumer that
+    writes each entry out before requesting the next holds at most one
+    artifact's content in memory. With ``without_items``, the item list is
+    left empty for the consumer to read through ``iter_artifact_items``;
+    boundary validation needs the whole content, so it loads items anyway.
+
+    Exports leave the run, so under the ``boundary`` validation policy each
+    output is validated against its schema before it is included.
 
     Args:
         result: Execution result with artifact outcomes.
         plan: Execution plan with runbook and schemas.
         store: Artifact store to load artifact messages.
+        without_items: Leave item lists empty where possible.
 
-    Returns:
-        List of OutputEntry for artifacts marked for output.
+    Yields:
+        OutputEntry for each artifact marked for output, with the name of
+        its content field left empty for streaming (None if it is complete).
+
+    Raises:
+        MessageValidationError: If an output fails boundary validation.
 
     """
-    outputs: list[OutputEntry] = []
+    validate_outputs = SchemaRegistry.get_validation_policy() == "boundary"
 
     for art_id in result.completed:
         # Only include artifacts marked output:true
@@ -198,7 +224,14 @@ async def _build_output_entries(
             continue
 
         # Load artifact message from store
-        message = await store.get_artifact(result.run_id, art_id)
+        items_field: str | None = None
+        if without_items and not validate_outputs:
+            message = await store.get_artifact_without_items(result.run_id, art_id)
+            items_field = artifact_items_field(message.content)
+        else:
+            message = await store.get_artifact(result.run_id, art_id)
+        if validate_outputs and message.content:
+            message.validate(boundary=True)
 
         # Get schema info from plan
         _, output_schema = plan.artifact_schemas.get(art_id, (None, None))
@@ -209,19 +242,36 @@ async def _build_output_entries(
         )
 
         # Build output entry with artifact metadata
-        outputs.append(
-            OutputEntry(
-                artifact_id=art_id,
-                duration_seconds=message.execution_duration or 0.0,
-                name=artifact_def.name,
-                description=artifact_def.description,
-                contact=artifact_def.contact,
-                schema=schema_info,
-                content=message.content if message.content else None,
-            )
+        entry = OutputEntry(
+            artifact_id=art_id,
+            duration_seconds=message.execution_duration or 0.0,
+            name=artifact_def.name,
+            description=artifact_def.description,
+            contact=artifact_def.contact,
+            schema=schema_info,
+            content=message.content if message.content else None,
         )
+        yield entry, items_field
+
+
+async def _build_output_entries(
+    result: ExecutionResult, plan: ExecutionPlan, store: ArtifactStore
+) -> list[OutputEntry]:
+    """Build output entries for artifacts marked output:true.
+
+    Args:
+        result: Execution result with artifact outcomes.
+        plan: Execution plan with runbook and schemas.
+        store: Artifact store to load artifact messages.
 
-    return outputs
+    Returns:
+        List of OutputEntry for artifacts marked for output.
+
+    Raises:
+        MessageValidationError: If an output fails boundary validation.
+
+    """
+    return [entry async for entry, _ in _iter_output_entries(result, plan, store)]
 
 
 async def build_core_export(
@@ -237,6 +287,56 @@ async def build_core_export(
     Returns:
         Validated CoreExport model with standard structure.
 
+    """
+    export = await _build_core_export_header(result, plan, store)
+    export.outputs = await _build_output_entries(result, plan, store)
+    return export
+
+
+async def write_core_export(
+    result: ExecutionResult,
+    plan: ExecutionPlan,
+    store: ArtifactStore,
+    stream: TextIO,
+) -> None:
+    """Write the core export document to a text stream incrementally.
+
+    Produces the same JSON text as ``json.dump(export.model_dump(), indent=2)``
+    on the result of ``build_core_export``, but output entries are loaded,
+    serialised and released one at a time, and their item lists are read
+    through ``iter_artifact_items``. Peak memory is bounded by the largest
+    artifact header plus one stored chunk of items rather than the whole
+    export.
+
+    Args:
+        result: Execution result with artifact outcomes.
+        plan: Execution plan with runbook metadata.
+        store: Artifact store to load artifact messages.
+        stream: Text stream the JSON document is written to.
+
+    Raises:
+        MessageValidationError: If an output fails boundary validation.
+
+    """
+    header = (await _build_core_export_header(result, plan, store)).model_dump()
+
+    stream.write("{")
+    for index, (key, value) in enumerate(header.items()):
+        stream.write(f"{',' if index else ''}\n{_INDENT}{json.dumps(key)}: ")
+        if key == "outputs":
+            await _write_output_entries(result, plan, store, stream)
+        else:
+            _write_indented(value, stream, level=1)
+    stream.write("\n}")
+
+
+async def _build_core_export_header(
+    result: ExecutionResult, plan: ExecutionPlan, store: ArtifactStore
+) -> CoreExport:
+    """Build the core export without output entries.
+
+    Everything except ``outputs`` is small (run metadata, summary, IDs and
+    error messages), so it is built up front by both export paths.
     """
     return CoreExport(
         format_version="2.0.0",
@@ -255,5 +355,84 @@ async def build_core_export(
         errors=await _build_error_entries(result, store),
         skipped=_build_skipped_list(result),
         pending=list(result.pending),
-        outputs=await _build_output_entries(result, plan, store),
     )
+
+
+async def _write_output_entries(
+    result: ExecutionResult,
+    plan: ExecutionPlan,
+    store: ArtifactStore,
+    stream: TextIO,
+) -> None:
+    """Write the ``outputs`` array, one artifact at a time."""
+    count = 0
+    async for entry, items_field in _iter_output_entries(
+        result, plan, store, without_items=True
+    ):
+        # Content is written as-is rather than copied by model_dump()
+        entry_dict = entry.model_dump(exclude={"content"})
+        entry_dict["content"] = entry.content
+        stream.write(f"{',' if count else '['}\n{_INDENT * 2}")
+        if items_field is None:
+            _write_indented(entry_dict, stream, level=2)
+        else:
+            await _write_streamed_entry(
+                entry_dict,
+                store.iter_artifact_items(result.run_id, entry.artifact_id),
+                items_field,
+                stream,
+            )
+        count += 1
+    stream.write(f"\n{_INDENT}]" if count else "[]")
+
+
+async def _write_streamed_entry(
+    entry_dict: dict[str, Any],
+    items: AsyncIterator[Any],
+    items_field: str,
+    stream: TextIO,
+) -> None:
+    """Write an output entry, reading ``content[items_field]`` from ``items``.
+
+    Lays the entry out exactly as ``_write_indented`` would with the items in
+    place: the entry sits two indents deep and its content three.
+    """
+    stream.write("{")
+    for index, (key, value) in enumerate(entry_dict.items()):
+        stream.write(f"{',' if index else ''}\n{_INDENT * 3}{json.dumps(key)}: ")
+        if key != "content":
+            _write_indented(value, stream, level=3)
+            continue
+        stream.write("{")
+        for field_index, (field, field_value) in enumerate(value.items()):
+            separator = "," if field_index else ""
+            stream.write(f"{separator}\n{_INDENT * 4}{json.dumps(field)}: ")
+            if field == items_field:
+                await _write_streamed_items(items, stream, level=4)
+            else:
+                _write_indented(field_value, stream, level=4)
+        stream.write(f"\n{_INDENT * 3}}}")
+    stream.write(f"\n{_INDENT * 2}}}")
+
+
+async def _write_streamed_items(
+    items: AsyncIterator[Any], stream: TextIO, *, level: int
+) -> None:
+    """Write a JSON array nested ``level`` indents deep, item by item."""
+    count = 0
+    async for item in items:
+        stream.write(f"{',' if count else '['}\n{_INDENT * (level + 1)}")
+        _write_indented(item, stream, level=level + 1)
+        count += 1
+    stream.write(f"\n{_INDENT * level}]" if count else "[]")
+
+
+def _write_indented(value: object, stream: TextIO, *, level: int) -> None:
+    """Write a JSON value nested ``level`` indents deep, chunk by chunk.
+
+    Newlines inside JSON strings are always escaped, so every newline in the
+    encoder output is structural and can be re-indented safely.
+    """
+    prefix = "\n" + _INDENT * level
+    for chunk in _ENCODER.iterencode(value):
+        stream.write(chunk.replace("\n", prefix))
@@ -1,11 +1,11 @@
 """JSON exporter for generic compliance analysis results."""
 
-from typing import Any
+from typing import Any, TextIO
 
 from waivern_artifact_store import ArtifactStore
 from waivern_orchestration import ExecutionPlan, ExecutionResult
 
-from wct.exporters.core import build_core_export
+from wct.exporters.core import build_core_export, write_core_export
 
 
 class JsonExporter:
@@ -64,3 +64,24 @@ class JsonExporter:
         """
         core_export = await build_core_export(result, plan, store)
         return core_export.model_dump()
+
+    async def export_to(
+        self,
+        result: ExecutionResult,
+        plan: ExecutionPlan,
+        store: ArtifactStore,
+        stream: TextIO,
+    ) -> None:
+        """Write execution results to a text stream as JSON.
+
+        Output artifacts are loaded and written one at a time, so peak memory
+        is bounded by the largest single artifact.
+
+        Args:
+            result: Execution results with artifact data
+            plan: Execution plan with runbook metadata
+            store: Artifact store to load artifact messages
+            stream: Text stream to write the JSON document to
+
+        """
+        await write_core_export(result, plan, store, stream)
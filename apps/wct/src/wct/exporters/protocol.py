@@ -1,7 +1,7 @@
 """Protocol for compliance exporters."""
 
 from collections.abc import Coroutine
-from typing import Any, Protocol, runtime_checkable
+from typing import Any, Protocol, TextIO, runtime_checkable
 
 from waivern_artifact_store import ArtifactStore
 from waivern_orchestration import ExecutionPlan, ExecutionResult
@@ -72,3 +72,37 @@ class Exporter(Protocol):
 
         """
         ...
+
+
+@runtime_checkable
+class StreamingExporter(Exporter, Protocol):
+    """Exporter that can write its export document incrementally.
+
+    ``export()`` returns the whole document as one dictionary. Streaming
+    exporters additionally write it straight to a text stream, loading one
+    artifact at a time, so large runs are exported without holding every
+    output in memory.
+    """
+
+    def export_to(
+        self,
+        result: ExecutionResult,
+        plan: ExecutionPlan,
+        store: ArtifactStore,
+        stream: TextIO,
+    ) -> Coroutine[Any, Any, None]:
+        """Write execution results to a text stream as JSON.
+
+        The written document must equal ``json.dumps(export(...), indent=2)``.
+
+        Args:
+            result: Execution results (summary with artifact IDs)
+            plan: Execution plan with runbook metadata
+            store: Artifact store to load artifact data from
+            stream: Text stream to write the JSON document to
+
+        Returns:
+            Coroutine completing once the document is written
+
+        """
+        ...
@@ -0,0 +1,92 @@
+"""CLI tests for 'wct gc' command.
+
+Tests the command's wiring and output. Retention rules are tested in
+waivern-orchestration's test_retention.py.
+"""
+
+from __future__ import annotations
+
+import asyncio
+from datetime import UTC, datetime, timedelta
+from unittest.mock import Mock
+
+import pytest
+import typer
+from waivern_artifact_store.in_memory import AsyncInMemoryStore
+from waivern_orchestration.run_metadata import RunMetadata
+
+# =============================================================================
+# Helpers
+# =============================================================================
+
+
+def _save_runs(store: AsyncInMemoryStore, count: int) -> None:
+    """Save completed runs 'run-0' (newest) to 'run-{count-1}' (oldest)."""
+    now = datetime.now(UTC)
+    for index in range(count):
+        metadata = RunMetadata(
+            run_id=f"run-{index}",
+            runbook_path="analysis.yaml",
+            started_at=now - timedelta(days=index),
+            status="completed",
+        )
+        asyncio.run(metadata.save(store))
+
+
+def _use_store(monkeypatch: pytest.MonkeyPatch, store: AsyncInMemoryStore) -> None:
+    mock_store_factory = Mock()
+    mock_store_factory.return_value.create.return_value = store
+    monkeypatch.setattr("wct.cli.gc.ArtifactStoreFactory", mock_store_factory)
+    monkeypatch.setattr("wct.cli.gc.setup_logging", lambda **kwargs: None)
+
+
+# =============================================================================
+# Tests
+# =============================================================================
+
+
+class TestGcRunsCommand:
+    """Tests for gc_runs_command()."""
+
+    def test_deletes_runs_outside_policy(
+        self, capsys: pytest.CaptureFixture[str], monkeypatch: pytest.MonkeyPatch
+    ) -> None:
+        store = AsyncInMemoryStore()
+        _save_runs(store, 3)
+        _use_store(monkeypatch, store)
+
+        from wct.cli import gc_runs_command
+
+        gc_runs_command(keep_last=1, keep_days=None, protect_runbooks=[])
+
+        assert asyncio.run(store.list_runs()) == ["run-0"]
+        assert "Deleted 2 run(s)" in capsys.readouterr().out
+
+    def test_dry_run_deletes_nothing(
+        self, capsys: pytest.CaptureFixture[str], monkeypatch: pytest.MonkeyPatch
+    ) -> None:
+        store = AsyncInMemoryStore()
+        _save_runs(store, 3)
+        _use_store(monkeypatch, store)
+
+        from wct.cli import gc_runs_command
+
+        gc_runs_command(keep_last=1, keep_days=None, protect_runbooks=[], dry_run=True)
+
+        assert len(asyncio.run(store.list_runs())) == 3
+        assert "2 run(s) to delete" in capsys.readouterr().out
+
+    def test_missing_policy_exits_with_error(
+        self, monkeypatch: pytest.MonkeyPatch
+    ) -> None:
+        store = AsyncInMemoryStore()
+        _save_runs(store, 1)
+        _use_store(monkeypatch, store)
+
+        from wct.cli import gc_runs_command
+
+        with pytest.raises(typer.Exit) as exc_info:
+            gc_runs_command(keep_last=None, keep_days=None, protect_runbooks=[])
+
+        assert exc_info.value.exit_code == 1
+        assert len(asyncio.run(store.list_runs())) == 1
@@ -0,0 +1,86 @@
+"""Tests for metrics of 'wct' runs and the Prometheus endpoint of long-running modes."""
+
+from __future__ import annotations
+
+import asyncio
+
+import pytest
+from waivern_core.metrics import MetricsRegistry
+
+from wct.cli.errors import CLIError
+from wct.cli.infrastructure import build_service_container, resolve_metrics
+from wct.cli.metrics_server import CONTENT_TYPE, serving_metrics
+
+# =============================================================================
+# Helpers
+# =============================================================================
+
+
+async def _get(port: int, path: str) -> tuple[str, dict[str, str], str]:
+    """Send one HTTP GET and return (status line, headers, body)."""
+    reader, writer = await asyncio.open_connection("127.0.0.1", port)
+    writer.write(f"GET {path} HTTP/1.1\r\nHost: localhost\r\n\r\n".encode())
+    await writer.drain()
+    response = (await reader.read()).decode()
+    writer.close()
+
+    head, _, body = response.partition("\r\n\r\n")
+    status, *header_lines = head.split("\r\n")
+    headers = dict(line.split(": ", 1) for line in header_lines)
+    return status, headers, body
+
+
+# =============================================================================
+# Endpoint
+# =============================================================================
+
+
+class TestMetricsEndpoint:
+    """Tests for serving a metrics registry over HTTP."""
+
+    async def test_metrics_path_returns_prometheus_text(self) -> None:
+        registry = MetricsRegistry()
+        registry.counter("waivern_artifacts_total", "Artifacts.").inc(state="completed")
+
+        async with serving_metrics(registry, 0) as port:
+            assert port is not None
+            status, headers, body = await _get(port, "/metrics")
+
+        assert status == "HTTP/1.0 200 OK"
+        assert headers["Content-Type"] == CONTENT_TYPE
+        assert 'waivern_artifacts_total{state="completed"} 1' in body
+
+    async def test_other_paths_are_not_found(self) -> None:
+        async with serving_metrics(MetricsRegistry(), 0) as port:
+            assert port is not None
+            status, _, _ = await _get(port, "/")
+
+        assert status == "HTTP/1.0 404 Not Found"
+
+    async def test_no_port_serves_nothing(self) -> None:
+        async with serving_metrics(MetricsRegistry(), None) as port:
+            assert port is None
+
+    async def test_port_in_use_is_a_cli_error(self) -> None:
+        async with serving_metrics(MetricsRegistry(), 0) as port:
+            assert port is not None
+            with pytest.raises(CLIError, match="Cannot serve metrics"):
+                async with serving_metrics(MetricsRegistry(), port):
+                    pass
+
+
+# =============================================================================
+# Registration
+# =============================================================================
+
+
+class TestMetricsRegistration:
+    """Tests for registering the metrics registry only when metrics are wanted."""
+
+    def test_no_registry_by_default(self) -> None:
+        assert resolve_metrics(build_service_container()) is None
+
+    def test_registry_is_registered_on_request(self) -> None:
+        container = build_service_container(metrics=True)
+
+        assert isinstance(resolve_metrics(container), MetricsRegistry)
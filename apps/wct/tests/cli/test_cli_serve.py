@@ -0,0 +1,270 @@
+"""CLI tests for the 'wct serve' daemon and the 'wct run --server' client.
+
+Tests the socket protocol end to end with the run pipeline stubbed out.
+Planning and execution are tested in waivern-orchestration.
+"""
+
+from __future__ import annotations
+
+import asyncio
+import logging
+import os
+import shutil
+import stat
+import tempfile
+from collections.abc import AsyncIterator, Iterator
+from pathlib import Path
+from typing import Any
+from unittest.mock import AsyncMock, Mock
+
+import pytest
+from waivern_orchestration import ExecutionResult
+
+from wct.cli.daemon import RunRequest, ping, submit_run
+from wct.cli.errors import CLIError
+from wct.cli.serve import RunServer
+
+# =============================================================================
+# Helpers
+# =============================================================================
+
+
+def _result() -> ExecutionResult:
+    return ExecutionResult(
+        run_id="run-123",
+        start_timestamp="2025-06-15T10:00:00+00:00",
+        completed={"findings"},
+        total_duration_seconds=1.5,
+    )
+
+
+def _request() -> RunRequest:
+    return RunRequest(
+        runbook_path=Path("/work/analysis.yaml"),
+        output_path=Path("/work/outputs/results.json"),
+    )
+
+
+@pytest.fixture
+def socket_path() -> Iterator[Path]:
+    """Short socket path (Unix socket paths are limited to ~100 bytes)."""
+    directory = Path(tempfile.mkdtemp(prefix="wct"))
+    yield directory / "wct.sock"
+    shutil.rmtree(directory, ignore_errors=True)
+
+
+@pytest.fixture
+def pipeline(monkeypatch: pytest.MonkeyPatch) -> Mock:
+    """Stub the run pipeline the server calls."""
+    stub = Mock()
+    stub.plan_and_execute = AsyncMock(return_value=(Mock(), _result()))
+    stub.export_results = AsyncMock()
+    monkeypatch.setattr("wct.cli.serve.plan_and_execute", stub.plan_and_execute)
+    monkeypatch.setattr("wct.cli.serve.export_results", stub.export_results)
+    return stub
+
+
+@pytest.fixture
+async def server(socket_path: Path) -> AsyncIterator[RunServer]:
+    """Run a server on ``socket_path`` for the duration of the test."""
+    run_server = RunServer(Mock())
+    task = asyncio.create_task(run_server.serve(socket_path))
+    while not socket_path.exists():
+        await asyncio.sleep(0.01)
+    yield run_server
+    task.cancel()
+    with pytest.raises(asyncio.CancelledError):
+        await task
+
+
+# =============================================================================
+# Tests
+# =============================================================================
+
+
+class TestRunRequest:
+    """Tests for the run request protocol message."""
+
+    def test_round_trips_through_message(self) -> None:
+        request = RunRequest(
+            runbook_path=Path("/work/analysis.yaml"),
+            output_path=Path("/work/out.json"),
+            exporter_override="gdpr",
+            resume_run_id="run-1",
+            rerun_stale=True,
+            cwd=Path("/work"),
+            environment={"DB_PASSWORD": "secret"},
+        )
+
+        assert RunRequest.from_message(request.to_message()) == request
+
+    def test_defaults_to_current_directory_and_environment(self) -> None:
+        request = _request()
+
+        assert request.cwd == Path.cwd()
+        assert request.environment == os.environ
+
+    def test_missing_paths_rejected(self) -> None:
+        with pytest.raises(ValueError, match="runbook"):
+            RunRequest.from_message({"type": "run", "output": "/out.json"})
+
+    def test_missing_working_directory_rejected(self) -> None:
+        message = _request().to_message()
+        del message["cwd"]
+
+        with pytest.raises(ValueError, match="cwd"):
+            RunRequest.from_message(message)
+
+
+class TestRunServer:
+    """Tests for submitting runs to a running server."""
+
+    async def test_submitted_run_returns_result(
+        self, server: RunServer, socket_path: Path, pipeline: Mock
+    ) -> None:
+        result = await submit_run(socket_path, _request())
+
+        assert result == _result()
+        pipeline.export_results.assert_awaited_once()
+        assert pipeline.plan_and_execute.await_args.args[1] == Path(
+            "/work/analysis.yaml"
+        )
+
+    async def test_run_logs_are_relayed_to_client(
+        self,
+        server: RunServer,
+        socket_path: Path,
+        pipeline: Mock,
+        caplog: pytest.LogCaptureFixture,
+    ) -> None:
+        async def plan_and_execute(*args: Any, **kwargs: Any) -> tuple[Mock, Any]:
+            logging.getLogger("waivern_orchestration.executor").warning("artifact slow")
+            return Mock(), _result()
+
+        pipeline.plan_and_execute.side_effect = plan_and_execute
+
+        with caplog.at_level(logging.WARNING):
+            await submit_run(socket_path, _request())
+
+        relayed = [r for r in caplog.records if r.getMessage() == "artifact slow"]
+        # Once as emitted by the server, once as relayed by the client
+        assert len(relayed) == 2
+
+    async def test_failed_run_raises_cli_error(
+        self, server: RunServer, socket_path: Path, pipeline: Mock
+    ) -> None:
+        pipeline.plan_and_execute.side_effect = CLIError(
+            "Failed to plan runbook execution: bad", command="run"
+        )
+
+        with pytest.raises(CLIError, match="Failed to plan") as exc_info:
+            await submit_run(socket_path, _request())
+
+        # The server's command prefix is not repeated
+        assert str(exc_info.value).count("CLI command") == 1
+
+    async def test_run_uses_client_directory_and_environment(
+        self,
+        server: RunServer,
+        socket_path: Path,
+        pipeline: Mock,
+        tmp_path: Path,
+        monkeypatch: pytest.MonkeyPatch,
+    ) -> None:
+        seen: dict[str, object] = {}
+
+        async def plan_and_execute(*args: Any, **kwargs: Any) -> tuple[Mock, Any]:
+            seen["cwd"] = Path.cwd()
+            seen["var"] = os.environ.get("WCT_TEST_CLIENT_VAR")
+            return Mock(), _result()
+
+        pipeline.plan_and_execute.side_effect = plan_and_execute
+        server_dir = tmp_path / "server"
+        client_dir = tmp_path / "client"
+        server_dir.mkdir()
+        client_dir.mkdir()
+        monkeypatch.chdir(server_dir)
+        request = RunRequest(
+            runbook_path=client_dir / "analysis.yaml",
+            output_path=client_dir / "results.json",
+            cwd=client_dir,
+            environment={"WCT_TEST_CLIENT_VAR": "client"},
+        )
+
+        await submit_run(socket_path, request)
+
+        assert seen == {"cwd": client_dir.resolve(), "var": "client"}
+        assert Path.cwd() == server_dir.resolve()
+        assert "WCT_TEST_CLIENT_VAR" not in os.environ
+
+    async def test_missing_client_directory_fails_run(
+        self, server: RunServer, socket_path: Path, pipeline: Mock, tmp_path: Path
+    ) -> None:
+        request = RunRequest(
+            runbook_path=Path("/work/analysis.yaml"),
+            output_path=Path("/work/outputs/results.json"),
+            cwd=tmp_path / "missing",
+        )
+
+        with pytest.raises(CLIError, match="working directory"):
+            await submit_run(socket_path, request)
+
+        pipeline.plan_and_execute.assert_not_awaited()
+
+    async def test_run_with_another_store_configuration_is_rejected(
+        self, server: RunServer, socket_path: Path, pipeline: Mock
+    ) -> None:
+        environment = {
+            name: value
+            for name, value in os.environ.items()
+            if not name.startswith("WAIVERN_STORE_")
+        }
+        environment["WAIVERN_STORE_TYPE"] = "wct-test-store"
+        request = RunRequest(
+            runbook_path=Path("/work/analysis.yaml"),
+            output_path=Path("/work/outputs/results.json"),
+            environment=environment,
+        )
+
+        with pytest.raises(CLIError, match=r"settings \(WAIVERN_STORE_TYPE\)"):
+            await submit_run(socket_path, request)
+
+        pipeline.plan_and_execute.assert_not_awaited()
+
+    async def test_ping_reports_server_presence(
+        self, server: RunServer, socket_path: Path
+    ) -> None:
+        assert await ping(socket_path) is True
+
+    async def test_socket_is_private_to_the_user(self, socket_path: Path) -> None:
+        previous = os.umask(0o022)
+        try:
+            task = asyncio.create_task(RunServer(Mock()).serve(socket_path))
+            while not socket_path.exists():
+                await asyncio.sleep(0.01)
+
+            assert stat.S_IMODE(socket_path.stat().st_mode) & 0o077 == 0
+            assert os.umask(0o022) == 0o022  # Restored once the socket is bound
+
+            task.cancel()
+            with pytest.raises(asyncio.CancelledError):
+                await task
+        finally:
+            os.umask(previous)
+
+    async def test_second_server_on_same_socket_is_refused(
+        self, server: RunServer, socket_path: Path
+    ) -> None:
+        with pytest.raises(CLIError, match="already listening"):
+            await RunServer(Mock()).serve(socket_path)
+
+
+class TestSubmitRun:
+    """Tests for the client without a server."""
+
+    async def test_unreachable_server_raises_cli_error(self, socket_path: Path) -> None:
+        with pytest.raises(CLIError, match="wct serve"):
+            await submit_run(socket_path, _request())
+
+    async def test_ping_without_server_is_false(self, socket_path: Path) -> None:
+        assert await ping(socket_path) is False
@@ -0,0 +1,219 @@
+"""Tests for change detection in 'wct run --watch'.
+
+The incremental re-execution itself uses ExecutionState.invalidate and the
+executor's resume path, which are tested in waivern-orchestration.
+"""
+
+from __future__ import annotations
+
+import asyncio
+from pathlib import Path
+from unittest.mock import AsyncMock, Mock
+
+import pytest
+from waivern_artifact_store.write_buffer import temporary_path
+from waivern_orchestration import (
+    ArtifactDefinition,
+    ExecutionDAG,
+    ProcessConfig,
+    SourceConfig,
+)
+
+from wct.cli import run
+from wct.cli.daemon import RunRequest
+from wct.cli.watch import (
+    FileWatcher,
+    affected_artifacts,
+    changed_paths,
+    take_snapshot,
+    watched_sources,
+)
+
+# =============================================================================
+# Helpers
+# =============================================================================
+
+
+def _plan(tmp_path: Path) -> Mock:
+    """Plan with two watched sources, one database source and a shared sink.
+
+    docs -> docs_findings -> report <- code_findings <- code
+    """
+    artifacts = {
+        "docs": ArtifactDefinition(
+            source=SourceConfig(
+                type="filesystem", properties={"path": str(tmp_path / "docs")}
+            )
+        ),
+        "code": ArtifactDefinition(
+            source=SourceConfig(
+                type="filesystem", properties={"path": str(tmp_path / "src")}
+            )
+        ),
+        "db": ArtifactDefinition(
+            source=SourceConfig(type="mysql", properties={"host": "localhost"})
+        ),
+        "docs_findings": ArtifactDefinition(
+            inputs="docs", process=ProcessConfig(type="analyser")
+        ),
+        "code_findings": ArtifactDefinition(
+            inputs="code", process=ProcessConfig(type="analyser")
+        ),
+        "report": ArtifactDefinition(
+            inputs=["docs_findings", "code_findings"],
+            process=ProcessConfig(type="merger"),
+        ),
+    }
+    plan = Mock()
+    plan.runbook.artifacts = artifacts
+    plan.dag = ExecutionDAG(artifacts)
+    return plan
+
+
+# =============================================================================
+# Invalidation
+# =============================================================================
+
+
+class TestAffectedArtifacts:
+    """Tests for mapping changed files to artifacts to re-execute."""
+
+    def test_only_file_backed_sources_are_watched(self, tmp_path: Path) -> None:
+        sources = watched_sources(_plan(tmp_path))
+
+        assert sources == {
+            "docs": ((tmp_path / "docs").resolve(),),
+            "code": ((tmp_path / "src").resolve(),),
+        }
+
+    def test_changed_file_invalidates_its_source_and_downstream(
+        self, tmp_path: Path
+    ) -> None:
+        plan = _plan(tmp_path)
+
+        affected = affected_artifacts(
+            plan,
+            watched_sources(plan),
+            [(tmp_path / "src" / "app" / "main.py").resolve()],
+        )
+
+        assert affected == {"code", "code_findings", "report"}
+
+    def test_file_outside_watched_paths_invalidates_nothing(
+        self, tmp_path: Path
+    ) -> None:
+        plan = _plan(tmp_path)
+
+        affected = affected_artifacts(
+            plan, watched_sources(plan), [tmp_path / "notes.txt"]
+        )
+
+        assert affected == set()
+
+
+# =============================================================================
+# Change Detection
+# =============================================================================
+
+
+class TestSnapshots:
+    """Tests for detecting file changes between snapshots."""
+
+    def test_created_modified_and_deleted_files_are_changed(
+        self, tmp_path: Path
+    ) -> None:
+        (tmp_path / "kept.txt").write_text("same")
+        (tmp_path / "edited.txt").write_text("before")
+        (tmp_path / "deleted.txt").write_text("gone soon")
+        before = take_snapshot([tmp_path])
+
+        (tmp_path / "edited.txt").write_text("after, and longer")
+        (tmp_path / "deleted.txt").unlink()
+        (tmp_path / "created.txt").write_text("new")
+
+        assert changed_paths(before, take_snapshot([tmp_path])) == {
+            tmp_path / "edited.txt",
+            tmp_path / "deleted.txt",
+            tmp_path / "created.txt",
+        }
+
+    def test_hidden_directories_are_not_watched(self, tmp_path: Path) -> None:
+        (tmp_path / ".waivern").mkdir()
+        (tmp_path / ".waivern" / "state.json").write_text("{}")
+        (tmp_path / "visible.txt").write_text("x")
+
+        assert set(take_snapshot([tmp_path])) == {tmp_path / "visible.txt"}
+
+
+class TestFileWatcher:
+    """Tests for waiting on file changes."""
+
+    async def test_changes_in_quick_succession_are_reported_together(
+        self, tmp_path: Path
+    ) -> None:
+        watcher = FileWatcher(poll_interval=0.05)
+        await watcher.watch([tmp_path])
+
+        waiting = asyncio.create_task(watcher.wait_for_changes())
+        (tmp_path / "a.txt").write_text("a")
+        await asyncio.sleep(0.02)
+        (tmp_path / "b.txt").write_text("b")
+
+        changed = await asyncio.wait_for(waiting, timeout=2)
+
+        assert changed == {tmp_path / "a.txt", tmp_path / "b.txt"}
+
+    async def test_ignored_files_are_not_reported(self, tmp_path: Path) -> None:
+        output = tmp_path / "results.json"
+        watcher = FileWatcher(poll_interval=0.01, ignored=[output])
+        await watcher.watch([tmp_path])
+
+        output.write_text("{}")
+        temporary_path(output).write_text("{")
+        (tmp_path / "input.txt").write_text("x")
+
+        changed = await asyncio.wait_for(watcher.wait_for_changes(), timeout=2)
+
+        assert changed == {tmp_path / "input.txt"}
+
+
+class TestWatchLoop:
+    """Tests for the 'wct run --watch' loop."""
+
+    async def test_source_edits_during_the_first_run_are_rerun(
+        self, tmp_path: Path, monkeypatch: pytest.MonkeyPatch
+    ) -> None:
+        (tmp_path / "docs").mkdir()
+        (tmp_path / "src").mkdir()
+        runbook = tmp_path / "runbook.yaml"
+        runbook.write_text("name: test")
+        plan = _plan(tmp_path)
+
+        async def execute_plan(*_args: object, **_kwargs: object) -> Mock:
+            # The user edits a source while the first run is still going
+            (tmp_path / "docs" / "policy.md").write_text("edited")
+            return Mock(run_id="run-1")
+
+        rerun = asyncio.Event()
+
+        async def rerun_affected(
+            *_args: object, affected: set[str], **_kwargs: object
+        ) -> Mock:
+            assert affected == {"docs", "docs_findings", "report"}
+            rerun.set()
+            return Mock(run_id="run-1")
+
+        monkeypatch.setattr(run, "load_or_plan", AsyncMock(return_value=plan))
+        monkeypatch.setattr(run, "execute_plan", execute_plan)
+        monkeypatch.setattr(run, "_rerun_affected", rerun_affected)
+        monkeypatch.setattr(run, "_show_and_export", AsyncMock())
+        registry = Mock()
+        request = RunRequest(runbook_path=runbook, output_path=tmp_path / "out.json")
+
+        watching = asyncio.create_task(
+            run._watch(Mock(), request, registry, verbose=False)
+        )
+        try:
+            await asyncio.wait_for(rerun.wait(), timeout=5)
+        finally:
+            watching.cancel()
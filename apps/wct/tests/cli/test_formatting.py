@@ -8,6 +8,7 @@ from unittest.mock import AsyncMock, Mock
 
 import pytest
 from rich.console import Console
+from waivern_artifact_store import ArtifactMetadata
 from waivern_core import Message, Schema
 from waivern_core.message import ExecutionContext, MessageExtensions
 from waivern_orchestration import ExecutionPlan, ExecutionResult
@@ -53,6 +54,9 @@ def _make_store(messages: dict[str, Message] | None = None) -> AsyncMock:
     store = AsyncMock()
     msgs = messages or {}
     store.get_artifact = AsyncMock(side_effect=lambda _run_id, aid: msgs[aid])
+    store.get_artifact_metadata = AsyncMock(
+        side_effect=lambda _run_id, aid: ArtifactMetadata.from_message(msgs[aid])
+    )
     return store
 
 
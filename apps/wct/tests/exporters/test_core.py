@@ -1,7 +1,10 @@
 """Tests for core export functionality."""
 
+from pathlib import Path
 from unittest.mock import Mock
 
+from waivern_artifact_store import ArtifactStore
+from waivern_artifact_store.filesystem import LocalFilesystemStore
 from waivern_artifact_store.in_memory import AsyncInMemoryStore
 from waivern_core import Schema
 from waivern_orchestration import ExecutionPlan, ExecutionResult, Runbook
@@ -526,3 +529,129 @@ class TestBuildCoreExportRunbookMetadata:
         export_dict = export.model_dump(by_alias=True, exclude_none=True)
 
         assert "contact" not in export_dict["runbook"]
+
+
+# =============================================================================
+# Streaming Export
+# =============================================================================
+
+
+class TestWriteCoreExport:
+    """Tests for write_core_export() incremental serialisation."""
+
+    async def _assert_matches_build_core_export(
+        self, result: ExecutionResult, plan: ExecutionPlan, store: ArtifactStore
+    ) -> None:
+        import io
+        import json
+
+        from wct.exporters.core import build_core_export, write_core_export
+
+        stream = io.StringIO()
+        await write_core_export(result, plan, store, stream)
+
+        export = await build_core_export(result, plan, store)
+        expected = json.dumps(export.model_dump(), indent=2, default=str)
+        assert stream.getvalue() == expected
+
+    async def test_empty_run_matches_in_memory_export(
+        self, empty_plan: ExecutionPlan, empty_result: ExecutionResult
+    ) -> None:
+        """Streamed document equals the in-memory export when nothing ran."""
+        await self._assert_matches_build_core_export(
+            empty_result, empty_plan, AsyncInMemoryStore()
+        )
+
+    async def test_outputs_and_errors_match_in_memory_export(self) -> None:
+        """Streamed document equals the in-memory export for mixed outcomes."""
+        from waivern_orchestration import ArtifactDefinition, SourceConfig
+
+        schema = Schema("test_schema", "1.0.0")
+        artifacts = {
+            art_id: ArtifactDefinition(
+                source=SourceConfig(type="test", properties={}), output=True
+            )
+            for art_id in ("art1", "art2", "art3")
+        }
+        runbook = Runbook(name="Test", description="Test", artifacts=artifacts)
+        plan = ExecutionPlan(
+            runbook=runbook,
+            dag=Mock(),
+            artifact_schemas={"art1": (None, schema), "art2": (None, schema)},
+        )
+        result = ExecutionResult(
+            run_id="123e4567-e89b-12d3-a456-426614174000",
+            start_timestamp="2024-01-15T10:30:00+00:00",
+            completed={"art1", "art2"},
+            failed={"art3"},
+            skipped=set(),
+            total_duration_seconds=3.0,
+        )
+
+        store = AsyncInMemoryStore()
+        await store.save_artifact(
+            result.run_id,
+            "art1",
+            create_success_message(
+                {"findings": [{"text": "multi\nline", "tags": []}], "n": 1.5},
+                schema=schema,
+            ),
+        )
+        await store.save_artifact(
+            result.run_id, "art2", create_success_message(schema=schema)
+        )
+        await store.save_artifact(
+            result.run_id, "art3", create_error_message("boom", schema=schema)
+        )
+
+        await self._assert_matches_build_core_export(result, plan, store)
+
+    async def test_chunked_items_match_in_memory_export(self, tmp_path: Path) -> None:
+        """Item lists streamed from stored chunks lay out like the full export."""
+        from waivern_orchestration import ArtifactDefinition, SourceConfig
+
+        schema = Schema("test_schema", "1.0.0")
+        runbook = Runbook(
+            name="Test",
+            description="Test",
+            artifacts={
+                art_id: ArtifactDefinition(
+                    source=SourceConfig(type="test", properties={}), output=True
+                )
+                for art_id in ("findings", "empty")
+            },
+        )
+        plan = ExecutionPlan(runbook=runbook, dag=Mock(), artifact_schemas={})
+        result = ExecutionResult(
+            run_id="123e4567-e89b-12d3-a456-426614174000",
+            start_timestamp="2024-01-15T10:30:00+00:00",
+            completed={"findings", "empty"},
+            failed=set(),
+            skipped=set(),
+            total_duration_seconds=1.0,
+        )
+
+        store = LocalFilesystemStore(
+            base_path=tmp_path, chunk_size=2, columnar_findings=True
+        )
+        await store.save_artifact(
+            result.run_id,
+            "findings",
+            create_success_message(
+                {
+                    "findings": [
+                        {"id": str(i), "metadata": {"source": "a.txt"}}
+                        for i in range(5)
+                    ],
+                    "summary": {"total_findings": 5},
+                },
+                schema=schema,
+            ),
+        )
+        await store.save_artifact(
+            result.run_id,
+            "empty",
+            create_success_message({"findings": [], "n": 0}, schema=schema),
+        )
+
+        await self._assert_matches_build_core_export(result, plan, store)
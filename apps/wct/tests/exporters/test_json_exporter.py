@@ -71,3 +71,28 @@ class TestJsonExporterExport:
         json_str = json.dumps(export_result, indent=2)
         assert isinstance(json_str, str)
         assert len(json_str) > 0
+
+    async def test_export_to_writes_same_document_as_export(
+        self,
+        minimal_result: ExecutionResult,
+        minimal_plan: ExecutionPlan,
+    ) -> None:
+        """export_to() streams the same JSON document export() returns."""
+        import io
+        import json
+
+        from wct.exporters.json_exporter import JsonExporter
+        from wct.exporters.protocol import StreamingExporter
+
+        store = AsyncInMemoryStore()
+        await store.save_artifact(
+            minimal_result.run_id, "art1", create_success_message()
+        )
+        exporter = JsonExporter()
+        stream = io.StringIO()
+
+        await exporter.export_to(minimal_result, minimal_plan, store, stream)
+
+        assert isinstance(exporter, StreamingExporter)
+        expected = await exporter.export(minimal_result, minimal_plan, store)
+        assert json.loads(stream.getvalue()) == expected
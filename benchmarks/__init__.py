@@ -0,0 +1,5 @@
+"""End-to-end benchmarks of runbook execution on synthetic estates.
+
+Run with ``scripts/bench.sh`` (or ``python -m benchmarks``); see
+``benchmarks/README.md``.
+"""
@@ -0,0 +1,276 @@
+"""Run the end-to-end benchmarks and compare them with the baseline.
+
+Generates a synthetic estate, runs each scenario (a bundled runbook bound to
+the estate) in its own process with an offline LLM, and reports wall time,
+planning and execution time, time per component, peak RSS and store size.
+Results are compared with ``benchmarks/baselines/<size>.json``; the exit
+status is 1 if anything regressed beyond the tolerance, and 2 if there is no
+complete baseline for the estate and LLM latency (record one with
+``--update-baseline``). Timings and peak RSS are only reported unless
+``--machine-tolerance`` is given.
+
+Usage::
+
+    python -m benchmarks --size small
+    python -m benchmarks --size medium --repeat 3 --update-baseline
+    python -m benchmarks --repeat 3 --machine-tolerance 0.5
+"""
+
+from __future__ import annotations
+
+import argparse
+import dataclasses
+import json
+import os
+import shutil
+import statistics
+import subprocess
+import sys
+import tempfile
+from pathlib import Path
+from typing import Any
+
+from benchmarks.compare import compare
+from benchmarks.estate import PRESETS, EstateSize, generate_estate
+from benchmarks.scenarios import SCENARIOS, Scenario, write_runbook
+
+REPO_ROOT = Path(__file__).resolve().parent.parent
+BASELINES_DIR = Path(__file__).resolve().parent / "baselines"
+
+_MEDIAN_MEASURES = (
+    "wall_seconds",
+    "planning_seconds",
+    "execution_seconds",
+    "peak_rss_bytes",
+    "store_bytes",
+)
+
+
+def _parse_args() -> argparse.Namespace:
+    parser = argparse.ArgumentParser(
+        prog="python -m benchmarks",
+        description="Run end-to-end benchmarks on a synthetic estate.",
+    )
+    parser.add_argument("--size", choices=sorted(PRESETS), default="small")
+    for field in dataclasses.fields(EstateSize):
+        parser.add_argument(
+            f"--{field.name.replace('_', '-')}",
+            type=int,
+            metavar="N",
+            help=f"Override the preset's {field.name.replace('_', ' ')}",
+        )
+    parser.add_argument(
+        "--scenario",
+        action="append",
+        choices=[scenario.name for scenario in SCENARIOS],
+        help="Run only this scenario (repeatable; default: all)",
+    )
+    parser.add_argument(
+        "--repeat", type=int, default=1, help="Runs per scenario; medians are kept"
+    )
+    parser.add_argument(
+        "--llm-latency",
+        type=float,
+        default=0.0,
+        metavar="SECONDS",
+        help="Simulated latency of each offline LLM call",
+    )
+    parser.add_argument(
+        "--tolerance",
+        type=float,
+        default=0.25,
+        help="Allowed growth of store size and LLM calls over the baseline, "
+        "as a fraction (default: 0.25)",
+    )
+    parser.add_argument(
+        "--machine-tolerance",
+        type=float,
+        metavar="FRACTION",
+        help="Also fail on timings and peak RSS grown by more than this fraction "
+        "(default: report them only). Use a baseline from the same machine and "
+        "Python version and a tolerance above its run-to-run noise",
+    )
+    parser.add_argument("--baseline", type=Path, help="Baseline results file")
+    parser.add_argument(
+        "--update-baseline",
+        action="store_true",
+        help="Record these results as the baseline instead of comparing",
+    )
+    parser.add_argument("--output", type=Path, help="Also write results here")
+    parser.add_argument(
+        "--workdir", type=Path, help="Keep the estate and stores here (default: temp)"
+    )
+    parser.add_argument("--seed", type=int, default=0)
+    return parser.parse_args()
+
+
+def _estate_size(args: argparse.Namespace) -> tuple[str, EstateSize]:
+    """Return the size's name (``custom`` if overridden) and the size."""
+    overrides = {
+        field.name: getattr(args, field.name)
+        for field in dataclasses.fields(EstateSize)
+        if getattr(args, field.name) is not None
+    }
+    size = dataclasses.replace(PRESETS[args.size], **overrides)
+    return ("custom" if overrides else args.size), size
+
+
+def _run_once(runbook: Path, store: Path, llm_latency: float) -> dict[str, Any]:
+    """Run one scenario in a fresh interpreter and return its measurements."""
+    shutil.rmtree(store, ignore_errors=True)
+    env = os.environ | {
+        "WAIVERN_STORE_TYPE": "filesystem",
+        "WAIVERN_STORE_PATH": str(store),
+        "WAIVERN_PLAN_CACHE": "off",
+        "WAIVERN_MEMORY_PROFILE": "off",
+        "WAIVERN_COMPONENT_MANIFEST": "off",
+    }
+    completed = subprocess.run(  # noqa: S603 - runs this interpreter
+        [
+            sys.executable,
+            "-m",
+            "benchmarks.runner",
+            str(runbook),
+            "--llm-latency",
+            str(llm_latency),
+        ],
+        cwd=REPO_ROOT,
+        env=env,
+        capture_output=True,
+        text=True,
+        check=False,
+    )
+    if completed.returncode != 0:
+        sys.stderr.write(completed.stderr)
+        raise SystemExit(f"Benchmark run of {runbook.name} failed")
+    return json.loads(completed.stdout)
+
+
+def _median(runs: list[dict[str, Any]]) -> dict[str, Any]:
+    """Combine repeated runs, keeping the median of each measurement."""
+    merged = dict(runs[-1])
+    for measure in _MEDIAN_MEASURES:
+        merged[measure] = statistics.median(run[measure] for run in runs)
+    components = sorted({c for run in runs for c in run["component_seconds"]})
+    merged["component_seconds"] = {
+        component: statistics.median(
+            run["component_seconds"].get(component, 0.0) for run in runs
+        )
+        for component in components
+    }
+    return merged
+
+
+def _run_scenarios(
+    scenarios: list[Scenario], args: argparse.Namespace, workdir: Path
+) -> dict[str, Any]:
+    size_name, size = _estate_size(args)
+    print(f"Generating {size_name} estate: {size.as_dict()}", file=sys.stderr)
+    estate = generate_estate(workdir / "estate", size, seed=args.seed)
+
+    results: dict[str, Any] = {}
+    for scenario in scenarios:
+        runbook = write_runbook(scenario, estate, workdir / "runbooks")
+        runs = [
+            _run_once(
+                runbook, workdir / "stores" / f"{scenario.name}_{run}", args.llm_latency
+            )
+            for run in range(args.repeat)
+        ]
+        results[scenario.name] = _median(runs)
+        print(
+            f"{scenario.name}: {results[scenario.name]['wall_seconds']:.2f}s",
+            file=sys.stderr,
+        )
+
+    return {
+        "size": size_name,
+        "estate": size.as_dict(),
+        "llm_latency": args.llm_latency,
+        "repeat": args.repeat,
+        "scenarios": results,
+    }
+
+
+def _report(
+    results: dict[str, Any],
+    baseline_path: Path,
+    tolerance: float,
+    machine_tolerance: float | None = None,
+) -> int:
+    """Print the comparison with the baseline; return the exit status."""
+    if not baseline_path.exists():
+        print(
+            f"No baseline at {baseline_path}; record one with --update-baseline",
+            file=sys.stderr,
+        )
+        return 2
+
+    baseline = json.loads(baseline_path.read_text())
+    if (baseline["estate"], baseline["llm_latency"]) != (
+        results["estate"],
+        results["llm_latency"],
+    ):
+        print(
+            f"Baseline {baseline_path} was recorded for another estate or LLM "
+            "latency; pass --baseline or record one with --update-baseline",
+            file=sys.stderr,
+        )
+        return 2
+
+    try:
+        changes = compare(
+            baseline, results, tolerance=tolerance, machine_tolerance=machine_tolerance
+        )
+    except ValueError as e:
+        print(
+            f"Baseline {baseline_path} is incomplete ({e}); "
+            "record it again with --update-baseline",
+            file=sys.stderr,
+        )
+        return 2
+    print(
+        f"{'scenario':<24} {'measure':<36} {'baseline':>14} {'current':>14} "
+        f"{'ratio':>8}"
+    )
+    for change in changes:
+        print(change.describe())
+
+    regressions = [change for change in changes if change.regressed]
+    if regressions:
+        print(f"{len(regressions)} regression(s) against {baseline_path}")
+        return 1
+    print(f"No regressions against {baseline_path}")
+    return 0
+
+
+def main() -> int:
+    """Run the benchmarks; return the exit status."""
+    args = _parse_args()
+    scenarios = [
+        scenario
+        for scenario in SCENARIOS
+        if args.scenario is None or scenario.name in args.scenario
+    ]
+
+    if args.workdir is not None:
+        results = _run_scenarios(scenarios, args, args.workdir)
+    else:
+        with tempfile.TemporaryDirectory(prefix="waivern-bench-") as workdir:
+            results = _run_scenarios(scenarios, args, Path(workdir))
+
+    rendered = json.dumps(results, indent=2, sort_keys=True) + "\n"
+    if args.output is not None:
+        args.output.write_text(rendered)
+
+    baseline_path = args.baseline or BASELINES_DIR / f"{results['size']}.json"
+    if args.update_baseline:
+        baseline_path.parent.mkdir(parents=True, exist_ok=True)
+        baseline_path.write_text(rendered)
+        print(f"Recorded baseline {baseline_path}", file=sys.stderr)
+        return 0
+    return _report(results, baseline_path, args.tolerance, args.machine_tolerance)
+
+
+if __name__ == "__main__":
+    sys.exit(main())
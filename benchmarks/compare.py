@@ -0,0 +1,172 @@
+"""Comparison of benchmark results against a recorded baseline."""
+
+from __future__ import annotations
+
+from dataclasses import dataclass
+from typing import Any
+
+_TIME_FLOOR_SECONDS = 0.05
+"""Smaller slowdowns are noise, whatever their relative size."""
+
+_COMPONENT_FLOOR_FRACTION = 0.05
+"""Smaller slowdowns of one component, as a fraction of the scenario's wall
+time, are noise: components share the interpreter's threads, so a small
+component's time swings with contention from the rest of the run."""
+
+_MEMORY_FLOOR_BYTES = 4 * 1024 * 1024
+"""Smaller growth in peak RSS is noise, whatever its relative size."""
+
+_MACHINE_MEASURES: dict[str, float] = {
+    "wall_seconds": _TIME_FLOOR_SECONDS,
+    "planning_seconds": _TIME_FLOOR_SECONDS,
+    "execution_seconds": _TIME_FLOOR_SECONDS,
+    "peak_rss_bytes": _MEMORY_FLOOR_BYTES,
+}
+"""Measurements compared per scenario (as is ``component_seconds``) that vary
+from run to run and with the machine and Python version, with their noise
+floors. They only regress when asked to."""
+
+_MEASURES: dict[str, float] = {"store_bytes": 0, "llm_calls": 0}
+"""Deterministic measurements compared per scenario, with the change below
+which they pass."""
+
+_OUTCOMES = ("failed", "skipped")
+"""Artifact outcomes that regress whenever they grow."""
+
+
+@dataclass(frozen=True)
+class Change:
+    """One measurement of one scenario, before and after."""
+
+    scenario: str
+    measure: str
+    baseline: float
+    current: float
+    regressed: bool
+    gated: bool = True
+    """Whether the measurement can regress, or is only reported."""
+
+    @property
+    def ratio(self) -> float:
+        """Current value relative to the baseline (1.0 = unchanged)."""
+        if self.baseline:
+            return self.current / self.baseline
+        return 1.0 if self.current == self.baseline else float("inf")
+
+    def describe(self) -> str:
+        """Return a one-line, human-readable description."""
+        if self.regressed:
+            marker = "REGRESSED"
+        else:
+            marker = "ok" if self.gated else "(not gated)"
+        return (
+            f"{self.scenario:<24} {self.measure:<36} "
+            f"{self.baseline:>14.3f} {self.current:>14.3f} "
+            f"{self.ratio:>7.2f}x  {marker}"
+        )
+
+
+def _regressed(baseline: float, current: float, tolerance: float, floor: float) -> bool:
+    return current > baseline * (1 + tolerance) and current - baseline > floor
+
+
+def _machine_change(  # noqa: PLR0913 - one Change's fields and its gate
+    scenario: str,
+    measure: str,
+    baseline: float,
+    current: float,
+    floor: float,
+    tolerance: float | None,
+) -> Change:
+    if tolerance is None:
+        return Change(scenario, measure, baseline, current, False, gated=False)
+    regressed = _regressed(baseline, current, tolerance, floor)
+    return Change(scenario, measure, baseline, current, regressed)
+
+
+def compare(
+    baseline: dict[str, Any],
+    current: dict[str, Any],
+    *,
+    tolerance: float,
+    machine_tolerance: float | None = None,
+) -> list[Change]:
+    """Compare ``current`` results with ``baseline``.
+
+    A measurement regresses when it exceeds the baseline by more than
+    ``tolerance`` (a fraction) and by more than its noise floor. More failed
+    or skipped artifacts than the baseline always regress. Timings and peak
+    RSS are reported, but only regress (likewise, by ``machine_tolerance``)
+    when ``machine_tolerance`` is given. A component in the baseline that
+    no longer runs is reported with a time of zero.
+
+    Args:
+        baseline: Results recorded earlier.
+        current: Results of this run.
+        tolerance: Allowed relative growth of store size and LLM calls, e.g.
+            0.25 for 25%.
+        machine_tolerance: Allowed relative growth of timings and peak RSS,
+            or None to report them without comparing them. Only meaningful
+            against a baseline recorded on the same machine and Python
+            version, above its run-to-run noise.
+
+    Returns:
+        Changes for every measurement of every scenario in both results.
+
+    Raises:
+        ValueError: If a baseline scenario lacks a measurement, so that
+            regressions in it could not be detected.
+
+    """
+    changes: list[Change] = []
+    for name, before in baseline["scenarios"].items():
+        after = current["scenarios"].get(name)
+        if after is None:
+            continue
+
+        missing = [
+            m
+            for m in (*_MACHINE_MEASURES, *_MEASURES, "component_seconds")
+            if m not in before
+        ]
+        missing += [
+            f"artifacts[{outcome}]"
+            for outcome in _OUTCOMES
+            if outcome not in before.get("artifacts", {})
+        ]
+        if missing:
+            raise ValueError(f"Baseline scenario {name!r} lacks {', '.join(missing)}")
+
+        for measure, floor in _MACHINE_MEASURES.items():
+            changes.append(
+                _machine_change(
+                    name,
+                    measure,
+                    before[measure],
+                    after[measure],
+                    floor,
+                    machine_tolerance,
+                )
+            )
+        component_floor = max(
+            _TIME_FLOOR_SECONDS, before["wall_seconds"] * _COMPONENT_FLOOR_FRACTION
+        )
+        for component, was in before["component_seconds"].items():
+            changes.append(
+                _machine_change(
+                    name,
+                    f"component_seconds[{component}]",
+                    was,
+                    after["component_seconds"].get(component, 0.0),
+                    component_floor,
+                    machine_tolerance,
+                )
+            )
+        for measure, floor in _MEASURES.items():
+            was, now = before[measure], after[measure]
+            regressed = _regressed(was, now, tolerance, floor)
+            changes.append(Change(name, measure, was, now, regressed))
+        for outcome in _OUTCOMES:
+            was, now = before["artifacts"][outcome], after["artifacts"][outcome]
+            changes.append(Change(name, f"artifacts[{outcome}]", was, now, now > was))
+    return changes
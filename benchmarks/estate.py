@@ -0,0 +1,288 @@
+"""Synthetic estates for the end-to-end benchmarks.
+
+An estate is a directory holding what the bundled runbooks analyse:
+
+- ``repos/``: repositories of PHP, JavaScript and TypeScript files;
+- ``databases/``: SQLite databases of customer-style tables;
+- ``documents/``: policy and record documents.
+
+Generated content is deterministic for a given size and seed, and each
+file mixes in the personal data, service integrations and data collection
+patterns the analysers look for, so every stage of the pipelines has work.
+"""
+
+from __future__ import annotations
+
+import random
+import sqlite3
+from dataclasses import asdict, dataclass
+from pathlib import Path
+
+_FIRST_NAMES = ("alice", "bob", "carol", "dave", "erin", "frank", "grace", "heidi")
+_LAST_NAMES = ("smith", "jones", "taylor", "brown", "wilson", "evans", "thomas")
+_DOMAINS = ("example.com", "example.org", "mail.example.net")
+
+_PHP_TEMPLATE = """<?php
+namespace App\\Module{index};
+
+class CustomerController{index}
+{{
+    public function register($request)
+    {{
+        $email = $_POST['email'];
+        $phone = $_POST['phone_number'];
+        $dateOfBirth = $_POST['date_of_birth'];
+        setcookie('session_id', session_id(), time() + 3600);
+
+        $stmt = $this->db->prepare(
+            'INSERT INTO customers (email, phone_number, date_of_birth) VALUES (?, ?, ?)'
+        );
+        $stmt->execute([$email, $phone, $dateOfBirth]);
+
+        \\Stripe\\Charge::create(['amount' => 1000, 'receipt_email' => $email]);
+        mail('{contact}', 'New customer', "Registered: $email");
+        return ['customer_id' => $this->db->lastInsertId()];
+    }}
+}}
+"""
+
+_JS_TEMPLATE = """// Patient portal module {index}
+const {{ Client }} = require("pg");
+const analytics = require("@segment/analytics-node");
+
+async function submitForm{index}(form) {{
+  const email = form.querySelector("#email").value;
+  const patientName = form.querySelector("#full_name").value;
+  document.cookie = "tracking_id=" + crypto.randomUUID();
+
+  await fetch("https://api.mailchimp.com/3.0/lists/subscribers", {{
+    method: "POST",
+    body: JSON.stringify({{ email_address: email, name: patientName }}),
+  }});
+  analytics.track({{ userId: email, event: "Signed Up" }});
+
+  const client = new Client();
+  await client.query(
+    "SELECT medical_record_number, diagnosis FROM patients WHERE email = $1",
+    [email],
+  );
+  console.log("Contact {contact} for support");
+}}
+
+module.exports = {{ submitForm{index} }};
+"""
+
+_TS_TEMPLATE = """// Employee directory service {index}
+import {{ S3Client, PutObjectCommand }} from "@aws-sdk/client-s3";
+
+interface Employee{index} {{
+  employeeId: string;
+  email: string;
+  homeAddress: string;
+  salary: number;
+  nationalInsuranceNumber: string;
+}}
+
+export async function uploadPayslip{index}(employee: Employee{index}, pdf: Buffer) {{
+  const client = new S3Client({{ region: "eu-west-2" }});
+  await client.send(
+    new PutObjectCommand({{
+      Bucket: "payslips",
+      Key: `${{employee.employeeId}}/payslip.pdf`,
+      Body: pdf,
+      Metadata: {{ email: employee.email }},
+    }}),
+  );
+  localStorage.setItem("last_upload", employee.email);
+  return {{ notified: "{contact}" }};
+}}
+"""
+
+_DOCUMENT_TEMPLATE = """# {title}
+
+Owner: {contact}
+Review date: 2025-0{month}-1{day}
+
+## Purpose
+
+This policy describes how customer and employee personal data is processed,
+including names, email addresses, telephone numbers, home addresses and
+dates of birth collected through registration forms and support requests.
+
+## Access control
+
+Access to production systems requires multi-factor authentication. User
+access reviews are performed quarterly and leavers are removed within one
+working day. Administrator accounts are restricted to named individuals.
+
+## Data retention
+
+Payment records are retained for seven years for accounting purposes and
+then deleted. Marketing preferences are kept until consent is withdrawn.
+Backups are encrypted at rest and retained for ninety days.
+
+## Records
+
+{records}
+"""
+
+_LANGUAGES = (("php", _PHP_TEMPLATE), ("js", _JS_TEMPLATE), ("ts", _TS_TEMPLATE))
+
+
+@dataclass(frozen=True)
+class EstateSize:
+    """How much synthetic data an estate holds."""
+
+    repos: int
+    files_per_repo: int
+    databases: int
+    tables: int
+    rows_per_table: int
+    documents: int
+
+    def as_dict(self) -> dict[str, int]:
+        """Return the size as JSON-compatible data."""
+        return asdict(self)
+
+
+PRESETS: dict[str, EstateSize] = {
+    "small": EstateSize(
+        repos=2,
+        files_per_repo=15,
+        databases=1,
+        tables=5,
+        rows_per_table=20,
+        documents=10,
+    ),
+    "medium": EstateSize(
+        repos=10,
+        files_per_repo=60,
+        databases=2,
+        tables=20,
+        rows_per_table=50,
+        documents=50,
+    ),
+    "large": EstateSize(
+        repos=40,
+        files_per_repo=150,
+        databases=4,
+        tables=60,
+        rows_per_table=100,
+        documents=200,
+    ),
+}
+"""Named estate sizes; baselines are recorded per preset."""
+
+
+@dataclass(frozen=True)
+class Estate:
+    """Paths of a generated estate."""
+
+    root: Path
+    size: EstateSize
+
+    @property
+    def repos(self) -> Path:
+        """Directory holding one subdirectory per repository."""
+        return self.root / "repos"
+
+    @property
+    def databases(self) -> list[Path]:
+        """SQLite database files."""
+        return [
+            self.root / "databases" / f"estate_{index}.db"
+            for index in range(self.size.databases)
+        ]
+
+    @property
+    def documents(self) -> Path:
+        """Directory of documents."""
+        return self.root / "documents"
+
+
+def _contact(rng: random.Random) -> str:
+    first = rng.choice(_FIRST_NAMES)
+    last = rng.choice(_LAST_NAMES)
+    return f"{first}.{last}@{rng.choice(_DOMAINS)}"
+
+
+def _write_repos(estate: Estate, rng: random.Random) -> None:
+    for repo in range(estate.size.repos):
+        for index in range(estate.size.files_per_repo):
+            extension, template = _LANGUAGES[index % len(_LANGUAGES)]
+            path = estate.repos / f"repo_{repo:03d}" / "src" / f"module_{index:04d}"
+            path = path.with_suffix(f".{extension}")
+            path.parent.mkdir(parents=True, exist_ok=True)
+            path.write_text(template.format(index=index, contact=_contact(rng)))
+
+
+def _write_database(path: Path, size: EstateSize, rng: random.Random) -> None:
+    path.parent.mkdir(parents=True, exist_ok=True)
+    path.unlink(missing_ok=True)
+    with sqlite3.connect(path) as connection:
+        for table in range(size.tables):
+            connection.execute(
+                f"CREATE TABLE customers_{table} ("
+                "id INTEGER PRIMARY KEY, first_name TEXT, last_name TEXT, "
+                "email TEXT, phone_number TEXT, date_of_birth TEXT, "
+                "home_address TEXT, marketing_consent INTEGER)"
+            )
+            rows = [
+                (
+                    rng.choice(_FIRST_NAMES).title(),
+                    rng.choice(_LAST_NAMES).title(),
+                    _contact(rng),
+                    f"+44 7700 9{rng.randrange(10000, 99999)}",
+                    f"19{rng.randrange(50, 99)}-0{rng.randrange(1, 9)}-1{rng.randrange(0, 9)}",
+                    f"{rng.randrange(1, 200)} High Street, London",
+                    rng.randrange(2),
+                )
+                for _ in range(size.rows_per_table)
+            ]
+            connection.executemany(
+                f"INSERT INTO customers_{table} "  # noqa: S608 - generated table name
+                "(first_name, last_name, email, phone_number, date_of_birth, "
+                "home_address, marketing_consent) VALUES (?, ?, ?, ?, ?, ?, ?)",
+                rows,
+            )
+    connection.close()
+
+
+def _write_documents(estate: Estate, rng: random.Random) -> None:
+    estate.documents.mkdir(parents=True, exist_ok=True)
+    for index in range(estate.size.documents):
+        records = "\n".join(
+            f"- {rng.choice(_FIRST_NAMES).title()} {rng.choice(_LAST_NAMES).title()}, "
+            f"{_contact(rng)}, account {rng.randrange(10**7, 10**8)}"
+            for _ in range(10)
+        )
+        (estate.documents / f"policy_{index:04d}.md").write_text(
+            _DOCUMENT_TEMPLATE.format(
+                title=f"Data Protection Policy {index}",
+                contact=_contact(rng),
+                month=index % 9 + 1,
+                day=index % 10,
+                records=records,
+            )
+        )
+
+
+def generate_estate(root: Path, size: EstateSize, *, seed: int = 0) -> Estate:
+    """Generate a synthetic estate under ``root``.
+
+    Args:
+        root: Directory to generate into; existing estate files are replaced.
+        size: How much data to generate.
+        seed: Seed for the generated values.
+
+    Returns:
+        The generated estate.
+
+    """
+    rng = random.Random(seed)  # noqa: S311 - synthetic data, not security
+    estate = Estate(root, size)
+    _write_repos(estate, rng)
+    for database in estate.databases:
+        _write_database(database, size, rng)
+    _write_documents(estate, rng)
+    return estate
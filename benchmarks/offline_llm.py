@@ -0,0 +1,127 @@
+"""Offline LLM for benchmarks: real dispatch, canned responses.
+
+``OfflineComponentRegistry`` resolves LLM requests to an ``LLMDispatcher``
+backed by ``OfflineLLMProvider``, so runs exercise the dispatcher's
+batching, caching and metrics without network access or API keys. The
+provider answers every prompt with the smallest response its model
+accepts, after an optional simulated latency.
+"""
+
+from __future__ import annotations
+
+import asyncio
+from typing import Any, override
+
+from pydantic import BaseModel
+from waivern_artifact_store import ArtifactStore
+from waivern_core.dispatch import DispatchRequest, DispatchResult, RequestDispatcher
+from waivern_core.services import ComponentRegistry, ServiceContainer
+from waivern_llm import LLMDispatcher
+from waivern_llm.types import LLMRequest
+from wct.cli.infrastructure import resolve_metrics
+
+_CONTEXT_WINDOW = 200_000
+
+
+def _placeholder(  # noqa: PLR0911 - one return per JSON schema construct
+    schema: dict[str, Any], definitions: dict[str, Any]
+) -> object:
+    """Return the simplest value that validates against a JSON schema."""
+    if "$ref" in schema:
+        return _placeholder(definitions[schema["$ref"].rsplit("/", 1)[-1]], definitions)
+    if "default" in schema:
+        return schema["default"]
+    if "const" in schema:
+        return schema["const"]
+    if "enum" in schema:
+        return schema["enum"][0]
+    for combinator in ("anyOf", "oneOf", "allOf"):
+        if combinator in schema:
+            return _placeholder(schema[combinator][0], definitions)
+
+    match schema.get("type"):
+        case "object":
+            required = set(schema.get("required", ()))
+            return {
+                name: _placeholder(property_schema, definitions)
+                for name, property_schema in schema.get("properties", {}).items()
+                if name in required
+            }
+        case "array":
+            return []
+        case "string":
+            return "offline"
+        case "integer" | "number":
+            return schema.get("minimum", 0)
+        case "boolean":
+            return False
+        case _:
+            return None
+
+
+class OfflineLLMProvider:
+    """An ``LLMProvider`` that answers without calling a model."""
+
+    def __init__(self, latency: float = 0.0) -> None:
+        """Initialise the provider.
+
+        Args:
+            latency: Seconds each call waits before answering.
+
+        """
+        self._latency = latency
+        self.calls = 0
+
+    @property
+    def model_name(self) -> str:
+        """Return the model name being used."""
+        return "offline"
+
+    @property
+    def context_window(self) -> int:
+        """Return the model's context window size in tokens."""
+        return _CONTEXT_WINDOW
+
+    async def invoke_structured[R: BaseModel](
+        self, prompt: str, response_model: type[R]
+    ) -> R:
+        """Return the smallest valid ``response_model`` for any prompt."""
+        self.calls += 1
+        if self._latency:
+            await asyncio.sleep(self._latency)
+        schema = response_model.model_json_schema()
+        return response_model.model_validate(
+            _placeholder(schema, schema.get("$defs", {}))
+        )
+
+
+class OfflineComponentRegistry(ComponentRegistry):
+    """A ``ComponentRegistry`` that dispatches LLM requests offline."""
+
+    def __init__(
+        self, container: ServiceContainer, provider: OfflineLLMProvider
+    ) -> None:
+        """Initialise the registry.
+
+        Args:
+            container: ServiceContainer with an ArtifactStore registered.
+            provider: Provider answering every LLM request.
+
+        """
+        super().__init__(container)
+        self._provider = provider
+
+    @override
+    def get_dispatcher_for(
+        self, request_type: type[DispatchRequest]
+    ) -> RequestDispatcher[DispatchRequest, DispatchResult]:
+        """Resolve LLM requests offline and anything else as usual."""
+        if not issubclass(request_type, LLMRequest):
+            return super().get_dispatcher_for(request_type)
+
+        dispatcher = LLMDispatcher(
+            provider=self._provider,
+            store=self.container.get_service(ArtifactStore),
+            metrics=resolve_metrics(self.container),
+        )
+        return dispatcher  # type: ignore[return-value]
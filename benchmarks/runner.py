@@ -0,0 +1,115 @@
+"""Run one benchmark scenario and print its measurements as JSON.
+
+Invoked by ``python -m benchmarks`` in a fresh interpreter per scenario, so
+peak RSS belongs to that scenario alone::
+
+    python -m benchmarks.runner RUNBOOK [--llm-latency SECONDS]
+
+The store, plan cache, memory profile and component manifest are configured
+through the usual ``WAIVERN_*`` environment variables, which the caller
+sets; infrastructure is built exactly as ``wct run`` builds it, except that
+LLM requests are answered by ``OfflineLLMProvider``.
+"""
+
+from __future__ import annotations
+
+import argparse
+import asyncio
+import json
+import os
+import resource
+import sys
+import time
+from pathlib import Path
+from typing import Any
+
+from waivern_artifact_store import ArtifactStore
+from waivern_orchestration import DAGExecutor, Planner
+from wct.cli.infrastructure import (
+    build_memory_profile,
+    build_plan_cache,
+    build_service_container,
+    initialise_exporters,
+    resolve_metrics,
+)
+
+from benchmarks.offline_llm import OfflineComponentRegistry, OfflineLLMProvider
+
+_DURATION_METRIC = "waivern_artifact_duration_seconds"
+
+
+def peak_rss_bytes() -> int:
+    """Return this process's peak resident set size in bytes."""
+    peak = resource.getrusage(resource.RUSAGE_SELF).ru_maxrss
+    # Linux reports kilobytes, macOS bytes
+    return peak if sys.platform == "darwin" else peak * 1024
+
+
+def directory_size(path: Path) -> int:
+    """Return the total size in bytes of the files under ``path``."""
+    return sum(file.stat().st_size for file in path.rglob("*") if file.is_file())
+
+
+def _component_seconds(snapshot: dict[str, Any]) -> dict[str, float]:
+    """Return total artifact seconds per component from a metrics snapshot."""
+    totals: dict[str, float] = {}
+    for sample in snapshot.get(_DURATION_METRIC, {}).get("samples", []):
+        component = sample["labels"].get("component", "unknown")
+        totals[component] = totals.get(component, 0.0) + sample["sum"]
+    return dict(sorted(totals.items()))
+
+
+async def run_scenario(runbook: Path, llm_latency: float) -> dict[str, Any]:
+    """Plan and execute ``runbook``, returning its measurements."""
+    start = time.perf_counter()
+    initialise_exporters()
+    provider = OfflineLLMProvider(latency=llm_latency)
+    registry = OfflineComponentRegistry(build_service_container(metrics=True), provider)
+
+    planned = time.perf_counter()
+    plan = Planner(registry, plan_cache=build_plan_cache()).plan(runbook)
+    planning_seconds = time.perf_counter() - planned
+
+    metrics = resolve_metrics(registry.container)
+    executor = DAGExecutor(
+        registry, memory_profile=build_memory_profile(), metrics=metrics
+    )
+    executed = time.perf_counter()
+    result = await executor.execute(plan, runbook_path=runbook)
+    execution_seconds = time.perf_counter() - executed
+
+    await registry.container.get_service(ArtifactStore).flush()
+    wall_seconds = time.perf_counter() - start
+
+    store_path = Path(os.environ["WAIVERN_STORE_PATH"])
+    return {
+        "wall_seconds": wall_seconds,
+        "planning_seconds": planning_seconds,
+        "execution_seconds": execution_seconds,
+        "peak_rss_bytes": peak_rss_bytes(),
+        "store_bytes": directory_size(store_path) if store_path.exists() else 0,
+        "artifacts": {
+            "completed": len(result.completed),
+            "failed": len(result.failed),
+            "skipped": len(result.skipped),
+        },
+        "llm_calls": provider.calls,
+        "component_seconds": _component_seconds(
+            metrics.snapshot() if metrics is not None else {}
+        ),
+    }
+
+
+def main() -> None:
+    """Run the scenario named on the command line."""
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("runbook", type=Path)
+    parser.add_argument("--llm-latency", type=float, default=0.0)
+    args = parser.parse_args()
+
+    measurements = asyncio.run(run_scenario(args.runbook, args.llm_latency))
+    json.dump(measurements, sys.stdout)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,198 @@
+"""Benchmark scenarios: the bundled sample runbooks, pointed at an estate.
+
+Each scenario names a runbook from ``apps/wct/runbooks/samples`` and binds
+its source artifacts to parts of the estate. A source bound to repositories
+or databases is fanned out into one copy per repository or database, along
+with every artifact downstream of it, so the DAG widens as the estate grows
+just as a real multi-repository runbook would.
+"""
+
+from __future__ import annotations
+
+import copy
+from collections.abc import Mapping
+from dataclasses import dataclass
+from enum import StrEnum
+from pathlib import Path
+from typing import Any
+
+import yaml
+
+from benchmarks.estate import Estate
+
+SAMPLES_DIR = (
+    Path(__file__).resolve().parent.parent / "apps" / "wct" / "runbooks" / "samples"
+)
+"""Directory of the bundled sample runbooks."""
+
+_SOURCE_CODE_PATTERNS = ["*.php", "*.js", "*.ts"]
+
+
+class EstatePart(StrEnum):
+    """The part of an estate a source artifact reads."""
+
+    REPOS = "repos"
+    DATABASES = "databases"
+    DOCUMENTS = "documents"
+
+
+@dataclass(frozen=True)
+class Scenario:
+    """A bundled runbook with its sources bound to an estate."""
+
+    name: str
+    runbook: str
+    """File name in the samples directory."""
+    sources: Mapping[str, EstatePart]
+    """Source artifact ID -> the estate part it reads."""
+    llm_validation: bool = False
+    """Enable LLM validation in every processor that offers it."""
+
+
+SCENARIOS: tuple[Scenario, ...] = (
+    Scenario(
+        name="lamp_stack_lite",
+        runbook="LAMP_stack_lite.yaml",
+        sources={
+            "sqlite_data": EstatePart.DATABASES,
+            "filesystem_data": EstatePart.DOCUMENTS,
+            "source_code_files": EstatePart.REPOS,
+        },
+    ),
+    Scenario(
+        name="file_content_analysis",
+        runbook="file_content_analysis.yaml",
+        sources={"file_content": EstatePart.DOCUMENTS},
+    ),
+    Scenario(
+        name="lamp_stack_lite_llm",
+        runbook="LAMP_stack_lite.yaml",
+        sources={
+            "sqlite_data": EstatePart.DATABASES,
+            "filesystem_data": EstatePart.DOCUMENTS,
+            "source_code_files": EstatePart.REPOS,
+        },
+        llm_validation=True,
+    ),
+)
+"""Scenarios run by default, in order.
+
+The GitHub and MongoDB samples need network services and are not run.
+"""
+
+
+def _source_properties(estate: Estate, part: EstatePart) -> list[dict[str, Any]]:
+    """Return source properties per copy of a source reading ``part``."""
+    size = estate.size
+    match part:
+        case EstatePart.REPOS:
+            return [
+                {
+                    "path": str(repo),
+                    "include_patterns": _SOURCE_CODE_PATTERNS,
+                    "max_files": size.files_per_repo,
+                }
+                for repo in sorted(estate.repos.iterdir())
+            ]
+        case EstatePart.DATABASES:
+            return [
+                {
+                    "database_path": str(database),
+                    "max_rows_per_table": size.rows_per_table,
+                }
+                for database in estate.databases
+            ]
+        case EstatePart.DOCUMENTS:
+            return [{"path": str(estate.documents), "max_files": size.documents}]
+
+
+def _inputs(definition: dict[str, Any]) -> list[str]:
+    inputs = definition.get("inputs")
+    if inputs is None:
+        return []
+    return [inputs] if isinstance(inputs, str) else list(inputs)
+
+
+def _downstream(artifacts: dict[str, Any], source_id: str) -> set[str]:
+    """Return ``source_id`` and every artifact that depends on it."""
+    found = {source_id}
+    changed = True
+    while changed:
+        changed = False
+        for artifact_id, definition in artifacts.items():
+            if artifact_id not in found and found.intersection(_inputs(definition)):
+                found.add(artifact_id)
+                changed = True
+    return found
+
+
+def _fan_out(
+    artifacts: dict[str, Any], source_id: str, properties: list[dict[str, Any]]
+) -> dict[str, Any]:
+    """Bind ``source_id`` to each of ``properties``, copying what depends on it."""
+    if len(properties) == 1:
+        artifacts[source_id]["source"]["properties"].update(properties[0])
+        return artifacts
+
+    family = _downstream(artifacts, source_id)
+    fanned: dict[str, Any] = {}
+    for artifact_id, definition in artifacts.items():
+        if artifact_id not in family:
+            inputs = _inputs(definition)
+            if family.intersection(inputs):
+                # Fan-in: an artifact outside the family reads every copy
+                definition["inputs"] = [
+                    f"{name}_{index}" if name in family else name
+                    for name in inputs
+                    for index in range(len(properties) if name in family else 1)
+                ]
+            fanned[artifact_id] = definition
+            continue
+
+        for index, source_properties in enumerate(properties):
+            clone = copy.deepcopy(definition)
+            if artifact_id == source_id:
+                clone["source"]["properties"].update(source_properties)
+            else:
+                clone["inputs"] = [
+                    f"{name}_{index}" if name in family else name
+                    for name in _inputs(definition)
+                ]
+            fanned[f"{artifact_id}_{index}"] = clone
+    return fanned
+
+
+def _enable_llm_validation(artifacts: dict[str, Any]) -> None:
+    for definition in artifacts.values():
+        properties = definition.get("process", {}).get("properties", {})
+        validation = properties.get("llm_validation")
+        if isinstance(validation, dict):
+            validation["enable_llm_validation"] = True
+
+
+def write_runbook(scenario: Scenario, estate: Estate, directory: Path) -> Path:
+    """Write the scenario's runbook, bound to ``estate``, into ``directory``.
+
+    Returns:
+        Path of the written runbook.
+
+    Raises:
+        KeyError: If the runbook has no artifact named by ``scenario.sources``.
+
+    """
+    runbook = yaml.safe_load((SAMPLES_DIR / scenario.runbook).read_text())
+    artifacts: dict[str, Any] = runbook["artifacts"]
+    for source_id, part in scenario.sources.items():
+        if source_id not in artifacts:
+            raise KeyError(
+                f"Runbook '{scenario.runbook}' has no source artifact '{source_id}'"
+            )
+        artifacts = _fan_out(artifacts, source_id, _source_properties(estate, part))
+    if scenario.llm_validation:
+        _enable_llm_validation(artifacts)
+    runbook["artifacts"] = artifacts
+
+    directory.mkdir(parents=True, exist_ok=True)
+    path = directory / f"{scenario.name}.yaml"
+    path.write_text(yaml.safe_dump(runbook, sort_keys=False))
+    return path
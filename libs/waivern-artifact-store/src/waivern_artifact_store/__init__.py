@@ -2,7 +2,11 @@
 
 # Async interface (stateless, run_id per operation)
 # Configuration (discriminated union pattern)
-from waivern_artifact_store.base import ArtifactStore
+from waivern_artifact_store.base import (
+    ArtifactMetadata,
+    ArtifactStore,
+    artifact_items_field,
+)
 from waivern_artifact_store.configuration import (
     ArtifactStoreConfiguration,
     FilesystemStoreConfig,
@@ -16,6 +20,8 @@ from waivern_artifact_store.llm_cache import LLMCache
 __all__ = [
     # Async interface
     "ArtifactStore",
+    "ArtifactMetadata",
+    "artifact_items_field",
     # Protocols
     "LLMCache",
     # Configuration
@@ -11,9 +11,103 @@ The interface is stateless - run_id is passed to each operation, enabling:
 from __future__ import annotations
 
 from abc import ABC, abstractmethod
+from collections.abc import AsyncIterator
+from dataclasses import dataclass, replace
+from datetime import datetime
+from typing import Any, cast
 
-from waivern_core import JsonValue
-from waivern_core.message import Message
+from waivern_core import JsonValue, Schema
+from waivern_core.message import Message, MessageExtensions
+from waivern_core.metrics import MetricsRegistry
+
+# Content fields holding an artifact's item list, in lookup order: analyser
+# outputs keep findings in ``findings``, connector outputs keep items in ``data``
+ARTIFACT_ITEM_FIELDS: tuple[str, ...] = ("findings", "data")
+
+
+def artifact_items_field(content: dict[str, Any]) -> str | None:
+    """Name the content field that holds an artifact's item list.
+
+    Args:
+        content: Artifact message content.
+
+    Returns:
+        The first of ``ARTIFACT_ITEM_FIELDS`` whose value is a list, or None.
+
+    """
+    for field in ARTIFACT_ITEM_FIELDS:
+        if isinstance(content.get(field), list):
+            return field
+    return None
+
+
+@dataclass(frozen=True, slots=True)
+class ArtifactMetadata:
+    """Header of a stored artifact: everything except its content.
+
+    Summaries, listings and error reports only need execution status,
+    timing and schema. Stores that keep the header apart from the content
+    return it without reading or decoding the content.
+    """
+
+    message_id: str
+    schema: Schema
+    timestamp: datetime
+    run_id: str | None = None
+    source: str | None = None
+    extensions: MessageExtensions | None = None
+    item_count: int | None = None
+    """Length of the item list (see ``ARTIFACT_ITEM_FIELDS``), if any."""
+
+    @classmethod
+    def from_message(
+        cls, message: Message, *, item_count: int | None = None
+    ) -> ArtifactMetadata:
+        """Build metadata from a message, counting its items if not given.
+
+        Args:
+            message: Artifact message (content is only inspected for its
+                item list length).
+            item_count: Known item count, e.g. from a stored header.
+
+        Returns:
+            Metadata carrying the message header fields.
+
+        """
+        if item_count is None:
+            field = artifact_items_field(message.content)
+            if field is not None:
+                item_count = len(cast(list[Any], message.content[field]))
+        return cls(
+            message_id=message.id,
+            schema=message.schema,
+            timestamp=message.timestamp,
+            run_id=message.run_id,
+            source=message.source,
+            extensions=message.extensions,
+            item_count=item_count,
+        )
+
+    @property
+    def is_success(self) -> bool:
+        """Check if execution succeeded (False without execution context)."""
+        if self.extensions and self.extensions.execution:
+            return self.extensions.execution.status == "success"
+        return False
+
+    @property
+    def execution_error(self) -> str | None:
+        """Get execution error message, if any."""
+        if self.extensions and self.extensions.execution:
+            return self.extensions.execution.error
+        return None
+
+    @property
+    def execution_duration(self) -> float | None:
+        """Get execution duration in seconds, if available."""
+        if self.extensions and self.extensions.execution:
+            return self.extensions.execution.duration_seconds
+        return None
 
 
 class ArtifactStore(ABC):
@@ -111,6 +205,95 @@ class ArtifactStore(ABC):
         """
         ...
 
+    async def get_artifact_metadata(
+        self, run_id: str, artifact_id: str
+    ) -> ArtifactMetadata:
+        """Retrieve an artifact's header without its content.
+
+        Stores that persist the header separately override this to skip
+        reading the content; the default loads the whole artifact.
+
+        Args:
+            run_id: Unique identifier for the run.
+            artifact_id: The artifact identifier to read.
+
+        Returns:
+            The artifact's metadata.
+
+        Raises:
+            ArtifactNotFoundError: If artifact with this ID does not exist.
+
+        """
+        message = await self.get_artifact(run_id, artifact_id)
+        return ArtifactMetadata.from_message(message)
+
+    async def get_artifact_without_items(
+        self, run_id: str, artifact_id: str
+    ) -> Message:
+        """Retrieve an artifact with its item list left empty.
+
+        Pairs with ``iter_artifact_items`` for consumers that write an
+        artifact out item by item: the item list keeps its place in the
+        content but is empty. Stores that keep items apart from the header
+        override this to skip reading them; the default loads the whole
+        artifact.
+
+        Args:
+            run_id: Unique identifier for the run.
+            artifact_id: The artifact identifier to read.
+
+        Returns:
+            The artifact message with an empty item list, if it has one.
+
+        Raises:
+            ArtifactNotFoundError: If artifact with this ID does not exist.
+
+        """
+        message = await self.get_artifact(run_id, artifact_id)
+        field = artifact_items_field(message.content)
+        if field is None:
+            return message
+        return replace(message, content={**message.content, field: []})
+
+    async def iter_artifact_items(
+        self,
+        run_id: str,
+        artifact_id: str,
+        *,
+        start: int = 0,
+        stop: int | None = None,
+    ) -> AsyncIterator[Any]:
+        """Iterate a slice of an artifact's item list.
+
+        The item list is the first of ``ARTIFACT_ITEM_FIELDS`` present in the
+        content. Stores that split content into chunks override this to read
+        only the chunks overlapping the slice; the default loads the whole
+        artifact.
+
+        This serves readers of the store, such as exporters. Processors
+        (analysers and classifiers) still receive each input as a whole
+        ``Message`` from the executor and do not read through this iterator.
+
+        Args:
+            run_id: Unique identifier for the run.
+            artifact_id: The artifact identifier to read.
+            start: Index of the first item to yield.
+            stop: Index after the last item to yield (None for the end).
+
+        Yields:
+            Items in stored order. Nothing if the artifact has no item list.
+
+        Raises:
+            ArtifactNotFoundError: If artifact with this ID does not exist.
+
+        """
+        message = await self.get_artifact(run_id, artifact_id)
+        field = artifact_items_field(message.content)
+        if field is None:
+            return
+        for item in cast(list[Any], message.content[field])[start:stop]:
+            yield item
+
     @abstractmethod
     async def clear_artifacts(self, run_id: str) -> None:
         """Remove all artifacts for a run.
@@ -136,7 +319,8 @@ class ArtifactStore(ABC):
         Uses upsert semantics — overwrites if the key already exists.
 
         Well-known keys: ``"metadata"`` (run metadata), ``"state"``
-        (execution state), ``"plan"`` (execution plan).
+        (execution state), ``"plan"`` (execution plan), ``"metrics"``
+        (operational metrics of the run's latest execution).
 
         Args:
             run_id: Unique identifier for the run.
@@ -227,6 +411,19 @@ class ArtifactStore(ABC):
         """
         ...
 
+    @abstractmethod
+    async def delete_batch_job(self, run_id: str, batch_id: str) -> None:
+        """Stop tracking a batch job, e.g. one whose results are no longer needed.
+
+        No-op if the batch job does not exist.
+
+        Args:
+            run_id: Unique identifier for the run.
+            batch_id: The provider's batch identifier.
+
+        """
+        ...
+
     # ========================================================================
     # Prepared State Operations
     # ========================================================================
@@ -293,6 +490,34 @@ class ArtifactStore(ABC):
         """
         ...
 
+    # ========================================================================
+    # Durability
+    # ========================================================================
+
+    async def flush(self) -> None:
+        """Make every write accepted so far durable.
+
+        Stores that buffer writes (see ``LocalFilesystemStore`` with
+        ``write_behind``) commit them here. ``save_system_data`` is a
+        durability point: implementations flush before persisting system
+        data, so saved execution state never refers to unwritten artifacts.
+
+        The default implementation writes through and has nothing to flush.
+        """
+        return
+
+    # ========================================================================
+    # Instrumentation
+    # ========================================================================
+
+    def attach_metrics(self, metrics: MetricsRegistry) -> None:
+        """Record the latency of storage operations in ``metrics``.
+
+        The default implementation records nothing: only stores whose
+        operations involve I/O (see ``LocalFilesystemStore``) measure them.
+        """
+        return
+
     # ========================================================================
     # Run Enumeration
     # ========================================================================
@@ -306,3 +531,49 @@ class ArtifactStore(ABC):
 
         """
         ...
+
+    async def list_run_metadata(self) -> dict[str, dict[str, JsonValue]]:
+        """Return the ``"metadata"`` system data of every run that has it.
+
+        Listing commands and retention need every run's metadata. The default
+        loads it run by run; stores may serve it from an index instead.
+
+        Returns:
+            Mapping of run ID to its metadata. Runs without metadata are
+            omitted.
+
+        """
+        result: dict[str, dict[str, JsonValue]] = {}
+        for run_id in await self.list_runs():
+            if await self.system_data_exists(run_id, "metadata"):
+                result[run_id] = await self.load_system_data(run_id, "metadata")
+        return result
+
+    # ========================================================================
+    # Retention
+    # ========================================================================
+
+    @abstractmethod
+    async def delete_run(self, run_id: str) -> None:
+        """Delete everything stored for a run.
+
+        Removes artifacts, system data, LLM cache entries, batch jobs and
+        prepared state. No-op if the run does not exist.
+
+        Args:
+            run_id: Unique identifier for the run.
+
+        """
+        ...
+
+    async def collect_garbage(self) -> int:
+        """Remove shared data that no remaining run references.
+
+        Call after ``delete_run`` to reclaim storage shared between runs
+        (e.g. content-addressed blobs). The default has nothing to collect.
+
+        Returns:
+            Number of items removed.
+
+        """
+        return 0
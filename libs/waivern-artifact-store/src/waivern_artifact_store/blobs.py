@@ -0,0 +1,276 @@
+"""Content-addressed storage for large string values.
+
+Repository scans persist the same file contents several times per run: in
+the connector's ``standard_input`` artifact, in ``source_code`` artifacts
+(``raw_content``) and in LLM cache entries whose prompts embed the file.
+
+This module moves long strings out of stored JSON into compressed blobs
+keyed by the SHA-256 of their text. Each distinct string is written once
+per store, however many artifacts (or runs) contain it. Stored JSON holds a
+reference in its place::
+
+    {"$blob": "3f2a...e9"}
+
+Blob files live under ``{root}/{digest[:2]}/{digest}.z`` and contain the
+zlib-compressed UTF-8 text.
+"""
+
+from __future__ import annotations
+
+import hashlib
+import os
+import re
+import zlib
+from collections.abc import Iterable, Iterator, Mapping, Set
+from pathlib import Path
+from typing import Any, cast
+
+import aiofiles
+
+from waivern_artifact_store.errors import ArtifactStoreError
+from waivern_artifact_store.write_buffer import temporary_path
+
+BLOB_REF_KEY = "$blob"
+
+_DIGEST_PATTERN = re.compile(r"[0-9a-f]{64}")
+
+# Lone surrogates can appear in decoded JSON strings; keep them round-trippable
+_TEXT_ERRORS = "surrogatepass"
+
+
+def blob_digest(text: str) -> str:
+    """Return the content address of a string.
+
+    Args:
+        text: String value to address.
+
+    Returns:
+        Hex SHA-256 digest of the UTF-8 encoded text.
+
+    """
+    return hashlib.sha256(text.encode("utf-8", _TEXT_ERRORS)).hexdigest()
+
+
+def extract_blobs(value: Any, min_length: int) -> tuple[Any, dict[str, str]]:  # noqa: ANN401 - walks arbitrary JSON
+    """Replace strings of at least ``min_length`` characters with references.
+
+    The input is not modified; containers on the path to a replaced string
+    are copied.
+
+    Args:
+        value: JSON value (typically artifact content or a cache entry).
+        min_length: Shortest string length moved into a blob.
+
+    Returns:
+        Tuple of (value with references, mapping of digest to text).
+
+    """
+    found: dict[str, str] = {}
+
+    def walk(node: Any) -> Any:  # noqa: ANN401
+        if isinstance(node, str):
+            if len(node) < min_length:
+                return node
+            digest = blob_digest(node)
+            found[digest] = node
+            return {BLOB_REF_KEY: digest}
+        if isinstance(node, dict):
+            items = cast(dict[str, Any], node).items()
+            return {key: walk(item) for key, item in items}
+        if isinstance(node, list):
+            return [walk(item) for item in cast(list[Any], node)]
+        return node
+
+    return walk(value), found
+
+
+def iter_blob_refs(value: Any) -> Iterator[str]:  # noqa: ANN401 - walks arbitrary JSON
+    """Yield the digest of every blob reference in a JSON value.
+
+    Args:
+        value: JSON value read from storage.
+
+    Yields:
+        Referenced digests (duplicates included).
+
+    """
+    if isinstance(value, dict):
+        node = cast(dict[str, Any], value)
+        digest = _ref_digest(node)
+        if digest is not None:
+            yield digest
+            return
+        for item in node.values():
+            yield from iter_blob_refs(item)
+    elif isinstance(value, list):
+        for item in cast(list[Any], value):
+            yield from iter_blob_refs(item)
+
+
+def resolve_blobs(value: Any, texts: Mapping[str, str]) -> Any:  # noqa: ANN401 - walks arbitrary JSON
+    """Replace blob references with their text, in place where possible.
+
+    Args:
+        value: JSON value read from storage (mutated).
+        texts: Mapping of digest to text covering every reference in value.
+
+    Returns:
+        The value with references resolved (a string if value was a reference).
+
+    """
+    if isinstance(value, dict):
+        node = cast(dict[str, Any], value)
+        digest = _ref_digest(node)
+        if digest is not None:
+            return texts[digest]
+        for key, item in node.items():
+            node[key] = resolve_blobs(item, texts)
+    elif isinstance(value, list):
+        items = cast(list[Any], value)
+        for index, item in enumerate(items):
+            items[index] = resolve_blobs(item, texts)
+    return value
+
+
+def _ref_digest(node: dict[str, Any]) -> str | None:
+    """Return the digest if ``node`` is a blob reference."""
+    if len(node) != 1:
+        return None
+    digest = node.get(BLOB_REF_KEY)
+    if isinstance(digest, str) and _DIGEST_PATTERN.fullmatch(digest):
+        return digest
+    return None
+
+
+class FilesystemBlobStore:
+    """Compressed, content-addressed blobs in a directory tree.
+
+    Blobs are immutable: a digest already on disk is never rewritten, so
+    repeated saves of the same content cost an ``exists`` check and a touch.
+    """
+
+    def __init__(self, root: Path, *, compression_level: int = 6) -> None:
+        """Initialise blob store.
+
+        Args:
+            root: Directory holding blob files.
+            compression_level: zlib compression level (0-9).
+
+        """
+        self._root = root
+        self._compression_level = compression_level
+
+    @property
+    def root(self) -> Path:
+        """Directory holding blob files."""
+        return self._root
+
+    def path_for(self, digest: str) -> Path:
+        """Return the file path of a blob.
+
+        Raises:
+            ArtifactStoreError: If the digest is not a SHA-256 hex digest.
+
+        """
+        if not _DIGEST_PATTERN.fullmatch(digest):
+            raise ArtifactStoreError(f"Invalid blob digest '{digest}'.")
+        return self._root / digest[:2] / f"{digest}.z"
+
+    async def put_many(self, blobs: Mapping[str, str]) -> None:
+        """Write blobs that are not stored yet.
+
+        Each blob is written to a temporary file of its own and renamed into
+        place, so a crash never leaves a truncated blob under its final name
+        and concurrent saves of the same new blob do not interfere.
+
+        Args:
+            blobs: Mapping of digest to text (from ``extract_blobs``).
+
+        """
+        for digest, text in blobs.items():
+            path = self.path_for(digest)
+            if path.exists():
+                # Refresh the mtime so garbage collection sees the blob in use
+                os.utime(path)
+                continue
+            path.parent.mkdir(parents=True, exist_ok=True)
+            data = zlib.compress(
+                text.encode("utf-8", _TEXT_ERRORS), self._compression_level
+            )
+            temporary = temporary_path(path)
+            try:
+                async with aiofiles.open(temporary, "wb") as f:
+                    await f.write(data)
+                # Otherwise a concurrent save has written the same content
+                if not path.exists():
+                    temporary.replace(path)
+            finally:
+                temporary.unlink(missing_ok=True)
+
+    def remove_unreferenced(self, referenced: Set[str], *, older_than: float) -> int:
+        """Delete blobs outside ``referenced`` last modified before a cutoff.
+
+        Blobs are written before the files that reference them, so recent
+        blobs may belong to a save still in progress; the cutoff keeps them.
+        Leftover ``.partial`` files from interrupted writes are removed too.
+
+        Args:
+            referenced: Digests still referenced by stored files.
+            older_than: POSIX timestamp; files modified later are kept.
+
+        Returns:
+            Number of files removed.
+
+        """
+        if not self._root.exists():
+            return 0
+        removed = 0
+        for path in self._root.glob("*/*"):
+            if path.suffix == ".z" and path.stem in referenced:
+                continue
+            if path.stat().st_mtime >= older_than:
+                continue
+            path.unlink(missing_ok=True)
+            removed += 1
+        for directory in self._root.iterdir():
+            if directory.is_dir() and not any(directory.iterdir()):
+                directory.rmdir()
+        return removed
+
+    async def get_many(self, digests: Iterable[str]) -> dict[str, str]:
+        """Read and decompress blobs.
+
+        Args:
+            digests: Digests to read (duplicates are read once).
+
+        Returns:
+            Mapping of digest to text.
+
+        Raises:
+            ArtifactStoreError: If a referenced blob is missing.
+
+        """
+        texts: dict[str, str] = {}
+        for digest in digests:
+            if digest in texts:
+                continue
+            path = self.path_for(digest)
+            if not path.exists():
+                raise ArtifactStoreError(f"Blob '{digest}' is missing from the store.")
+            async with aiofiles.open(path, "rb") as f:
+                data = await f.read()
+            texts[digest] = zlib.decompress(data).decode("utf-8", _TEXT_ERRORS)
+        return texts
+
+    async def resolve(self, value: Any) -> Any:  # noqa: ANN401 - walks arbitrary JSON
+        """Resolve every blob reference in a JSON value read from storage.
+
+        Args:
+            value: JSON value (mutated in place).
+
+        Returns:
+            The value with references replaced by their text.
+
+        """
+        texts = await self.get_many(iter_blob_refs(value))
+        return resolve_blobs(value, texts) if texts else value
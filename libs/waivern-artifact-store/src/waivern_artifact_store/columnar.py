@@ -0,0 +1,228 @@
+"""Columnar encoding for finding-heavy artifact content.
+
+Findings artifacts (``*_indicator``, ``gdpr_*``, ...) are long lists of
+nested dicts that repeat the same keys, categories, sources and patterns in
+every row. Row-oriented JSON stores each key and value once per finding.
+
+This module encodes such a list column by column:
+
+- Nested dicts are flattened into one column per key path
+  (``("metadata", "source")``); lists and empty dicts stay leaf values.
+- Each column is dictionary-encoded when it repeats values: distinct values
+  are stored once and rows hold integer codes.
+- Keys absent from a row are recorded per column, so decoding reproduces
+  every row exactly.
+
+Encoded form::
+
+    {
+        "format": "columnar/1",
+        "rows": 3,
+        "columns": [
+            {"path": ["category"], "dict": ["email", "phone"], "codes": [0, 1, 0]},
+            {"path": ["confidence"], "values": [0.9, 0.7, 0.8]},
+            {"path": ["metadata", "line"], "values": [1, 2, null], "absent": [2]},
+        ],
+    }
+
+The encoding is plain JSON, so encoded artifacts stay inspectable and need no
+extra dependencies.
+"""
+
+from __future__ import annotations
+
+import copy
+import json
+from collections.abc import Iterator, Sequence
+from typing import Any, cast
+
+from waivern_core import JsonValue
+
+COLUMNAR_FORMAT = "columnar/1"
+
+# Columns with at most this share of distinct values are dictionary-encoded
+_DICTIONARY_MAX_DISTINCT_RATIO = 0.5
+
+_ABSENT_CODE = -1
+
+
+def is_columnar(value: object) -> bool:
+    """Check whether a value is a columnar-encoded row list.
+
+    Args:
+        value: Any JSON value read from storage.
+
+    Returns:
+        True if the value was produced by ``encode_rows``.
+
+    """
+    return (
+        isinstance(value, dict)
+        and cast(dict[str, object], value).get("format") == COLUMNAR_FORMAT
+    )
+
+
+def can_encode(rows: object) -> bool:
+    """Check whether a value is a non-empty list of dicts with string keys.
+
+    Args:
+        rows: Candidate value (typically ``content["findings"]``).
+
+    Returns:
+        True if ``encode_rows`` can losslessly encode the value.
+
+    """
+    if not isinstance(rows, list) or not rows:
+        return False
+    return all(isinstance(row, dict) for row in cast(list[object], rows))
+
+
+def encode_rows(rows: Sequence[dict[str, Any]]) -> dict[str, JsonValue]:
+    """Encode a list of (nested) dicts into columnar form.
+
+    Args:
+        rows: Rows sharing a mostly common structure, e.g. findings.
+
+    Returns:
+        Columnar representation (see module docstring).
+
+    """
+    # path -> (values per row index, in first-seen column order)
+    columns: dict[tuple[str, ...], dict[int, Any]] = {}
+    for index, row in enumerate(rows):
+        for path, value in _flatten(row, ()):
+            columns.setdefault(path, {})[index] = value
+
+    encoded: list[JsonValue] = []
+    for path, values_by_row in columns.items():
+        encoded.append(_encode_column(path, values_by_row, len(rows)))
+
+    return {"format": COLUMNAR_FORMAT, "rows": len(rows), "columns": encoded}
+
+
+def iter_rows(encoded: dict[str, Any]) -> Iterator[dict[str, Any]]:
+    """Decode columnar form back into rows, one row at a time.
+
+    Only the column data is held in memory; each row dict is built on demand.
+
+    Args:
+        encoded: Value produced by ``encode_rows``.
+
+    Yields:
+        Row dicts equal to the originally encoded rows.
+
+    Raises:
+        ValueError: If the value is not in a supported columnar format.
+
+    """
+    if not is_columnar(encoded):
+        raise ValueError(f"Unsupported columnar format: {encoded.get('format')!r}")
+
+    readers = [_ColumnReader(column) for column in encoded["columns"]]
+    for index in range(encoded["rows"]):
+        row: dict[str, Any] = {}
+        for reader in readers:
+            present, value = reader.value_at(index)
+            if present:
+                _assign(row, reader.path, value)
+        yield row
+
+
+def decode_rows(encoded: dict[str, Any]) -> list[dict[str, Any]]:
+    """Decode columnar form back into a list of rows.
+
+    Args:
+        encoded: Value produced by ``encode_rows``.
+
+    Returns:
+        Rows equal to the originally encoded rows.
+
+    """
+    return list(iter_rows(encoded))
+
+
+def _flatten(
+    value: dict[str, Any], prefix: tuple[str, ...]
+) -> Iterator[tuple[tuple[str, ...], Any]]:
+    """Yield ``(path, leaf)`` pairs; non-empty dicts are descended into."""
+    for key, item in value.items():
+        path = (*prefix, key)
+        if isinstance(item, dict) and item:
+            yield from _flatten(cast(dict[str, Any], item), path)
+        else:
+            yield path, item
+
+
+def _assign(row: dict[str, Any], path: list[str], value: object) -> None:
+    """Set ``value`` at ``path`` in ``row``, creating intermediate dicts."""
+    target = row
+    for key in path[:-1]:
+        target = target.setdefault(key, {})
+    target[path[-1]] = value
+
+
+def _dictionary_key(value: object) -> object:
+    """Hashable identity for a leaf value (lists/dicts compared by JSON)."""
+    if isinstance(value, list | dict):
+        return ("json", json.dumps(value, sort_keys=True, default=str))
+    # Keep 1, 1.0 and True distinct so decoding preserves JSON types
+    return (type(value).__name__, value)
+
+
+def _encode_column(
+    path: tuple[str, ...], values_by_row: dict[int, Any], row_count: int
+) -> dict[str, JsonValue]:
+    """Encode one column, choosing dictionary or plain encoding."""
+    distinct: dict[object, int] = {}
+    dictionary: list[JsonValue] = []
+    for value in values_by_row.values():
+        key = _dictionary_key(value)
+        if key not in distinct:
+            distinct[key] = len(dictionary)
+            dictionary.append(value)
+
+    column: dict[str, JsonValue] = {"path": list(path)}
+    if len(dictionary) <= max(1, len(values_by_row) * _DICTIONARY_MAX_DISTINCT_RATIO):
+        codes: list[JsonValue] = []
+        for index in range(row_count):
+            if index in values_by_row:
+                codes.append(distinct[_dictionary_key(values_by_row[index])])
+            else:
+                codes.append(_ABSENT_CODE)
+        column["dict"] = dictionary
+        column["codes"] = codes
+        return column
+
+    column["values"] = [values_by_row.get(index) for index in range(row_count)]
+    if len(values_by_row) < row_count:
+        column["absent"] = [i for i in range(row_count) if i not in values_by_row]
+    return column
+
+
+class _ColumnReader:
+    """Random access over one encoded column."""
+
+    __slots__ = ("_absent", "_codes", "_dictionary", "_values", "path")
+
+    def __init__(self, column: dict[str, Any]) -> None:
+        self.path: list[str] = column["path"]
+        self._dictionary: list[Any] | None = column.get("dict")
+        self._codes: list[int] = column.get("codes", [])
+        self._values: list[Any] = column.get("values", [])
+        self._absent: frozenset[int] = frozenset(column.get("absent", ()))
+
+    def value_at(self, index: int) -> tuple[bool, object]:
+        """Return ``(present, value)`` for a row index."""
+        if self._dictionary is not None:
+            code = self._codes[index]
+            if code == _ABSENT_CODE:
+                return False, None
+            value = self._dictionary[code]
+            # Dictionary entries are shared across rows; give each row its own
+            if isinstance(value, list | dict):
+                return True, copy.deepcopy(value)
+            return True, value
+
+        if index in self._absent:
+            return False, None
+        return True, self._values[index]
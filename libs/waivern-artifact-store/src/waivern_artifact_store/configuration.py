@@ -44,10 +44,22 @@ class FilesystemStoreConfig(BaseModel):
 
     type: Literal["filesystem"] = "filesystem"
     base_path: Path = Path(".waivern")
+    columnar_findings: bool = False
+    chunk_size: int | None = Field(default=None, ge=1)
+    blob_threshold: int | None = Field(default=None, ge=1)
+    write_behind: bool = False
+    fsync: bool = False
 
     def create_store(self) -> ArtifactStore:
         """Create a filesystem-backed artifact store."""
-        return LocalFilesystemStore(base_path=self.base_path)
+        return LocalFilesystemStore(
+            base_path=self.base_path,
+            columnar_findings=self.columnar_findings,
+            chunk_size=self.chunk_size,
+            blob_threshold=self.blob_threshold,
+            write_behind=self.write_behind,
+            fsync=self.fsync,
+        )
 
 
 class RemoteStoreConfig(BaseModel):
@@ -116,6 +128,16 @@ class ArtifactStoreConfiguration(RootModel[_ArtifactStoreConfigUnion]):
         Environment variables used:
         - WAIVERN_STORE_TYPE: Store type (memory, filesystem, remote). Default: memory
         - WAIVERN_STORE_PATH: Base path for filesystem store. Default: .waivern
+        - WAIVERN_STORE_COLUMNAR_FINDINGS: Store findings in columnar form
+          (filesystem store). Default: false
+        - WAIVERN_STORE_CHUNK_SIZE: Items per chunk file for artifact item
+          lists (filesystem store). Default: unset (single file per artifact)
+        - WAIVERN_STORE_BLOB_THRESHOLD: Minimum string length stored once as a
+          compressed blob (filesystem store). Default: unset (strings inline)
+        - WAIVERN_STORE_WRITE_BEHIND: Buffer writes and commit them in groups
+          at durability points (filesystem store). Default: false
+        - WAIVERN_STORE_FSYNC: fsync committed files (filesystem store).
+          Default: false
         - WAIVERN_STORE_URL: Endpoint URL for remote store
         - WAIVERN_STORE_API_KEY: API key for remote store
 
@@ -137,11 +159,9 @@ class ArtifactStoreConfiguration(RootModel[_ArtifactStoreConfigUnion]):
 
         store_type = config_data["type"]
 
-        # Filesystem-specific: base_path
-        if store_type == "filesystem" and "base_path" not in config_data:
-            base_path = os.getenv("WAIVERN_STORE_PATH")
-            if base_path:
-                config_data["base_path"] = base_path
+        # Filesystem-specific: base_path and storage layout options
+        if store_type == "filesystem":
+            _apply_filesystem_environment(config_data)
 
         # Remote-specific: endpoint_url and api_key
         if store_type == "remote":
@@ -167,3 +187,36 @@ class ArtifactStoreConfiguration(RootModel[_ArtifactStoreConfigUnion]):
 
         """
         return self.root.create_store()
+
+
+# Filesystem options that fall back to boolean environment variables
+_FILESYSTEM_BOOL_ENV_VARS = {
+    "columnar_findings": "WAIVERN_STORE_COLUMNAR_FINDINGS",
+    "write_behind": "WAIVERN_STORE_WRITE_BEHIND",
+    "fsync": "WAIVERN_STORE_FSYNC",
+}
+
+# Filesystem layout options that fall back to integer environment variables
+_FILESYSTEM_INT_ENV_VARS = {
+    "chunk_size": "WAIVERN_STORE_CHUNK_SIZE",
+    "blob_threshold": "WAIVERN_STORE_BLOB_THRESHOLD",
+}
+
+
+def _apply_filesystem_environment(config_data: dict[str, Any]) -> None:
+    """Fill unset filesystem store options from environment variables."""
+    if "base_path" not in config_data:
+        base_path = os.getenv("WAIVERN_STORE_PATH")
+        if base_path:
+            config_data["base_path"] = base_path
+
+    for option, env_var in _FILESYSTEM_BOOL_ENV_VARS.items():
+        if option not in config_data:
+            value = os.getenv(env_var, "")
+            config_data[option] = value.lower() in ("true", "1", "yes")
+
+    for option, env_var in _FILESYSTEM_INT_ENV_VARS.items():
+        if option not in config_data:
+            value = os.getenv(env_var)
+            if value:
+                config_data[option] = value
@@ -9,6 +9,7 @@ from __future__ import annotations
 import logging
 
 from waivern_core.errors import ServiceConfigError
+from waivern_core.metrics import MetricsRegistry
 
 from waivern_artifact_store.base import ArtifactStore
 from waivern_artifact_store.configuration import ArtifactStoreConfiguration
@@ -52,15 +53,23 @@ class ArtifactStoreFactory:
 
     """
 
-    def __init__(self, config: ArtifactStoreConfiguration | None = None) -> None:
+    def __init__(
+        self,
+        config: ArtifactStoreConfiguration | None = None,
+        *,
+        metrics: MetricsRegistry | None = None,
+    ) -> None:
         """Initialize factory with optional configuration.
 
         Args:
             config: Optional explicit configuration. If None, will attempt
                    to create configuration from environment variables.
+            metrics: Registry the created store records operation
+                   latencies in, if any.
 
         """
         self._config = config
+        self._metrics = metrics
 
     def _get_config(self) -> ArtifactStoreConfiguration | None:
         """Get configuration, either from constructor or environment.
@@ -110,6 +119,8 @@ class ArtifactStoreFactory:
 
         try:
             store = config.create_store()
+            if self._metrics is not None:
+                store.attach_metrics(self._metrics)
             logger.info(f"Created artifact store: {type(store).__name__}")
             return store
         except NotImplementedError as e:
@@ -4,13 +4,20 @@ Maps artifact IDs and system metadata to filesystem paths under
 `.waivern/runs/{run_id}/`. Uses aiofiles for async I/O operations.
 
 Storage structure:
+    {base_path}/run_index.json        # cached run metadata (list_run_metadata)
+    {base_path}/blobs/                # only with blob_threshold set
+        └── {digest[:2]}/{digest}.z   # shared by all runs
     {base_path}/runs/{run_id}/
         ├── _system/
         │   ├── run.json          # RunMetadata
         │   └── state.json        # ExecutionState
         ├── artifacts/
-        │   ├── {artifact_id}.json
+        │   ├── {artifact_id}.json    # findings optionally columnar-encoded
         │   └── ...
+        ├── artifact_chunks/          # only with chunk_size set
+        │   └── {artifact_id}/
+        │       ├── {version}-00000.json  # items [0, chunk_size)
+        │       └── ...
         ├── llm_cache/
         │   ├── {cache_key}.json
         │   └── ...
@@ -21,16 +28,40 @@ Storage structure:
 
 from __future__ import annotations
 
+import asyncio
+import contextlib
 import json
+import shutil
+import time
+import uuid
+from collections.abc import AsyncIterator, Iterable, Iterator
+from itertools import islice
 from pathlib import Path
-from typing import cast, override
+from typing import Any, cast, override
 
 import aiofiles
 from waivern_core import JsonValue
 from waivern_core.message import Message
-
-from waivern_artifact_store.base import ArtifactStore
+from waivern_core.metrics import Histogram, MetricsRegistry
+
+from waivern_artifact_store import columnar
+from waivern_artifact_store.base import (
+    ArtifactMetadata,
+    ArtifactStore,
+    artifact_items_field,
+)
+from waivern_artifact_store.blobs import (
+    BLOB_REF_KEY,
+    FilesystemBlobStore,
+    extract_blobs,
+    iter_blob_refs,
+)
 from waivern_artifact_store.errors import ArtifactNotFoundError, ArtifactStoreError
+from waivern_artifact_store.write_buffer import (
+    WriteBehindBuffer,
+    temporary_path,
+    write_files,
+)
 
 
 class LocalFilesystemStore(ArtifactStore):
@@ -39,6 +70,32 @@ class LocalFilesystemStore(ArtifactStore):
     Stateless singleton that stores artifacts on the local filesystem.
     Artifacts are stored in 'artifacts/' subdirectory, system metadata
     in '_system/' subdirectory.
+
+    With ``columnar_findings`` enabled, an artifact's ``content["findings"]``
+    list is stored column by column with dictionary-encoded values (see
+    ``waivern_artifact_store.columnar``) and the file is written without
+    indentation. Reads decode transparently, so either layout can be read
+    regardless of the setting.
+
+    With ``chunk_size`` set, an artifact's item list (``findings`` or
+    ``data``) is split into files of ``chunk_size`` items under
+    ``artifact_chunks/`` and ``artifacts/{artifact_id}.json`` keeps only the
+    header and the remaining (small) content. Metadata reads and item slices
+    then touch only the files they need. Both layouts are always readable.
+
+    With ``blob_threshold`` set, strings of at least that many characters in
+    artifact content and LLM cache entries are stored once, compressed, in
+    the store-wide ``blobs/`` directory (see ``waivern_artifact_store.blobs``)
+    and resolved transparently on read.
+
+    With ``write_behind`` enabled, artifact, chunk, LLM cache and prepared
+    state files are buffered in memory and written as a group by one worker
+    thread (see ``waivern_artifact_store.write_buffer``). Buffered writes
+    are visible to reads immediately. ``flush()`` commits them, and so does
+    every ``save_system_data`` and ``save_batch_job`` call before writing
+    through: execution state is only persisted once everything it refers to
+    is on disk, which keeps crash-resume safe. With ``fsync`` enabled,
+    committed files and their directories are also flushed to stable storage.
     """
 
     # Internal storage prefixes
@@ -47,27 +104,108 @@ class LocalFilesystemStore(ArtifactStore):
     _LLM_CACHE_PREFIX = "llm_cache"
     _BATCH_JOBS_PREFIX = "batch_jobs"
     _PREPARED_PREFIX = "prepared"
+    _CHUNKS_PREFIX = "artifact_chunks"
+
+    # Marks which content fields of a stored artifact are encoded, and how
+    _CONTENT_ENCODING_KEY = "content_encoding"
+    _FINDINGS_FIELD = "findings"
+
+    # Describes how a chunked artifact's item list is split across files
+    _CONTENT_LAYOUT_KEY = "content_layout"
+    _CHUNKED_FORMAT = "chunked/1"
+
+    # Marks stored JSON whose long strings were moved into blobs
+    _BLOBS_KEY = "content_blobs"
+    _BLOBS_FORMAT = "blob/1"
+    _BLOBS_DIR = "blobs"
+
+    # Blobs touched more recently than this may belong to a save in progress
+    _BLOB_GC_GRACE_SECONDS = 3600.0
+
+    # Cache of every run's metadata, validated against file mtimes on read
+    _RUN_INDEX_FILE = "run_index.json"
+    _RUN_INDEX_VERSION = 1
 
     # System file keys (used internally by _system_key_to_path)
     # Well-known keys: "metadata", "state", "plan"
 
-    def __init__(self, base_path: Path) -> None:
+    def __init__(  # noqa: PLR0913 - keyword-only storage options
+        self,
+        base_path: Path,
+        *,
+        columnar_findings: bool = False,
+        chunk_size: int | None = None,
+        blob_threshold: int | None = None,
+        write_behind: bool = False,
+        fsync: bool = False,
+    ) -> None:
         """Initialise filesystem store.
 
         Args:
             base_path: Root directory for storage (e.g., Path('.waivern')).
+            columnar_findings: Store findings lists in columnar form.
+            chunk_size: Items per chunk file; None stores each artifact in a
+                single file.
+            blob_threshold: Minimum string length (characters) moved into
+                compressed blobs; None keeps all strings inline.
+            write_behind: Buffer writes and commit them in groups at
+                durability points.
+            fsync: fsync written files before reporting them durable.
+
+        Raises:
+            ValueError: If chunk_size or blob_threshold is not positive.
 
         """
+        if chunk_size is not None and chunk_size < 1:
+            raise ValueError(f"chunk_size must be positive, got {chunk_size}")
+        if blob_threshold is not None and blob_threshold < 1:
+            raise ValueError(f"blob_threshold must be positive, got {blob_threshold}")
         self._base_path = base_path
+        # Anchored once, so a later working directory change (the wct server
+        # runs each runbook in its client's directory) does not move the store
+        self._root = base_path.absolute()
+        self._columnar_findings = columnar_findings
+        self._chunk_size = chunk_size
+        self._blob_threshold = blob_threshold
+        # Always available so blob references stay readable with the setting off
+        self._blobs = FilesystemBlobStore(self._root / self._BLOBS_DIR)
+        self._fsync = fsync
+        self._buffer = WriteBehindBuffer(fsync=fsync) if write_behind else None
+        self._latency: Histogram | None = None
 
     @property
     def base_path(self) -> Path:
         """The base path for storage."""
         return self._base_path
 
+    @property
+    def columnar_findings(self) -> bool:
+        """Whether findings lists are written in columnar form."""
+        return self._columnar_findings
+
+    @property
+    def chunk_size(self) -> int | None:
+        """Items per chunk file, or None if artifacts are not chunked."""
+        return self._chunk_size
+
+    @property
+    def blob_threshold(self) -> int | None:
+        """Minimum string length stored as a blob, or None if disabled."""
+        return self._blob_threshold
+
+    @property
+    def write_behind(self) -> bool:
+        """Whether writes are buffered until a durability point."""
+        return self._buffer is not None
+
+    @property
+    def fsync(self) -> bool:
+        """Whether committed files are fsync-ed."""
+        return self._fsync
+
     def _run_dir(self, run_id: str) -> Path:
         """Get the directory for a run's artifacts."""
-        return self._base_path / "runs" / run_id
+        return self._root / "runs" / run_id
 
     def _validate_key(self, key: str) -> None:
         """Validate that a key is safe for filesystem use.
@@ -107,6 +245,113 @@ class LocalFilesystemStore(ArtifactStore):
         """Convert artifact ID to prepared state storage key."""
         return f"{self._PREPARED_PREFIX}/{artifact_id}"
 
+    def _chunk_dir(self, run_id: str, artifact_id: str) -> Path:
+        """Get the directory holding an artifact's content chunks."""
+        self._validate_key(artifact_id)
+        return self._run_dir(run_id) / self._CHUNKS_PREFIX / artifact_id
+
+    def _chunk_key(self, artifact_id: str, index: int, version: str | None) -> str:
+        """Convert artifact ID, chunk version and index to chunk storage key.
+
+        Chunks written before chunk versions were recorded have none.
+        """
+        name = f"{index:05d}" if version is None else f"{version}-{index:05d}"
+        return f"{self._CHUNKS_PREFIX}/{artifact_id}/{name}"
+
+    # ========================================================================
+    # File I/O (write-behind aware)
+    # ========================================================================
+
+    async def _write_file(self, path: Path, text: str) -> None:
+        """Write a file, buffering it when write-behind is enabled."""
+        if self._buffer is not None:
+            await self._buffer.put(path, text)
+        else:
+            await self._write_through(path, text)
+
+    async def _write_through(self, path: Path, text: str) -> None:
+        """Write a file immediately (and atomically), bypassing the buffer."""
+        with self._timed("write"):
+            if self._fsync:
+                await asyncio.to_thread(write_files, {path: text}, fsync=True)
+                return
+            path.parent.mkdir(parents=True, exist_ok=True)
+            temporary = temporary_path(path)
+            try:
+                async with aiofiles.open(temporary, "w") as f:
+                    await f.write(text)
+                temporary.replace(path)
+            except BaseException:
+                temporary.unlink(missing_ok=True)
+                raise
+
+    async def _read_file(self, path: Path) -> str | None:
+        """Read a file, preferring buffered contents; None if it does not exist."""
+        if self._buffer is not None:
+            text = self._buffer.get(path)
+            if text is not None:
+                return text
+        if not path.exists():
+            return None
+        with self._timed("read"):
+            async with aiofiles.open(path) as f:
+                return await f.read()
+
+    def _file_exists(self, path: Path) -> bool:
+        """Check whether a file exists on disk or in the buffer."""
+        return path.exists() or (
+            self._buffer is not None and self._buffer.contains(path)
+        )
+
+    async def _delete_file(self, path: Path) -> None:
+        """Delete a file and drop any buffered write to it."""
+        if self._buffer is None:
+            path.unlink(missing_ok=True)
+            return
+        # Hold the lock so a commit in progress cannot recreate the file
+        async with self._buffer.lock:
+            self._buffer.discard(path)
+            path.unlink(missing_ok=True)
+
+    async def _delete_tree(self, directory: Path) -> None:
+        """Delete a directory tree and drop buffered writes inside it."""
+        if self._buffer is None:
+            if directory.exists():
+                shutil.rmtree(directory)
+            return
+        async with self._buffer.lock:
+            self._buffer.discard_under(directory)
+            if directory.exists():
+                shutil.rmtree(directory)
+
+    @override
+    async def flush(self) -> None:
+        """Commit buffered writes as one group (no-op without write-behind)."""
+        if self._buffer is not None and self._buffer.pending_count:
+            with self._timed("commit"):
+                await self._buffer.commit()
+
+    # ========================================================================
+    # Instrumentation
+    # ========================================================================
+
+    @override
+    def attach_metrics(self, metrics: MetricsRegistry) -> None:
+        """Record file read, write and group commit latencies in ``metrics``."""
+        self._latency = metrics.histogram(
+            "waivern_store_operation_duration_seconds",
+            "Latency of artifact store file operations.",
+        )
+
+    @contextlib.contextmanager
+    def _timed(self, operation: str) -> Iterator[None]:
+        """Observe the latency of ``operation`` when metrics are attached."""
+        if self._latency is None:
+            yield
+            return
+        with self._latency.time(store="filesystem", operation=operation):
+            yield
+
     # ========================================================================
     # Artifact Operations
     # ========================================================================
@@ -115,54 +360,327 @@ class LocalFilesystemStore(ArtifactStore):
     async def save_artifact(
         self, run_id: str, artifact_id: str, message: Message
     ) -> None:
-        """Store artifact by ID (in artifacts/ subdirectory)."""
+        """Store artifact by ID (in artifacts/ subdirectory).
+
+        An overwritten chunked artifact keeps its old chunks until the new
+        chunks and header are written, so a failure in between leaves the
+        previous version readable.
+        """
         key = self._artifact_key(artifact_id)
         file_path = self._key_to_path(run_id, key)
-        file_path.parent.mkdir(parents=True, exist_ok=True)
 
         data = message.to_dict()
-        async with aiofiles.open(file_path, "w") as f:
-            await f.write(json.dumps(data, indent=2, default=str))
+        data["content"] = await self._extract_blobs(data, data["content"])
+        items_field = artifact_items_field(data["content"])
+        findings = data["content"].get(self._FINDINGS_FIELD)
+        version: str | None = None
+        if self._chunk_size is not None and items_field is not None:
+            version = await self._save_chunked(
+                run_id, artifact_id, data, items_field, self._chunk_size
+            )
+            serialised = json.dumps(data, indent=2, default=str)
+        elif self._columnar_findings and columnar.can_encode(findings):
+            data["content"] = {
+                **data["content"],
+                self._FINDINGS_FIELD: columnar.encode_rows(findings),
+            }
+            data[self._CONTENT_ENCODING_KEY] = {
+                self._FINDINGS_FIELD: columnar.COLUMNAR_FORMAT
+            }
+            serialised = json.dumps(data, separators=(",", ":"), default=str)
+        else:
+            serialised = json.dumps(data, indent=2, default=str)
+
+        await self._write_file(file_path, serialised)
+        await self._remove_superseded_chunks(run_id, artifact_id, version)
+
+    async def _save_chunked(
+        self,
+        run_id: str,
+        artifact_id: str,
+        data: dict[str, Any],
+        items_field: str,
+        chunk_size: int,
+    ) -> str:
+        """Write an artifact's item list as chunk files of a new version.
+
+        Removes the item list from ``data["content"]`` and records the layout
+        in ``data``, leaving ``data`` as the header to write. Returns the
+        chunk version, which no earlier save of the artifact used.
+        """
+        content = dict(data["content"])
+        items = cast(list[Any], content.pop(items_field))
+        version = uuid.uuid4().hex[:12]
+        data["content"] = content
+        data[self._CONTENT_LAYOUT_KEY] = {
+            "format": self._CHUNKED_FORMAT,
+            "field": items_field,
+            "items": len(items),
+            "chunk_size": chunk_size,
+            "version": version,
+        }
+
+        for index, offset in enumerate(range(0, len(items), chunk_size)):
+            chunk_items = items[offset : offset + chunk_size]
+            chunk_path = self._key_to_path(
+                run_id, self._chunk_key(artifact_id, index, version)
+            )
+            if (
+                self._columnar_findings
+                and items_field == self._FINDINGS_FIELD
+                and columnar.can_encode(chunk_items)
+            ):
+                serialised = json.dumps(
+                    columnar.encode_rows(chunk_items),
+                    separators=(",", ":"),
+                    default=str,
+                )
+            else:
+                serialised = json.dumps(chunk_items, default=str)
+            await self._write_file(chunk_path, serialised)
+        return version
+
+    async def _remove_superseded_chunks(
+        self, run_id: str, artifact_id: str, version: str | None
+    ) -> None:
+        """Delete chunk files of an artifact's earlier versions.
+
+        Only files directly in the artifact's chunk directory are chunks of
+        it (artifact IDs containing ``/`` nest their own directories). When
+        writes are buffered, the new version is committed first, so the
+        header on disk never points at deleted chunks.
+        """
+        chunk_dir = self._chunk_dir(run_id, artifact_id)
+        chunk_paths = set(chunk_dir.glob("*.json")) if chunk_dir.exists() else set()
+        if self._buffer is not None:
+            chunk_paths.update(
+                path
+                for path in self._buffer.paths_under(chunk_dir)
+                if path.parent == chunk_dir
+            )
+        superseded = [
+            path
+            for path in chunk_paths
+            if version is None or not path.name.startswith(f"{version}-")
+        ]
+        if not superseded:
+            return
+        await self.flush()
+        for path in superseded:
+            await self._delete_file(path)
+
+    async def _remove_chunks(self, run_id: str, artifact_id: str) -> None:
+        """Delete an artifact's chunk directory, if any."""
+        await self._delete_tree(self._chunk_dir(run_id, artifact_id))
 
     @override
     async def get_artifact(self, run_id: str, artifact_id: str) -> Message:
         """Retrieve artifact by ID (from artifacts/ subdirectory)."""
-        key = self._artifact_key(artifact_id)
-        file_path = self._key_to_path(run_id, key)
+        data = await self._load_artifact_data(run_id, artifact_id)
+        uses_blobs = self._pop_blobs_marker(data)
+        layout = data.pop(self._CONTENT_LAYOUT_KEY, None)
+        if layout is not None:
+            data["content"][layout["field"]] = [
+                item
+                async for item in self._iter_chunked_items(run_id, artifact_id, layout)
+            ]
+        elif self._pop_columnar_marker(data):
+            data["content"][self._FINDINGS_FIELD] = columnar.decode_rows(
+                data["content"][self._FINDINGS_FIELD]
+            )
+        if uses_blobs:
+            data["content"] = await self._blobs.resolve(data["content"])
+        return Message.from_dict(data)
 
-        if not file_path.exists():
+    @override
+    async def get_artifact_metadata(
+        self, run_id: str, artifact_id: str
+    ) -> ArtifactMetadata:
+        """Read the header; cheap for chunked artifacts, whose content is apart."""
+        data = await self._load_artifact_data(run_id, artifact_id)
+        self._pop_blobs_marker(data)
+        layout = data.pop(self._CONTENT_LAYOUT_KEY, None)
+        if layout is not None:
+            item_count: int | None = layout["items"]
+        else:
+            content = data["content"]
+            items_field = artifact_items_field(content)
+            if self._pop_columnar_marker(data):
+                item_count = content[self._FINDINGS_FIELD]["rows"]
+            elif items_field is not None:
+                item_count = len(content[items_field])
+            else:
+                item_count = None
+        data["content"] = {}
+        return ArtifactMetadata.from_message(
+            Message.from_dict(data), item_count=item_count
+        )
+
+    @override
+    async def get_artifact_without_items(
+        self, run_id: str, artifact_id: str
+    ) -> Message:
+        """Read the header and inline content, leaving chunk files unread."""
+        data = await self._load_artifact_data(run_id, artifact_id)
+        uses_blobs = self._pop_blobs_marker(data)
+        layout = data.pop(self._CONTENT_LAYOUT_KEY, None)
+        content = data["content"]
+        if layout is not None:
+            # get_artifact appends reassembled items after the inline content
+            content[layout["field"]] = []
+        elif self._pop_columnar_marker(data):
+            content[self._FINDINGS_FIELD] = []
+        else:
+            items_field = artifact_items_field(content)
+            if items_field is not None:
+                content[items_field] = []
+        if uses_blobs:
+            data["content"] = await self._blobs.resolve(content)
+        return Message.from_dict(data)
+
+    @override
+    async def iter_artifact_items(
+        self,
+        run_id: str,
+        artifact_id: str,
+        *,
+        start: int = 0,
+        stop: int | None = None,
+    ) -> AsyncIterator[Any]:
+        """Iterate a slice of the item list, reading only overlapping chunks.
+
+        Chunked artifacts are read from disk one chunk file at a time, and
+        columnar findings are decoded one row at a time, so only the current
+        chunk (or the encoded columns) is held in memory.
+        """
+        data = await self._load_artifact_data(run_id, artifact_id)
+        uses_blobs = self._pop_blobs_marker(data)
+        layout = data.pop(self._CONTENT_LAYOUT_KEY, None)
+        if layout is not None:
+            async for item in self._iter_chunked_items(
+                run_id, artifact_id, layout, start=start, stop=stop
+            ):
+                yield await self._resolve_item(item, uses_blobs)
+            return
+
+        content = data["content"]
+        if self._pop_columnar_marker(data):
+            items: Iterable[Any] = columnar.iter_rows(content[self._FINDINGS_FIELD])
+        else:
+            items_field = artifact_items_field(content)
+            if items_field is None:
+                return
+            items = content[items_field]
+        for item in islice(items, start, stop):
+            yield await self._resolve_item(item, uses_blobs)
+
+    async def _iter_chunked_items(
+        self,
+        run_id: str,
+        artifact_id: str,
+        layout: dict[str, Any],
+        *,
+        start: int = 0,
+        stop: int | None = None,
+    ) -> AsyncIterator[Any]:
+        """Yield items ``[start, stop)`` of a chunked artifact, chunk by chunk."""
+        if layout.get("format") != self._CHUNKED_FORMAT:
+            raise ArtifactStoreError(
+                f"Unsupported content layout for artifact '{artifact_id}' in run "
+                f"'{run_id}': {layout.get('format')!r}"
+            )
+        chunk_size: int = layout["chunk_size"]
+        stop = layout["items"] if stop is None else min(stop, layout["items"])
+        if start >= stop:
+            return
+
+        version: str | None = layout.get("version")
+        for index in range(start // chunk_size, (stop - 1) // chunk_size + 1):
+            chunk_path = self._key_to_path(
+                run_id, self._chunk_key(artifact_id, index, version)
+            )
+            text = await self._read_file(chunk_path)
+            if text is None:
+                raise ArtifactStoreError(
+                    f"Chunk {index} of artifact '{artifact_id}' is missing in "
+                    f"run '{run_id}'."
+                )
+            chunk = json.loads(text)
+            items: Iterable[Any] = (
+                columnar.iter_rows(chunk) if columnar.is_columnar(chunk) else chunk
+            )
+
+            offset = index * chunk_size
+            for item in islice(items, max(start - offset, 0), stop - offset):
+                yield item
+
+    async def _load_artifact_data(
+        self, run_id: str, artifact_id: str
+    ) -> dict[str, Any]:
+        """Read an artifact file as stored, without decoding content."""
+        key = self._artifact_key(artifact_id)
+        content = await self._read_file(self._key_to_path(run_id, key))
+        if content is None:
             raise ArtifactNotFoundError(
                 f"Artifact '{artifact_id}' not found in run '{run_id}'."
             )
+        return json.loads(content)
 
-        async with aiofiles.open(file_path) as f:
-            content = await f.read()
-        data = json.loads(content)
-        return Message.from_dict(data)
+    async def _extract_blobs(self, data: dict[str, Any], value: Any) -> Any:  # noqa: ANN401 - walks arbitrary JSON
+        """Move long strings of ``value`` into blobs, marking ``data`` if any.
+
+        Blobs are written before the caller writes ``data``, so a stored file
+        never references a blob that is not on disk.
+        """
+        if self._blob_threshold is None:
+            return value
+        value, blobs = extract_blobs(value, self._blob_threshold)
+        if blobs:
+            await self._blobs.put_many(blobs)
+            data[self._BLOBS_KEY] = self._BLOBS_FORMAT
+        return value
+
+    def _pop_blobs_marker(self, data: dict[str, Any]) -> bool:
+        """Remove the blobs marker and report whether references need resolving."""
+        marker = data.pop(self._BLOBS_KEY, None)
+        if marker is not None and marker != self._BLOBS_FORMAT:
+            raise ArtifactStoreError(f"Unsupported blob format: {marker!r}")
+        return marker is not None
+
+    async def _resolve_item(self, item: Any, uses_blobs: bool) -> Any:  # noqa: ANN401 - walks arbitrary JSON
+        """Resolve blob references in one item if its artifact uses blobs."""
+        return await self._blobs.resolve(item) if uses_blobs else item
+
+    def _pop_columnar_marker(self, data: dict[str, Any]) -> bool:
+        """Remove the encoding marker and report whether findings are columnar."""
+        encoding = data.pop(self._CONTENT_ENCODING_KEY, None) or {}
+        return encoding.get(self._FINDINGS_FIELD) == columnar.COLUMNAR_FORMAT
 
     @override
     async def artifact_exists(self, run_id: str, artifact_id: str) -> bool:
         """Check if artifact exists."""
         key = self._artifact_key(artifact_id)
-        return self._key_to_path(run_id, key).exists()
+        return self._file_exists(self._key_to_path(run_id, key))
 
     @override
     async def delete_artifact(self, run_id: str, artifact_id: str) -> None:
         """Delete artifact by ID."""
         key = self._artifact_key(artifact_id)
-        file_path = self._key_to_path(run_id, key)
-        if file_path.exists():
-            file_path.unlink()
+        await self._delete_file(self._key_to_path(run_id, key))
+        await self._remove_chunks(run_id, artifact_id)
 
     @override
     async def list_artifacts(self, run_id: str) -> list[str]:
         """List all artifact IDs for a run (without artifacts/ prefix)."""
         artifacts_dir = self._run_dir(run_id) / self._ARTIFACTS_PREFIX
-        if not artifacts_dir.exists():
-            return []
+        file_paths: set[Path] = set()
+        if artifacts_dir.exists():
+            file_paths.update(artifacts_dir.rglob("*.json"))
+        if self._buffer is not None:
+            file_paths.update(self._buffer.paths_under(artifacts_dir))
 
         artifact_ids: list[str] = []
-        for file_path in artifacts_dir.rglob("*.json"):
+        for file_path in file_paths:
             # Convert path to artifact ID (relative to artifacts_dir, without .json)
             relative_path = file_path.relative_to(artifacts_dir)
             artifact_id = str(relative_path.with_suffix(""))
@@ -173,7 +691,13 @@ class LocalFilesystemStore(ArtifactStore):
     @override
     async def clear_artifacts(self, run_id: str) -> None:
         """Remove all artifacts for a run (preserves system metadata)."""
+        await self._delete_tree(self._run_dir(run_id) / self._CHUNKS_PREFIX)
+
         artifacts_dir = self._run_dir(run_id) / self._ARTIFACTS_PREFIX
+        if self._buffer is not None:
+            # The rest of the clear never yields, so no commit can interleave
+            async with self._buffer.lock:
+                self._buffer.discard_under(artifacts_dir)
         if not artifacts_dir.exists():
             return
 
@@ -202,12 +726,11 @@ class LocalFilesystemStore(ArtifactStore):
     async def save_system_data(
         self, run_id: str, key: str, data: dict[str, JsonValue]
     ) -> None:
-        """Persist system data to _system/{key}.json."""
-        file_path = self._system_key_path(run_id, key)
-        file_path.parent.mkdir(parents=True, exist_ok=True)
-
-        async with aiofiles.open(file_path, "w") as f:
-            await f.write(json.dumps(data, indent=2))
+        """Persist system data to _system/{key}.json (a durability point)."""
+        await self.flush()
+        await self._write_through(
+            self._system_key_path(run_id, key), json.dumps(data, indent=2)
+        )
 
     @override
     async def load_system_data(self, run_id: str, key: str) -> dict[str, JsonValue]:
@@ -241,12 +764,130 @@ class LocalFilesystemStore(ArtifactStore):
     @override
     async def list_runs(self) -> list[str]:
         """List all run IDs in the store."""
-        runs_dir = self._base_path / "runs"
+        runs_dir = self._root / "runs"
         if not runs_dir.exists():
             return []
 
         return sorted(d.name for d in runs_dir.iterdir() if d.is_dir())
 
+    @override
+    async def list_run_metadata(self) -> dict[str, dict[str, JsonValue]]:
+        """Return every run's metadata from the run index.
+
+        Each index entry records the mtime of the run's metadata file; only
+        files changed since they were indexed are read again. The index is a
+        cache checked on every call, so concurrent writers cannot make it
+        stale, and it is rewritten only when an entry changed.
+        """
+        index = await self._load_run_index()
+        entries: dict[str, dict[str, Any]] = {}
+        for run_id in await self.list_runs():
+            path = self._system_key_path(run_id, "metadata")
+            try:
+                mtime_ns = path.stat().st_mtime_ns
+            except FileNotFoundError:
+                continue
+            entry = index.get(run_id)
+            if entry is None or entry.get("mtime_ns") != mtime_ns:
+                try:
+                    metadata = await self.load_system_data(run_id, "metadata")
+                except (ArtifactStoreError, ValueError):
+                    # Deleted or half-written since the stat; skip this time
+                    continue
+                entry = {"mtime_ns": mtime_ns, "metadata": metadata}
+            entries[run_id] = entry
+
+        if entries != index:
+            await self._write_run_index(entries)
+        return {run_id: entry["metadata"] for run_id, entry in entries.items()}
+
+    async def _load_run_index(self) -> dict[str, dict[str, Any]]:
+        """Read the run index; an absent or unreadable index is empty."""
+        path = self._root / self._RUN_INDEX_FILE
+        if not path.exists():
+            return {}
+        try:
+            async with aiofiles.open(path) as f:
+                data = json.loads(await f.read())
+        except ValueError:
+            return {}
+        if not isinstance(data, dict):
+            return {}
+        data = cast(dict[str, Any], data)
+        if data.get("version") != self._RUN_INDEX_VERSION:
+            return {}
+        return cast(dict[str, dict[str, Any]], data.get("runs", {}))
+
+    async def _write_run_index(self, entries: dict[str, dict[str, Any]]) -> None:
+        """Replace the run index atomically (readers never see a partial file)."""
+        path = self._root / self._RUN_INDEX_FILE
+        path.parent.mkdir(parents=True, exist_ok=True)
+        temporary = temporary_path(path)
+        data = {"version": self._RUN_INDEX_VERSION, "runs": entries}
+        try:
+            async with aiofiles.open(temporary, "w") as f:
+                await f.write(json.dumps(data, separators=(",", ":")))
+            temporary.replace(path)
+        except BaseException:
+            temporary.unlink(missing_ok=True)
+            raise
+
+    # ========================================================================
+    # Retention
+    # ========================================================================
+
+    @override
+    async def delete_run(self, run_id: str) -> None:
+        """Delete the run directory, dropping any buffered writes to it."""
+        self._validate_key(run_id)
+        if not run_id or "/" in run_id:
+            raise ValueError(f"Invalid run ID '{run_id}'.")
+        await self._delete_tree(self._run_dir(run_id))
+
+    @override
+    async def collect_garbage(self) -> int:
+        """Delete blobs that no stored file references any more.
+
+        Scans every remaining run file for blob references, including those
+        inside columnar findings and chunks. Blobs written or reused within
+        the last hour are kept, so saves in progress in other processes are
+        not affected.
+        """
+        await self.flush()
+        referenced: set[str] = set()
+        runs_dir = self._root / "runs"
+        if runs_dir.exists():
+            for path in runs_dir.rglob("*.json"):
+                async with aiofiles.open(path) as f:
+                    text = await f.read()
+                # Most files hold no references; skip parsing them
+                if BLOB_REF_KEY in text:
+                    referenced.update(self._iter_stored_blob_refs(json.loads(text)))
+        cutoff = time.time() - self._BLOB_GC_GRACE_SECONDS
+        return self._blobs.remove_unreferenced(referenced, older_than=cutoff)
+
+    @classmethod
+    def _iter_stored_blob_refs(cls, value: Any) -> Iterator[str]:  # noqa: ANN401 - walks arbitrary JSON
+        """Yield blob digests in a stored JSON value.
+
+        Columnar encoding splits a reference into a ``[..., "$blob"]`` column
+        whose values are the digests, so columnar lists are decoded back into
+        rows before they are scanned.
+        """
+        if columnar.is_columnar(value):
+            for row in columnar.iter_rows(cast(dict[str, Any], value)):
+                yield from iter_blob_refs(row)
+        elif isinstance(value, dict):
+            node = cast(dict[str, Any], value)
+            if BLOB_REF_KEY in node:
+                yield from iter_blob_refs(node)
+            else:
+                for item in node.values():
+                    yield from cls._iter_stored_blob_refs(item)
+        elif isinstance(value, list):
+            for item in cast(list[Any], value):
+                yield from cls._iter_stored_blob_refs(item)
+
     # ========================================================================
     # Batch Job Operations
     # ========================================================================
@@ -255,12 +896,16 @@ class LocalFilesystemStore(ArtifactStore):
     async def save_batch_job(
         self, run_id: str, batch_id: str, data: dict[str, JsonValue]
     ) -> None:
-        """Store batch job data to batch_jobs/{batch_id}.json."""
-        file_path = self._key_to_path(run_id, self._batch_job_key(batch_id))
-        file_path.parent.mkdir(parents=True, exist_ok=True)
+        """Store batch job data to batch_jobs/{batch_id}.json (a durability point).
 
-        async with aiofiles.open(file_path, "w") as f:
-            await f.write(json.dumps(data, indent=2))
+        Batch jobs track requests submitted to the provider, so they are
+        written through after committing buffered cache entries.
+        """
+        await self.flush()
+        await self._write_through(
+            self._key_to_path(run_id, self._batch_job_key(batch_id)),
+            json.dumps(data, indent=2),
+        )
 
     @override
     async def load_batch_job(self, run_id: str, batch_id: str) -> dict[str, JsonValue]:
@@ -286,6 +931,13 @@ class LocalFilesystemStore(ArtifactStore):
 
         return sorted(f.stem for f in batch_dir.glob("*.json"))
 
+    @override
+    async def delete_batch_job(self, run_id: str, batch_id: str) -> None:
+        """Delete batch job data from batch_jobs/{batch_id}.json."""
+        await self._delete_file(
+            self._key_to_path(run_id, self._batch_job_key(batch_id))
+        )
+
     # ========================================================================
     # Prepared State Operations
     # ========================================================================
@@ -296,10 +948,7 @@ class LocalFilesystemStore(ArtifactStore):
     ) -> None:
         """Persist prepared state to prepared/{artifact_id}.json."""
         file_path = self._key_to_path(run_id, self._prepared_key(artifact_id))
-        file_path.parent.mkdir(parents=True, exist_ok=True)
-
-        async with aiofiles.open(file_path, "w") as f:
-            await f.write(json.dumps(data, indent=2))
+        await self._write_file(file_path, json.dumps(data, indent=2))
 
     @override
     async def load_prepared(
@@ -307,28 +956,27 @@ class LocalFilesystemStore(ArtifactStore):
     ) -> dict[str, JsonValue]:
         """Load prepared state from prepared/{artifact_id}.json."""
         file_path = self._key_to_path(run_id, self._prepared_key(artifact_id))
-
-        if not file_path.exists():
+        content = await self._read_file(file_path)
+        if content is None:
             raise ArtifactNotFoundError(
                 f"Prepared state for '{artifact_id}' not found in run '{run_id}'."
             )
-
-        async with aiofiles.open(file_path) as f:
-            content = await f.read()
         data = json.loads(content)
         return cast(dict[str, JsonValue], data)
 
     @override
     async def delete_prepared(self, run_id: str, artifact_id: str) -> None:
         """Delete prepared state for an artifact."""
-        file_path = self._key_to_path(run_id, self._prepared_key(artifact_id))
-        if file_path.exists():
-            file_path.unlink()
+        await self._delete_file(
+            self._key_to_path(run_id, self._prepared_key(artifact_id))
+        )
 
     @override
     async def prepared_exists(self, run_id: str, artifact_id: str) -> bool:
         """Check if prepared state exists for an artifact."""
-        return self._key_to_path(run_id, self._prepared_key(artifact_id)).exists()
+        return self._file_exists(
+            self._key_to_path(run_id, self._prepared_key(artifact_id))
+        )
 
     # ========================================================================
     # LLM Cache Operations
@@ -336,14 +984,12 @@ class LocalFilesystemStore(ArtifactStore):
 
     async def cache_get(self, run_id: str, key: str) -> dict[str, JsonValue] | None:
         """Retrieve a cache entry by key."""
-        file_path = self._key_to_path(run_id, self._cache_key(key))
-
-        if not file_path.exists():
+        content = await self._read_file(self._key_to_path(run_id, self._cache_key(key)))
+        if content is None:
             return None
-
-        async with aiofiles.open(file_path) as f:
-            content = await f.read()
         data = json.loads(content)
+        if self._pop_blobs_marker(data):
+            data = await self._blobs.resolve(data)
         return cast(dict[str, JsonValue], data)
 
     async def cache_set(
@@ -351,20 +997,20 @@ class LocalFilesystemStore(ArtifactStore):
     ) -> None:
         """Store a cache entry (upsert semantics)."""
         file_path = self._key_to_path(run_id, self._cache_key(key))
-        file_path.parent.mkdir(parents=True, exist_ok=True)
-
-        async with aiofiles.open(file_path, "w") as f:
-            await f.write(json.dumps(entry, indent=2))
+        marker: dict[str, Any] = {}
+        stored = await self._extract_blobs(marker, entry)
+        await self._write_file(file_path, json.dumps({**stored, **marker}, indent=2))
 
     async def cache_delete(self, run_id: str, key: str) -> None:
         """Delete a cache entry by key (no-op if not found)."""
-        file_path = self._key_to_path(run_id, self._cache_key(key))
-        if file_path.exists():
-            file_path.unlink()
+        await self._delete_file(self._key_to_path(run_id, self._cache_key(key)))
 
     async def cache_clear(self, run_id: str) -> None:
         """Delete all cache entries for a run."""
         cache_dir = self._run_dir(run_id) / self._LLM_CACHE_PREFIX
+        if self._buffer is not None:
+            async with self._buffer.lock:
+                self._buffer.discard_under(cache_dir)
         if not cache_dir.exists():
             return
 
@@ -6,6 +6,7 @@ for testing without filesystem dependencies.
 
 from __future__ import annotations
 
+from dataclasses import replace
 from typing import override
 
 from waivern_core import JsonValue
@@ -75,7 +76,9 @@ class AsyncInMemoryStore(ArtifactStore):
     async def save_artifact(
         self, run_id: str, artifact_id: str, message: Message
     ) -> None:
-        """Store artifact by ID."""
+        """Store artifact by ID, without its in-process typed model."""
+        if message.typed_content is not None:
+            message = replace(message, typed_content=None)
         self._get_artifact_storage(run_id)[artifact_id] = message
 
     @override
@@ -146,6 +149,18 @@ class AsyncInMemoryStore(ArtifactStore):
         all_run_ids = set(self._artifacts.keys()) | set(self._system_data.keys())
         return sorted(all_run_ids)
 
+    @override
+    async def delete_run(self, run_id: str) -> None:
+        """Delete everything stored for a run."""
+        for storage in (
+            self._artifacts,
+            self._system_data,
+            self._llm_cache,
+            self._batch_jobs,
+            self._prepared,
+        ):
+            storage.pop(run_id, None)
+
     # ========================================================================
     # Batch Job Operations
     # ========================================================================
@@ -172,6 +187,11 @@ class AsyncInMemoryStore(ArtifactStore):
         """List all batch job IDs for a run."""
         return sorted(self._get_batch_job_storage(run_id).keys())
 
+    @override
+    async def delete_batch_job(self, run_id: str, batch_id: str) -> None:
+        """Delete batch job data."""
+        self._get_batch_job_storage(run_id).pop(batch_id, None)
+
     # ========================================================================
     # Prepared State Operations
     # ========================================================================
@@ -0,0 +1,185 @@
+"""Write-behind buffering with group commit for file-backed stores.
+
+Writing each artifact, cache entry or prepared state as soon as it is saved
+costs an ``open``/``write``/``close`` round trip through a worker thread per
+file. Runs that dispatch thousands of LLM requests spend much of their store
+time on those hops.
+
+``WriteBehindBuffer`` keeps saved file contents in memory and commits them
+as a group: one worker thread writes every buffered file, optionally
+``fsync``-ing files and their directories before returning. Commits happen
+at explicit durability points (the owning store commits before it persists
+execution state) and whenever the buffer grows past its limits.
+
+Buffered contents stay readable through ``get`` until they are committed,
+so callers see their own writes.
+"""
+
+from __future__ import annotations
+
+import asyncio
+import os
+import uuid
+from collections.abc import Iterator
+from pathlib import Path
+
+DEFAULT_MAX_FILES = 1024
+DEFAULT_MAX_BYTES = 64 * 1024 * 1024
+
+
+class WriteBehindBuffer:
+    """In-memory buffer of pending file writes, committed in groups.
+
+    The latest write to a path wins. Not thread-safe: use from one event loop.
+    """
+
+    def __init__(
+        self,
+        *,
+        max_files: int = DEFAULT_MAX_FILES,
+        max_bytes: int = DEFAULT_MAX_BYTES,
+        fsync: bool = False,
+    ) -> None:
+        """Initialise buffer.
+
+        Args:
+            max_files: Commit automatically once this many files are pending.
+            max_bytes: Commit automatically once pending text reaches this
+                many characters.
+            fsync: Flush committed files and their directories to stable
+                storage before a commit returns.
+
+        """
+        self._max_files = max_files
+        self._max_bytes = max_bytes
+        self._fsync = fsync
+        self._pending: dict[Path, str] = {}
+        self._pending_bytes = 0
+        # Files handed to the worker thread but not yet on disk
+        self._committing: dict[Path, str] = {}
+        self._lock = asyncio.Lock()
+
+    @property
+    def lock(self) -> asyncio.Lock:
+        """Lock held while a commit is writing files.
+
+        Hold it while deleting files on disk, so a commit in progress cannot
+        recreate a file after it was deleted.
+        """
+        return self._lock
+
+    @property
+    def pending_count(self) -> int:
+        """Number of files waiting to be committed."""
+        return len(self._pending)
+
+    def get(self, path: Path) -> str | None:
+        """Return buffered contents for a path, or None if not buffered."""
+        text = self._pending.get(path)
+        if text is None:
+            text = self._committing.get(path)
+        return text
+
+    def contains(self, path: Path) -> bool:
+        """Check whether a path has buffered contents."""
+        return path in self._pending or path in self._committing
+
+    def paths_under(self, directory: Path) -> Iterator[Path]:
+        """Yield buffered paths inside a directory (recursively)."""
+        for path in {*self._pending, *self._committing}:
+            if path.is_relative_to(directory):
+                yield path
+
+    def discard(self, path: Path) -> None:
+        """Drop a pending write (call while holding ``lock``)."""
+        text = self._pending.pop(path, None)
+        if text is not None:
+            self._pending_bytes -= len(text)
+
+    def discard_under(self, directory: Path) -> None:
+        """Drop pending writes inside a directory (call while holding ``lock``)."""
+        for path in list(self._pending):
+            if path.is_relative_to(directory):
+                self.discard(path)
+
+    async def put(self, path: Path, text: str) -> None:
+        """Buffer a file write, committing if the buffer is full.
+
+        Args:
+            path: Destination file path.
+            text: Complete file contents.
+
+        """
+        self.discard(path)
+        self._pending[path] = text
+        self._pending_bytes += len(text)
+        if (
+            len(self._pending) >= self._max_files
+            or self._pending_bytes >= self._max_bytes
+        ):
+            await self.commit()
+
+    async def commit(self) -> None:
+        """Write every pending file in one worker thread (group commit)."""
+        async with self._lock:
+            if not self._pending:
+                return
+            self._committing = self._pending
+            self._pending = {}
+            self._pending_bytes = 0
+            try:
+                await asyncio.to_thread(
+                    write_files, self._committing, fsync=self._fsync
+                )
+            except BaseException:
+                # Keep unwritten contents pending (newer writes take priority)
+                self._pending = {**self._committing, **self._pending}
+                self._pending_bytes = sum(len(t) for t in self._pending.values())
+                raise
+            finally:
+                self._committing = {}
+
+
+def temporary_path(path: Path) -> Path:
+    """Return a sibling to write to before replacing ``path``.
+
+    The name is unique per call, so concurrent writes of the same path (from
+    this process or another) never write to the same temporary file.
+    """
+    return path.with_name(f"{path.name}.{os.getpid()}.{uuid.uuid4().hex}.partial")
+
+
+def write_files(files: dict[Path, str], *, fsync: bool) -> None:
+    """Write files synchronously (run in a worker thread).
+
+    Each file is written to a temporary sibling and renamed over ``path``,
+    so readers and a crash see either the old or the new contents.
+
+    Args:
+        files: Mapping of path to complete contents, written in order.
+        fsync: fsync each file, then each parent directory once.
+
+    """
+    directories: set[Path] = set()
+    for path, text in files.items():
+        path.parent.mkdir(parents=True, exist_ok=True)
+        temporary = temporary_path(path)
+        try:
+            with temporary.open("w") as f:
+                f.write(text)
+                if fsync:
+                    f.flush()
+                    os.fsync(f.fileno())
+            temporary.replace(path)
+        except BaseException:
+            temporary.unlink(missing_ok=True)
+            raise
+        directories.add(path.parent)
+
+    if fsync:
+        for directory in directories:
+            fd = os.open(directory, os.O_RDONLY)
+            try:
+                os.fsync(fd)
+            finally:
+                os.close(fd)
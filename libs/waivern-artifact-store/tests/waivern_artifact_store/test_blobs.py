@@ -0,0 +1,128 @@
+"""Tests for the content-addressed blob layer."""
+
+import asyncio
+import os
+from pathlib import Path
+
+import pytest
+
+from waivern_artifact_store.blobs import (
+    BLOB_REF_KEY,
+    FilesystemBlobStore,
+    blob_digest,
+    extract_blobs,
+    iter_blob_refs,
+    resolve_blobs,
+)
+from waivern_artifact_store.errors import ArtifactStoreError
+
+LONG_TEXT = "def main():\n    return 42\n" * 20
+
+
+class TestExtractAndResolve:
+    """Tests for the pure extract/resolve helpers."""
+
+    def test_long_strings_replaced_by_reference(self) -> None:
+        content = {"data": [{"content": LONG_TEXT, "name": "a.py"}]}
+
+        stored, blobs = extract_blobs(content, min_length=100)
+
+        digest = blob_digest(LONG_TEXT)
+        assert stored == {"data": [{"content": {BLOB_REF_KEY: digest}, "name": "a.py"}]}
+        assert blobs == {digest: LONG_TEXT}
+
+    def test_input_is_not_modified(self) -> None:
+        content = {"data": [{"content": LONG_TEXT}]}
+
+        extract_blobs(content, min_length=100)
+
+        assert content == {"data": [{"content": LONG_TEXT}]}
+
+    def test_duplicate_strings_share_one_blob(self) -> None:
+        content = {"a": LONG_TEXT, "b": [LONG_TEXT]}
+
+        stored, blobs = extract_blobs(content, min_length=100)
+
+        assert len(blobs) == 1
+        assert list(iter_blob_refs(stored)) == [blob_digest(LONG_TEXT)] * 2
+
+    def test_round_trip_restores_value(self) -> None:
+        content = {"a": LONG_TEXT, "b": [{"c": LONG_TEXT + "x"}], "d": 1}
+
+        stored, blobs = extract_blobs(content, min_length=100)
+
+        assert resolve_blobs(stored, blobs) == content
+
+    def test_dict_with_non_digest_blob_key_is_not_a_reference(self) -> None:
+        value = {BLOB_REF_KEY: "not-a-digest"}
+
+        assert list(iter_blob_refs(value)) == []
+
+
+class TestFilesystemBlobStore:
+    """Tests for blob persistence."""
+
+    async def test_put_then_get_round_trips_compressed_text(
+        self, tmp_path: Path
+    ) -> None:
+        store = FilesystemBlobStore(tmp_path)
+        digest = blob_digest(LONG_TEXT)
+
+        await store.put_many({digest: LONG_TEXT})
+
+        assert store.path_for(digest).stat().st_size < len(LONG_TEXT)
+        assert await store.get_many([digest]) == {digest: LONG_TEXT}
+
+    async def test_existing_blob_is_touched_not_rewritten(self, tmp_path: Path) -> None:
+        store = FilesystemBlobStore(tmp_path)
+        digest = blob_digest(LONG_TEXT)
+        await store.put_many({digest: LONG_TEXT})
+        path = store.path_for(digest)
+        inode = path.stat().st_ino
+        os.utime(path, (0, 0))
+
+        await store.put_many({digest: LONG_TEXT})
+
+        # Same file (no rewrite), but marked as recently used for GC
+        assert path.stat().st_ino == inode
+        assert path.stat().st_mtime > 0
+
+    async def test_concurrent_writers_of_one_new_blob_both_succeed(
+        self, tmp_path: Path
+    ) -> None:
+        store = FilesystemBlobStore(tmp_path)
+        digest = blob_digest(LONG_TEXT)
+
+        await asyncio.gather(*(store.put_many({digest: LONG_TEXT}) for _ in range(8)))
+
+        assert await store.get_many([digest]) == {digest: LONG_TEXT}
+        assert list(store.path_for(digest).parent.iterdir()) == [store.path_for(digest)]
+
+    async def test_remove_unreferenced_keeps_referenced_and_recent_blobs(
+        self, tmp_path: Path
+    ) -> None:
+        store = FilesystemBlobStore(tmp_path)
+        texts = {blob_digest(t): t for t in ("kept " * 50, "old " * 50, "new " * 50)}
+        await store.put_many(texts)
+        kept, old, new = texts
+        for digest in (kept, old):
+            os.utime(store.path_for(digest), (0, 0))
+
+        removed = store.remove_unreferenced({kept}, older_than=1.0)
+
+        assert removed == 1
+        assert not store.path_for(old).exists()
+        assert store.path_for(kept).exists()
+        assert store.path_for(new).exists()
+
+    async def test_missing_blob_raises(self, tmp_path: Path) -> None:
+        store = FilesystemBlobStore(tmp_path)
+
+        with pytest.raises(ArtifactStoreError, match="missing"):
+            await store.get_many([blob_digest("absent")])
+
+    def test_invalid_digest_rejected(self, tmp_path: Path) -> None:
+        store = FilesystemBlobStore(tmp_path)
+
+        with pytest.raises(ArtifactStoreError, match="Invalid blob digest"):
+            store.path_for("../../etc/passwd")
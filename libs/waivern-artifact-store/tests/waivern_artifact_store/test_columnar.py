@@ -0,0 +1,94 @@
+"""Tests for the columnar findings codec."""
+
+from typing import Any
+
+import pytest
+
+from waivern_artifact_store.columnar import (
+    can_encode,
+    decode_rows,
+    encode_rows,
+    is_columnar,
+    iter_rows,
+)
+
+
+def _rows() -> list[dict[str, Any]]:
+    return [
+        {
+            "category": "email",
+            "confidence": 0.9,
+            "evidence": [{"content": "a@b.c"}],
+            "metadata": {"source": "users.csv", "context": {}},
+        },
+        {
+            "category": "phone",
+            "confidence": 0.7,
+            "evidence": [{"content": "0123"}],
+            "metadata": None,
+        },
+        {
+            "category": "email",
+            "confidence": 0.8,
+            "evidence": [{"content": "a@b.c"}],
+            "metadata": {"source": "users.csv", "line": 3},
+            "flag": True,
+        },
+    ]
+
+
+class TestColumnarCodec:
+    """Round-trip and layout tests for encode_rows/decode_rows."""
+
+    def test_round_trip_preserves_rows(self) -> None:
+        rows = _rows()
+
+        assert decode_rows(encode_rows(rows)) == rows
+
+    def test_iter_rows_yields_rows_in_order(self) -> None:
+        rows = _rows()
+
+        assert list(iter_rows(encode_rows(rows))) == rows
+
+    def test_repeated_values_are_dictionary_encoded(self) -> None:
+        rows = [{"category": "email" if i % 2 else "phone"} for i in range(10)]
+
+        encoded = encode_rows(rows)
+
+        (column,) = encoded["columns"]  # type: ignore[misc]
+        assert column["dict"] == ["phone", "email"]  # type: ignore[index]
+        assert len(column["codes"]) == 10  # type: ignore[index]
+
+    def test_json_types_are_preserved(self) -> None:
+        rows: list[dict[str, Any]] = [{"v": 1}, {"v": 1.0}, {"v": True}, {"v": 1}]
+
+        decoded = decode_rows(encode_rows(rows))
+
+        assert [type(row["v"]) for row in decoded] == [int, float, bool, int]
+
+    def test_decoded_rows_do_not_share_nested_values(self) -> None:
+        rows = [{"patterns": ["@"]} for _ in range(4)]
+
+        decoded = decode_rows(encode_rows(rows))
+        decoded[0]["patterns"].append("x")
+
+        assert decoded[1]["patterns"] == ["@"]
+
+    def test_empty_rows_and_empty_dicts_round_trip(self) -> None:
+        rows: list[dict[str, Any]] = [{}, {"context": {}}]
+
+        assert decode_rows(encode_rows(rows)) == rows
+
+    def test_is_columnar_detects_encoded_value(self) -> None:
+        assert is_columnar(encode_rows(_rows()))
+        assert not is_columnar(_rows())
+
+    def test_can_encode_requires_non_empty_list_of_dicts(self) -> None:
+        assert can_encode(_rows())
+        assert not can_encode([])
+        assert not can_encode(["a", "b"])
+        assert not can_encode({"rows": 1})
+
+    def test_unsupported_format_raises(self) -> None:
+        with pytest.raises(ValueError, match="Unsupported columnar format"):
+            list(iter_rows({"format": "columnar/99", "rows": 0, "columns": []}))
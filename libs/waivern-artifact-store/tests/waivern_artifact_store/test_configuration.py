@@ -62,6 +62,11 @@ class TestArtifactStoreConfigurationDiscriminatedUnion:
 ENV_VARS = [
     "WAIVERN_STORE_TYPE",
     "WAIVERN_STORE_PATH",
+    "WAIVERN_STORE_COLUMNAR_FINDINGS",
+    "WAIVERN_STORE_CHUNK_SIZE",
+    "WAIVERN_STORE_BLOB_THRESHOLD",
+    "WAIVERN_STORE_WRITE_BEHIND",
+    "WAIVERN_STORE_FSYNC",
     "WAIVERN_STORE_URL",
     "WAIVERN_STORE_API_KEY",
 ]
@@ -104,6 +109,56 @@ class TestArtifactStoreConfigurationFromProperties:
         assert isinstance(config.root, FilesystemStoreConfig)
         assert config.root.base_path == Path("/custom/path")
 
+    def test_from_properties_reads_columnar_findings_from_environment(
+        self, monkeypatch: pytest.MonkeyPatch
+    ) -> None:
+        """Read columnar_findings from WAIVERN_STORE_COLUMNAR_FINDINGS env var."""
+        monkeypatch.setenv("WAIVERN_STORE_TYPE", "filesystem")
+        monkeypatch.setenv("WAIVERN_STORE_COLUMNAR_FINDINGS", "true")
+
+        config = ArtifactStoreConfiguration.from_properties({})
+
+        assert isinstance(config.root, FilesystemStoreConfig)
+        assert config.root.columnar_findings is True
+
+    def test_from_properties_reads_chunk_size_from_environment(
+        self, monkeypatch: pytest.MonkeyPatch
+    ) -> None:
+        """Read chunk_size from WAIVERN_STORE_CHUNK_SIZE env var."""
+        monkeypatch.setenv("WAIVERN_STORE_TYPE", "filesystem")
+        monkeypatch.setenv("WAIVERN_STORE_CHUNK_SIZE", "500")
+
+        config = ArtifactStoreConfiguration.from_properties({})
+
+        assert isinstance(config.root, FilesystemStoreConfig)
+        assert config.root.chunk_size == 500
+
+    def test_from_properties_reads_blob_threshold_from_environment(
+        self, monkeypatch: pytest.MonkeyPatch
+    ) -> None:
+        """Read blob_threshold from WAIVERN_STORE_BLOB_THRESHOLD env var."""
+        monkeypatch.setenv("WAIVERN_STORE_TYPE", "filesystem")
+        monkeypatch.setenv("WAIVERN_STORE_BLOB_THRESHOLD", "4096")
+
+        config = ArtifactStoreConfiguration.from_properties({})
+
+        assert isinstance(config.root, FilesystemStoreConfig)
+        assert config.root.blob_threshold == 4096
+
+    def test_from_properties_reads_write_behind_and_fsync_from_environment(
+        self, monkeypatch: pytest.MonkeyPatch
+    ) -> None:
+        """Read write_behind and fsync from WAIVERN_STORE_* env vars."""
+        monkeypatch.setenv("WAIVERN_STORE_TYPE", "filesystem")
+        monkeypatch.setenv("WAIVERN_STORE_WRITE_BEHIND", "true")
+        monkeypatch.setenv("WAIVERN_STORE_FSYNC", "1")
+
+        config = ArtifactStoreConfiguration.from_properties({})
+
+        assert isinstance(config.root, FilesystemStoreConfig)
+        assert config.root.write_behind is True
+        assert config.root.fsync is True
+
     def test_from_properties_properties_override_environment(
         self, monkeypatch: pytest.MonkeyPatch
     ) -> None:
@@ -1,11 +1,15 @@
 """Tests for LocalFilesystemStore implementation."""
 
+import asyncio
 import json
+import os
+import shutil
 from pathlib import Path
 
 import pytest
 from waivern_core import JsonValue
 from waivern_core.message import Message
+from waivern_core.metrics import MetricsRegistry
 from waivern_core.schemas import Schema
 
 from waivern_artifact_store.errors import ArtifactNotFoundError, ArtifactStoreError
@@ -118,6 +122,505 @@ class TestLocalFilesystemStoreGetArtifact:
             await store.get_artifact("test-run", "nonexistent")
 
 
+# =============================================================================
+# Columnar Findings Tests
+# =============================================================================
+
+
+def _findings_message(count: int) -> Message:
+    findings = [
+        {
+            "id": f"finding-{i}",
+            "category": "email" if i % 2 else "phone",
+            "matched_patterns": ["@"],
+            "metadata": {"source": f"table_users_row_{i}", "context": {}},
+        }
+        for i in range(count)
+    ]
+    return Message(
+        id="msg-1",
+        content={"findings": findings, "summary": {"total_findings": count}},
+        schema=Schema("test_schema", "1.0.0"),
+    )
+
+
+def _chunk_file(tmp_path: Path, index: int) -> Path:
+    """Return the chunk file ``index`` of ``artifact`` in ``test-run``."""
+    chunk_dir = tmp_path / "runs" / "test-run" / "artifact_chunks" / "artifact"
+    (path,) = chunk_dir.glob(f"*-{index:05d}.json")
+    return path
+
+
+class TestLocalFilesystemStoreColumnarFindings:
+    """Tests for columnar findings storage."""
+
+    async def test_columnar_store_writes_encoded_findings(self, tmp_path: Path) -> None:
+        store = LocalFilesystemStore(base_path=tmp_path, columnar_findings=True)
+
+        await store.save_artifact("test-run", "artifact", _findings_message(10))
+
+        file_path = tmp_path / "runs" / "test-run" / "artifacts" / "artifact.json"
+        saved_data = json.loads(file_path.read_text())
+        assert saved_data["content_encoding"] == {"findings": "columnar/1"}
+        assert saved_data["content"]["findings"]["rows"] == 10
+
+    async def test_get_artifact_decodes_columnar_findings(self, tmp_path: Path) -> None:
+        store = LocalFilesystemStore(base_path=tmp_path, columnar_findings=True)
+        original = _findings_message(10)
+        await store.save_artifact("test-run", "artifact", original)
+
+        retrieved = await store.get_artifact("test-run", "artifact")
+
+        assert retrieved.content == original.content
+
+    async def test_row_store_reads_columnar_artifacts(self, tmp_path: Path) -> None:
+        original = _findings_message(5)
+        await LocalFilesystemStore(
+            base_path=tmp_path, columnar_findings=True
+        ).save_artifact("test-run", "artifact", original)
+
+        retrieved = await LocalFilesystemStore(base_path=tmp_path).get_artifact(
+            "test-run", "artifact"
+        )
+
+        assert retrieved.content == original.content
+
+    @pytest.mark.parametrize("columnar_findings", [True, False])
+    async def test_iter_artifact_items_yields_findings_in_order(
+        self, tmp_path: Path, columnar_findings: bool
+    ) -> None:
+        store = LocalFilesystemStore(
+            base_path=tmp_path, columnar_findings=columnar_findings
+        )
+        original = _findings_message(7)
+        await store.save_artifact("test-run", "artifact", original)
+
+        findings = [f async for f in store.iter_artifact_items("test-run", "artifact")]
+
+        assert findings == original.content["findings"]
+
+    async def test_iter_artifact_items_yields_nothing_without_items(
+        self, tmp_path: Path
+    ) -> None:
+        store = LocalFilesystemStore(base_path=tmp_path, columnar_findings=True)
+        message = Message(
+            id="msg-1",
+            content={"data": "test-value"},
+            schema=Schema("test_schema", "1.0.0"),
+        )
+        await store.save_artifact("test-run", "artifact", message)
+
+        findings = [f async for f in store.iter_artifact_items("test-run", "artifact")]
+
+        assert findings == []
+
+
+# =============================================================================
+# Blob Storage Tests
+# =============================================================================
+
+
+def _source_message(raw_content: str) -> Message:
+    return Message(
+        id="msg-1",
+        content={
+            "data": [
+                {"file_path": "a.py", "raw_content": raw_content},
+                {"file_path": "b.py", "raw_content": raw_content},
+            ]
+        },
+        schema=Schema("source_code", "1.0.0"),
+    )
+
+
+class TestLocalFilesystemStoreBlobs:
+    """Tests for content-addressed blob storage of long strings."""
+
+    RAW = "print('hello world')\n" * 50
+
+    async def test_long_strings_stored_once_as_blob(self, tmp_path: Path) -> None:
+        store = LocalFilesystemStore(base_path=tmp_path, blob_threshold=100)
+
+        await store.save_artifact("run-1", "source", _source_message(self.RAW))
+        await store.save_artifact("run-2", "source", _source_message(self.RAW))
+
+        blobs = [p for p in (tmp_path / "blobs").rglob("*.z")]
+        assert len(blobs) == 1
+        artifact_file = tmp_path / "runs" / "run-1" / "artifacts" / "source.json"
+        assert self.RAW not in artifact_file.read_text()
+
+    @pytest.mark.parametrize("chunk_size", [None, 1])
+    async def test_get_artifact_rehydrates_blobs(
+        self, tmp_path: Path, chunk_size: int | None
+    ) -> None:
+        store = LocalFilesystemStore(
+            base_path=tmp_path, blob_threshold=100, chunk_size=chunk_size
+        )
+        original = _source_message(self.RAW)
+        await store.save_artifact("run-1", "source", original)
+
+        loaded = await store.get_artifact("run-1", "source")
+        items = [item async for item in store.iter_artifact_items("run-1", "source")]
+
+        assert loaded.content == original.content
+        assert items == original.content["data"]
+
+    async def test_blob_artifacts_readable_with_setting_disabled(
+        self, tmp_path: Path
+    ) -> None:
+        original = _source_message(self.RAW)
+        await LocalFilesystemStore(
+            base_path=tmp_path, blob_threshold=100
+        ).save_artifact("run-1", "source", original)
+
+        loaded = await LocalFilesystemStore(base_path=tmp_path).get_artifact(
+            "run-1", "source"
+        )
+
+        assert loaded.content == original.content
+
+    async def test_cache_entries_use_blobs(self, tmp_path: Path) -> None:
+        store = LocalFilesystemStore(base_path=tmp_path, blob_threshold=100)
+        entry: dict[str, JsonValue] = {"prompt": self.RAW, "status": "pending"}
+
+        await store.cache_set("run-1", "key", entry)
+
+        cache_file = tmp_path / "runs" / "run-1" / "llm_cache" / "key.json"
+        assert self.RAW not in cache_file.read_text()
+        assert await store.cache_get("run-1", "key") == entry
+
+    async def test_short_strings_stay_inline(self, tmp_path: Path) -> None:
+        store = LocalFilesystemStore(base_path=tmp_path, blob_threshold=10_000)
+
+        await store.save_artifact("run-1", "source", _source_message(self.RAW))
+
+        assert not (tmp_path / "blobs").exists()
+
+
+# =============================================================================
+# Chunked Artifact Tests
+# =============================================================================
+
+
+class TestLocalFilesystemStoreChunkedArtifacts:
+    """Tests for chunked artifact layout, metadata reads and item slices."""
+
+    async def test_chunked_store_writes_header_and_chunk_files(
+        self, tmp_path: Path
+    ) -> None:
+        store = LocalFilesystemStore(base_path=tmp_path, chunk_size=4)
+
+        await store.save_artifact("test-run", "artifact", _findings_message(10))
+
+        run_dir = tmp_path / "runs" / "test-run"
+        header = json.loads((run_dir / "artifacts" / "artifact.json").read_text())
+        assert "findings" not in header["content"]
+        assert header["content"]["summary"] == {"total_findings": 10}
+        assert header["content_layout"]["items"] == 10
+        version = header["content_layout"]["version"]
+        chunks = sorted((run_dir / "artifact_chunks" / "artifact").iterdir())
+        assert [c.name for c in chunks] == [
+            f"{version}-00000.json",
+            f"{version}-00001.json",
+            f"{version}-00002.json",
+        ]
+
+    @pytest.mark.parametrize("columnar_findings", [False, True])
+    async def test_get_artifact_reassembles_chunks(
+        self, tmp_path: Path, columnar_findings: bool
+    ) -> None:
+        store = LocalFilesystemStore(
+            base_path=tmp_path, chunk_size=4, columnar_findings=columnar_findings
+        )
+        original = _findings_message(10)
+        await store.save_artifact("test-run", "artifact", original)
+
+        loaded = await store.get_artifact("test-run", "artifact")
+
+        assert loaded.content == original.content
+
+    async def test_iter_artifact_items_reads_requested_slice(
+        self, tmp_path: Path
+    ) -> None:
+        store = LocalFilesystemStore(base_path=tmp_path, chunk_size=4)
+        await store.save_artifact("test-run", "artifact", _findings_message(10))
+        # Chunks outside the slice are never read
+        _chunk_file(tmp_path, 0).unlink()
+
+        items = [
+            item
+            async for item in store.iter_artifact_items(
+                "test-run", "artifact", start=5, stop=9
+            )
+        ]
+
+        assert [item["id"] for item in items] == [f"finding-{i}" for i in range(5, 9)]
+
+    @pytest.mark.parametrize("columnar_findings", [False, True])
+    async def test_get_artifact_without_items_skips_chunk_files(
+        self, tmp_path: Path, columnar_findings: bool
+    ) -> None:
+        store = LocalFilesystemStore(
+            base_path=tmp_path, chunk_size=4, columnar_findings=columnar_findings
+        )
+        await store.save_artifact("test-run", "artifact", _findings_message(10))
+        shutil.rmtree(tmp_path / "runs" / "test-run" / "artifact_chunks")
+
+        message = await store.get_artifact_without_items("test-run", "artifact")
+
+        assert message.content == {"summary": {"total_findings": 10}, "findings": []}
+
+    @pytest.mark.parametrize("columnar_findings", [False, True])
+    async def test_get_artifact_without_items_keeps_inline_field_order(
+        self, tmp_path: Path, columnar_findings: bool
+    ) -> None:
+        store = LocalFilesystemStore(
+            base_path=tmp_path, columnar_findings=columnar_findings
+        )
+        await store.save_artifact("test-run", "artifact", _findings_message(3))
+
+        message = await store.get_artifact_without_items("test-run", "artifact")
+
+        assert list(message.content.items()) == [
+            ("findings", []),
+            ("summary", {"total_findings": 3}),
+        ]
+
+    @pytest.mark.parametrize("chunk_size", [None, 4])
+    async def test_iter_artifact_items_matches_list_slice(
+        self, tmp_path: Path, chunk_size: int | None
+    ) -> None:
+        store = LocalFilesystemStore(base_path=tmp_path, chunk_size=chunk_size)
+        original = _findings_message(10)
+        await store.save_artifact("test-run", "artifact", original)
+
+        items = [
+            item
+            async for item in store.iter_artifact_items("test-run", "artifact", start=3)
+        ]
+
+        assert items == original.content["findings"][3:]
+
+    async def test_get_artifact_metadata_skips_chunk_files(
+        self, tmp_path: Path
+    ) -> None:
+        from waivern_core.message import ExecutionContext, MessageExtensions
+
+        store = LocalFilesystemStore(base_path=tmp_path, chunk_size=4)
+        message = _findings_message(10)
+        message.extensions = MessageExtensions(
+            execution=ExecutionContext(
+                status="error", error="boom", duration_seconds=2.5
+            )
+        )
+        await store.save_artifact("test-run", "artifact", message)
+        for chunk in (tmp_path / "runs" / "test-run" / "artifact_chunks").rglob("*"):
+            if chunk.is_file():
+                chunk.unlink()
+
+        metadata = await store.get_artifact_metadata("test-run", "artifact")
+
+        assert metadata.message_id == "msg-1"
+        assert metadata.schema.name == "test_schema"
+        assert metadata.item_count == 10
+        assert metadata.execution_error == "boom"
+        assert metadata.execution_duration == 2.5
+
+    @pytest.mark.parametrize("columnar_findings", [False, True])
+    async def test_get_artifact_metadata_for_single_file_layout(
+        self, tmp_path: Path, columnar_findings: bool
+    ) -> None:
+        store = LocalFilesystemStore(
+            base_path=tmp_path, columnar_findings=columnar_findings
+        )
+        await store.save_artifact("test-run", "artifact", _findings_message(10))
+
+        metadata = await store.get_artifact_metadata("test-run", "artifact")
+
+        assert metadata.item_count == 10
+
+    async def test_delete_and_overwrite_remove_stale_chunks(
+        self, tmp_path: Path
+    ) -> None:
+        store = LocalFilesystemStore(base_path=tmp_path, chunk_size=4)
+        chunk_dir = tmp_path / "runs" / "test-run" / "artifact_chunks" / "artifact"
+        await store.save_artifact("test-run", "artifact", _findings_message(10))
+
+        await store.save_artifact("test-run", "artifact", _findings_message(2))
+        assert list(chunk_dir.iterdir()) == [_chunk_file(tmp_path, 0)]
+
+        await store.delete_artifact("test-run", "artifact")
+        assert not chunk_dir.exists()
+
+    @pytest.mark.parametrize("write_behind", [False, True])
+    async def test_failed_overwrite_keeps_previous_version_readable(
+        self, tmp_path: Path, monkeypatch: pytest.MonkeyPatch, write_behind: bool
+    ) -> None:
+        store = LocalFilesystemStore(
+            base_path=tmp_path, chunk_size=4, write_behind=write_behind
+        )
+        original = _findings_message(10)
+        await store.save_artifact("test-run", "artifact", original)
+        await store.flush()
+        header = tmp_path / "runs" / "test-run" / "artifacts" / "artifact.json"
+        write_file = store._write_file  # pyright: ignore[reportPrivateUsage]
+
+        async def fail_on_header(path: Path, text: str) -> None:
+            if path == header:
+                raise OSError("disk full")
+            await write_file(path, text)
+
+        monkeypatch.setattr(store, "_write_file", fail_on_header)
+        with pytest.raises(OSError, match="disk full"):
+            await store.save_artifact("test-run", "artifact", _findings_message(2))
+        await store.flush()
+
+        reopened = LocalFilesystemStore(base_path=tmp_path)
+        loaded = await reopened.get_artifact("test-run", "artifact")
+        assert loaded.content == original.content
+
+    async def test_reads_and_replaces_unversioned_chunks(self, tmp_path: Path) -> None:
+        """Chunks saved before chunk versions were recorded stay readable."""
+        store = LocalFilesystemStore(base_path=tmp_path, chunk_size=4)
+        original = _findings_message(10)
+        await store.save_artifact("test-run", "artifact", original)
+        header_path = tmp_path / "runs" / "test-run" / "artifacts" / "artifact.json"
+        header = json.loads(header_path.read_text())
+        del header["content_layout"]["version"]
+        header_path.write_text(json.dumps(header))
+        for index in range(3):
+            chunk = _chunk_file(tmp_path, index)
+            chunk.rename(chunk.with_name(f"{index:05d}.json"))
+
+        assert (await store.get_artifact("test-run", "artifact")).content == (
+            original.content
+        )
+
+        await store.save_artifact("test-run", "artifact", _findings_message(2))
+        chunk_dir = header_path.parents[1] / "artifact_chunks" / "artifact"
+        assert list(chunk_dir.iterdir()) == [_chunk_file(tmp_path, 0)]
+
+    async def test_missing_chunk_raises_store_error(self, tmp_path: Path) -> None:
+        store = LocalFilesystemStore(base_path=tmp_path, chunk_size=4)
+        await store.save_artifact("test-run", "artifact", _findings_message(10))
+        _chunk_file(tmp_path, 1).unlink()
+
+        with pytest.raises(ArtifactStoreError, match="Chunk 1"):
+            await store.get_artifact("test-run", "artifact")
+
+    def test_non_positive_chunk_size_rejected(self, tmp_path: Path) -> None:
+        with pytest.raises(ValueError, match="chunk_size"):
+            LocalFilesystemStore(base_path=tmp_path, chunk_size=0)
+
+
+# =============================================================================
+# Write-Behind Tests
+# =============================================================================
+
+
+class TestLocalFilesystemStoreWriteBehind:
+    """Tests for buffered writes with group commit at durability points."""
+
+    async def test_buffered_artifact_is_readable_before_flush(
+        self, tmp_path: Path
+    ) -> None:
+        store = LocalFilesystemStore(
+            base_path=tmp_path, write_behind=True, chunk_size=4
+        )
+        original = _findings_message(10)
+
+        await store.save_artifact("test-run", "artifact", original)
+
+        assert not (tmp_path / "runs" / "test-run").exists()
+        assert await store.artifact_exists("test-run", "artifact")
+        assert await store.list_artifacts("test-run") == ["artifact"]
+        loaded = await store.get_artifact("test-run", "artifact")
+        assert loaded.content == original.content
+
+    async def test_flush_writes_buffered_files(self, tmp_path: Path) -> None:
+        store = LocalFilesystemStore(base_path=tmp_path, write_behind=True)
+        await store.save_artifact("test-run", "artifact", _findings_message(3))
+        await store.cache_set("test-run", "key", {"response": "ok"})
+        await store.save_prepared("test-run", "artifact", {"step": 1})
+
+        await store.flush()
+
+        run_dir = tmp_path / "runs" / "test-run"
+        assert (run_dir / "artifacts" / "artifact.json").exists()
+        assert json.loads((run_dir / "llm_cache" / "key.json").read_text()) == {
+            "response": "ok"
+        }
+        assert (run_dir / "prepared" / "artifact.json").exists()
+
+    async def test_save_system_data_commits_buffered_writes_first(
+        self, tmp_path: Path
+    ) -> None:
+        store = LocalFilesystemStore(base_path=tmp_path, write_behind=True)
+        await store.save_artifact("test-run", "artifact", _findings_message(3))
+
+        await store.save_system_data("test-run", "state", {"completed": ["artifact"]})
+
+        run_dir = tmp_path / "runs" / "test-run"
+        assert (run_dir / "artifacts" / "artifact.json").exists()
+        assert (run_dir / "_system" / "state.json").exists()
+
+    async def test_delete_drops_buffered_write(self, tmp_path: Path) -> None:
+        store = LocalFilesystemStore(base_path=tmp_path, write_behind=True)
+        await store.save_artifact("test-run", "artifact", _findings_message(3))
+        await store.cache_set("test-run", "key", {"response": "ok"})
+
+        await store.delete_artifact("test-run", "artifact")
+        await store.cache_clear("test-run")
+        await store.flush()
+
+        assert not await store.artifact_exists("test-run", "artifact")
+        assert await store.cache_get("test-run", "key") is None
+        assert not (tmp_path / "runs" / "test-run").exists()
+
+    async def test_latest_buffered_write_wins(self, tmp_path: Path) -> None:
+        store = LocalFilesystemStore(base_path=tmp_path, write_behind=True)
+        await store.cache_set("test-run", "key", {"response": "first"})
+        await store.cache_set("test-run", "key", {"response": "second"})
+
+        await store.flush()
+
+        assert await store.cache_get("test-run", "key") == {"response": "second"}
+
+    async def test_fsync_store_round_trips(self, tmp_path: Path) -> None:
+        store = LocalFilesystemStore(base_path=tmp_path, write_behind=True, fsync=True)
+        original = _findings_message(3)
+        await store.save_artifact("test-run", "artifact", original)
+        await store.save_system_data("test-run", "state", {"completed": []})
+
+        fresh = LocalFilesystemStore(base_path=tmp_path)
+        loaded = await fresh.get_artifact("test-run", "artifact")
+        assert loaded.content == original.content
+
+
+# =============================================================================
+# Metrics Tests
+# =============================================================================
+
+
+class TestLocalFilesystemStoreMetrics:
+    """Tests for recording operation latencies."""
+
+    async def test_reads_writes_and_commits_are_timed(self, tmp_path: Path) -> None:
+        metrics = MetricsRegistry()
+        store = LocalFilesystemStore(base_path=tmp_path, write_behind=True)
+        store.attach_metrics(metrics)
+
+        await store.save_artifact("test-run", "artifact", _findings_message(3))
+        await store.flush()
+        await store.flush()  # Nothing pending: not a commit
+        await store.get_artifact("test-run", "artifact")
+
+        latency = metrics.histogram("waivern_store_operation_duration_seconds", "")
+        assert latency.count(store="filesystem", operation="commit") == 1
+        assert latency.count(store="filesystem", operation="read") == 1
+        assert latency.count(store="filesystem", operation="write") == 0
+
+
 # =============================================================================
 # Artifact Exists Tests
 # =============================================================================
@@ -381,6 +884,143 @@ class TestLocalFilesystemStoreListRuns:
         assert run_ids == []
 
 
+class TestLocalFilesystemStoreRunIndex:
+    """Tests for list_run_metadata() and its run index file."""
+
+    async def test_list_run_metadata_returns_metadata_of_each_run(
+        self, tmp_path: Path
+    ) -> None:
+        store = LocalFilesystemStore(base_path=tmp_path)
+        await store.save_system_data("run-1", "metadata", {"status": "completed"})
+        await store.save_system_data("run-2", "metadata", {"status": "running"})
+        await store.save_system_data("run-3", "state", {"completed": []})
+
+        result = await store.list_run_metadata()
+
+        assert result == {
+            "run-1": {"status": "completed"},
+            "run-2": {"status": "running"},
+        }
+        assert (tmp_path / "run_index.json").exists()
+
+    async def test_index_entries_refresh_when_metadata_changes(
+        self, tmp_path: Path
+    ) -> None:
+        store = LocalFilesystemStore(base_path=tmp_path)
+        await store.save_system_data("run-1", "metadata", {"status": "running"})
+        await store.list_run_metadata()
+
+        await store.save_system_data("run-1", "metadata", {"status": "completed"})
+        await store.delete_run("run-2")
+
+        assert await store.list_run_metadata() == {"run-1": {"status": "completed"}}
+
+    async def test_concurrent_listings_both_write_the_index(
+        self, tmp_path: Path
+    ) -> None:
+        store = LocalFilesystemStore(base_path=tmp_path)
+        await store.save_system_data("run-1", "metadata", {"status": "running"})
+
+        results = await asyncio.gather(
+            store.list_run_metadata(), store.list_run_metadata()
+        )
+
+        assert results == [{"run-1": {"status": "running"}}] * 2
+        assert not list(tmp_path.glob("run_index.json.*"))
+
+    async def test_unreadable_index_is_rebuilt(self, tmp_path: Path) -> None:
+        store = LocalFilesystemStore(base_path=tmp_path)
+        await store.save_system_data("run-1", "metadata", {"status": "running"})
+        (tmp_path / "run_index.json").write_text("{not json")
+
+        assert await store.list_run_metadata() == {"run-1": {"status": "running"}}
+
+
+# =============================================================================
+# Retention Tests
+# =============================================================================
+
+
+class TestLocalFilesystemStoreRetention:
+    """Tests for delete_run() and collect_garbage()."""
+
+    async def test_delete_run_removes_run_directory(self, tmp_path: Path) -> None:
+        store = LocalFilesystemStore(base_path=tmp_path)
+        await store.save_artifact("run-1", "artifact", _findings_message(2))
+        await store.cache_set("run-1", "key", {"response": "ok"})
+        await store.save_artifact("run-2", "artifact", _findings_message(2))
+
+        await store.delete_run("run-1")
+
+        assert await store.list_runs() == ["run-2"]
+        assert not (tmp_path / "runs" / "run-1").exists()
+
+    @pytest.mark.parametrize("run_id", ["", "../other", "a/b"])
+    async def test_delete_run_rejects_unsafe_ids(
+        self, tmp_path: Path, run_id: str
+    ) -> None:
+        store = LocalFilesystemStore(base_path=tmp_path)
+
+        with pytest.raises(ValueError):
+            await store.delete_run(run_id)
+
+    async def test_collect_garbage_removes_unreferenced_old_blobs(
+        self, tmp_path: Path
+    ) -> None:
+        store = LocalFilesystemStore(base_path=tmp_path, blob_threshold=100)
+        shared = "x" * 200
+        await store.save_artifact("run-1", "artifact", _source_message(shared))
+        await store.save_artifact("run-2", "artifact", _source_message("y" * 200))
+        await store.delete_run("run-2")
+        blobs = list((tmp_path / "blobs").rglob("*.z"))
+        for blob in blobs:
+            os.utime(blob, (0, 0))
+
+        removed = await store.collect_garbage()
+
+        assert removed == 1
+        assert len(list((tmp_path / "blobs").rglob("*.z"))) == 1
+        loaded = await store.get_artifact("run-1", "artifact")
+        assert loaded.content["data"][0]["raw_content"] == shared
+
+    @pytest.mark.parametrize("chunk_size", [None, 2])
+    async def test_collect_garbage_keeps_blobs_of_columnar_findings(
+        self, tmp_path: Path, chunk_size: int | None
+    ) -> None:
+        store = LocalFilesystemStore(
+            base_path=tmp_path,
+            columnar_findings=True,
+            blob_threshold=100,
+            chunk_size=chunk_size,
+        )
+        original = Message(
+            id="msg-1",
+            content={
+                "findings": [
+                    {"id": str(i), "metadata": {"source": f"{i}" * 200}}
+                    for i in range(4)
+                ]
+            },
+            schema=Schema("test_schema", "1.0.0"),
+        )
+        await store.save_artifact("run-1", "artifact", original)
+        for blob in (tmp_path / "blobs").rglob("*.z"):
+            os.utime(blob, (0, 0))
+
+        removed = await store.collect_garbage()
+
+        assert removed == 0
+        loaded = await store.get_artifact("run-1", "artifact")
+        assert loaded.content == original.content
+
+    async def test_collect_garbage_keeps_recent_blobs(self, tmp_path: Path) -> None:
+        store = LocalFilesystemStore(base_path=tmp_path, blob_threshold=100)
+        await store.save_artifact("run-1", "artifact", _source_message("y" * 200))
+        await store.delete_run("run-1")
+
+        assert await store.collect_garbage() == 0
+
+
 # =============================================================================
 # System Data Tests
 # =============================================================================
@@ -833,6 +1473,27 @@ class TestLocalFilesystemStoreListBatchJobs:
         assert result == []
 
 
+class TestLocalFilesystemStoreDeleteBatchJob:
+    """Tests for the delete_batch_job() method."""
+
+    async def test_delete_batch_job_removes_only_that_job(self, tmp_path: Path) -> None:
+        store = LocalFilesystemStore(base_path=tmp_path)
+        for batch_id in ["batch-a", "batch-b"]:
+            data: dict[str, JsonValue] = {"batch_id": batch_id, "status": "submitted"}
+            await store.save_batch_job("test-run", batch_id, data)
+
+        await store.delete_batch_job("test-run", "batch-a")
+
+        assert await store.list_batch_jobs("test-run") == ["batch-b"]
+
+    async def test_delete_missing_batch_job_is_noop(self, tmp_path: Path) -> None:
+        store = LocalFilesystemStore(base_path=tmp_path)
+
+        await store.delete_batch_job("test-run", "batch-nonexistent")
+
+        assert await store.list_batch_jobs("test-run") == []
+
+
 class TestLocalFilesystemStoreBatchJobIsolation:
     """Tests for batch job isolation between runs and storage domains."""
 
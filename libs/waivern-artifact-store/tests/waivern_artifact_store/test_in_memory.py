@@ -50,6 +50,21 @@ class TestAsyncInMemoryStoreSaveArtifact:
         assert retrieved.id == "msg-2"
         assert retrieved.content == {"version": "updated"}
 
+    async def test_save_artifact_drops_typed_content(self) -> None:
+        store = AsyncInMemoryStore()
+        message = Message(
+            id="msg-1",
+            content={"data": "test-value"},
+            schema=Schema("test_schema", "1.0.0"),
+            typed_content=object(),
+        )
+
+        await store.save_artifact("test-run", "artifact", message)
+
+        retrieved = await store.get_artifact("test-run", "artifact")
+        assert retrieved.typed_content is None
+        assert retrieved.content == {"data": "test-value"}
+
 
 # =============================================================================
 # Get Artifact Tests
@@ -66,6 +81,78 @@ class TestAsyncInMemoryStoreGetArtifact:
             await store.get_artifact("test-run", "nonexistent")
 
 
+# =============================================================================
+# Partial Read Tests (ArtifactStore defaults)
+# =============================================================================
+
+
+class TestAsyncInMemoryStorePartialReads:
+    """Tests for the default partial-read methods of ArtifactStore."""
+
+    async def test_get_artifact_metadata_counts_items(self) -> None:
+        store = AsyncInMemoryStore()
+        message = Message(
+            id="msg-1",
+            content={"data": [{"content": "a"}, {"content": "b"}]},
+            schema=Schema("standard_input", "1.0.0"),
+        )
+        await store.save_artifact("test-run", "artifact", message)
+
+        metadata = await store.get_artifact_metadata("test-run", "artifact")
+
+        assert metadata.message_id == "msg-1"
+        assert metadata.item_count == 2
+
+    async def test_get_artifact_metadata_without_item_list(self) -> None:
+        store = AsyncInMemoryStore()
+        message = Message(
+            id="msg-1", content={"key": "value"}, schema=Schema("test", "1.0.0")
+        )
+        await store.save_artifact("test-run", "artifact", message)
+
+        metadata = await store.get_artifact_metadata("test-run", "artifact")
+
+        assert metadata.item_count is None
+
+    async def test_iter_artifact_items_yields_slice(self) -> None:
+        store = AsyncInMemoryStore()
+        message = Message(
+            id="msg-1",
+            content={"findings": [{"id": str(i)} for i in range(5)]},
+            schema=Schema("test", "1.0.0"),
+        )
+        await store.save_artifact("test-run", "artifact", message)
+
+        items = [
+            item
+            async for item in store.iter_artifact_items(
+                "test-run", "artifact", start=1, stop=3
+            )
+        ]
+
+        assert items == [{"id": "1"}, {"id": "2"}]
+
+    async def test_get_artifact_without_items_empties_item_list(self) -> None:
+        store = AsyncInMemoryStore()
+        message = Message(
+            id="msg-1",
+            content={"findings": [{"id": "1"}], "summary": {"total": 1}},
+            schema=Schema("test", "1.0.0"),
+        )
+        await store.save_artifact("test-run", "artifact", message)
+
+        header = await store.get_artifact_without_items("test-run", "artifact")
+
+        assert header.content == {"findings": [], "summary": {"total": 1}}
+        assert message.content["findings"] == [{"id": "1"}]
+
+    async def test_get_artifact_metadata_raises_for_missing_artifact(self) -> None:
+        store = AsyncInMemoryStore()
+
+        with pytest.raises(ArtifactNotFoundError):
+            await store.get_artifact_metadata("test-run", "missing")
+
+
 # =============================================================================
 # Artifact Exists Tests
 # =============================================================================
@@ -269,6 +356,24 @@ class TestAsyncInMemoryStoreListRuns:
 
         assert run_ids == []
 
+    async def test_delete_run_removes_all_run_data(self) -> None:
+        store = AsyncInMemoryStore()
+        message = Message(
+            id="msg-1",
+            content={"data": "value"},
+            schema=Schema("test_schema", "1.0.0"),
+        )
+        await store.save_artifact("run-001", "artifact", message)
+        await store.save_system_data("run-001", "metadata", {"status": "completed"})
+        await store.cache_set("run-001", "key", {"response": "ok"})
+        await store.save_artifact("run-002", "artifact", message)
+
+        await store.delete_run("run-001")
+
+        assert await store.list_runs() == ["run-002"]
+        assert await store.cache_get("run-001", "key") is None
+        assert await store.list_run_metadata() == {}
+
 
 # =============================================================================
 # System Data Tests
@@ -682,6 +787,27 @@ class TestAsyncInMemoryStoreListBatchJobs:
         assert result == []
 
 
+class TestAsyncInMemoryStoreDeleteBatchJob:
+    """Tests for the delete_batch_job() method."""
+
+    async def test_delete_batch_job_removes_only_that_job(self) -> None:
+        store = AsyncInMemoryStore()
+        for batch_id in ["batch-a", "batch-b"]:
+            data: dict[str, JsonValue] = {"batch_id": batch_id, "status": "submitted"}
+            await store.save_batch_job("test-run", batch_id, data)
+
+        await store.delete_batch_job("test-run", "batch-a")
+
+        assert await store.list_batch_jobs("test-run") == ["batch-b"]
+
+    async def test_delete_missing_batch_job_is_noop(self) -> None:
+        store = AsyncInMemoryStore()
+
+        await store.delete_batch_job("test-run", "batch-nonexistent")
+
+        assert await store.list_batch_jobs("test-run") == []
+
+
 class TestAsyncInMemoryStoreBatchJobIsolation:
     """Tests for batch job isolation between runs and storage domains."""
 
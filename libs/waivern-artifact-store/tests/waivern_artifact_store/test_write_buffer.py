@@ -0,0 +1,69 @@
+"""Tests for the write-behind buffer."""
+
+from pathlib import Path
+
+import pytest
+
+from waivern_artifact_store.write_buffer import (
+    WriteBehindBuffer,
+    temporary_path,
+    write_files,
+)
+
+
+class TestWriteBehindBuffer:
+    """Tests for buffering, group commit and discard."""
+
+    async def test_put_buffers_until_commit(self, tmp_path: Path) -> None:
+        buffer = WriteBehindBuffer()
+        path = tmp_path / "a" / "file.json"
+
+        await buffer.put(path, "{}")
+
+        assert not path.exists()
+        assert buffer.get(path) == "{}"
+
+        await buffer.commit()
+
+        assert path.read_text() == "{}"
+        assert buffer.get(path) is None
+        assert buffer.pending_count == 0
+
+    async def test_commits_automatically_when_full(self, tmp_path: Path) -> None:
+        buffer = WriteBehindBuffer(max_files=2)
+
+        await buffer.put(tmp_path / "one.json", "1")
+        assert buffer.pending_count == 1
+        await buffer.put(tmp_path / "two.json", "2")
+
+        assert buffer.pending_count == 0
+        assert (tmp_path / "one.json").exists()
+        assert (tmp_path / "two.json").exists()
+
+    async def test_discard_under_drops_directory_contents(self, tmp_path: Path) -> None:
+        buffer = WriteBehindBuffer()
+        await buffer.put(tmp_path / "dir" / "a.json", "a")
+        await buffer.put(tmp_path / "other.json", "b")
+
+        buffer.discard_under(tmp_path / "dir")
+
+        assert list(buffer.paths_under(tmp_path)) == [tmp_path / "other.json"]
+
+
+class TestWriteFiles:
+    """Tests for atomic file writes through temporary siblings."""
+
+    def test_temporary_paths_are_unique_per_write(self, tmp_path: Path) -> None:
+        path = tmp_path / "entry.json"
+
+        assert temporary_path(path) != temporary_path(path)
+        assert temporary_path(path).parent == tmp_path
+
+    def test_failed_write_leaves_no_temporary_file(self, tmp_path: Path) -> None:
+        path = tmp_path / "entry.json"
+        path.mkdir()  # Replacing a directory with a file fails
+
+        with pytest.raises(OSError):
+            write_files({path: "{}"}, fsync=False)
+
+        assert list(tmp_path.iterdir()) == [path]
@@ -17,6 +17,12 @@ class DatabaseConnector(Connector, abc.ABC):
     but subclasses can override to support additional schemas.
     """
 
+    @classmethod
+    @override
+    def get_resource_pool(cls) -> str | None:
+        """Run database connectors in the ``db_io`` pool."""
+        return "db_io"
+
     @classmethod
     @override
     def get_supported_output_schemas(cls) -> list[Schema]:
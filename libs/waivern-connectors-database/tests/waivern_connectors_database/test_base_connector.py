@@ -23,6 +23,10 @@ class TestBaseDatabaseConnector:
         assert supported_schemas[0].name == "standard_input"
         assert supported_schemas[0].version == "1.0.0"
 
+    def test_base_connector_runs_in_db_io_pool(self) -> None:
+        """Test that database connectors default to the db_io resource pool."""
+        assert DatabaseConnector.get_resource_pool() == "db_io"
+
     def test_base_connector_is_abstract_class(self) -> None:
         """Test that DatabaseConnector cannot be instantiated directly as it's abstract."""
         # Act & Assert
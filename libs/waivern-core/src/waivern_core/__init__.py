@@ -45,6 +45,7 @@ from waivern_core.llm_validation_types import (
     ValidationResultType,
 )
 from waivern_core.message import ExecutionContext, Message, MessageExtensions
+from waivern_core.metrics import MetricsRegistry, MetricsRegistryFactory
 from waivern_core.protocols import Finding, FindingMetadata
 from waivern_core.ruleset_types import (
     ClassificationRule,
@@ -132,6 +133,9 @@ __all__ = [
     "DispatchRequest",
     "DispatchResult",
     "PrepareResult",
+    # Metrics
+    "MetricsRegistry",
+    "MetricsRegistryFactory",
     # Utilities
     "validate_output_schema",
     # Errors
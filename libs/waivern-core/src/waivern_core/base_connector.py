@@ -31,6 +31,21 @@ class Connector(abc.ABC):
     def get_name(cls) -> str:
         """Return the name of the connector."""
 
+    @classmethod
+    def get_resource_pool(cls) -> str | None:
+        """Name the resource pool this connector runs in by default.
+
+        Runbooks bound pools in ``config.resource_pools`` (e.g. ``db_io: 4``)
+        so a burst of one kind of work cannot starve another. Components in
+        no pool, or in a pool the runbook does not declare, share
+        ``max_concurrency``.
+
+        Returns:
+            Pool name, or None for the shared pool.
+
+        """
+        return None
+
     @classmethod
     def get_supported_output_schemas(cls) -> list[Schema]:
         """Auto-discover supported output schemas from schema_producers/ directory.
@@ -111,6 +111,22 @@ class Processor(abc.ABC):
 
         """
 
+    @classmethod
+    def get_resource_pool(cls) -> str | None:
+        """Name the resource pool this processor runs in by default.
+
+        See ``Connector.get_resource_pool``. The pattern-matching analysers
+        run in ``cpu``; processors bound by LLM calls run in ``llm``. For a
+        distributed processor the pool bounds its prepare and finalise
+        steps, not its LLM requests, which the shared dispatcher sends (see
+        ``WAIVERN_LLM_SYNC_CONCURRENCY``).
+
+        Returns:
+            Pool name, or None for the shared pool.
+
+        """
+        return None
+
     def process(
         self,
         inputs: list[Message],
@@ -11,6 +11,8 @@ This module provides:
 - MessageValidationError: Message validation exception
 """
 
+from collections.abc import Sequence
+
 from pydantic_core import ErrorDetails
 
 
@@ -119,4 +121,5 @@ class PendingProcessingError(WaivernError):
     domain-specific fields such as batch IDs.
     """
 
-    pass
+    batch_ids: Sequence[str] = ()
+    """Identifiers of the submitted jobs whose results are pending, if known."""
@@ -4,16 +4,20 @@ This module provides:
 - Message: universal communication unit between framework components
 - MessageExtensions: optional typed metadata (execution, tracing, etc.)
 - ExecutionContext: execution-specific metadata filled by executor
+- boundary_typed_content: the typed model a producer attaches to a Message
 """
 
 from dataclasses import dataclass, field
 from datetime import UTC, datetime
 from typing import Any, Literal, Self
 
-import jsonschema
-
 from waivern_core.errors import MessageValidationError
-from waivern_core.schemas import Schema, SchemaLoadError
+from waivern_core.schemas import (
+    Schema,
+    SchemaLoadError,
+    SchemaRegistry,
+    SchemaValidationError,
+)
 
 
 @dataclass(slots=True)
@@ -139,6 +143,17 @@ class Message:
     extensions: MessageExtensions | None = None
     """Optional typed metadata (execution, tracing, etc.)."""
 
+    typed_content: object | None = field(default=None, repr=False, compare=False)
+    """Validated typed model that ``content`` was dumped from, if any.
+
+    In-process only: never serialised, and dropped when the message is
+    stored; the executor reattaches it to inputs produced earlier in the same
+    run. Consumers must treat it as read-only. Under the ``boundary``
+    validation policy its presence lets ``validate()`` skip re-validation;
+    producers attach it via ``boundary_typed_content`` so it is absent under
+    the ``full`` policy.
+    """
+
     # === Execution Context Convenience Properties ===
 
     @property
@@ -186,13 +201,41 @@ class Message:
             return self.extensions.execution.model_name
         return None
 
+    # === Typed Content ===
+
+    def get_typed_content[T](self, model_class: type[T]) -> T | None:
+        """Get the carried typed model if it is an instance of ``model_class``.
+
+        Lets in-process consumers skip re-parsing ``content`` when the producer
+        attached the model it was dumped from.
+
+        Args:
+            model_class: Expected model type for this message's schema.
+
+        Returns:
+            The typed model, or None if absent or of a different type.
+
+        """
+        if isinstance(self.typed_content, model_class):
+            return self.typed_content
+        return None
+
     # === Validation ===
 
-    def validate(self) -> Self:
+    def validate(self, *, boundary: bool = False) -> Self:
         """Validate the message content against its schema.
 
-        Validates on-demand - no cached state. Call this explicitly when
-        validation is required (e.g., at system boundaries).
+        Validates on-demand using the schema's compiled validator, which is
+        built once per (name, version) and reused across messages.
+
+        Under the ``boundary`` validation policy (see
+        ``SchemaRegistry.get_validation_policy``), messages carrying
+        ``typed_content`` were already validated by their model and are
+        trusted unless ``boundary`` is set.
+
+        Args:
+            boundary: Content is entering the run from outside (connector
+                output, reused artifact, export) and is always validated.
 
         Returns:
             Self for method chaining
@@ -204,12 +247,18 @@ class Message:
         if not self.content:
             raise MessageValidationError("No content provided for validation")
 
+        if (
+            not boundary
+            and self.typed_content is not None
+            and SchemaRegistry.get_validation_policy() == "boundary"
+        ):
+            return self
+
         try:
-            schema_definition = self.schema.schema
-            jsonschema.validate(self.content, schema_definition)
+            self.schema.validator.validate(self.content)
             return self
 
-        except jsonschema.ValidationError as e:
+        except SchemaValidationError as e:
             raise MessageValidationError(
                 f"Schema validation failed for schema '{self.schema.name}': {e.message}"
             ) from e
@@ -274,3 +323,22 @@ class Message:
             timestamp=timestamp,
             extensions=extensions,
         )
+
+
+def boundary_typed_content[T](model: T) -> T | None:
+    """Return the typed model a producer should attach as ``typed_content``.
+
+    Only the ``boundary`` validation policy uses it (to skip re-validating
+    ``content``), so under ``full`` nothing is attached and the model is not
+    kept alive alongside the content dumped from it.
+
+    Args:
+        model: The validated model that ``content`` was dumped from.
+
+    Returns:
+        ``model`` under the ``boundary`` policy, otherwise None.
+
+    """
+    if SchemaRegistry.get_validation_policy() == "boundary":
+        return model
+    return None
@@ -0,0 +1,403 @@
+"""Process-wide operational metrics with Prometheus text exposition.
+
+Components record counters, gauges and histograms in a ``MetricsRegistry``
+shared through the ``ServiceContainer``. The registry renders the Prometheus
+text format for long-running processes to serve, and JSON snapshots for
+per-run reports. It has no dependencies and is safe to update from worker
+threads.
+
+Values are cumulative for the life of the process, as Prometheus expects.
+A ``MetricsCheckpoint`` taken when a run starts lets ``snapshot`` report
+only what changed during that run.
+"""
+
+from __future__ import annotations
+
+import bisect
+import itertools
+import math
+import threading
+import time
+from collections.abc import Callable, Iterator, Sequence
+from contextlib import contextmanager
+from typing import Any, ClassVar, override
+
+from waivern_core.types import JsonValue
+
+type _LabelKey = tuple[tuple[str, str], ...]
+
+DEFAULT_BUCKETS: tuple[float, ...] = (
+    0.005,
+    0.01,
+    0.025,
+    0.05,
+    0.1,
+    0.25,
+    0.5,
+    1.0,
+    2.5,
+    5.0,
+    10.0,
+    30.0,
+    60.0,
+    300.0,
+)
+"""Histogram upper bounds in seconds, from fast file reads to slow LLM calls."""
+
+
+def _label_key(labels: dict[str, str]) -> _LabelKey:
+    return tuple(sorted(labels.items()))
+
+
+def _format_value(value: float) -> str:
+    if math.isinf(value):
+        return "+Inf" if value > 0 else "-Inf"
+    if value.is_integer():
+        return str(int(value))
+    return repr(value)
+
+
+def _escape_label(value: str) -> str:
+    return value.replace("\\", "\\\\").replace("\n", "\\n").replace('"', '\\"')
+
+
+def _format_labels(key: _LabelKey, extra: tuple[str, str] | None = None) -> str:
+    pairs = [*key, extra] if extra is not None else list(key)
+    if not pairs:
+        return ""
+    return "{" + ",".join(f'{k}="{_escape_label(v)}"' for k, v in pairs) + "}"
+
+
+class _Metric:
+    """A named metric family with one value per label combination."""
+
+    kind: ClassVar[str]
+
+    def __init__(self, name: str, documentation: str, lock: threading.Lock) -> None:
+        self.name = name
+        self.documentation = documentation
+        self._lock = lock
+
+    def copy_values(self) -> dict[_LabelKey, Any]:
+        """Copy the values per label combination; the caller holds the lock."""
+        raise NotImplementedError
+
+    def render_lines(self) -> Iterator[str]:
+        """Yield exposition lines; the caller holds the lock."""
+        raise NotImplementedError
+
+    def samples(self, since: dict[_LabelKey, Any] | None) -> list[JsonValue]:
+        """Return JSON samples relative to copied values; the caller holds the lock."""
+        raise NotImplementedError
+
+
+class _ValueMetric(_Metric):
+    """A metric family holding a single number per label combination."""
+
+    def __init__(self, name: str, documentation: str, lock: threading.Lock) -> None:
+        super().__init__(name, documentation, lock)
+        self._values: dict[_LabelKey, float] = {}
+
+    def inc(self, amount: float = 1.0, **labels: str) -> None:
+        """Increase the value for ``labels`` by ``amount``."""
+        key = _label_key(labels)
+        with self._lock:
+            self._values[key] = self._values.get(key, 0.0) + amount
+
+    def value(self, **labels: str) -> float:
+        """Return the current value for ``labels``."""
+        with self._lock:
+            return self._values.get(_label_key(labels), 0.0)
+
+    @override
+    def copy_values(self) -> dict[_LabelKey, Any]:
+        return dict(self._values)
+
+    @override
+    def render_lines(self) -> Iterator[str]:
+        for key, value in sorted(self._values.items()):
+            yield f"{self.name}{_format_labels(key)} {_format_value(value)}"
+
+
+class Counter(_ValueMetric):
+    """A value that only increases, such as a number of requests."""
+
+    kind = "counter"
+
+    @override
+    def samples(self, since: dict[_LabelKey, Any] | None) -> list[JsonValue]:
+        before = since or {}
+        return [
+            {"labels": dict(key), "value": value - before.get(key, 0.0)}
+            for key, value in sorted(self._values.items())
+        ]
+
+
+class Gauge(_ValueMetric):
+    """A value that goes up and down, such as the number of queued tasks."""
+
+    kind = "gauge"
+
+    def set(self, value: float, **labels: str) -> None:
+        """Set the gauge for ``labels`` to ``value``."""
+        with self._lock:
+            self._values[_label_key(labels)] = value
+
+    def dec(self, amount: float = 1.0, **labels: str) -> None:
+        """Decrease the gauge for ``labels`` by ``amount``."""
+        self.inc(-amount, **labels)
+
+    @override
+    def samples(self, since: dict[_LabelKey, Any] | None) -> list[JsonValue]:
+        # A gauge is a level, not an accumulation: report its current value
+        return [
+            {"labels": dict(key), "value": value}
+            for key, value in sorted(self._values.items())
+        ]
+
+
+class _HistogramValue:
+    """Observation counts per bucket (not cumulative), plus their sum."""
+
+    __slots__ = ("buckets", "count", "total")
+
+    def __init__(self, bucket_count: int) -> None:
+        self.buckets = [0] * bucket_count
+        self.count = 0
+        self.total = 0.0
+
+    def copy(self) -> _HistogramValue:
+        value = _HistogramValue(len(self.buckets))
+        value.buckets = list(self.buckets)
+        value.count = self.count
+        value.total = self.total
+        return value
+
+
+class Histogram(_Metric):
+    """Observations counted into buckets, such as request latencies."""
+
+    kind = "histogram"
+
+    def __init__(
+        self,
+        name: str,
+        documentation: str,
+        lock: threading.Lock,
+        buckets: Sequence[float] = DEFAULT_BUCKETS,
+    ) -> None:
+        """Initialise an empty histogram family.
+
+        Raises:
+            ValueError: If ``buckets`` is empty or not strictly increasing.
+
+        """
+        super().__init__(name, documentation, lock)
+        bounds = tuple(float(bound) for bound in buckets)
+        if not bounds or any(a >= b for a, b in itertools.pairwise(bounds)):
+            raise ValueError(f"Histogram buckets must increase strictly: {buckets}")
+        self.buckets = bounds
+        self._labels = (*map(_format_value, bounds), "+Inf")
+        self._values: dict[_LabelKey, _HistogramValue] = {}
+
+    def observe(self, value: float, **labels: str) -> None:
+        """Record one observation of ``value`` for ``labels``."""
+        key = _label_key(labels)
+        index = bisect.bisect_left(self.buckets, value)
+        with self._lock:
+            entry = self._values.get(key)
+            if entry is None:
+                # One extra bucket for observations above the last bound (+Inf)
+                entry = self._values[key] = _HistogramValue(len(self._labels))
+            entry.buckets[index] += 1
+            entry.count += 1
+            entry.total += value
+
+    @contextmanager
+    def time(self, **labels: str) -> Iterator[None]:
+        """Observe the seconds spent in the ``with`` block, even if it raises."""
+        start = time.perf_counter()
+        try:
+            yield
+        finally:
+            self.observe(time.perf_counter() - start, **labels)
+
+    def count(self, **labels: str) -> int:
+        """Return the number of observations for ``labels``."""
+        with self._lock:
+            entry = self._values.get(_label_key(labels))
+            return entry.count if entry is not None else 0
+
+    @override
+    def copy_values(self) -> dict[_LabelKey, Any]:
+        return {key: entry.copy() for key, entry in self._values.items()}
+
+    @override
+    def render_lines(self) -> Iterator[str]:
+        for key, entry in sorted(self._values.items(), key=lambda item: item[0]):
+            cumulative = 0
+            for bound, count in zip(self._labels, entry.buckets, strict=True):
+                cumulative += count
+                labels = _format_labels(key, ("le", bound))
+                yield f"{self.name}_bucket{labels} {cumulative}"
+            yield f"{self.name}_sum{_format_labels(key)} {_format_value(entry.total)}"
+            yield f"{self.name}_count{_format_labels(key)} {entry.count}"
+
+    @override
+    def samples(self, since: dict[_LabelKey, Any] | None) -> list[JsonValue]:
+        samples: list[JsonValue] = []
+        for key, entry in sorted(self._values.items(), key=lambda item: item[0]):
+            before: _HistogramValue = (since or {}).get(key) or _HistogramValue(
+                len(self._labels)
+            )
+            buckets: dict[str, JsonValue] = {}
+            cumulative = 0
+            for bound, count, earlier in zip(
+                self._labels, entry.buckets, before.buckets, strict=True
+            ):
+                cumulative += count - earlier
+                buckets[bound] = cumulative
+            samples.append(
+                {
+                    "labels": dict(key),
+                    "count": entry.count - before.count,
+                    "sum": entry.total - before.total,
+                    "buckets": buckets,
+                }
+            )
+        return samples
+
+
+class MetricsCheckpoint:
+    """The registry's values at one point in time (see ``MetricsRegistry.checkpoint``)."""
+
+    def __init__(self, values: dict[str, dict[_LabelKey, Any]]) -> None:
+        """Wrap copied metric values."""
+        self._values = values
+
+    def values_for(self, name: str) -> dict[_LabelKey, Any] | None:
+        """Return the copied values of metric ``name``, if it existed then."""
+        return self._values.get(name)
+
+
+class MetricsRegistry:
+    """Named metric families, rendered for Prometheus or as JSON."""
+
+    def __init__(self) -> None:
+        """Initialise an empty registry."""
+        self._lock = threading.Lock()
+        self._metrics: dict[str, _Metric] = {}
+
+    def counter(self, name: str, documentation: str) -> Counter:
+        """Return the counter ``name``, creating it on first use."""
+        return self._register(
+            Counter, name, lambda: Counter(name, documentation, self._lock)
+        )
+
+    def gauge(self, name: str, documentation: str) -> Gauge:
+        """Return the gauge ``name``, creating it on first use."""
+        return self._register(
+            Gauge, name, lambda: Gauge(name, documentation, self._lock)
+        )
+
+    def histogram(
+        self,
+        name: str,
+        documentation: str,
+        *,
+        buckets: Sequence[float] = DEFAULT_BUCKETS,
+    ) -> Histogram:
+        """Return the histogram ``name``, creating it on first use.
+
+        ``buckets`` only applies when the histogram is created.
+        """
+        return self._register(
+            Histogram,
+            name,
+            lambda: Histogram(name, documentation, self._lock, buckets),
+        )
+
+    def _register[M: _Metric](
+        self, metric_type: type[M], name: str, create: Callable[[], M]
+    ) -> M:
+        """Return the metric ``name``, creating it on first use.
+
+        Raises:
+            ValueError: If ``name`` is registered as another kind of metric.
+
+        """
+        with self._lock:
+            metric = self._metrics.get(name)
+            if metric is None:
+                metric = self._metrics[name] = create()
+        if not isinstance(metric, metric_type):
+            raise ValueError(
+                f"Metric '{name}' is already registered as a {metric.kind}"
+            )
+        return metric
+
+    def checkpoint(self) -> MetricsCheckpoint:
+        """Copy the current values, to report changes since now via ``snapshot``."""
+        with self._lock:
+            return MetricsCheckpoint(
+                {name: metric.copy_values() for name, metric in self._metrics.items()}
+            )
+
+    def render_prometheus(self) -> str:
+        """Render every metric in the Prometheus text exposition format (0.0.4)."""
+        lines: list[str] = []
+        with self._lock:
+            for name, metric in sorted(self._metrics.items()):
+                documentation = metric.documentation.replace("\\", "\\\\").replace(
+                    "\n", "\\n"
+                )
+                lines.append(f"# HELP {name} {documentation}")
+                lines.append(f"# TYPE {name} {metric.kind}")
+                lines.extend(metric.render_lines())
+        return "\n".join(lines) + "\n" if lines else ""
+
+    def snapshot(self, since: MetricsCheckpoint | None = None) -> dict[str, JsonValue]:
+        """Return every metric as JSON-compatible data.
+
+        Args:
+            since: Report counters and histograms as the change since this
+                checkpoint; gauges always report their current value.
+
+        Returns:
+            Metric name -> ``{"type", "help", "samples"}``.
+
+        """
+        data: dict[str, JsonValue] = {}
+        with self._lock:
+            for name, metric in sorted(self._metrics.items()):
+                before = since.values_for(name) if since is not None else None
+                data[name] = {
+                    "type": metric.kind,
+                    "help": metric.documentation,
+                    "samples": metric.samples(before),
+                }
+        return data
+
+
+class MetricsRegistryFactory:
+    """Provides one shared ``MetricsRegistry`` to a ``ServiceContainer``.
+
+    Satisfies the ``ServiceFactory[MetricsRegistry]`` protocol.
+    """
+
+    def __init__(self, registry: MetricsRegistry | None = None) -> None:
+        """Initialise the factory.
+
+        Args:
+            registry: Registry to provide, or None to create a new one.
+
+        """
+        self._registry = registry if registry is not None else MetricsRegistry()
+
+    def can_create(self) -> bool:
+        """Return True: the registry needs no configuration."""
+        return True
+
+    def create(self) -> MetricsRegistry:
+        """Return the shared registry."""
+        return self._registry
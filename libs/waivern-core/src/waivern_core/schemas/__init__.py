@@ -14,16 +14,26 @@ from waivern_core.schemas.finding_types import (
     BaseFindingMetadata,
     BaseFindingModel,
     BaseSchemaOutput,
+    InternedStr,
     PatternMatchDetail,
+    SharedStr,
+    share_context,
+    share_str,
 )
 from waivern_core.schemas.loader import (
     JsonSchemaLoader,
     SchemaLoader,
     SchemaLoadError,
 )
-from waivern_core.schemas.registry import SchemaRegistry
+from waivern_core.schemas.registry import SchemaRegistry, ValidationPolicy
 from waivern_core.schemas.schema import Schema
 from waivern_core.schemas.validation import DataParsingError, parse_data_model
+from waivern_core.schemas.validator import (
+    SchemaValidationError,
+    SchemaValidator,
+    ValidatorBackend,
+    compile_validator,
+)
 
 __all__ = [
     # Base schema infrastructure
@@ -32,6 +42,12 @@ __all__ = [
     "SchemaLoadError",
     "SchemaLoader",
     "SchemaRegistry",
+    "ValidationPolicy",
+    # Compiled validators
+    "SchemaValidationError",
+    "SchemaValidator",
+    "ValidatorBackend",
+    "compile_validator",
     # Finding types (analyser output)
     "BaseFindingModel",
     "BaseFindingMetadata",
@@ -39,6 +55,10 @@ __all__ = [
     "BaseAnalysisOutputMetadata",
     "BaseSchemaOutput",
     "PatternMatchDetail",
+    "InternedStr",
+    "SharedStr",
+    "share_context",
+    "share_str",
     # Validation utilities
     "parse_data_model",
     "DataParsingError",
@@ -2,20 +2,89 @@
 
 This module contains base types and models for analyser output,
 including finding metadata and evidence.
+
+Findings repeat the same short strings (sources, categories, purposes,
+pattern names) across thousands of rows, so every finding holding the same
+value shares one string object:
+
+- Fields drawn from a ruleset's fixed vocabulary (categories, purposes,
+  pattern names) are ``InternedStr``. Interned strings are immortal on
+  CPython 3.12+, which is fine for a bounded vocabulary.
+- Fields whose values grow with the data (sources, context values such as
+  file paths and row locations) are ``SharedStr``, deduplicated through a
+  bounded table so a long-running process does not keep every value alive.
+
+Sharing happens during validation only; the JSON schema and the serialised
+values are plain strings.
 """
 
 from __future__ import annotations
 
 import json
+import sys
 import uuid
 from datetime import UTC, datetime
 from pathlib import Path
 from typing import Annotated, ClassVar
 
-from pydantic import BaseModel, ConfigDict, Field, PlainSerializer
+from pydantic import AfterValidator, BaseModel, ConfigDict, Field, PlainSerializer
 
 from waivern_core.types import JsonValue
 
+# Entries kept by share_str before its table is emptied
+_SHARED_STRINGS_MAX = 65_536
+
+_shared_strings: dict[str, str] = {}
+
+
+def share_str(value: str) -> str:
+    """Return the shared copy of a string from a bounded table.
+
+    Unlike ``sys.intern``, the table drops all its entries once it holds
+    ``_SHARED_STRINGS_MAX`` strings, so values are freed once no finding
+    references them. Sharing is best effort: equal strings validated on
+    either side of a reset are separate objects.
+
+    Args:
+        value: String to share.
+
+    Returns:
+        A string equal to ``value``, shared with earlier equal values.
+
+    """
+    shared = _shared_strings.get(value)
+    if shared is None:
+        if len(_shared_strings) >= _SHARED_STRINGS_MAX:
+            _shared_strings.clear()
+        shared = _shared_strings[value] = value
+    return shared
+
+
+# Plain aliases (not ``type`` statements) so generated JSON schemas keep an
+# inline ``{"type": "string"}`` instead of a named definition
+InternedStr = Annotated[str, AfterValidator(sys.intern)]
+SharedStr = Annotated[str, AfterValidator(share_str)]
+
+
+def share_context(context: dict[str, JsonValue]) -> dict[str, JsonValue]:
+    """Share top-level string values of a finding context.
+
+    Context values (connector type, artifact id, ...) are identical for
+    every finding produced from the same input, so they are shared like
+    ``SharedStr`` fields. Nested values are left untouched.
+
+    Args:
+        context: Finding context mapping.
+
+    Returns:
+        The same mapping, with string values replaced by shared strings.
+
+    """
+    for key, value in context.items():
+        if isinstance(value, str):
+            context[key] = share_str(value)
+    return context
+
 
 class BaseFindingEvidence(BaseModel):
     """Evidence item with content and collection timestamp."""
@@ -41,8 +110,10 @@ class BaseFindingMetadata(BaseModel):
 
     model_config = ConfigDict(extra="forbid")
 
-    source: str = Field(description="Source file or location where the data was found")
-    context: dict[str, JsonValue] = Field(
+    source: SharedStr = Field(
+        description="Source file or location where the data was found"
+    )
+    context: Annotated[dict[str, JsonValue], AfterValidator(share_context)] = Field(
         default_factory=dict,
         description="Extensible context for pipeline metadata (connector_type, artifact_id, etc.)",
     )
@@ -56,7 +127,7 @@ class PatternMatchDetail(BaseModel):
     which is useful for auditing and confidence assessment.
     """
 
-    pattern: str = Field(description="The pattern that matched")
+    pattern: InternedStr = Field(description="The pattern that matched")
     match_count: int = Field(
         ge=1, description="Number of times this pattern matched in the content"
     )
@@ -10,6 +10,12 @@ import json
 from pathlib import Path
 from typing import Any, Protocol, runtime_checkable
 
+from waivern_core.schemas.validator import (
+    SchemaValidator,
+    ValidatorBackend,
+    compile_validator,
+)
+
 
 class SchemaLoadError(Exception):
     """Raised when schema files cannot be loaded or parsed."""
@@ -45,24 +51,37 @@ class JsonSchemaLoader:
     for different project structures. If no paths are provided, it searches
     package-relative paths (json_schemas/ directory alongside this file).
 
-    The loader caches schemas after first load to improve performance.
+    The loader caches schemas after first load to improve performance, and
+    caches compiled validators so each schema is only compiled once.
 
     Design note: Schema search paths are registered centrally by ``waivern-schemas``
     via ``SchemaRegistry``. Individual components should not configure their own
     search paths.
     """
 
-    def __init__(self, search_paths: list[Path] | None = None) -> None:
+    def __init__(
+        self,
+        search_paths: list[Path] | None = None,
+        validator_backend: ValidatorBackend = "jsonschema",
+    ) -> None:
         """Initialize with empty cache and optional search paths.
 
         Args:
             search_paths: Optional list of base directories to search for schemas.
                          If provided, ONLY these paths are searched (overrides defaults).
                          If None, uses package-relative path (json_schemas/ alongside this file).
+            validator_backend: Backend used to compile validators (see get_validator)
 
         """
         self._cache: dict[tuple[str, str], dict[str, Any]] = {}
+        self._validators: dict[tuple[str, str], SchemaValidator] = {}
         self._custom_search_paths = search_paths
+        self._validator_backend: ValidatorBackend = validator_backend
+
+    @property
+    def validator_backend(self) -> ValidatorBackend:
+        """Return the backend used to compile validators."""
+        return self._validator_backend
 
     def _generate_schema_paths(self, schema_name: str, version: str) -> list[Path]:
         """Generate list of paths to search for schema files.
@@ -148,3 +167,37 @@ class JsonSchemaLoader:
         raise FileNotFoundError(
             f"Schema file for '{schema_name}' version '{version}' not found in any of: {schema_paths}"
         )
+
+    def get_validator(
+        self, schema_name: str, version: str = "1.0.0"
+    ) -> SchemaValidator:
+        """Get a compiled validator for a schema, compiling it on first use.
+
+        Args:
+            schema_name: Name of the schema
+            version: Version of the schema
+
+        Returns:
+            Cached validator for the schema definition
+
+        Raises:
+            FileNotFoundError: If schema file doesn't exist
+            SchemaLoadError: If schema file cannot be parsed or compiled
+
+        """
+        cache_key = (schema_name, version)
+        validator = self._validators.get(cache_key)
+        if validator is None:
+            schema_def = self.load(schema_name, version)
+            try:
+                validator = compile_validator(schema_def, self._validator_backend)
+            except ImportError as e:
+                raise SchemaLoadError(
+                    f"Validator backend '{self._validator_backend}' is not installed: {e}"
+                ) from e
+            except Exception as e:
+                raise SchemaLoadError(
+                    f"Cannot compile schema '{schema_name}' version '{version}': {e}"
+                ) from e
+            self._validators[cache_key] = validator
+        return validator
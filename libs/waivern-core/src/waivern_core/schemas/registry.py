@@ -6,10 +6,26 @@ enabling packages to contribute their own schemas without modifying waivern-core
 
 from __future__ import annotations
 
+import os
 from pathlib import Path
-from typing import ClassVar, TypedDict
+from typing import ClassVar, Literal, TypedDict, cast
 
 from waivern_core.schemas.loader import JsonSchemaLoader
+from waivern_core.schemas.validator import VALIDATOR_BACKENDS, ValidatorBackend
+
+VALIDATOR_BACKEND_ENV_VAR = "WAIVERN_SCHEMA_VALIDATOR"
+VALIDATION_POLICY_ENV_VAR = "WAIVERN_VALIDATION_POLICY"
+
+type ValidationPolicy = Literal["full", "boundary"]
+"""When message content is validated against its JSON schema.
+
+- ``full``: every ``Message.validate()`` call runs JSON Schema validation.
+- ``boundary``: messages carrying an already-validated typed model skip
+  re-validation in-process; only data entering the run from outside (connector
+  output, reused artifacts, exports) is validated.
+"""
+
+VALIDATION_POLICIES: tuple[ValidationPolicy, ...] = ("full", "boundary")
 
 
 class SchemaRegistryState(TypedDict):
@@ -21,6 +37,8 @@ class SchemaRegistryState(TypedDict):
 
     search_paths: list[Path]
     initialised: bool
+    validator_backend: ValidatorBackend | None
+    validation_policy: ValidationPolicy | None
 
 
 class SchemaRegistry:
@@ -41,6 +59,12 @@ class SchemaRegistry:
     # Shared singleton loader for caching across all Schema instances
     _loader: ClassVar[JsonSchemaLoader | None] = None
 
+    # Explicit validator backend (None = environment variable or "jsonschema")
+    _validator_backend: ClassVar[ValidatorBackend | None] = None
+
+    # Explicit validation policy (None = environment variable or "full")
+    _validation_policy: ClassVar[ValidationPolicy | None] = None
+
     @classmethod
     def _ensure_initialised(cls) -> None:
         """Ensure default search paths are registered (called once)."""
@@ -95,9 +119,102 @@ class SchemaRegistry:
         """
         if cls._loader is None:
             search_paths = cls.get_search_paths()
-            cls._loader = JsonSchemaLoader(search_paths=search_paths)
+            cls._loader = JsonSchemaLoader(
+                search_paths=search_paths,
+                validator_backend=cls.get_validator_backend(),
+            )
         return cls._loader
 
+    @classmethod
+    def set_validator_backend(cls, backend: ValidatorBackend | None) -> None:
+        """Select the backend used to compile schema validators.
+
+        Args:
+            backend: "jsonschema", "fastjsonschema", or None to fall back to the
+                WAIVERN_SCHEMA_VALIDATOR environment variable
+
+        Raises:
+            ValueError: If the backend is unknown
+
+        Note:
+            Invalidates the singleton loader cache so validators are recompiled.
+
+        """
+        if backend is not None and backend not in VALIDATOR_BACKENDS:
+            raise ValueError(
+                f"Unknown validator backend '{backend}'. Expected one of: {VALIDATOR_BACKENDS}"
+            )
+        cls._validator_backend = backend
+        cls._loader = None
+
+    @classmethod
+    def get_validator_backend(cls) -> ValidatorBackend:
+        """Get the validator backend for the shared loader.
+
+        Returns:
+            Explicitly selected backend, otherwise the WAIVERN_SCHEMA_VALIDATOR
+            environment variable, otherwise "jsonschema"
+
+        Raises:
+            ValueError: If the environment variable names an unknown backend
+
+        """
+        if cls._validator_backend is not None:
+            return cls._validator_backend
+
+        env_backend = os.getenv(VALIDATOR_BACKEND_ENV_VAR, "").strip().lower()
+        if not env_backend:
+            return "jsonschema"
+        if env_backend not in VALIDATOR_BACKENDS:
+            raise ValueError(
+                f"Invalid {VALIDATOR_BACKEND_ENV_VAR} '{env_backend}'. "
+                f"Expected one of: {VALIDATOR_BACKENDS}"
+            )
+        return cast(ValidatorBackend, env_backend)
+
+    @classmethod
+    def set_validation_policy(cls, policy: ValidationPolicy | None) -> None:
+        """Select when message content is validated against its schema.
+
+        Args:
+            policy: "full", "boundary", or None to fall back to the
+                WAIVERN_VALIDATION_POLICY environment variable
+
+        Raises:
+            ValueError: If the policy is unknown
+
+        """
+        if policy is not None and policy not in VALIDATION_POLICIES:
+            raise ValueError(
+                f"Unknown validation policy '{policy}'. Expected one of: {VALIDATION_POLICIES}"
+            )
+        cls._validation_policy = policy
+
+    @classmethod
+    def get_validation_policy(cls) -> ValidationPolicy:
+        """Get the active validation policy.
+
+        Returns:
+            Explicitly selected policy, otherwise the WAIVERN_VALIDATION_POLICY
+            environment variable, otherwise "full"
+
+        Raises:
+            ValueError: If the environment variable names an unknown policy
+
+        """
+        if cls._validation_policy is not None:
+            return cls._validation_policy
+
+        env_policy = os.getenv(VALIDATION_POLICY_ENV_VAR, "").strip().lower()
+        if not env_policy:
+            return "full"
+        if env_policy not in VALIDATION_POLICIES:
+            raise ValueError(
+                f"Invalid {VALIDATION_POLICY_ENV_VAR} '{env_policy}'. "
+                f"Expected one of: {VALIDATION_POLICIES}"
+            )
+        return cast(ValidationPolicy, env_policy)
+
     @classmethod
     def clear_search_paths(cls) -> None:
         """Clear all registered search paths (primarily for testing).
@@ -108,6 +225,8 @@ class SchemaRegistry:
         """
         cls._search_paths.clear()
         cls._initialised = False
+        cls._validator_backend = None
+        cls._validation_policy = None
         cls._loader = None
 
     @classmethod
@@ -124,6 +243,8 @@ class SchemaRegistry:
         return {
             "search_paths": cls._search_paths.copy(),
             "initialised": cls._initialised,
+            "validator_backend": cls._validator_backend,
+            "validation_policy": cls._validation_policy,
             # Note: _loader is not captured - it will be recreated as needed
         }
 
@@ -140,4 +261,6 @@ class SchemaRegistry:
         """
         cls._search_paths = state["search_paths"].copy()
         cls._initialised = state["initialised"]
+        cls._validator_backend = state["validator_backend"]
+        cls._validation_policy = state["validation_policy"]
         cls._loader = None  # Force recreation with restored paths
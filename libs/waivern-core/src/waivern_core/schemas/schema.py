@@ -10,6 +10,7 @@ from typing import Any, override
 
 from waivern_core.schemas.loader import JsonSchemaLoader
 from waivern_core.schemas.registry import SchemaRegistry
+from waivern_core.schemas.validator import SchemaValidator
 
 
 class Schema:
@@ -73,6 +74,23 @@ class Schema:
 
         return self._schema_def
 
+    @property
+    def validator(self) -> SchemaValidator:
+        """Get compiled validator for this schema.
+
+        Validators are cached by the loader, keyed by (name, version), so every
+        Schema instance with the same identity shares one compiled validator.
+
+        Raises:
+            SchemaLoadError: If schema file cannot be loaded or compiled
+            FileNotFoundError: If schema JSON file doesn't exist
+
+        """
+        loader = (
+            self._loader if self._loader is not None else SchemaRegistry.get_loader()
+        )
+        return loader.get_validator(self.name, self.version)
+
     @override
     def __eq__(self, other: object) -> bool:
         """Compare schemas based on (name, version) tuple.
@@ -0,0 +1,170 @@
+"""Compiled JSON Schema validators for Waivern Compliance Framework.
+
+``jsonschema.validate()`` checks the schema definition against its meta-schema
+and builds a fresh validator on every call. Components validate every output
+message (sidecars included), so this module compiles a validator once per
+schema definition and lets the loader cache it by ``(name, version)``.
+
+Two backends are available:
+- ``jsonschema``: the reference implementation (default)
+- ``fastjsonschema``: code-generated validation functions, considerably faster
+  on large payloads. Optional - install ``fastjsonschema`` to enable it.
+"""
+
+from __future__ import annotations
+
+import itertools
+from typing import Any, Literal, Protocol
+
+import jsonschema
+from jsonschema.exceptions import best_match
+
+type ValidatorBackend = Literal["jsonschema", "fastjsonschema"]
+
+VALIDATOR_BACKENDS: tuple[ValidatorBackend, ...] = ("jsonschema", "fastjsonschema")
+
+# Keywords whose object keys are names (property/definition names), not keywords
+_NAMED_SUBSCHEMA_KEYWORDS = frozenset(
+    {"properties", "patternProperties", "definitions", "$defs", "dependencies"}
+)
+
+
+class SchemaValidationError(Exception):
+    """Raised when content does not conform to its schema definition."""
+
+    def __init__(self, message: str) -> None:
+        """Initialise with the most relevant validation failure message.
+
+        Args:
+            message: Human-readable description of the validation failure
+
+        """
+        super().__init__(message)
+        self.message = message
+
+
+class SchemaValidator(Protocol):
+    """Protocol for a validator compiled from a single schema definition."""
+
+    def validate(self, instance: Any) -> None:  # noqa: ANN401 - validates arbitrary JSON
+        """Validate an instance against the compiled schema.
+
+        Raises:
+            SchemaValidationError: If the instance does not conform
+
+        """
+        ...
+
+
+class JsonSchemaValidator:
+    """Validator backed by the reference ``jsonschema`` implementation.
+
+    The schema definition is checked against its meta-schema once, at
+    construction, instead of on every validation call.
+    """
+
+    def __init__(self, schema_def: dict[str, Any]) -> None:
+        """Compile validator for the given schema definition.
+
+        Args:
+            schema_def: JSON schema definition
+
+        Raises:
+            jsonschema.SchemaError: If the definition is not a valid schema
+
+        """
+        validator_class = jsonschema.validators.validator_for(schema_def)
+        validator_class.check_schema(schema_def)
+        self._validator = validator_class(schema_def)
+
+    def validate(self, instance: Any) -> None:  # noqa: ANN401 - validates arbitrary JSON
+        """Validate an instance, reporting the best matching error on failure."""
+        errors = self._validator.iter_errors(instance)
+        first = next(errors, None)
+        if first is None:
+            return
+
+        # Same error selection as jsonschema.validate() for consistent messages
+        error = best_match(itertools.chain([first], errors))
+        raise SchemaValidationError(error.message) from error
+
+
+class FastJsonSchemaValidator:
+    """Validator backed by code generated with ``fastjsonschema``.
+
+    fastjsonschema writes schema defaults into the validated data. Defaults are
+    stripped from the definition before compiling so validation never mutates
+    message content.
+    """
+
+    def __init__(self, schema_def: dict[str, Any]) -> None:
+        """Generate validation function for the given schema definition.
+
+        Args:
+            schema_def: JSON schema definition
+
+        Raises:
+            ImportError: If fastjsonschema is not installed
+
+        """
+        import fastjsonschema  # noqa: PLC0415 - optional dependency
+
+        self._value_error = fastjsonschema.JsonSchemaValueException
+        # Formats are annotations only in jsonschema's default configuration
+        self._validate = fastjsonschema.compile(
+            _strip_defaults(schema_def), use_formats=False
+        )
+
+    def validate(self, instance: Any) -> None:  # noqa: ANN401 - validates arbitrary JSON
+        """Validate an instance using the generated function."""
+        try:
+            self._validate(instance)
+        except self._value_error as e:
+            raise SchemaValidationError(str(e.message)) from e
+
+
+def compile_validator(
+    schema_def: dict[str, Any], backend: ValidatorBackend = "jsonschema"
+) -> SchemaValidator:
+    """Compile a validator for a schema definition.
+
+    Args:
+        schema_def: JSON schema definition
+        backend: Validator backend to compile with
+
+    Returns:
+        Reusable validator for the definition
+
+    Raises:
+        ValueError: If the backend is unknown
+
+    """
+    if backend == "jsonschema":
+        return JsonSchemaValidator(schema_def)
+    if backend == "fastjsonschema":
+        return FastJsonSchemaValidator(schema_def)
+    raise ValueError(
+        f"Unknown validator backend '{backend}'. Expected one of: {VALIDATOR_BACKENDS}"
+    )
+
+
+def _strip_defaults(node: Any, *, is_property_map: bool = False) -> Any:  # noqa: ANN401
+    """Return a copy of a schema definition without ``default`` keywords.
+
+    Keys of ``properties``/``$defs``/``definitions`` maps are names rather than
+    keywords, so a property called ``default`` is preserved.
+    """
+    if isinstance(node, list):
+        return [_strip_defaults(item) for item in node]  # type: ignore[reportUnknownVariableType]
+    if not isinstance(node, dict):
+        return node
+
+    result: dict[str, Any] = {}
+    for key, value in node.items():  # type: ignore[reportUnknownVariableType]
+        if key == "default" and not is_property_map:
+            continue
+        result[key] = _strip_defaults(
+            value,
+            is_property_map=not is_property_map and key in _NAMED_SUBSCHEMA_KEYWORDS,
+        )
+    return result
@@ -0,0 +1,98 @@
+"""Cached manifest of component entry points.
+
+Scanning ``importlib.metadata`` for entry points reads the metadata of every
+installed distribution. The manifest stores the result (group -> name ->
+``module:attribute`` reference) in a JSON file, together with a fingerprint
+of the Python environment, so later processes can skip the scan until
+something is installed or removed.
+"""
+
+from __future__ import annotations
+
+import contextlib
+import hashlib
+import json
+import logging
+import os
+import sys
+from pathlib import Path
+
+logger = logging.getLogger(__name__)
+
+type EntryPointReferences = dict[str, dict[str, str]]
+"""Entry point group -> entry point name -> ``module:attribute`` reference."""
+
+_MANIFEST_VERSION = 1
+
+
+def environment_fingerprint() -> str:
+    """Fingerprint the interpreter and its import path.
+
+    Installing or removing a distribution (including an editable
+    reinstall) adds or removes a ``.dist-info`` directory, which changes
+    the modification time of the directory on ``sys.path`` holding it.
+    """
+    digest = hashlib.sha256()
+    digest.update(sys.version.encode())
+    digest.update(sys.prefix.encode())
+    for entry in sys.path:
+        try:
+            mtime = os.stat(entry or ".").st_mtime_ns
+        except OSError:
+            continue
+        digest.update(f"{entry}\0{mtime}\0".encode())
+    return digest.hexdigest()
+
+
+class ComponentManifest:
+    """JSON file caching entry point references for one Python environment."""
+
+    def __init__(self, path: Path) -> None:
+        """Initialise the manifest.
+
+        Args:
+            path: File the manifest is read from and written to.
+
+        """
+        self._path = path
+
+    @property
+    def path(self) -> Path:
+        """File the manifest is read from and written to."""
+        return self._path
+
+    def load(self) -> EntryPointReferences | None:
+        """Return the cached references, or None if missing, corrupt or stale."""
+        try:
+            data = json.loads(self._path.read_text(encoding="utf-8"))
+        except (OSError, ValueError):
+            return None
+
+        if (
+            not isinstance(data, dict)
+            or data.get("version") != _MANIFEST_VERSION
+            or data.get("fingerprint") != environment_fingerprint()
+            or not isinstance(data.get("groups"), dict)
+        ):
+            return None
+        return data["groups"]  # type: ignore[no-any-return]
+
+    def save(self, groups: EntryPointReferences) -> None:
+        """Write the references atomically.
+
+        The manifest is only a cache: failure to write it is logged, not raised.
+        """
+        data = {
+            "version": _MANIFEST_VERSION,
+            "fingerprint": environment_fingerprint(),
+            "groups": groups,
+        }
+        partial = self._path.with_name(f"{self._path.name}.{os.getpid()}.partial")
+        try:
+            self._path.parent.mkdir(parents=True, exist_ok=True)
+            partial.write_text(json.dumps(data, indent=2), encoding="utf-8")
+            partial.replace(self._path)
+        except OSError as e:
+            logger.debug("Cannot write component manifest %s: %s", self._path, e)
+            with contextlib.suppress(OSError):
+                partial.unlink(missing_ok=True)
@@ -3,13 +3,19 @@
 The ComponentRegistry provides a single source of truth for component
 discovery via entry points. It wraps the ServiceContainer and provides
 lazy-loaded access to connector, processor, and dispatcher factories.
+
+Discovery only lists entry points; a factory's module (and the heavy
+dependencies it imports, e.g. database drivers or LLM SDKs) is imported the
+first time the factory is looked up by name.
 """
 
 from __future__ import annotations
 
 import logging
-from collections.abc import Mapping
-from importlib.metadata import entry_points
+from collections.abc import Callable, Iterable, Iterator, Mapping
+from importlib.metadata import EntryPoint, entry_points
+from pathlib import Path
+from typing import override
 
 from waivern_core.base_connector import Connector
 from waivern_core.base_processor import Processor
@@ -22,9 +28,63 @@ from waivern_core.dispatch import (
     RequestDispatcher,
 )
 from waivern_core.services.container import ServiceContainer
+from waivern_core.services.manifest import ComponentManifest, EntryPointReferences
 
 logger = logging.getLogger(__name__)
 
+_SCHEMAS_GROUP = "waivern.schemas"
+_CONNECTORS_GROUP = "waivern.connectors"
+_PROCESSORS_GROUP = "waivern.processors"
+_DISPATCHERS_GROUP = "waivern.dispatchers"
+_GROUPS = (_SCHEMAS_GROUP, _CONNECTORS_GROUP, _PROCESSORS_GROUP, _DISPATCHERS_GROUP)
+
+
+class _LazyFactories[F](Mapping[str, F]):
+    """Factories keyed by entry point name, each loaded on first lookup.
+
+    Membership tests, iteration and ``len()`` only use the entry point
+    names; ``m[name]``, ``values()`` and ``items()`` load factories.
+    """
+
+    def __init__(
+        self,
+        group: str,
+        entry_points: Mapping[str, EntryPoint],
+        load: Callable[[str, str, EntryPoint], F],
+    ) -> None:
+        self._group = group
+        self._entry_points = entry_points
+        self._load = load
+        self._loaded: dict[str, F] = {}
+
+    @override
+    def __getitem__(self, name: str) -> F:
+        if name not in self._loaded:
+            entry_point = self._entry_points[name]
+            self._loaded[name] = self._load(self._group, name, entry_point)
+        return self._loaded[name]
+
+    @override
+    def __contains__(self, name: object) -> bool:
+        return name in self._entry_points
+
+    @override
+    def __iter__(self) -> Iterator[str]:
+        return iter(self._entry_points)
+
+    @override
+    def __len__(self) -> int:
+        return len(self._entry_points)
+
+    @property
+    def group(self) -> str:
+        """Entry point group the factories belong to."""
+        return self._group
+
+    def references(self) -> dict[str, str]:
+        """Return ``module:attribute`` references by name, without loading."""
+        return {name: ep.value for name, ep in self._entry_points.items()}
+
 
 class ComponentRegistry:
     """Centralises component discovery and factory management.
@@ -33,8 +93,12 @@ class ComponentRegistry:
     entry points and provides unified access for all consumers (Planner, Executor,
     CLI commands).
 
-    Discovery is lazy - factories are only instantiated on first access to
-    connector_factories, processor_factories, or dispatcher_factories properties.
+    Discovery is lazy - entry points are only listed on first access to
+    connector_factories, processor_factories, or dispatcher_factories
+    properties, and each factory is imported and instantiated on first
+    lookup by name. With a ``manifest_path``, the entry point listing is
+    cached in a ``ComponentManifest`` and reused while the Python
+    environment is unchanged.
 
     Example:
         >>> container = ServiceContainer()
@@ -47,18 +111,31 @@ class ComponentRegistry:
 
     """
 
-    def __init__(self, container: ServiceContainer) -> None:
+    def __init__(
+        self, container: ServiceContainer, *, manifest_path: Path | None = None
+    ) -> None:
         """Initialise registry with service container.
 
         Args:
             container: ServiceContainer for factory dependency injection.
+            manifest_path: Optional file caching the entry point listing
+                between processes.
 
         """
         self._container = container
-        self._connector_factories: dict[str, ComponentFactory[Connector]] | None = None
-        self._processor_factories: dict[str, ComponentFactory[Processor]] | None = None
+        self._manifest = (
+            ComponentManifest(manifest_path) if manifest_path is not None else None
+        )
+        self._from_manifest = False
+        self._rescanned: dict[str, dict[str, EntryPoint]] | None = None
+        self._connector_factories: (
+            _LazyFactories[ComponentFactory[Connector]] | None
+        ) = None
+        self._processor_factories: (
+            _LazyFactories[ComponentFactory[Processor]] | None
+        ) = None
         self._dispatcher_factories: (
-            dict[str, DispatcherFactory[DispatchRequest, DispatchResult]] | None
+            _LazyFactories[DispatcherFactory[DispatchRequest, DispatchResult]] | None
         ) = None
 
     @property
@@ -89,6 +166,27 @@ class ComponentRegistry:
             self._discover_components()
         return self._dispatcher_factories  # type: ignore[return-value]
 
+    def entry_point_references(self) -> dict[str, dict[str, str]]:
+        """Describe discovered components without importing them.
+
+        Returns:
+            Entry point group -> component name -> ``module:attribute``
+            reference, for connectors, processors and dispatchers.
+
+        """
+        if self._connector_factories is None:
+            self._discover_components()
+        groups = (
+            self._connector_factories,
+            self._processor_factories,
+            self._dispatcher_factories,
+        )
+        return {
+            factories.group: factories.references()
+            for factories in groups
+            if factories is not None
+        }
+
     def get_dispatcher_for(
         self, request_type: type[DispatchRequest]
     ) -> RequestDispatcher[DispatchRequest, DispatchResult]:
@@ -132,40 +230,83 @@ class ComponentRegistry:
         raise ValueError(msg)
 
     def _discover_components(self) -> None:
-        """Discover connector, processor, and dispatcher factories from entry points.
+        """List connector, processor, and dispatcher entry points.
 
         Also registers schemas from packages via waivern.schemas entry points.
         Schema registration must happen before components are used to ensure
         schema files can be found.
         """
+        groups = self._list_entry_points()
+
         # Register schemas first (before component factories need them)
-        self._register_schemas()
-
-        self._connector_factories = {}
-        self._processor_factories = {}
-        self._dispatcher_factories = {}
-
-        # Discover connectors
-        for ep in entry_points(group="waivern.connectors"):
-            factory_class = ep.load()
-            factory = factory_class(self._container)
-            self._connector_factories[ep.name] = factory
-
-        # Discover processors
-        for ep in entry_points(group="waivern.processors"):
-            factory_class = ep.load()
-            factory = factory_class(self._container)
-            self._processor_factories[ep.name] = factory
-
-        # Discover dispatchers
-        for ep in entry_points(group="waivern.dispatchers"):
-            factory_class = ep.load()
-            factory = factory_class(self._container)
-            self._dispatcher_factories[ep.name] = factory
-
-    def _register_schemas(self) -> None:
+        self._register_schemas(groups[_SCHEMAS_GROUP].values())
+
+        self._connector_factories = _LazyFactories(
+            _CONNECTORS_GROUP, groups[_CONNECTORS_GROUP], self._load_factory
+        )
+        self._processor_factories = _LazyFactories(
+            _PROCESSORS_GROUP, groups[_PROCESSORS_GROUP], self._load_factory
+        )
+        self._dispatcher_factories = _LazyFactories(
+            _DISPATCHERS_GROUP, groups[_DISPATCHERS_GROUP], self._load_factory
+        )
+
+    def _list_entry_points(self) -> dict[str, dict[str, EntryPoint]]:
+        """Return entry points by group, from the manifest when it is current."""
+        if self._manifest is not None:
+            cached = self._manifest.load()
+            if cached is not None:
+                self._from_manifest = True
+                return {
+                    group: {
+                        name: EntryPoint(name=name, value=value, group=group)
+                        for name, value in cached.get(group, {}).items()
+                    }
+                    for group in _GROUPS
+                }
+
+        return self._scan_entry_points()
+
+    def _scan_entry_points(self) -> dict[str, dict[str, EntryPoint]]:
+        """Read entry points from installed distributions (and cache them)."""
+        groups = {
+            group: {ep.name: ep for ep in entry_points(group=group)}
+            for group in _GROUPS
+        }
+        if self._manifest is not None:
+            references: EntryPointReferences = {
+                group: {name: ep.value for name, ep in eps.items()}
+                for group, eps in groups.items()
+            }
+            self._manifest.save(references)
+        return groups
+
+    def _load_factory[F](self, group: str, name: str, entry_point: EntryPoint) -> F:
+        """Import a factory class and instantiate it with the container.
+
+        If the entry point came from the manifest and no longer imports
+        (e.g. a package was changed in place), entry points are rescanned
+        and the lookup is retried once.
+        """
+        try:
+            factory_class = entry_point.load()
+        except (ImportError, AttributeError):
+            if not self._from_manifest:
+                raise
+            if self._rescanned is None:
+                logger.info("Component manifest is stale; rescanning entry points")
+                self._rescanned = self._scan_entry_points()
+            fresh = self._rescanned[group].get(name)
+            if fresh is None:
+                raise
+            factory_class = fresh.load()
+
+        logger.debug("Loaded %s factory '%s'", group, name)
+        return factory_class(self._container)
+
+    def _register_schemas(self, schema_entry_points: Iterable[EntryPoint]) -> None:
         """Register schemas from all packages via entry points."""
-        for ep in entry_points(group="waivern.schemas"):
+        for ep in schema_entry_points:
             try:
                 register_func = ep.load()
                 register_func()
@@ -6,7 +6,7 @@ from typing import Any, override
 import pytest
 from waivern_schemas import register_schemas
 
-from waivern_core.schemas import Schema
+from waivern_core.schemas import Schema, SchemaValidator, compile_validator
 
 
 @pytest.fixture(autouse=True)
@@ -53,3 +53,8 @@ class MockTypedSchema(Schema):
     @override
     def schema(self) -> dict[str, Any]:
         return self._schema_definition
+
+    @property
+    @override
+    def validator(self) -> SchemaValidator:
+        return compile_validator(self._schema_definition)
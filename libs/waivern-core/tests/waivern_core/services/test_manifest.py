@@ -0,0 +1,50 @@
+"""Tests for ComponentManifest - the cached entry point listing."""
+
+import json
+from pathlib import Path
+
+from waivern_core.services.manifest import ComponentManifest
+
+REFERENCES = {"waivern.connectors": {"filesystem": "pkg:FilesystemConnectorFactory"}}
+
+
+class TestComponentManifest:
+    """Test suite for ComponentManifest."""
+
+    def test_save_then_load_round_trips(self, tmp_path: Path) -> None:
+        """Saved references are returned while the environment is unchanged."""
+        manifest = ComponentManifest(tmp_path / "cache" / "components.json")
+
+        manifest.save(REFERENCES)
+
+        assert manifest.load() == REFERENCES
+
+    def test_missing_file_loads_as_none(self, tmp_path: Path) -> None:
+        """A manifest that was never written is treated as absent."""
+        assert ComponentManifest(tmp_path / "components.json").load() is None
+
+    def test_changed_environment_loads_as_none(self, tmp_path: Path) -> None:
+        """A manifest written for another environment is stale."""
+        path = tmp_path / "components.json"
+        ComponentManifest(path).save(REFERENCES)
+        data = json.loads(path.read_text())
+        data["fingerprint"] = "another-environment"
+        path.write_text(json.dumps(data))
+
+        assert ComponentManifest(path).load() is None
+
+    def test_corrupt_file_loads_as_none(self, tmp_path: Path) -> None:
+        """A truncated manifest is ignored rather than raised."""
+        path = tmp_path / "components.json"
+        path.write_text('{"version": 1, "groups"')
+
+        assert ComponentManifest(path).load() is None
+
+    def test_unwritable_location_is_ignored(self, tmp_path: Path) -> None:
+        """Failing to write the cache does not raise."""
+        blocker = tmp_path / "blocker"
+        blocker.write_text("")
+
+        ComponentManifest(blocker / "components.json").save(REFERENCES)
+
+        assert ComponentManifest(blocker / "components.json").load() is None
@@ -3,16 +3,21 @@
 These tests verify the registry's ability to:
 - Expose the underlying ServiceContainer
 - Lazily discover components from entry points
+- Import each factory only when it is looked up by name
 - Cache discovered factories after first access
+- Reuse a cached entry point manifest between registries
 - Discover dispatcher factories and resolve dispatchers by request type
 """
 
-from unittest.mock import MagicMock, patch
+from importlib.metadata import EntryPoint
+from pathlib import Path
+from unittest.mock import MagicMock, Mock, patch
 
 import pytest
 
 from waivern_core.dispatch import DispatcherUnavailableError, DispatchRequest
 from waivern_core.services import ComponentRegistry, ServiceContainer
+from waivern_core.services.manifest import ComponentManifest
 
 # =============================================================================
 # Component Registry Core
@@ -165,11 +170,37 @@ class TestComponentRegistry:
             )
 
             # Act
-            _ = registry.connector_factories
+            _ = registry.connector_factories["test_connector"]
 
         # Assert - factory class instantiated with container
         mock_factory_class.assert_called_once_with(container)
 
+    def test_factory_not_imported_until_looked_up(self) -> None:
+        """Verify discovery lists entry points without importing factories."""
+        # Arrange
+        container = ServiceContainer()
+        registry = ComponentRegistry(container)
+
+        mock_used_ep = MagicMock()
+        mock_used_ep.name = "used_connector"
+        mock_unused_ep = MagicMock()
+        mock_unused_ep.name = "unused_connector"
+
+        with patch("waivern_core.services.registry.entry_points") as mock_entry_points:
+            mock_entry_points.side_effect = lambda group: (
+                [mock_used_ep, mock_unused_ep] if group == "waivern.connectors" else []
+            )
+
+            # Act - membership and listing, then one lookup
+            factories = registry.connector_factories
+            assert "unused_connector" in factories
+            assert sorted(factories) == ["unused_connector", "used_connector"]
+            _ = factories["used_connector"]
+
+        # Assert - only the looked-up factory was imported
+        mock_used_ep.load.assert_called_once()
+        mock_unused_ep.load.assert_not_called()
+
 
 # =============================================================================
 # Schema Entry Point Discovery
@@ -383,3 +414,83 @@ class TestGetDispatcherFor:
                 DispatcherUnavailableError, match="create\\(\\) returned None"
             ):
                 registry.get_dispatcher_for(DispatchRequest)
+
+
+# =============================================================================
+# Entry Point Manifest
+# =============================================================================
+
+
+class TestComponentRegistryManifest:
+    """Test suite for caching the entry point listing in a manifest."""
+
+    def test_scan_writes_manifest(self, tmp_path: Path) -> None:
+        """A scan records entry point references in the manifest file."""
+        # Arrange
+        manifest_path = tmp_path / "components.json"
+        registry = ComponentRegistry(ServiceContainer(), manifest_path=manifest_path)
+        ep = EntryPoint(
+            name="test_connector",
+            value="unittest.mock:Mock",
+            group="waivern.connectors",
+        )
+
+        with patch("waivern_core.services.registry.entry_points") as mock_entry_points:
+            mock_entry_points.side_effect = lambda group: (
+                [ep] if group == "waivern.connectors" else []
+            )
+
+            # Act
+            _ = registry.connector_factories
+
+        # Assert
+        cached = ComponentManifest(manifest_path).load()
+        assert cached is not None
+        assert cached["waivern.connectors"] == {"test_connector": "unittest.mock:Mock"}
+
+    def test_current_manifest_skips_entry_point_scan(self, tmp_path: Path) -> None:
+        """A registry with a current manifest does not read distribution metadata."""
+        # Arrange
+        manifest_path = tmp_path / "components.json"
+        ComponentManifest(manifest_path).save(
+            {"waivern.connectors": {"test_connector": "unittest.mock:Mock"}}
+        )
+        container = ServiceContainer()
+        registry = ComponentRegistry(container, manifest_path=manifest_path)
+
+        with patch("waivern_core.services.registry.entry_points") as mock_entry_points:
+            # Act
+            factory = registry.connector_factories["test_connector"]
+
+        # Assert
+        mock_entry_points.assert_not_called()
+        assert isinstance(factory, Mock)
+
+    def test_stale_manifest_entry_triggers_rescan(self, tmp_path: Path) -> None:
+        """An entry that no longer imports is resolved from a fresh scan."""
+        # Arrange
+        manifest_path = tmp_path / "components.json"
+        ComponentManifest(manifest_path).save(
+            {"waivern.connectors": {"test_connector": "removed_package:Factory"}}
+        )
+        registry = ComponentRegistry(ServiceContainer(), manifest_path=manifest_path)
+
+        mock_factory_instance = MagicMock()
+        mock_ep = MagicMock()
+        mock_ep.name = "test_connector"
+        mock_ep.value = "new_package:Factory"
+        mock_ep.load.return_value = MagicMock(return_value=mock_factory_instance)
+
+        with patch("waivern_core.services.registry.entry_points") as mock_entry_points:
+            mock_entry_points.side_effect = lambda group: (
+                [mock_ep] if group == "waivern.connectors" else []
+            )
+
+            # Act
+            factory = registry.connector_factories["test_connector"]
+
+        # Assert - fresh entry point used and the manifest rewritten
+        assert factory is mock_factory_instance
+        cached = ComponentManifest(manifest_path).load()
+        assert cached is not None
+        assert cached["waivern.connectors"] == {"test_connector": "new_package:Factory"}
@@ -1,7 +1,7 @@
 """Tests for custom logic in finding types.
 
 These tests cover our custom code only:
-- Custom validators (JSON serialisation, risk level)
+- Custom validators (JSON serialisation, risk level, string sharing)
 - Custom methods (generate_json_schema)
 - ClassVar version override behaviour
 
@@ -20,6 +20,8 @@ from pydantic import Field, ValidationError
 from waivern_core.schemas import (
     BaseFindingMetadata,
     BaseSchemaOutput,
+    PatternMatchDetail,
+    finding_types,
 )
 
 
@@ -51,6 +53,59 @@ class TestBaseFindingMetadataCustomValidators:
         assert metadata.context["string"] == "value"
 
 
+class TestFindingStringInterning:
+    """Tests for sharing of repetitive finding strings."""
+
+    def test_source_values_from_separate_payloads_share_one_object(self) -> None:
+        """Contract: equal sources decoded separately become the same object."""
+        first = BaseFindingMetadata.model_validate(
+            json.loads('{"source": "mysql_database_(db)_table_(t)"}')
+        )
+        second = BaseFindingMetadata.model_validate(
+            json.loads('{"source": "mysql_database_(db)_table_(t)"}')
+        )
+
+        assert first.source is second.source
+
+    def test_context_string_values_are_shared(self) -> None:
+        """Contract: top-level context strings are shared, others unchanged."""
+        payload = '{"source": "a", "context": {"connector_type": "mysql", "n": [1]}}'
+        first = BaseFindingMetadata.model_validate(json.loads(payload))
+        second = BaseFindingMetadata.model_validate(json.loads(payload))
+
+        assert first.context["connector_type"] is second.context["connector_type"]
+        assert first.context["n"] == [1]
+
+    def test_pattern_values_are_shared(self) -> None:
+        """Contract: equal pattern strings become the same object."""
+        first = PatternMatchDetail.model_validate(
+            json.loads('{"pattern": "email", "match_count": 1}')
+        )
+        second = PatternMatchDetail.model_validate(
+            json.loads('{"pattern": "email", "match_count": 2}')
+        )
+
+        assert first.pattern is second.pattern
+
+    def test_source_table_is_bounded(self, monkeypatch: pytest.MonkeyPatch) -> None:
+        """Contract: per-row sources are not kept alive for the process lifetime."""
+        table: dict[str, str] = {}
+        monkeypatch.setattr(finding_types, "_SHARED_STRINGS_MAX", 4)
+        monkeypatch.setattr(finding_types, "_shared_strings", table)
+
+        for row in range(10):
+            BaseFindingMetadata(source=f"mysql_database_(db)_table_(t)_row_({row})")
+
+        assert 0 < len(table) <= 4
+
+    def test_shared_fields_keep_plain_string_json_schema(self) -> None:
+        """Contract: sharing does not change the public JSON schema."""
+        schema = BaseFindingMetadata.model_json_schema(mode="serialization")
+
+        assert schema["properties"]["source"]["type"] == "string"
+        assert schema["properties"]["context"]["type"] == "object"
+
+
 class TestBaseSchemaOutputGeneration:
     """Tests for JSON schema generation functionality."""
 
@@ -8,7 +8,9 @@ from waivern_core.message import (
     MessageExtensions,
     MessageValidationError,
     Schema,
+    boundary_typed_content,
 )
+from waivern_core.schemas import SchemaRegistry
 
 from .conftest import MockTypedSchema
 
@@ -83,6 +85,130 @@ class TestMessage:
         assert result is message
 
 
+# =============================================================================
+# Typed Content and Validation Policy
+# =============================================================================
+
+
+class _TypedModel:
+    """Stand-in for the model a producer dumped content from."""
+
+
+class TestMessageTypedContent:
+    """Tests for typed content carried alongside message content."""
+
+    def test_get_typed_content_returns_matching_model(self) -> None:
+        """get_typed_content returns the model when its type matches."""
+        model = _TypedModel()
+        message = Message(
+            id="test-id",
+            content={"test": "value"},
+            schema=MockTypedSchema(),
+            typed_content=model,
+        )
+
+        assert message.get_typed_content(_TypedModel) is model
+
+    def test_get_typed_content_returns_none_for_other_type(self) -> None:
+        """get_typed_content returns None when the model type differs."""
+        message = Message(
+            id="test-id",
+            content={"test": "value"},
+            schema=MockTypedSchema(),
+            typed_content=_TypedModel(),
+        )
+
+        assert message.get_typed_content(dict) is None
+
+    def test_typed_content_not_serialised(self) -> None:
+        """Typed content is in-process only and absent after a round trip."""
+        message = Message(
+            id="test-id",
+            content={"test": "value"},
+            schema=Schema("test_schema", "1.0.0"),
+            typed_content=_TypedModel(),
+        )
+
+        restored = Message.from_dict(message.to_dict())
+
+        assert "typed_content" not in message.to_dict()
+        assert restored.typed_content is None
+
+    def test_full_policy_validates_typed_messages(self) -> None:
+        """Under the full policy typed content does not bypass validation."""
+        SchemaRegistry.set_validation_policy("full")
+        message = Message(
+            id="test-id",
+            content={"invalid": "content"},
+            schema=MockTypedSchema(),
+            typed_content=_TypedModel(),
+        )
+
+        with pytest.raises(MessageValidationError, match="Schema validation failed"):
+            message.validate()
+
+    def test_boundary_policy_trusts_typed_messages(self) -> None:
+        """Under the boundary policy typed messages skip schema validation."""
+        SchemaRegistry.set_validation_policy("boundary")
+        message = Message(
+            id="test-id",
+            content={"invalid": "content"},
+            schema=MockTypedSchema(),
+            typed_content=_TypedModel(),
+        )
+
+        assert message.validate() is message
+
+    def test_boundary_policy_validates_untyped_messages(self) -> None:
+        """Under the boundary policy messages without typed content are validated."""
+        SchemaRegistry.set_validation_policy("boundary")
+        message = Message(
+            id="test-id", content={"invalid": "content"}, schema=MockTypedSchema()
+        )
+
+        with pytest.raises(MessageValidationError, match="Schema validation failed"):
+            message.validate()
+
+    def test_boundary_flag_forces_validation(self) -> None:
+        """validate(boundary=True) validates even trusted typed messages."""
+        SchemaRegistry.set_validation_policy("boundary")
+        message = Message(
+            id="test-id",
+            content={"invalid": "content"},
+            schema=MockTypedSchema(),
+            typed_content=_TypedModel(),
+        )
+
+        with pytest.raises(MessageValidationError, match="Schema validation failed"):
+            message.validate(boundary=True)
+
+    def test_typed_content_is_attached_under_boundary_policy(self) -> None:
+        """Producers attach their typed model when the boundary policy uses it."""
+        SchemaRegistry.set_validation_policy("boundary")
+        model = _TypedModel()
+
+        assert boundary_typed_content(model) is model
+
+    def test_typed_content_is_not_attached_under_full_policy(self) -> None:
+        """Under the full policy producers attach no typed model."""
+        SchemaRegistry.set_validation_policy("full")
+
+        assert boundary_typed_content(_TypedModel()) is None
+
+    def test_policy_read_from_environment(self, monkeypatch) -> None:
+        """WAIVERN_VALIDATION_POLICY selects the policy when none is set."""
+        monkeypatch.setenv("WAIVERN_VALIDATION_POLICY", "boundary")
+
+        assert SchemaRegistry.get_validation_policy() == "boundary"
+
+    def test_invalid_environment_policy_raises(self, monkeypatch) -> None:
+        """An unknown WAIVERN_VALIDATION_POLICY value is rejected."""
+        monkeypatch.setenv("WAIVERN_VALIDATION_POLICY", "sometimes")
+
+        with pytest.raises(ValueError, match="WAIVERN_VALIDATION_POLICY"):
+            SchemaRegistry.get_validation_policy()
+
+
 # =============================================================================
 # Execution Context Convenience Properties
 # =============================================================================
@@ -0,0 +1,130 @@
+"""Tests for waivern_core.metrics module."""
+
+import threading
+
+import pytest
+
+from waivern_core.metrics import MetricsRegistry
+
+
+class TestPrometheusExposition:
+    """Tests for rendering the Prometheus text format."""
+
+    def test_counters_and_gauges_render_one_line_per_label_set(self) -> None:
+        registry = MetricsRegistry()
+        requests = registry.counter("requests_total", "Requests made.")
+        requests.inc(mode="sync")
+        requests.inc(2, mode="batch")
+        registry.gauge("queued", "Work waiting.").set(3)
+
+        assert registry.render_prometheus() == (
+            "# HELP queued Work waiting.\n"
+            "# TYPE queued gauge\n"
+            "queued 3\n"
+            "# HELP requests_total Requests made.\n"
+            "# TYPE requests_total counter\n"
+            'requests_total{mode="batch"} 2\n'
+            'requests_total{mode="sync"} 1\n'
+        )
+
+    def test_histogram_renders_cumulative_buckets_sum_and_count(self) -> None:
+        registry = MetricsRegistry()
+        latency = registry.histogram("latency_seconds", "Latency.", buckets=(0.1, 1))
+        latency.observe(0.05)
+        latency.observe(0.5)
+        latency.observe(5)
+
+        lines = registry.render_prometheus().splitlines()
+
+        assert lines[2:] == [
+            'latency_seconds_bucket{le="0.1"} 1',
+            'latency_seconds_bucket{le="1"} 2',
+            'latency_seconds_bucket{le="+Inf"} 3',
+            "latency_seconds_sum 5.55",
+            "latency_seconds_count 3",
+        ]
+
+    def test_label_values_are_escaped(self) -> None:
+        registry = MetricsRegistry()
+        registry.counter("errors_total", "Errors.").inc(kind='say "hi"\\\n')
+
+        assert 'errors_total{kind="say \\"hi\\"\\\\\\n"} 1' in (
+            registry.render_prometheus()
+        )
+
+
+class TestRegistration:
+    """Tests for looking up metric families by name."""
+
+    def test_same_name_returns_same_metric(self) -> None:
+        registry = MetricsRegistry()
+
+        registry.counter("hits_total", "Hits.").inc()
+        registry.counter("hits_total", "Hits.").inc()
+
+        assert registry.counter("hits_total", "Hits.").value() == 2
+
+    def test_same_name_with_other_kind_is_rejected(self) -> None:
+        registry = MetricsRegistry()
+        registry.counter("hits_total", "Hits.")
+
+        with pytest.raises(ValueError, match="already registered as a counter"):
+            registry.gauge("hits_total", "Hits.")
+
+    def test_updates_from_many_threads_are_not_lost(self) -> None:
+        counter = MetricsRegistry().counter("items_total", "Items.")
+
+        def work() -> None:
+            for _ in range(1000):
+                counter.inc()
+
+        threads = [threading.Thread(target=work) for _ in range(8)]
+        for thread in threads:
+            thread.start()
+        for thread in threads:
+            thread.join()
+
+        assert counter.value() == 8000
+
+
+class TestSnapshot:
+    """Tests for JSON snapshots of a single run."""
+
+    def test_snapshot_since_checkpoint_reports_only_changes(self) -> None:
+        registry = MetricsRegistry()
+        requests = registry.counter("requests_total", "Requests made.")
+        latency = registry.histogram("latency_seconds", "Latency.", buckets=(1,))
+        in_flight = registry.gauge("in_flight", "Running.")
+        requests.inc(5)
+        latency.observe(0.5)
+        in_flight.set(2)
+
+        checkpoint = registry.checkpoint()
+        requests.inc()
+        latency.observe(2)
+        in_flight.set(1)
+
+        snapshot = registry.snapshot(since=checkpoint)
+
+        assert snapshot["requests_total"] == {
+            "type": "counter",
+            "help": "Requests made.",
+            "samples": [{"labels": {}, "value": 1}],
+        }
+        assert snapshot["latency_seconds"] == {
+            "type": "histogram",
+            "help": "Latency.",
+            "samples": [
+                {
+                    "labels": {},
+                    "count": 1,
+                    "sum": 2,
+                    "buckets": {"1": 0, "+Inf": 1},
+                }
+            ],
+        }
+        assert snapshot["in_flight"] == {
+            "type": "gauge",
+            "help": "Running.",
+            "samples": [{"labels": {}, "value": 1}],
+        }
@@ -0,0 +1,164 @@
+"""Tests for compiled schema validators and the loader's validator cache."""
+
+from typing import Any
+
+import pytest
+
+from waivern_core.errors import MessageValidationError
+from waivern_core.message import Message
+from waivern_core.schemas import (
+    JsonSchemaLoader,
+    Schema,
+    SchemaLoadError,
+    SchemaRegistry,
+    SchemaValidationError,
+    compile_validator,
+)
+
+SCHEMA_WITH_DEFAULTS: dict[str, Any] = {
+    "$schema": "http://json-schema.org/draft-07/schema#",
+    "type": "object",
+    "properties": {
+        "name": {"type": "string"},
+        "tags": {"type": "array", "items": {"type": "string"}, "default": []},
+        "default": {"type": "integer"},
+    },
+    "required": ["name"],
+}
+
+# =============================================================================
+# Validator Backends
+# =============================================================================
+
+
+class TestCompiledValidators:
+    """Tests for compile_validator backends."""
+
+    @pytest.mark.parametrize("backend", ["jsonschema", "fastjsonschema"])
+    def test_valid_content_passes(self, backend) -> None:
+        if backend == "fastjsonschema":
+            pytest.importorskip("fastjsonschema")
+        validator = compile_validator(SCHEMA_WITH_DEFAULTS, backend)
+
+        validator.validate({"name": "x", "default": 1})
+
+    @pytest.mark.parametrize("backend", ["jsonschema", "fastjsonschema"])
+    def test_invalid_content_raises_schema_validation_error(self, backend) -> None:
+        if backend == "fastjsonschema":
+            pytest.importorskip("fastjsonschema")
+        validator = compile_validator(SCHEMA_WITH_DEFAULTS, backend)
+
+        with pytest.raises(SchemaValidationError) as exc_info:
+            validator.validate({"tags": ["a"]})
+
+        assert "name" in exc_info.value.message
+
+    @pytest.mark.parametrize("backend", ["jsonschema", "fastjsonschema"])
+    def test_validation_does_not_mutate_content(self, backend) -> None:
+        if backend == "fastjsonschema":
+            pytest.importorskip("fastjsonschema")
+        validator = compile_validator(SCHEMA_WITH_DEFAULTS, backend)
+        content = {"name": "x"}
+
+        validator.validate(content)
+
+        assert content == {"name": "x"}
+
+    def test_property_named_default_is_still_validated(self) -> None:
+        pytest.importorskip("fastjsonschema")
+        validator = compile_validator(SCHEMA_WITH_DEFAULTS, "fastjsonschema")
+
+        with pytest.raises(SchemaValidationError):
+            validator.validate({"name": "x", "default": "not-an-integer"})
+
+    def test_unknown_backend_raises_value_error(self) -> None:
+        with pytest.raises(ValueError, match="Unknown validator backend"):
+            compile_validator(SCHEMA_WITH_DEFAULTS, "unknown")  # type: ignore[arg-type]
+
+
+# =============================================================================
+# Loader Validator Cache
+# =============================================================================
+
+
+class TestLoaderValidatorCache:
+    """Tests for JsonSchemaLoader.get_validator caching."""
+
+    def test_validator_compiled_once_per_schema_identity(self) -> None:
+        loader = JsonSchemaLoader(search_paths=SchemaRegistry.get_search_paths())
+
+        first = loader.get_validator("standard_input", "1.0.0")
+        second = loader.get_validator("standard_input", "1.0.0")
+
+        assert first is second
+
+    def test_schema_instances_share_registry_validator(self) -> None:
+        first = Schema("standard_input", "1.0.0").validator
+        second = Schema("standard_input", "1.0.0").validator
+
+        assert first is second
+
+    def test_missing_backend_raises_schema_load_error(self, monkeypatch) -> None:
+        import builtins
+
+        real_import = builtins.__import__
+
+        def fail_fastjsonschema(name: str, *args: Any, **kwargs: Any) -> Any:
+            if name == "fastjsonschema":
+                raise ImportError("No module named 'fastjsonschema'")
+            return real_import(name, *args, **kwargs)
+
+        monkeypatch.setattr(builtins, "__import__", fail_fastjsonschema)
+        loader = JsonSchemaLoader(
+            search_paths=SchemaRegistry.get_search_paths(),
+            validator_backend="fastjsonschema",
+        )
+
+        with pytest.raises(SchemaLoadError, match="not installed"):
+            loader.get_validator("standard_input", "1.0.0")
+
+
+# =============================================================================
+# Registry Backend Selection
+# =============================================================================
+
+
+class TestRegistryValidatorBackend:
+    """Tests for SchemaRegistry validator backend selection."""
+
+    def test_defaults_to_jsonschema(self, monkeypatch) -> None:
+        monkeypatch.delenv("WAIVERN_SCHEMA_VALIDATOR", raising=False)
+
+        assert SchemaRegistry.get_validator_backend() == "jsonschema"
+
+    def test_backend_read_from_environment(self, monkeypatch) -> None:
+        monkeypatch.setenv("WAIVERN_SCHEMA_VALIDATOR", "fastjsonschema")
+
+        assert SchemaRegistry.get_validator_backend() == "fastjsonschema"
+
+    def test_invalid_environment_backend_raises(self, monkeypatch) -> None:
+        monkeypatch.setenv("WAIVERN_SCHEMA_VALIDATOR", "bogus")
+
+        with pytest.raises(ValueError, match="WAIVERN_SCHEMA_VALIDATOR"):
+            SchemaRegistry.get_validator_backend()
+
+    def test_set_backend_recreates_shared_loader(self) -> None:
+        loader_before = SchemaRegistry.get_loader()
+
+        SchemaRegistry.set_validator_backend("fastjsonschema")
+        loader_after = SchemaRegistry.get_loader()
+
+        assert loader_after is not loader_before
+        assert loader_after.validator_backend == "fastjsonschema"
+
+    def test_message_validation_with_fast_backend(self) -> None:
+        pytest.importorskip("fastjsonschema")
+        SchemaRegistry.set_validator_backend("fastjsonschema")
+        message = Message(
+            id="test",
+            content={"schemaVersion": "1.0.0"},
+            schema=Schema("standard_input", "1.0.0"),
+        )
+
+        with pytest.raises(MessageValidationError, match="Schema validation failed"):
+            message.validate()
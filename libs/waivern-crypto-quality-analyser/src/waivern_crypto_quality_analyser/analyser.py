@@ -10,12 +10,8 @@ from waivern_core import Analyser, InputRequirement
 from waivern_core.message import Message
 from waivern_core.schemas import Schema
 from waivern_rulesets.crypto_quality_indicator import CryptoQualityIndicatorRule
-from waivern_schemas.connector_types import BaseMetadata
 from waivern_schemas.crypto_quality_indicator import CryptoQualityIndicatorModel
-from waivern_schemas.standard_input import (
-    StandardInputDataItemModel,
-    StandardInputDataModel,
-)
+from waivern_schemas.standard_input import StandardInputItem, StandardInputView
 
 from .pattern_matcher import CryptoQualityPatternMatcher
 from .result_builder import CryptoQualityResultBuilder
@@ -54,6 +50,12 @@ class CryptoQualityAnalyser(Analyser):
         """Return the name of the analyser."""
         return "crypto_quality_analyser"
 
+    @classmethod
+    @override
+    def get_resource_pool(cls) -> str | None:
+        """Run in the ``cpu`` pool: algorithms are detected by pattern matching."""
+        return "cpu"
+
     @classmethod
     @override
     def get_input_requirements(cls) -> list[list[InputRequirement]]:
@@ -74,9 +76,7 @@ class CryptoQualityAnalyser(Analyser):
         """Declare output schemas this analyser can produce."""
         return [Schema("crypto_quality_indicator", "1.0.0")]
 
-    def _load_reader(
-        self, schema: Schema
-    ) -> SchemaReader[StandardInputDataModel[BaseMetadata]]:
+    def _load_reader(self, schema: Schema) -> SchemaReader[StandardInputView]:
         """Dynamically import reader module for the given input schema.
 
         Python's import system automatically caches modules in sys.modules,
@@ -97,9 +97,7 @@ class CryptoQualityAnalyser(Analyser):
             f"waivern_crypto_quality_analyser.schema_readers.{module_name}"
         )
 
-    def _merge_input_data_items(
-        self, inputs: list[Message]
-    ) -> list[StandardInputDataItemModel[BaseMetadata]]:
+    def _merge_input_data_items(self, inputs: list[Message]) -> list[StandardInputItem]:
         """Merge data items from multiple input messages (fan-in).
 
         Args:
@@ -112,7 +110,7 @@ class CryptoQualityAnalyser(Analyser):
         # Explicit annotation required: basedpyright strict mode infers [] as
         # list[Unknown], causing reportUnknownMemberType on .extend() calls.
         # Follow this pattern in all analyser methods that accumulate findings.
-        all_data_items: list[StandardInputDataItemModel[BaseMetadata]] = []
+        all_data_items: list[StandardInputItem] = []
         for message in inputs:
             reader = self._load_reader(message.schema)
             input_data = reader.read(message.content)
@@ -120,7 +118,7 @@ class CryptoQualityAnalyser(Analyser):
         return all_data_items
 
     def _find_patterns_in_data_items(
-        self, data_items: list[StandardInputDataItemModel[BaseMetadata]]
+        self, data_items: list[StandardInputItem]
     ) -> list[CryptoQualityIndicatorModel]:
         """Run pattern matching on all data items.
 
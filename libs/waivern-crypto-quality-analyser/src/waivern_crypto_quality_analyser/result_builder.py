@@ -4,7 +4,7 @@ import logging
 from datetime import UTC, datetime
 from pprint import pformat
 
-from waivern_core.message import Message
+from waivern_core.message import Message, boundary_typed_content
 from waivern_core.schemas import BaseAnalysisOutputMetadata, Schema
 from waivern_schemas.crypto_quality_indicator import (
     CryptoQualityIndicatorModel,
@@ -67,6 +67,7 @@ class CryptoQualityResultBuilder:
             id=f"crypto_quality_analysis_{datetime.now(UTC).isoformat()}",
             content=result_data,
             schema=output_schema,
+            typed_content=boundary_typed_content(output_model),
         )
 
         output_message.validate()
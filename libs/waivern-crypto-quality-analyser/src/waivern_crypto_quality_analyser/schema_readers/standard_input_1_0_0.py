@@ -2,24 +2,20 @@
 
 from typing import Any
 
-from waivern_schemas.connector_types import BaseMetadata
-from waivern_schemas.standard_input import StandardInputDataModel
+from waivern_schemas.standard_input import StandardInputView
 
 
-def read(content: dict[str, Any]) -> StandardInputDataModel[BaseMetadata]:
+def read(content: dict[str, Any]) -> StandardInputView:
     """Transform standard_input v1.0.0 to canonical format.
 
-    This version matches the canonical model structure, so we use
-    direct Pydantic validation without transformation.
+    This version matches the canonical structure, so content is wrapped in a
+    read-only view without transformation or re-validation.
 
     Args:
-        content: Data conforming to standard_input v1.0.0 schema
+        content: Validated standard_input v1.0.0 data
 
     Returns:
-        Validated StandardInputDataModel instance
-
-    Raises:
-        ValidationError: If content doesn't match schema structure
+        StandardInputView reading directly from ``content``
 
     """
-    return StandardInputDataModel[BaseMetadata].model_validate(content)
+    return StandardInputView.from_content(content)
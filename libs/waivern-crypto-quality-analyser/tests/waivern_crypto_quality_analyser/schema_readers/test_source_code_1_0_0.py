@@ -2,7 +2,7 @@
 
 from typing import Any
 
-from waivern_schemas.standard_input import StandardInputDataModel
+from waivern_schemas.standard_input import StandardInputView
 
 from waivern_crypto_quality_analyser.schema_readers import source_code_1_0_0
 
@@ -60,13 +60,13 @@ MULTI_FILE_INPUT: dict[str, Any] = {
 
 
 class TestSourceCodeReader:
-    """Tests for source_code schema v1.0.0 reader — verifies the transform to StandardInputDataModel."""
+    """Tests for source_code schema v1.0.0 reader — verifies the adaptation to StandardInputView."""
 
     def test_read_returns_standard_input_model(self) -> None:
-        """Test reader returns a StandardInputDataModel, not a raw dict."""
+        """Test reader returns a StandardInputView, not a raw dict."""
         result = source_code_1_0_0.read(SOURCE_CODE_INPUT)
 
-        assert isinstance(result, StandardInputDataModel)
+        assert isinstance(result, StandardInputView)
 
     def test_read_maps_raw_content_to_item_content(self) -> None:
         """Test file raw_content is mapped to item content for pattern matching."""
@@ -106,6 +106,10 @@ class TestCryptoQualityAnalyserContract(AnalyserContractTests[CryptoQualityAnaly
         """Provide the processor class for contract testing."""
         return CryptoQualityAnalyser
 
+    def test_runs_in_cpu_pool(self) -> None:
+        """Pattern matching is CPU-bound, so a declared ``cpu`` pool limits it."""
+        assert CryptoQualityAnalyser.get_resource_pool() == "cpu"
+
 
 # =============================================================================
 # Polarity and algorithm field derivation
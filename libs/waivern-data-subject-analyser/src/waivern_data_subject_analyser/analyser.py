@@ -60,6 +60,12 @@ class DataSubjectAnalyser(Analyser):
         """Get the name of the analyser."""
         return "data_subject_analyser"
 
+    @classmethod
+    @override
+    def get_resource_pool(cls) -> str | None:
+        """Run in the ``cpu`` pool: subjects are detected by pattern matching."""
+        return "cpu"
+
     @classmethod
     @override
     def get_input_requirements(cls) -> list[list[InputRequirement]]:
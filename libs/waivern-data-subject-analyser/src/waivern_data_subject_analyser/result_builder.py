@@ -8,7 +8,7 @@ import logging
 from datetime import UTC, datetime
 
 from waivern_analysers_shared.llm_validation import ValidationResult
-from waivern_core.message import Message
+from waivern_core.message import Message, boundary_typed_content
 from waivern_core.schemas import BaseAnalysisOutputMetadata, Schema
 from waivern_schemas.data_subject_indicator import (
     DataSubjectIndicatorModel,
@@ -72,6 +72,7 @@ class DataSubjectResultBuilder:
             id=f"data_subject_analysis_{datetime.now(UTC).isoformat()}",
             content=result_data,
             schema=output_schema,
+            typed_content=boundary_typed_content(output_model),
         )
 
         output_message.validate()
@@ -130,6 +131,7 @@ class DataSubjectResultBuilder:
             id=f"data_subject_removed_findings_{datetime.now(UTC).isoformat()}",
             content=payload.model_dump(mode="json"),
             schema=_REMOVED_FINDINGS_SCHEMA,
+            typed_content=boundary_typed_content(payload),
         )
         sidecar.validate()
         return sidecar
@@ -5,26 +5,26 @@ from typing import Any
 from waivern_analysers_shared import SchemaInputHandler
 from waivern_rulesets.data_subject_indicator import DataSubjectIndicatorRule
 from waivern_schemas.data_subject_indicator import DataSubjectIndicatorModel
-from waivern_schemas.source_code import SourceCodeDataModel
+from waivern_schemas.source_code import SourceCodeView
 
 from ..source_code_schema_input_handler import SourceCodeSchemaInputHandler
 from ..types import DataSubjectAnalyserConfig
 
 
-def read(content: dict[str, Any]) -> SourceCodeDataModel:
-    """Transform source_code v1.0.0 dict to Pydantic model.
+def read(content: dict[str, Any]) -> SourceCodeView:
+    """Wrap source_code v1.0.0 dict in a read-only view.
 
-    Message has already validated content against JSON schema.
-    Converts to authoritative SourceCodeDataModel for type-safe processing.
+    Message content has already been validated against the JSON schema, so
+    files are read directly from the dict without re-validation or copies.
 
     Args:
         content: Validated source_code v1.0.0 data
 
     Returns:
-        SourceCodeDataModel instance
+        SourceCodeView over ``content``
 
     """
-    return SourceCodeDataModel.model_validate(content)
+    return SourceCodeView(content)
 
 
 def create_handler(
@@ -4,31 +4,27 @@ from typing import Any
 
 from waivern_analysers_shared import SchemaInputHandler
 from waivern_rulesets.data_subject_indicator import DataSubjectIndicatorRule
-from waivern_schemas.connector_types import BaseMetadata
 from waivern_schemas.data_subject_indicator import DataSubjectIndicatorModel
-from waivern_schemas.standard_input import StandardInputDataModel
+from waivern_schemas.standard_input import StandardInputView
 
 from ..standard_input_schema_input_handler import StandardInputSchemaInputHandler
 from ..types import DataSubjectAnalyserConfig
 
 
-def read(content: dict[str, Any]) -> StandardInputDataModel[BaseMetadata]:
+def read(content: dict[str, Any]) -> StandardInputView:
     """Transform standard_input v1.0.0 to canonical format.
 
-    This version matches the canonical model structure, so we use
-    direct Pydantic validation without transformation.
+    This version matches the canonical structure, so content is wrapped in a
+    read-only view without transformation or re-validation.
 
     Args:
-        content: Data conforming to standard_input v1.0.0 schema
+        content: Validated standard_input v1.0.0 data
 
     Returns:
-        Validated StandardInputDataModel instance
-
-    Raises:
-        ValidationError: If content doesn't match schema structure
+        StandardInputView reading directly from ``content``
 
     """
-    return StandardInputDataModel[BaseMetadata].model_validate(content)
+    return StandardInputView.from_content(content)
 
 
 def create_handler(
@@ -1,6 +1,7 @@
 """Handler for data subject detection in source code.
 
-Uses authoritative Pydantic models from waivern-source-code-analyser.
+Accepts source_code data as authoritative Pydantic models or as read-only
+views over validated message content.
 """
 
 from collections.abc import Generator, Sequence
@@ -13,7 +14,12 @@ from waivern_schemas.data_subject_indicator import (
     DataSubjectIndicatorMetadata,
     DataSubjectIndicatorModel,
 )
-from waivern_schemas.source_code import SourceCodeDataModel, SourceCodeFileDataModel
+from waivern_schemas.source_code import (
+    SourceCodeDataModel,
+    SourceCodeFileDataModel,
+    SourceCodeFileView,
+    SourceCodeView,
+)
 
 from .confidence_scorer import DataSubjectConfidenceScorer
 from .types import SourceCodeContextWindow
@@ -30,8 +36,8 @@ CONTEXT_WINDOW_SIZES: dict[SourceCodeContextWindow, int | None] = {
 class SourceCodeSchemaInputHandler:
     """Handler for data subject detection in source code.
 
-    Processes source_code schema data using authoritative Pydantic models
-    from waivern-source-code-analyser.
+    Processes source_code schema data from SourceCodeDataModel or
+    SourceCodeView; both expose files with ``file_path`` and ``raw_content``.
     """
 
     def __init__(
@@ -60,27 +66,29 @@ class SourceCodeSchemaInputHandler:
         """Analyse input data for data subject patterns.
 
         Args:
-            data: Source code data (expected to be SourceCodeDataModel from reader).
+            data: Source code data (SourceCodeView from reader, or SourceCodeDataModel).
 
         Returns:
             List of data subject indicators.
 
         Raises:
-            TypeError: If data is not a SourceCodeDataModel instance.
+            TypeError: If data is neither a SourceCodeDataModel nor a SourceCodeView.
 
         """
-        if not isinstance(data, SourceCodeDataModel):
-            raise TypeError(f"Expected SourceCodeDataModel, got {type(data).__name__}")
+        if not isinstance(data, SourceCodeView | SourceCodeDataModel):
+            raise TypeError(
+                f"Expected SourceCodeDataModel or SourceCodeView, got {type(data).__name__}"
+            )
 
         return self._analyse_validated_data(data)
 
     def _analyse_validated_data(
-        self, data: SourceCodeDataModel
+        self, data: SourceCodeView | SourceCodeDataModel
     ) -> list[DataSubjectIndicatorModel]:
         """Analyse validated source code data (internal, type-safe).
 
         Args:
-            data: Validated SourceCodeDataModel instance.
+            data: Source code view or validated model.
 
         Returns:
             List of data subject indicators.
@@ -94,7 +102,7 @@ class SourceCodeSchemaInputHandler:
         return indicators
 
     def _analyse_file_data(
-        self, file_data: SourceCodeFileDataModel
+        self, file_data: SourceCodeFileView | SourceCodeFileDataModel
     ) -> list[DataSubjectIndicatorModel]:
         """Analyse a single source code file for data subject patterns.
 
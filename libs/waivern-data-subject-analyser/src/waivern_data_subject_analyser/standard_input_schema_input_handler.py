@@ -9,7 +9,7 @@ from waivern_analysers_shared.types import PatternMatchingConfig
 from waivern_rulesets.data_subject_indicator import DataSubjectIndicatorRule
 from waivern_schemas.connector_types import BaseMetadata
 from waivern_schemas.data_subject_indicator import DataSubjectIndicatorModel
-from waivern_schemas.standard_input import StandardInputDataModel
+from waivern_schemas.standard_input import StandardInputDataModel, StandardInputView
 
 from .pattern_matcher import DataSubjectPatternMatcher
 
@@ -38,21 +38,27 @@ class StandardInputSchemaInputHandler:
         """Analyse input data for data subject patterns.
 
         This is the public boundary - accepts object to keep analyser schema-agnostic.
-        Type safety is maintained internally via StandardInputDataModel.
+        Type safety is maintained internally via StandardInputView and
+        StandardInputDataModel, which expose the same item fields.
 
         Args:
-            data: Standard input data (expected to be StandardInputDataModel from reader).
+            data: Standard input data (StandardInputView from reader, or
+                StandardInputDataModel).
 
         Returns:
             List of data subject indicators.
 
         Raises:
-            TypeError: If data is not a StandardInputDataModel instance.
+            TypeError: If data is neither a StandardInputDataModel nor a
+                StandardInputView.
 
         """
+        if isinstance(data, StandardInputView):
+            return self._analyse_validated_data(data)
         if not isinstance(data, StandardInputDataModel):
             raise TypeError(
-                f"Expected StandardInputDataModel, got {type(data).__name__}"
+                "Expected StandardInputDataModel or StandardInputView, "
+                f"got {type(data).__name__}"
             )
 
         # Cast to concrete generic type after isinstance validation
@@ -60,12 +66,12 @@ class StandardInputSchemaInputHandler:
         return self._analyse_validated_data(typed_data)
 
     def _analyse_validated_data(
-        self, data: StandardInputDataModel[BaseMetadata]
+        self, data: StandardInputView | StandardInputDataModel[BaseMetadata]
     ) -> list[DataSubjectIndicatorModel]:
         """Analyse validated standard input data (internal, type-safe).
 
         Args:
-            data: Validated StandardInputDataModel instance.
+            data: Standard input view or validated model.
 
         Returns:
             List of data subject indicators.
@@ -4,7 +4,7 @@ Uses synthetic rules to decouple from production ruleset data.
 """
 
 from waivern_rulesets.data_subject_indicator import DataSubjectIndicatorRule
-from waivern_schemas.source_code import SourceCodeDataModel
+from waivern_schemas.source_code import SourceCodeView
 
 from waivern_data_subject_analyser.schema_readers import source_code_1_0_0
 from waivern_data_subject_analyser.source_code_schema_input_handler import (
@@ -35,8 +35,8 @@ class TestSourceCodeReader:
 
         assert isinstance(handler, SourceCodeSchemaInputHandler)
 
-    def test_read_returns_pydantic_model(self) -> None:
-        """Test reader returns SourceCodeDataModel from dict input."""
+    def test_read_returns_source_code_view(self) -> None:
+        """Test reader returns SourceCodeView over dict input."""
         input_data = {
             "schemaVersion": "1.0.0",
             "name": "Test source code",
@@ -63,7 +63,7 @@ class TestSourceCodeReader:
 
         result = source_code_1_0_0.read(input_data)
 
-        assert isinstance(result, SourceCodeDataModel)
+        assert isinstance(result, SourceCodeView)
         assert result.schemaVersion == "1.0.0"
         assert result.name == "Test source code"
         assert len(result.data) == 1
@@ -4,7 +4,7 @@ Uses synthetic rules to decouple from production ruleset data.
 """
 
 from waivern_rulesets.data_subject_indicator import DataSubjectIndicatorRule
-from waivern_schemas.standard_input import StandardInputDataModel
+from waivern_schemas.standard_input import StandardInputView
 
 from waivern_data_subject_analyser.schema_readers import standard_input_1_0_0
 from waivern_data_subject_analyser.standard_input_schema_input_handler import (
@@ -35,8 +35,8 @@ class TestStandardInputReader:
 
         assert isinstance(handler, StandardInputSchemaInputHandler)
 
-    def test_read_validates_and_returns_typed_model(self) -> None:
-        """Test reader validates input and returns StandardInputDataModel."""
+    def test_read_returns_standard_input_view(self) -> None:
+        """Test reader returns StandardInputView over dict input."""
         input_data = {
             "schemaVersion": "1.0.0",
             "name": "Test data",
@@ -56,7 +56,7 @@ class TestStandardInputReader:
 
         result = standard_input_1_0_0.read(input_data)
 
-        assert isinstance(result, StandardInputDataModel)
+        assert isinstance(result, StandardInputView)
         assert result.schemaVersion == "1.0.0"
         assert result.name == "Test data"
         assert len(result.data) == 1
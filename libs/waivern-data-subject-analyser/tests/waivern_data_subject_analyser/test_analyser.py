@@ -56,6 +56,9 @@ class TestDataSubjectAnalyserSchemaSupport:
     def test_get_name_returns_correct_identifier(self) -> None:
         assert DataSubjectAnalyser.get_name() == "data_subject_analyser"
 
+    def test_runs_in_cpu_pool(self) -> None:
+        assert DataSubjectAnalyser.get_resource_pool() == "cpu"
+
     def test_get_input_requirements_includes_standard_input(self) -> None:
         input_requirements = DataSubjectAnalyser.get_input_requirements()
         all_schema_names = {
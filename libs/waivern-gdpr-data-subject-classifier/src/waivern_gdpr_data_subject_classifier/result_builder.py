@@ -6,7 +6,7 @@ Keeps the classifier focused on orchestration.
 
 import logging
 
-from waivern_core.message import Message
+from waivern_core.message import Message, boundary_typed_content
 from waivern_core.schemas import BaseAnalysisOutputMetadata, Schema
 from waivern_schemas.gdpr_data_subject import (
     GDPRDataSubjectFindingModel,
@@ -74,6 +74,7 @@ class GDPRDataSubjectResultBuilder:
             id="gdpr_data_subject_classification",
             content=result_data,
             schema=output_schema,
+            typed_content=boundary_typed_content(output),
         )
 
         output_message.validate()
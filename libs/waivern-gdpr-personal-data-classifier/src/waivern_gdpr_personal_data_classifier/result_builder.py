@@ -6,7 +6,7 @@ Keeps the classifier focused on orchestration.
 
 import logging
 
-from waivern_core.message import Message
+from waivern_core.message import Message, boundary_typed_content
 from waivern_core.schemas import BaseAnalysisOutputMetadata, Schema
 from waivern_schemas.gdpr_personal_data import (
     GDPRPersonalDataFindingModel,
@@ -58,6 +58,7 @@ class GDPRClassifierResultBuilder:
             id="gdpr_personal_data_classification",
             content=result_data,
             schema=output_schema,
+            typed_content=boundary_typed_content(output),
         )
 
         output_message.validate()
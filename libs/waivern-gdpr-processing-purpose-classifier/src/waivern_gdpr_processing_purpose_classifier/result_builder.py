@@ -7,7 +7,7 @@ Keeps the classifier focused on orchestration.
 import logging
 from collections import Counter
 
-from waivern_core.message import Message
+from waivern_core.message import Message, boundary_typed_content
 from waivern_core.schemas import BaseAnalysisOutputMetadata, Schema
 from waivern_schemas.gdpr_processing_purpose import (
     GDPRProcessingPurposeFindingModel,
@@ -59,6 +59,7 @@ class GDPRProcessingPurposeResultBuilder:
             id="gdpr_processing_purpose_classification",
             content=result_data,
             schema=output_schema,
+            typed_content=boundary_typed_content(output),
         )
 
         output_message.validate()
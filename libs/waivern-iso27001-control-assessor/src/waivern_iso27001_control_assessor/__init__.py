@@ -1,11 +1,15 @@
 """ISO 27001 control assessor for Waivern Compliance Framework."""
 
 from .analyser import ISO27001Assessor
-from .factory import ISO27001AssessorFactory
-from .types import ISO27001AssessorConfig
+from .batch_analyser import ISO27001BatchAssessor
+from .factory import ISO27001AssessorFactory, ISO27001BatchAssessorFactory
+from .types import ISO27001AssessorConfig, ISO27001BatchAssessorConfig
 
 __all__ = [
     "ISO27001Assessor",
     "ISO27001AssessorConfig",
     "ISO27001AssessorFactory",
+    "ISO27001BatchAssessor",
+    "ISO27001BatchAssessorConfig",
+    "ISO27001BatchAssessorFactory",
 ]
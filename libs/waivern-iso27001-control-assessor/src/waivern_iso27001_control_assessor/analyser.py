@@ -6,29 +6,23 @@ from typing import Any, override
 
 from waivern_analysers_shared.utilities import RulesetManager
 from waivern_core import Analyser, InputRequirement
-from waivern_core.dispatch import (
-    DispatcherNotConfigured,
-    DispatchRequest,
-    DispatchResult,
-    PrepareResult,
-)
+from waivern_core.dispatch import DispatchRequest, DispatchResult, PrepareResult
 from waivern_core.message import Message
 from waivern_core.schemas import Schema
-from waivern_llm import BatchingMode, ItemGroup
-from waivern_llm.types import LLMDispatchResult, LLMRequest
+from waivern_llm.types import LLMRequest
 from waivern_rulesets.iso27001_domains import ISO27001DomainsRule
-from waivern_schemas.iso27001_assessment import (
-    AssessmentVerdict,
-    ControlStatus,
-    EvidenceStatus,
-)
-from waivern_schemas.security_document_context import SecurityDocumentContextModel
+from waivern_schemas.iso27001_assessment import EvidenceStatus
 from waivern_schemas.security_evidence import SecurityEvidenceModel
 
-from .prompts.prompt_builder import ControlContext, ISO27001PromptBuilder
-from .prompts.response_model import ISO27001LLMResponse
-from .result_builder import ISO27001ResultBuilder
-from .sampling import build_sampling_summary, stratified_sample
+from .control_assessment import (
+    assessment_fingerprint,
+    build_assessment_request,
+    derive_evidence_status,
+    resolve_verdict,
+)
+from .evidence_index import EvidenceIndex
+from .prior_assessments import PriorAssessments
+from .result_builder import AssessedControl, ISO27001ResultBuilder
 from .types import ISO27001AssessorConfig, ISO27001PrepareState
 
 logger = logging.getLogger(__name__)
@@ -52,6 +46,14 @@ class ISO27001Assessor(Analyser):
     Two input alternatives are supported:
     1. security_evidence + security_document_context (full assessment)
     2. security_evidence only (attestation-required controls emit not_assessed)
+
+    Either may additionally take the ``iso27001_assessment`` output of a
+    previous run. If the control's evidence, documents and rule are
+    unchanged since that run (same fingerprint), its previous verdict is
+    reused and no LLM request is made.
+
+    To assess many controls against the same inputs, use
+    ``ISO27001BatchAssessor``, which indexes the evidence once for all of them.
     """
 
     def __init__(self, config: ISO27001AssessorConfig) -> None:
@@ -70,6 +72,12 @@ class ISO27001Assessor(Analyser):
         """Return the name of the assessor."""
         return "iso27001_assessor"
 
+    @classmethod
+    @override
+    def get_resource_pool(cls) -> str | None:
+        """Run in the ``llm`` pool: controls are assessed by an LLM."""
+        return "llm"
+
     @classmethod
     @override
     def get_input_requirements(cls) -> list[list[InputRequirement]]:
@@ -82,6 +90,9 @@ class ISO27001Assessor(Analyser):
         The first alternative is preferred when document context is available.
         The second allows technical-only assessment where evidence-required
         controls emit requires_attestation status.
+
+        Each has a variant with a previous run's ``iso27001_assessment``
+        added, for incremental re-assessment.
         """
         return [
             [
@@ -89,6 +100,15 @@ class ISO27001Assessor(Analyser):
                 InputRequirement("security_document_context", "1.0.0"),
             ],
             [InputRequirement("security_evidence", "1.0.0")],
+            [
+                InputRequirement("security_evidence", "1.0.0"),
+                InputRequirement("security_document_context", "1.0.0"),
+                InputRequirement("iso27001_assessment", "1.0.0"),
+            ],
+            [
+                InputRequirement("security_evidence", "1.0.0"),
+                InputRequirement("iso27001_assessment", "1.0.0"),
+            ],
         ]
 
     @classmethod
@@ -107,7 +127,8 @@ class ISO27001Assessor(Analyser):
         1. Validate inputs and extract run_id
         2. Load matching rule and filter evidence by domain/evidence_source
         3. Derive evidence_status from filtered evidence
-        4. If AUTOMATED and LLM enabled, build LLMRequest; otherwise empty requests
+        4. If AUTOMATED, reuse the previous run's verdict when the fingerprint
+           matches; otherwise build LLMRequest. Other statuses: empty requests
 
         """
         if not inputs:
@@ -119,12 +140,33 @@ class ISO27001Assessor(Analyser):
             )
 
         rule = self._load_rule()
-        evidence, documents = self._partition_and_filter(inputs, rule)
-        evidence_status = self._derive_evidence_status(rule, evidence, documents)
+        evidence, documents = EvidenceIndex.from_messages(inputs).select(rule)
+        evidence_status = derive_evidence_status(rule, evidence, documents)
 
         requests: list[DispatchRequest] = []
+        fingerprint: str | None = None
+        reused_verdict = None
         if evidence_status == EvidenceStatus.AUTOMATED:
-            requests.append(self._build_llm_request(rule, evidence, documents, run_id))
+            fingerprint = assessment_fingerprint(
+                rule,
+                evidence,
+                documents,
+                domain_ruleset=self._config.domain_ruleset,
+                sampling=self._config.evidence_sampling,
+            )
+            reused_verdict = PriorAssessments.from_messages(inputs).reusable_verdict(
+                rule.control_ref, fingerprint
+            )
+            if reused_verdict is None:
+                requests.append(
+                    build_assessment_request(
+                        rule,
+                        evidence,
+                        documents,
+                        run_id=run_id,
+                        sampling=self._config.evidence_sampling,
+                    )
+                )
 
         return PrepareResult(
             state=ISO27001PrepareState(
@@ -133,59 +175,12 @@ class ISO27001Assessor(Analyser):
                 evidence=evidence,
                 documents=documents,
                 run_id=run_id,
+                fingerprint=fingerprint,
+                reused_verdict=reused_verdict,
             ),
             requests=requests,
         )
 
-    def _build_llm_request(
-        self,
-        rule: ISO27001DomainsRule,
-        evidence: list[SecurityEvidenceModel],
-        documents: list[SecurityDocumentContextModel],
-        run_id: str,
-    ) -> LLMRequest[SecurityEvidenceModel]:
-        """Build an LLMRequest for automated assessment.
-
-        When evidence sampling is enabled, applies stratified sampling to
-        reduce evidence volume while preserving assessment quality. The
-        sampling summary is injected into the prompt so the LLM knows it
-        is seeing a representative subset.
-        """
-        doc_content = self._format_document_content(documents)
-        control = ControlContext(
-            guidance_text=rule.guidance_text,
-            control_type=rule.control_type,
-            cia=list(rule.cia),
-            cybersecurity_concept=rule.cybersecurity_concept,
-            operational_capability=rule.operational_capability,
-            iso_security_domain=rule.iso_security_domain,
-        )
-
-        sampling_config = self._config.evidence_sampling
-        sampling_summary: str | None = None
-        if sampling_config.enabled:
-            sample_result = stratified_sample(
-                evidence, sampling_config.max_evidence_items
-            )
-            if sample_result.was_sampled:
-                sampling_summary = build_sampling_summary(sample_result)
-                evidence = sample_result.items
-
-        return LLMRequest(
-            name=f"assessment:{rule.control_ref}",
-            groups=[
-                ItemGroup(
-                    items=evidence,
-                    content=doc_content,
-                    group_id=rule.control_ref,
-                )
-            ],
-            prompt_builder=ISO27001PromptBuilder(control, sampling_summary),
-            response_model=ISO27001LLMResponse,
-            batching_mode=BatchingMode.INDEPENDENT,
-            run_id=run_id,
-        )
-
     def finalise(
         self,
         state: ISO27001PrepareState,
@@ -195,121 +190,32 @@ class ISO27001Assessor(Analyser):
         """Produce assessment verdict from state and dispatch results.
 
         1. Short-circuit paths (insufficient/requires-attestation): emit NOT_ASSESSED.
-        2. AUTOMATED + LLM result: parse response and build verdict.
-        3. AUTOMATED + empty LLM responses: evidence exceeded context window.
-        """
-        rule = state.rule
-
-        match state.evidence_status:
-            case EvidenceStatus.INSUFFICIENT_EVIDENCE:
-                primary = self._result_builder.build_output_message(
-                    rule,
-                    verdict=AssessmentVerdict(
-                        status=ControlStatus.NOT_ASSESSED,
-                        evidence_status=state.evidence_status,
-                        rationale=(
-                            "No relevant evidence found. Neither technical findings "
-                            "nor document context matched this control's security "
-                            "domains."
-                        ),
-                        gap_description=None,
-                    ),
-                    llm_enabled=False,
-                    output_schema=output_schema,
-                )
-            case EvidenceStatus.REQUIRES_ATTESTATION:
-                primary = self._result_builder.build_output_message(
-                    rule,
-                    verdict=AssessmentVerdict(
-                        status=ControlStatus.NOT_ASSESSED,
-                        evidence_status=state.evidence_status,
-                        rationale=(
-                            "Awaiting document evidence. This control requires "
-                            "human-produced documentation (e.g. policy, procedure, "
-                            "inspection report) that has not yet been provided."
-                        ),
-                        gap_description=None,
-                    ),
-                    llm_enabled=False,
-                    output_schema=output_schema,
-                )
-            case EvidenceStatus.AUTOMATED:
-                primary = self._finalise_llm_result(rule, results, output_schema)
+        2. AUTOMATED + reused verdict: emit the previous run's verdict.
+        3. AUTOMATED + LLM result: parse response and build verdict.
+        4. AUTOMATED + empty LLM responses: evidence exceeded context window.
 
-        return primary, []
-
-    def _finalise_llm_result(
-        self,
-        rule: ISO27001DomainsRule,
-        results: Sequence[DispatchResult],
-        output_schema: Schema,
-    ) -> Message:
-        """Interpret LLM dispatch results into an assessment verdict."""
-        for result in results:
-            match result:
-                case DispatcherNotConfigured() as nc:
-                    return self._result_builder.build_output_message(
-                        rule,
-                        verdict=AssessmentVerdict(
-                            status=ControlStatus.NOT_ASSESSED,
-                            evidence_status=EvidenceStatus.AUTOMATED,
-                            rationale=(
-                                "LLM dispatcher not configured. Evidence was "
-                                "sufficient for automated assessment but the "
-                                f"dispatcher is unavailable: {nc.reason}"
-                            ),
-                            gap_description=None,
-                        ),
-                        llm_enabled=False,
-                        output_schema=output_schema,
-                    )
-                case LLMDispatchResult() as llm_result:
-                    if not llm_result.responses:
-                        return self._result_builder.build_output_message(
-                            rule,
-                            verdict=AssessmentVerdict(
-                                status=ControlStatus.NOT_ASSESSED,
-                                evidence_status=EvidenceStatus.AUTOMATED,
-                                rationale=(
-                                    "LLM assessment skipped — evidence "
-                                    "exceeded context window."
-                                ),
-                                gap_description=None,
-                            ),
-                            llm_enabled=False,
-                            output_schema=output_schema,
-                        )
-
-                    llm_response = ISO27001LLMResponse.model_validate(
-                        llm_result.responses[0]
-                    )
-                    return self._result_builder.build_output_message(
-                        rule,
-                        verdict=AssessmentVerdict(
-                            status=ControlStatus(llm_response.status),
-                            evidence_status=EvidenceStatus.AUTOMATED,
-                            rationale=llm_response.rationale,
-                            gap_description=llm_response.gap_description,
-                            recommended_actions=llm_response.recommended_actions,
-                        ),
-                        llm_enabled=True,
-                        output_schema=output_schema,
-                    )
-                case _:
-                    continue
-
-        # No recognised DispatchResult found
-        return self._result_builder.build_output_message(
-            rule,
-            verdict=AssessmentVerdict(
-                status=ControlStatus.NOT_ASSESSED,
-                evidence_status=EvidenceStatus.AUTOMATED,
-                rationale="No LLM dispatch result received.",
-                gap_description=None,
-            ),
-            llm_enabled=False,
-            output_schema=output_schema,
+        LLM-produced verdicts record the fingerprint they were assessed on.
+        """
+        if state.reused_verdict is not None:
+            assessed = AssessedControl(
+                state.rule,
+                state.reused_verdict,
+                llm_enabled=True,
+                fingerprint=state.fingerprint,
+                reused=True,
+            )
+        else:
+            verdict, llm_enabled = resolve_verdict(state.evidence_status, results)
+            assessed = AssessedControl(
+                state.rule,
+                verdict,
+                llm_enabled,
+                fingerprint=state.fingerprint if llm_enabled else None,
+            )
+        primary = self._result_builder.build_output_message(
+            assessed, output_schema=output_schema
         )
+        return primary, []
 
     def deserialise_prepare_result(
         self, raw: dict[str, Any]
@@ -341,112 +247,3 @@ class ISO27001Assessor(Analyser):
             f"No rule found for control_ref '{self._config.control_ref}' "
             f"in ruleset '{self._config.domain_ruleset}'"
         )
-
-    def _partition_and_filter(
-        self,
-        inputs: list[Message],
-        rule: ISO27001DomainsRule,
-    ) -> tuple[list[SecurityEvidenceModel], list[SecurityDocumentContextModel]]:
-        """Partition inputs by schema, extract findings, and apply filters.
-
-        1. Separate messages into security_evidence and document_context groups
-        2. Extract typed findings from each group
-        3. Filter security_evidence by domain intersection
-        4. Apply evidence_source filter (drop technical if not accepted, etc.)
-        5. Filter document_context by domain intersection (cross-cutting always pass)
-
-        """
-        raw_evidence: list[SecurityEvidenceModel] = []
-        raw_documents: list[SecurityDocumentContextModel] = []
-
-        for message in inputs:
-            match message.schema.name:
-                case "security_evidence":
-                    for item in message.content["findings"]:
-                        raw_evidence.append(SecurityEvidenceModel.model_validate(item))
-                case "security_document_context":
-                    for item in message.content["findings"]:
-                        raw_documents.append(
-                            SecurityDocumentContextModel.model_validate(item)
-                        )
-                case _:
-                    logger.warning(
-                        "Unexpected input schema '%s' — skipping",
-                        message.schema.name,
-                    )
-
-        rule_domains = set(rule.security_domains)
-
-        # Domain filter on security_evidence
-        evidence = [e for e in raw_evidence if e.security_domain in rule_domains]
-
-        # Evidence source filter
-        if "TECHNICAL" not in rule.evidence_source:
-            evidence = []
-        if "DOCUMENT" not in rule.evidence_source:
-            raw_documents = [d for d in raw_documents if not d.security_domains]
-
-        # Domain filter on document_context (cross-cutting always passes)
-        documents = [
-            d
-            for d in raw_documents
-            if not d.security_domains or set(d.security_domains) & rule_domains
-        ]
-
-        return evidence, documents
-
-    def _derive_evidence_status(
-        self,
-        rule: ISO27001DomainsRule,
-        evidence: list[SecurityEvidenceModel],
-        documents: list[SecurityDocumentContextModel],
-    ) -> EvidenceStatus:
-        """Derive evidence_status from the filtered evidence.
-
-        Decision tree:
-        1. evidence_required set and any required type missing → requires_attestation
-        2. Any evidence item has require_review=True → requires_attestation
-        3. No evidence and no documents → insufficient_evidence
-        4. Otherwise → automated
-
-        """
-        if rule.evidence_required:
-            has_technical = len(evidence) > 0
-            has_document = len(documents) > 0
-            type_present = {"TECHNICAL": has_technical, "DOCUMENT": has_document}
-            for required_type in rule.evidence_required:
-                if not type_present.get(required_type, False):
-                    return EvidenceStatus.REQUIRES_ATTESTATION
-
-        if any(e.require_review is True for e in evidence):
-            return EvidenceStatus.REQUIRES_ATTESTATION
-
-        if not evidence and not documents:
-            return EvidenceStatus.INSUFFICIENT_EVIDENCE
-
-        return EvidenceStatus.AUTOMATED
-
-    def _format_document_content(
-        self,
-        documents: list[SecurityDocumentContextModel],
-    ) -> str:
-        """Format document context items into a single content string.
-
-        Concatenates document text with filename headers for the LLM prompt.
-        Always returns a non-empty string (includes a placeholder when no
-        documents are available) so the ItemGroup.content is never None.
-
-        Args:
-            documents: Filtered document context items.
-
-        Returns:
-            Formatted document content string.
-
-        """
-        if not documents:
-            return "No document context available for this control."
-
-        parts: list[str] = []
-        for doc in documents:
-            parts.append(f"--- {doc.filename} ---\n{doc.summary}")
-        return "\n\n".join(parts)
@@ -0,0 +1,394 @@
+"""Multi-control ISO 27001 assessor."""
+
+import logging
+from collections import defaultdict
+from collections.abc import Sequence
+from itertools import batched
+from typing import Any, override
+
+from waivern_analysers_shared.utilities import RulesetManager
+from waivern_core import Analyser, InputRequirement
+from waivern_core.dispatch import DispatchRequest, DispatchResult, PrepareResult
+from waivern_core.message import Message
+from waivern_core.schemas import Schema
+from waivern_llm.types import LLMRequest
+from waivern_rulesets.iso27001_domains import ISO27001DomainsRule
+from waivern_schemas.iso27001_assessment import EvidenceStatus
+from waivern_schemas.security_document_context import SecurityDocumentContextModel
+from waivern_schemas.security_evidence import SecurityEvidenceModel
+
+from .analyser import ISO27001Assessor
+from .control_assessment import (
+    assessment_fingerprint,
+    build_assessment_request,
+    build_coalesced_request,
+    derive_evidence_status,
+    estimate_request_tokens,
+    resolve_coalesced_verdict,
+    resolve_verdict,
+)
+from .evidence_index import EvidenceIndex, Selection
+from .prior_assessments import PriorAssessments
+from .result_builder import AssessedControl, ISO27001ResultBuilder
+from .types import (
+    ControlPrepareState,
+    ISO27001BatchAssessorConfig,
+    ISO27001BatchPrepareState,
+    SharedEvidence,
+)
+
+logger = logging.getLogger(__name__)
+
+
+class ISO27001BatchAssessor(Analyser):
+    """Assessor for a set of ISO 27001 controls sharing the same inputs.
+
+    Assesses each control exactly as ``ISO27001Assessor`` would, but
+    deserialises and indexes the input evidence once for all of them instead
+    of once per control. A full Annex A assessment therefore reads its
+    inputs once rather than ~90 times.
+
+    With ``coalescing`` enabled, controls that select exactly the same
+    evidence (typically controls of the same security domains) are assessed
+    by one multi-control prompt, so the evidence is sampled and sent once.
+    Controls the coalesced prompt cannot assess — it exceeded the context
+    window, or its response skipped them — are re-assessed with
+    single-control prompts in a second dispatch round.
+
+    Given a previous run's ``iso27001_assessment`` as an extra input, controls
+    whose evidence, documents and rule are unchanged since that run reuse
+    their previous verdict, so only changed controls are sent to the LLM.
+
+    Emits a single ``iso27001_assessment`` message holding one finding per
+    control, in the order the controls were configured.
+    """
+
+    def __init__(self, config: ISO27001BatchAssessorConfig) -> None:
+        """Initialise the assessor.
+
+        Args:
+            config: Validated configuration with control_refs and ruleset URI.
+
+        """
+        self._config = config
+        self._result_builder = ISO27001ResultBuilder(config.domain_ruleset)
+
+    @classmethod
+    @override
+    def get_name(cls) -> str:
+        """Return the name of the assessor."""
+        return "iso27001_batch_assessor"
+
+    @classmethod
+    @override
+    def get_resource_pool(cls) -> str | None:
+        """Run in the ``llm`` pool: controls are assessed by an LLM."""
+        return "llm"
+
+    @classmethod
+    @override
+    def get_input_requirements(cls) -> list[list[InputRequirement]]:
+        """Declare the same input alternatives as ``ISO27001Assessor``."""
+        return ISO27001Assessor.get_input_requirements()
+
+    @classmethod
+    @override
+    def get_supported_output_schemas(cls) -> list[Schema]:
+        """Declare output schemas this assessor can produce."""
+        return ISO27001Assessor.get_supported_output_schemas()
+
+    # ── DistributedProcessor ────────────────────────────────────────────
+
+    def prepare(
+        self, inputs: list[Message], output_schema: Schema
+    ) -> PrepareResult[ISO27001BatchPrepareState]:
+        """Analyse inputs and declare LLM dispatch needs for every control.
+
+        1. Validate inputs and extract run_id
+        2. Index the evidence by security domain once
+        3. Per control: select its evidence, derive evidence_status and,
+           if AUTOMATED, build its LLMRequest
+        4. With coalescing enabled, AUTOMATED controls sharing a selection
+           get one LLMRequest between them instead
+        5. AUTOMATED controls whose fingerprint matches the previous run's
+           reuse its verdict and get no LLMRequest at all
+
+        """
+        if not inputs:
+            raise ValueError("No input messages provided")
+        run_id = inputs[0].run_id
+        if not run_id:
+            raise ValueError("Missing run_id on input for ISO 27001 batch assessment")
+
+        index = EvidenceIndex.from_messages(inputs)
+        prior = PriorAssessments.from_messages(inputs)
+
+        controls: list[ControlPrepareState] = []
+        requests: list[DispatchRequest] = []
+        # Positions in ``controls`` of the AUTOMATED controls per selection
+        shared: dict[Selection, list[int]] = {}
+        for rule in self._load_rules():
+            selection = index.selection(rule)
+            evidence, documents = index.materialise(selection)
+            evidence_status = derive_evidence_status(rule, evidence, documents)
+
+            control = ControlPrepareState(
+                rule=rule, evidence_status=evidence_status, request_id=None
+            )
+            if evidence_status == EvidenceStatus.AUTOMATED and not self._reuse_verdict(
+                control, evidence, documents, prior
+            ):
+                if self._config.coalescing.enabled:
+                    shared.setdefault(selection, []).append(len(controls))
+                else:
+                    request = self._build_request(rule, evidence, documents, run_id)
+                    requests.append(request)
+                    control.request_id = request.request_id
+
+            controls.append(control)
+
+        evidence_sets: list[SharedEvidence] = []
+        for selection, positions in shared.items():
+            evidence, documents = index.materialise(selection)
+            evidence_set: int | None = None
+            for chunk in batched(
+                positions, self._config.coalescing.max_controls_per_prompt
+            ):
+                rules = [controls[position].rule for position in chunk]
+                coalesced = self._build_coalesced_request(
+                    rules, evidence, documents, run_id
+                )
+                if coalesced is not None:
+                    if evidence_set is None:
+                        evidence_set = len(evidence_sets)
+                        evidence_sets.append(
+                            SharedEvidence(evidence=evidence, documents=documents)
+                        )
+                    requests.append(coalesced)
+                    for position in chunk:
+                        controls[position].request_id = coalesced.request_id
+                        controls[position].evidence_set = evidence_set
+                    continue
+
+                for position in chunk:
+                    request = self._build_request(
+                        controls[position].rule, evidence, documents, run_id
+                    )
+                    requests.append(request)
+                    controls[position].request_id = request.request_id
+
+        return PrepareResult(
+            state=ISO27001BatchPrepareState(
+                controls=controls, run_id=run_id, evidence_sets=evidence_sets
+            ),
+            requests=requests,
+        )
+
+    def finalise(
+        self,
+        state: ISO27001BatchPrepareState,
+        results: Sequence[DispatchResult],
+        output_schema: Schema,
+    ) -> tuple[Message, list[Message]] | PrepareResult[ISO27001BatchPrepareState]:
+        """Produce a verdict per control from state and dispatch results.
+
+        Results are matched to controls by request_id; each control's verdict
+        is then resolved as in ``ISO27001Assessor.finalise()``. Controls a
+        coalesced request failed to assess are given single-control requests
+        and returned as a new ``PrepareResult`` for a fallback round.
+        """
+        results_by_request: defaultdict[str, list[DispatchResult]] = defaultdict(list)
+        for result in results:
+            results_by_request[result.request_id].append(result)
+
+        controls: list[ControlPrepareState] = []
+        fallback_requests: list[DispatchRequest] = []
+        for control in state.controls:
+            if control.verdict is not None:
+                controls.append(control)
+                continue
+
+            control_results = (
+                results_by_request.get(control.request_id, [])
+                if control.request_id is not None
+                else []
+            )
+            if control.evidence_set is None:
+                verdict, llm_enabled = resolve_verdict(
+                    control.evidence_status, control_results
+                )
+            else:
+                resolved = resolve_coalesced_verdict(
+                    control.rule.control_ref, control_results
+                )
+                if resolved is None:
+                    shared = state.evidence_sets[control.evidence_set]
+                    request = self._build_request(
+                        control.rule, shared.evidence, shared.documents, state.run_id
+                    )
+                    fallback_requests.append(request)
+                    controls.append(
+                        control.model_copy(
+                            update={
+                                "request_id": request.request_id,
+                                "evidence_set": None,
+                            }
+                        )
+                    )
+                    continue
+                verdict, llm_enabled = resolved
+
+            controls.append(
+                control.model_copy(
+                    update={"verdict": verdict, "llm_enabled": llm_enabled}
+                )
+            )
+
+        if fallback_requests:
+            logger.info(
+                "ISO27001BatchAssessor: re-assessing %d control(s) with "
+                "single-control prompts",
+                len(fallback_requests),
+            )
+            return PrepareResult(
+                state=ISO27001BatchPrepareState(controls=controls, run_id=state.run_id),
+                requests=fallback_requests,
+            )
+
+        reused = sum(control.reused for control in controls)
+        if reused:
+            logger.info(
+                "ISO27001BatchAssessor: reused previous verdicts of %d unchanged "
+                "control(s)",
+                reused,
+            )
+
+        assessed = [
+            AssessedControl(
+                control.rule,
+                control.verdict,
+                control.llm_enabled,
+                fingerprint=control.fingerprint if control.llm_enabled else None,
+                reused=control.reused,
+            )
+            for control in controls
+            if control.verdict is not None
+        ]
+        primary = self._result_builder.build_batch_output_message(
+            assessed, output_schema=output_schema
+        )
+        return primary, []
+
+    def deserialise_prepare_result(
+        self, raw: dict[str, Any]
+    ) -> PrepareResult[ISO27001BatchPrepareState]:
+        """Reconstruct a typed PrepareResult from a raw dict.
+
+        Called on the resume path where a persisted PrepareResult must be
+        restored. Handles LLMRequest reconstruction with correct field types.
+
+        """
+        state = ISO27001BatchPrepareState.model_validate(raw["state"])
+        requests: list[DispatchRequest] = [
+            LLMRequest[SecurityEvidenceModel].model_validate(r)
+            for r in raw.get("requests", [])
+        ]
+        return PrepareResult(state=state, requests=requests)
+
+    # ── Private helpers ─────────────────────────────────────────────────
+
+    def _reuse_verdict(
+        self,
+        control: ControlPrepareState,
+        evidence: list[SecurityEvidenceModel],
+        documents: list[SecurityDocumentContextModel],
+        prior: PriorAssessments,
+    ) -> bool:
+        """Fingerprint an AUTOMATED control and reuse its previous verdict.
+
+        Returns:
+            Whether the previous run's verdict was reused, in which case the
+            control needs no LLM request.
+
+        """
+        control.fingerprint = assessment_fingerprint(
+            control.rule,
+            evidence,
+            documents,
+            domain_ruleset=self._config.domain_ruleset,
+            sampling=self._config.evidence_sampling,
+        )
+        control.verdict = prior.reusable_verdict(
+            control.rule.control_ref, control.fingerprint
+        )
+        if control.verdict is None:
+            return False
+        control.llm_enabled = True
+        control.reused = True
+        return True
+
+    def _build_request(
+        self,
+        rule: ISO27001DomainsRule,
+        evidence: list[SecurityEvidenceModel],
+        documents: list[SecurityDocumentContextModel],
+        run_id: str,
+    ) -> LLMRequest[SecurityEvidenceModel]:
+        """Build the single-control request for ``rule``."""
+        return build_assessment_request(
+            rule,
+            evidence,
+            documents,
+            run_id=run_id,
+            sampling=self._config.evidence_sampling,
+        )
+
+    def _build_coalesced_request(
+        self,
+        rules: list[ISO27001DomainsRule],
+        evidence: list[SecurityEvidenceModel],
+        documents: list[SecurityDocumentContextModel],
+        run_id: str,
+    ) -> LLMRequest[SecurityEvidenceModel] | None:
+        """Build one request for ``rules``, or None if they should not share one.
+
+        A lone control keeps its single-control prompt, as does a group whose
+        coalesced prompt is estimated to exceed the token budget.
+        """
+        if len(rules) < 2:  # noqa: PLR2004 - coalescing needs two controls
+            return None
+
+        request = build_coalesced_request(
+            rules,
+            evidence,
+            documents,
+            run_id=run_id,
+            sampling=self._config.evidence_sampling,
+        )
+        tokens = estimate_request_tokens(request, rules)
+        if tokens > self._config.coalescing.max_prompt_tokens:
+            logger.debug(
+                "ISO27001BatchAssessor: not coalescing %s (~%d tokens)",
+                request.name,
+                tokens,
+            )
+            return None
+        return request
+
+    def _load_rules(self) -> list[ISO27001DomainsRule]:
+        """Load the configured controls' rules, in configured order."""
+        ruleset = RulesetManager.get_ruleset(
+            self._config.domain_ruleset, ISO27001DomainsRule
+        )
+        rules = list(ruleset.get_rules())
+        if self._config.control_refs is None:
+            return rules
+
+        by_ref = {rule.control_ref: rule for rule in rules}
+        missing = [ref for ref in self._config.control_refs if ref not in by_ref]
+        if missing:
+            raise ValueError(
+                f"No rules found for control_refs {missing} "
+                f"in ruleset '{self._config.domain_ruleset}'"
+            )
+        return [by_ref[ref] for ref in self._config.control_refs]
@@ -0,0 +1,376 @@
+"""Assessment steps shared by the single- and multi-control assessors.
+
+Each control goes through the same three steps, whichever assessor runs it:
+
+1. ``derive_evidence_status`` decides from the control's evidence whether
+   it can be assessed automatically;
+2. ``build_assessment_request`` builds the LLM request for an automated
+   assessment;
+3. ``resolve_verdict`` turns the evidence status and dispatch results into
+   the control's verdict.
+
+Controls that share the same evidence may instead be assessed together:
+``build_coalesced_request`` builds one request for all of them and
+``resolve_coalesced_verdict`` picks each control's verdict out of its result.
+
+``assessment_fingerprint`` identifies what an automated assessment is based
+on, so a previous run's verdict can be reused while it is unchanged.
+"""
+
+import hashlib
+import json
+from collections.abc import Sequence
+
+from waivern_core.dispatch import DispatcherNotConfigured, DispatchResult
+from waivern_llm import BatchingMode, ItemGroup
+from waivern_llm.token_estimation import TOKENS_PER_FINDING, estimate_tokens
+from waivern_llm.types import LLMDispatchResult, LLMRequest
+from waivern_rulesets.iso27001_domains import ISO27001DomainsRule
+from waivern_schemas.iso27001_assessment import (
+    AssessmentVerdict,
+    ControlStatus,
+    EvidenceStatus,
+)
+from waivern_schemas.security_document_context import SecurityDocumentContextModel
+from waivern_schemas.security_evidence import SecurityEvidenceModel
+
+from .prompts.prompt_builder import (
+    ControlContext,
+    ISO27001MultiControlPromptBuilder,
+    ISO27001PromptBuilder,
+)
+from .prompts.response_model import (
+    ISO27001LLMResponse,
+    ISO27001MultiControlLLMResponse,
+)
+from .sampling import build_sampling_summary, stratified_sample
+from .types import EvidenceSamplingConfig
+
+
+def derive_evidence_status(
+    rule: ISO27001DomainsRule,
+    evidence: list[SecurityEvidenceModel],
+    documents: list[SecurityDocumentContextModel],
+) -> EvidenceStatus:
+    """Derive evidence_status from the control's filtered evidence.
+
+    Decision tree:
+    1. evidence_required set and any required type missing → requires_attestation
+    2. Any evidence item has require_review=True → requires_attestation
+    3. No evidence and no documents → insufficient_evidence
+    4. Otherwise → automated
+
+    """
+    if rule.evidence_required:
+        has_technical = len(evidence) > 0
+        has_document = len(documents) > 0
+        type_present = {"TECHNICAL": has_technical, "DOCUMENT": has_document}
+        for required_type in rule.evidence_required:
+            if not type_present.get(required_type, False):
+                return EvidenceStatus.REQUIRES_ATTESTATION
+
+    if any(e.require_review is True for e in evidence):
+        return EvidenceStatus.REQUIRES_ATTESTATION
+
+    if not evidence and not documents:
+        return EvidenceStatus.INSUFFICIENT_EVIDENCE
+
+    return EvidenceStatus.AUTOMATED
+
+
+def format_document_content(documents: list[SecurityDocumentContextModel]) -> str:
+    """Format document context items into a single content string.
+
+    Concatenates document text with filename headers for the LLM prompt.
+    Always returns a non-empty string (includes a placeholder when no
+    documents are available) so the ItemGroup.content is never None.
+
+    Args:
+        documents: Filtered document context items.
+
+    Returns:
+        Formatted document content string.
+
+    """
+    if not documents:
+        return "No document context available for this control."
+
+    parts: list[str] = []
+    for doc in documents:
+        parts.append(f"--- {doc.filename} ---\n{doc.summary}")
+    return "\n\n".join(parts)
+
+
+def build_assessment_request(
+    rule: ISO27001DomainsRule,
+    evidence: list[SecurityEvidenceModel],
+    documents: list[SecurityDocumentContextModel],
+    *,
+    run_id: str,
+    sampling: EvidenceSamplingConfig,
+) -> LLMRequest[SecurityEvidenceModel]:
+    """Build an LLMRequest for automated assessment of one control.
+
+    When evidence sampling is enabled, applies stratified sampling to
+    reduce evidence volume while preserving assessment quality. The
+    sampling summary is injected into the prompt so the LLM knows it
+    is seeing a representative subset.
+    """
+    evidence, sampling_summary = _sample(evidence, sampling)
+
+    return LLMRequest(
+        name=f"assessment:{rule.control_ref}",
+        groups=[
+            ItemGroup(
+                items=evidence,
+                content=format_document_content(documents),
+                group_id=rule.control_ref,
+            )
+        ],
+        prompt_builder=ISO27001PromptBuilder(_control_context(rule), sampling_summary),
+        response_model=ISO27001LLMResponse,
+        batching_mode=BatchingMode.INDEPENDENT,
+        run_id=run_id,
+    )
+
+
+def build_coalesced_request(
+    rules: Sequence[ISO27001DomainsRule],
+    evidence: list[SecurityEvidenceModel],
+    documents: list[SecurityDocumentContextModel],
+    *,
+    run_id: str,
+    sampling: EvidenceSamplingConfig,
+) -> LLMRequest[SecurityEvidenceModel]:
+    """Build one LLMRequest assessing several controls on the same evidence.
+
+    The evidence is sampled once and written into the prompt once; the LLM
+    answers with an ``ISO27001MultiControlLLMResponse`` holding a verdict
+    per control.
+    """
+    evidence, sampling_summary = _sample(evidence, sampling)
+    control_refs = "+".join(rule.control_ref for rule in rules)
+
+    return LLMRequest(
+        name=f"assessment:{control_refs}",
+        groups=[
+            ItemGroup(
+                items=evidence,
+                content=format_document_content(documents),
+                group_id=control_refs,
+            )
+        ],
+        prompt_builder=ISO27001MultiControlPromptBuilder(
+            [(rule.control_ref, _control_context(rule)) for rule in rules],
+            sampling_summary,
+        ),
+        response_model=ISO27001MultiControlLLMResponse,
+        batching_mode=BatchingMode.INDEPENDENT,
+        run_id=run_id,
+    )
+
+
+def estimate_request_tokens(
+    request: LLMRequest[SecurityEvidenceModel], rules: Sequence[ISO27001DomainsRule]
+) -> int:
+    """Estimate the prompt tokens of an assessment request for ``rules``.
+
+    Uses the dispatcher's own heuristics for the evidence and documents,
+    plus the guidance text of each control.
+    """
+    payload = sum(
+        estimate_tokens(group.content or "") + len(group.items) * TOKENS_PER_FINDING
+        for group in request.groups
+    )
+    return payload + sum(estimate_tokens(rule.guidance_text) for rule in rules)
+
+
+_FINGERPRINT_VERSION = 1
+"""Bump when prompts change in a way that should invalidate reused verdicts."""
+
+
+def assessment_fingerprint(
+    rule: ISO27001DomainsRule,
+    evidence: list[SecurityEvidenceModel],
+    documents: list[SecurityDocumentContextModel],
+    *,
+    domain_ruleset: str,
+    sampling: EvidenceSamplingConfig,
+) -> str:
+    """Fingerprint what an automated assessment of ``rule``'s control sees.
+
+    Covers the ruleset and rule, the evidence after sampling and the
+    document context, exactly as they would be written into the prompt.
+    Per-run values (item ids, snippet collection timestamps) are left out,
+    so unchanged evidence fingerprints the same in every run.
+
+    Returns:
+        Hex SHA-256 digest.
+
+    """
+    sampled, sampling_summary = _sample(evidence, sampling)
+    payload = {
+        "version": _FINGERPRINT_VERSION,
+        "ruleset": domain_ruleset,
+        "rule": rule.model_dump(mode="json"),
+        "sampling_summary": sampling_summary,
+        "evidence": [
+            item.model_dump(
+                mode="json",
+                exclude={"id": True, "evidence": {"__all__": {"collection_timestamp"}}},
+            )
+            for item in sampled
+        ],
+        "documents": format_document_content(documents),
+    }
+    encoded = json.dumps(payload, sort_keys=True, separators=(",", ":")).encode()
+    return hashlib.sha256(encoded).hexdigest()
+
+
+def _control_context(rule: ISO27001DomainsRule) -> ControlContext:
+    return ControlContext(
+        guidance_text=rule.guidance_text,
+        control_type=rule.control_type,
+        cia=list(rule.cia),
+        cybersecurity_concept=rule.cybersecurity_concept,
+        operational_capability=rule.operational_capability,
+        iso_security_domain=rule.iso_security_domain,
+    )
+
+
+def _sample(
+    evidence: list[SecurityEvidenceModel], sampling: EvidenceSamplingConfig
+) -> tuple[list[SecurityEvidenceModel], str | None]:
+    """Apply stratified sampling when enabled; return the items and summary."""
+    if sampling.enabled:
+        sample_result = stratified_sample(evidence, sampling.max_evidence_items)
+        if sample_result.was_sampled:
+            return sample_result.items, build_sampling_summary(sample_result)
+    return evidence, None
+
+
+def _not_assessed(evidence_status: EvidenceStatus, rationale: str) -> AssessmentVerdict:
+    return AssessmentVerdict(
+        status=ControlStatus.NOT_ASSESSED,
+        evidence_status=evidence_status,
+        rationale=rationale,
+        gap_description=None,
+    )
+
+
+def _not_configured(result: DispatcherNotConfigured) -> AssessmentVerdict:
+    return _not_assessed(
+        EvidenceStatus.AUTOMATED,
+        "LLM dispatcher not configured. Evidence was "
+        "sufficient for automated assessment but the "
+        f"dispatcher is unavailable: {result.reason}",
+    )
+
+
+def _no_result() -> AssessmentVerdict:
+    return _not_assessed(EvidenceStatus.AUTOMATED, "No LLM dispatch result received.")
+
+
+def _llm_verdict(response: ISO27001LLMResponse) -> AssessmentVerdict:
+    return AssessmentVerdict(
+        status=ControlStatus(response.status),
+        evidence_status=EvidenceStatus.AUTOMATED,
+        rationale=response.rationale,
+        gap_description=response.gap_description,
+        recommended_actions=response.recommended_actions,
+    )
+
+
+def resolve_verdict(
+    evidence_status: EvidenceStatus, results: Sequence[DispatchResult]
+) -> tuple[AssessmentVerdict, bool]:
+    """Produce a control's verdict from its evidence status and dispatch results.
+
+    1. Short-circuit paths (insufficient/requires-attestation): NOT_ASSESSED.
+    2. AUTOMATED + LLM result: parse response and build verdict.
+    3. AUTOMATED + empty LLM responses: evidence exceeded context window.
+
+    Args:
+        evidence_status: The control's evidence status from prepare.
+        results: Dispatch results for the control's request, if any.
+
+    Returns:
+        The verdict, and whether it was produced by the LLM.
+
+    """
+    match evidence_status:
+        case EvidenceStatus.INSUFFICIENT_EVIDENCE:
+            return _not_assessed(
+                evidence_status,
+                "No relevant evidence found. Neither technical findings "
+                "nor document context matched this control's security "
+                "domains.",
+            ), False
+        case EvidenceStatus.REQUIRES_ATTESTATION:
+            return _not_assessed(
+                evidence_status,
+                "Awaiting document evidence. This control requires "
+                "human-produced documentation (e.g. policy, procedure, "
+                "inspection report) that has not yet been provided.",
+            ), False
+        case EvidenceStatus.AUTOMATED:
+            pass
+
+    for result in results:
+        match result:
+            case DispatcherNotConfigured() as nc:
+                return _not_configured(nc), False
+            case LLMDispatchResult() as llm_result:
+                if not llm_result.responses:
+                    return _not_assessed(
+                        EvidenceStatus.AUTOMATED,
+                        "LLM assessment skipped — evidence exceeded context window.",
+                    ), False
+
+                llm_response = ISO27001LLMResponse.model_validate(
+                    llm_result.responses[0]
+                )
+                return _llm_verdict(llm_response), True
+            case _:
+                continue
+
+    # No recognised DispatchResult found
+    return _no_result(), False
+
+
+def resolve_coalesced_verdict(
+    control_ref: str, results: Sequence[DispatchResult]
+) -> tuple[AssessmentVerdict, bool] | None:
+    """Pick one control's verdict out of a coalesced request's results.
+
+    Args:
+        control_ref: The control whose verdict to resolve.
+        results: Dispatch results for the coalesced request.
+
+    Returns:
+        The verdict and whether it was produced by the LLM, or None when the
+        control must be re-assessed on its own: the coalesced prompt was
+        skipped (e.g. it exceeded the context window) or its response has no
+        verdict for this control.
+
+    """
+    for result in results:
+        match result:
+            case DispatcherNotConfigured() as nc:
+                return _not_configured(nc), False
+            case LLMDispatchResult() as llm_result:
+                if not llm_result.responses:
+                    return None
+
+                llm_response = ISO27001MultiControlLLMResponse.model_validate(
+                    llm_result.responses[0]
+                )
+                for assessment in llm_response.assessments:
+                    if assessment.control_ref == control_ref:
+                        return _llm_verdict(assessment), True
+                return None
+            case _:
+                continue
+
+    # No recognised DispatchResult found
+    return _no_result(), False
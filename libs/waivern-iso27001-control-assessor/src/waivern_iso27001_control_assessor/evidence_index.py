@@ -0,0 +1,160 @@
+"""Security domain index over an assessor's input evidence.
+
+Input messages are deserialised once into an ``EvidenceIndex`` that maps
+each security domain to the evidence and documents tagged with it. Selecting
+the evidence for a control then only touches the items in that control's
+domains, so assessing many controls against the same inputs costs
+O(evidence) to index plus the size of each control's selection, rather than
+O(controls x evidence).
+"""
+
+import heapq
+import logging
+from collections import defaultdict
+from collections.abc import Iterable, Sequence
+from typing import Self
+
+from waivern_core.message import Message
+from waivern_rulesets.iso27001_domains import ISO27001DomainsRule
+from waivern_schemas.security_document_context import (
+    SecurityDocumentContextModel,
+    SecurityDocumentContextOutput,
+)
+from waivern_schemas.security_domain import SecurityDomain
+from waivern_schemas.security_evidence import (
+    SecurityEvidenceModel,
+    SecurityEvidenceOutput,
+)
+
+logger = logging.getLogger(__name__)
+
+type Selection = tuple[tuple[int, ...], tuple[int, ...]]
+"""Positions of a control's evidence and documents in an ``EvidenceIndex``.
+
+Controls with equal selections are assessed on exactly the same inputs.
+"""
+
+
+class EvidenceIndex:
+    """Evidence and document context of one assessment, indexed by domain.
+
+    Selections keep the input order of the items, so a control sees its
+    evidence in the same order however it was looked up.
+    """
+
+    def __init__(
+        self,
+        evidence: Iterable[SecurityEvidenceModel],
+        documents: Iterable[SecurityDocumentContextModel],
+    ) -> None:
+        """Index evidence and documents by security domain.
+
+        Args:
+            evidence: Security evidence items, in input order.
+            documents: Document context items, in input order.
+
+        """
+        self._evidence = list(evidence)
+        self._documents = list(documents)
+
+        # Positions of the items tagged with each domain, in ascending order
+        self._evidence_by_domain: defaultdict[SecurityDomain, list[int]] = defaultdict(
+            list
+        )
+        for position, item in enumerate(self._evidence):
+            self._evidence_by_domain[item.security_domain].append(position)
+
+        self._cross_cutting: list[int] = []
+        self._documents_by_domain: defaultdict[SecurityDomain, list[int]] = defaultdict(
+            list
+        )
+        for position, document in enumerate(self._documents):
+            if not document.security_domains:
+                self._cross_cutting.append(position)
+            for domain in set(document.security_domains):
+                self._documents_by_domain[domain].append(position)
+
+    @classmethod
+    def from_messages(cls, inputs: Sequence[Message]) -> Self:
+        """Deserialise and index the findings of the input messages.
+
+        Reads ``security_evidence`` and ``security_document_context``
+        messages. ``iso27001_assessment`` messages (a previous run's verdicts,
+        see ``PriorAssessments``) are skipped; messages of any other schema
+        are skipped with a warning. Messages carrying their producer's typed
+        model are not validated again.
+        """
+        evidence: list[SecurityEvidenceModel] = []
+        documents: list[SecurityDocumentContextModel] = []
+
+        for message in inputs:
+            match message.schema.name:
+                case "security_evidence":
+                    if output := message.get_typed_content(SecurityEvidenceOutput):
+                        evidence.extend(output.findings)
+                    else:
+                        evidence.extend(
+                            SecurityEvidenceModel.model_validate(item)
+                            for item in message.content["findings"]
+                        )
+                case "security_document_context":
+                    if context := message.get_typed_content(
+                        SecurityDocumentContextOutput
+                    ):
+                        documents.extend(context.findings)
+                    else:
+                        documents.extend(
+                            SecurityDocumentContextModel.model_validate(item)
+                            for item in message.content["findings"]
+                        )
+                case "iso27001_assessment":
+                    continue
+                case _:
+                    logger.warning(
+                        "Unexpected input schema '%s' — skipping",
+                        message.schema.name,
+                    )
+
+        return cls(evidence, documents)
+
+    def select(
+        self, rule: ISO27001DomainsRule
+    ) -> tuple[list[SecurityEvidenceModel], list[SecurityDocumentContextModel]]:
+        """Return the evidence and documents relevant to ``rule``'s control."""
+        return self.materialise(self.selection(rule))
+
+    def selection(self, rule: ISO27001DomainsRule) -> Selection:
+        """Return the positions of the items relevant to ``rule``'s control.
+
+        1. Security evidence whose domain is one of the rule's domains,
+           provided the rule accepts TECHNICAL evidence
+        2. Cross-cutting documents (no domains), plus documents sharing a
+           domain with the rule when the rule accepts DOCUMENT evidence
+
+        """
+        domains = set(rule.security_domains)
+
+        evidence: tuple[int, ...] = ()
+        if "TECHNICAL" in rule.evidence_source:
+            evidence = tuple(
+                heapq.merge(
+                    *(self._evidence_by_domain.get(domain, []) for domain in domains)
+                )
+            )
+
+        documents = set(self._cross_cutting)
+        if "DOCUMENT" in rule.evidence_source:
+            for domain in domains:
+                documents.update(self._documents_by_domain.get(domain, []))
+
+        return evidence, tuple(sorted(documents))
+
+    def materialise(
+        self, selection: Selection
+    ) -> tuple[list[SecurityEvidenceModel], list[SecurityDocumentContextModel]]:
+        """Return the evidence and documents at a selection's positions."""
+        evidence_positions, document_positions = selection
+        return (
+            [self._evidence[position] for position in evidence_positions],
+            [self._documents[position] for position in document_positions],
+        )
@@ -1,4 +1,4 @@
-"""Factory for creating ISO27001Assessor instances."""
+"""Factories for creating ISO 27001 assessor instances."""
 
 from typing import override
 
@@ -8,7 +8,8 @@ from waivern_core.services.container import ServiceContainer
 from waivern_rulesets.iso27001_domains import ISO27001DomainsRule
 
 from .analyser import ISO27001Assessor
-from .types import ISO27001AssessorConfig
+from .batch_analyser import ISO27001BatchAssessor
+from .types import ISO27001AssessorConfig, ISO27001BatchAssessorConfig
 
 
 class ISO27001AssessorFactory(ComponentFactory[ISO27001Assessor]):
@@ -60,3 +61,57 @@ class ISO27001AssessorFactory(ComponentFactory[ISO27001Assessor]):
     def get_service_dependencies(self) -> dict[str, type]:
         """ISO27001Assessor has no service dependencies."""
         return {}
+
+
+class ISO27001BatchAssessorFactory(ComponentFactory[ISO27001BatchAssessor]):
+    """Factory for creating ISO27001BatchAssessor instances.
+
+    Takes a ``ServiceContainer`` for symmetry with other processor
+    factories; ISO27001BatchAssessor currently has no injected services.
+    """
+
+    def __init__(self, container: ServiceContainer) -> None:
+        """Initialise factory.
+
+        Args:
+            container: Service container for resolving dependencies (unused today).
+
+        """
+        self._container = container
+
+    @override
+    def create(self, config: ComponentConfig) -> ISO27001BatchAssessor:
+        """Create an ISO27001BatchAssessor from configuration."""
+        return ISO27001BatchAssessor(
+            config=ISO27001BatchAssessorConfig.from_properties(config),
+        )
+
+    @override
+    def can_create(self, config: ComponentConfig) -> bool:
+        """Validate configuration, ruleset availability and control references."""
+        try:
+            assessor_config = ISO27001BatchAssessorConfig.from_properties(config)
+        except Exception:
+            return False
+
+        try:
+            ruleset = RulesetManager.get_ruleset(
+                assessor_config.domain_ruleset, ISO27001DomainsRule
+            )
+        except Exception:
+            return False
+
+        if assessor_config.control_refs is None:
+            return True
+        known = {rule.control_ref for rule in ruleset.get_rules()}
+        return all(ref in known for ref in assessor_config.control_refs)
+
+    @property
+    @override
+    def component_class(self) -> type[ISO27001BatchAssessor]:
+        return ISO27001BatchAssessor
+
+    @override
+    def get_service_dependencies(self) -> dict[str, type]:
+        """ISO27001BatchAssessor has no service dependencies."""
+        return {}
@@ -0,0 +1,98 @@
+"""Verdicts of a previous assessment run, for incremental re-assessment.
+
+An assessor may take the ``iso27001_assessment`` output of an earlier run as
+an extra input (typically a ``reuse:`` artifact naming that run). Every
+LLM-produced finding records the fingerprint of what it was assessed on in
+its ``metadata.context``; when a control's fingerprint is unchanged, its
+previous verdict is reused instead of assessing the control again.
+"""
+
+import logging
+from collections.abc import Sequence
+from typing import Any, Self
+
+from waivern_core.message import Message
+from waivern_schemas.iso27001_assessment import (
+    AssessmentVerdict,
+    ControlStatus,
+    EvidenceStatus,
+    ISO27001AssessmentModel,
+)
+
+logger = logging.getLogger(__name__)
+
+PRIOR_ASSESSMENT_SCHEMA = "iso27001_assessment"
+"""Input schema carrying the verdicts of a previous run."""
+
+FINGERPRINT_CONTEXT_KEY = "assessment_fingerprint"
+"""Finding context key holding the fingerprint a verdict was assessed on."""
+
+REUSED_CONTEXT_KEY = "reused_prior_verdict"
+"""Finding context key set when a verdict was reused from a previous run."""
+
+
+class PriorAssessments:
+    """Reusable verdicts of a previous run, keyed by control reference."""
+
+    def __init__(self, findings: dict[str, dict[str, Any]]) -> None:
+        """Initialise from raw findings.
+
+        Args:
+            findings: Raw ``iso27001_assessment`` findings by control_ref.
+                Only findings carrying a fingerprint are considered.
+
+        """
+        self._findings = findings
+
+    @classmethod
+    def from_messages(cls, inputs: Sequence[Message]) -> Self:
+        """Collect fingerprinted findings from ``iso27001_assessment`` inputs.
+
+        Findings are only validated when their fingerprint matches, so
+        reading a full Annex A assessment costs one dict lookup per control.
+        """
+        findings: dict[str, dict[str, Any]] = {}
+        for message in inputs:
+            if message.schema.name != PRIOR_ASSESSMENT_SCHEMA:
+                continue
+            for finding in message.content["findings"]:
+                context = finding.get("metadata", {}).get("context", {})
+                if FINGERPRINT_CONTEXT_KEY in context:
+                    findings[finding["control_ref"]] = finding
+        return cls(findings)
+
+    def reusable_verdict(
+        self, control_ref: str, fingerprint: str
+    ) -> AssessmentVerdict | None:
+        """Return the previous verdict for a control whose inputs are unchanged.
+
+        Args:
+            control_ref: The control to look up.
+            fingerprint: Fingerprint of the control's current inputs.
+
+        Returns:
+            The previous LLM-produced verdict if it was assessed on the same
+            fingerprint, otherwise None.
+
+        """
+        raw = self._findings.get(control_ref)
+        if raw is None:
+            return None
+        if raw["metadata"]["context"][FINGERPRINT_CONTEXT_KEY] != fingerprint:
+            return None
+
+        finding = ISO27001AssessmentModel.model_validate(raw)
+        if (
+            finding.evidence_status != EvidenceStatus.AUTOMATED
+            or finding.status == ControlStatus.NOT_ASSESSED
+        ):
+            return None
+
+        logger.debug("ISO27001 [%s]: evidence unchanged, reusing verdict", control_ref)
+        return AssessmentVerdict(
+            status=finding.status,
+            evidence_status=finding.evidence_status,
+            rationale=finding.rationale,
+            gap_description=finding.gap_description,
+            recommended_actions=finding.recommended_actions,
+        )
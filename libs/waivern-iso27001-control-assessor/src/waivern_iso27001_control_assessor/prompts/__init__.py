@@ -1,6 +1,21 @@
 """Prompt construction for ISO 27001 control assessment."""
 
-from .prompt_builder import ControlContext, ISO27001PromptBuilder
-from .response_model import ISO27001LLMResponse
+from .prompt_builder import (
+    ControlContext,
+    ISO27001MultiControlPromptBuilder,
+    ISO27001PromptBuilder,
+)
+from .response_model import (
+    ISO27001ControlLLMResponse,
+    ISO27001LLMResponse,
+    ISO27001MultiControlLLMResponse,
+)
 
-__all__ = ["ControlContext", "ISO27001LLMResponse", "ISO27001PromptBuilder"]
+__all__ = [
+    "ControlContext",
+    "ISO27001ControlLLMResponse",
+    "ISO27001LLMResponse",
+    "ISO27001MultiControlLLMResponse",
+    "ISO27001MultiControlPromptBuilder",
+    "ISO27001PromptBuilder",
+]
@@ -1,7 +1,8 @@
-"""PromptBuilder for ISO 27001 control assessment.
+"""PromptBuilders for ISO 27001 control assessment.
 
 Implements the PromptBuilder protocol for generating assessment prompts
-that combine control guidance, technical evidence, and document context.
+that combine control guidance, technical evidence, and document context,
+either for one control or for several controls sharing the same evidence.
 """
 
 from collections.abc import Sequence
@@ -74,60 +75,130 @@ class ISO27001PromptBuilder(PromptBuilder[SecurityEvidenceModel]):
             Complete prompt string for LLM assessment.
 
         """
-        items = groups[0].items
-        content = groups[0].content
+        return _build_prompt(
+            framework_context=_FRAMEWORK_CONTEXT,
+            controls_section=(
+                f"**CONTROL UNDER ASSESSMENT:**\n{_describe_control(self._control)}"
+            ),
+            sampling_summary=self._sampling_summary,
+            group=groups[0],
+            instructions=_INSTRUCTIONS,
+        )
+
 
-        sections: list[str] = [
-            _FRAMEWORK_CONTEXT,
-            self._build_control_section(),
-        ]
+class ISO27001MultiControlPromptBuilder(PromptBuilder[SecurityEvidenceModel]):
+    """Builds one prompt assessing several controls against shared evidence.
 
-        if self._sampling_summary is not None:
-            sections.append(self._sampling_summary)
+    Used when several controls select exactly the same evidence and document
+    context: the evidence is written into the prompt once, followed by the
+    guidance of each control, and the LLM returns one verdict per control
+    (see ``ISO27001MultiControlLLMResponse``).
 
-        if items:
-            sections.append(self._build_evidence_section(items))
+    Uses INDEPENDENT batching mode, with the same single-group layout as
+    ``ISO27001PromptBuilder``.
+    """
 
-        if content is not None:
-            sections.append(f"**DOCUMENT CONTEXT:**\n{content}")
+    def __init__(
+        self,
+        controls: Sequence[tuple[str, ControlContext]],
+        sampling_summary: str | None = None,
+    ) -> None:
+        """Initialise with the controls to assess.
 
-        sections.append(_INSTRUCTIONS)
+        Args:
+            controls: (control_ref, context) of each control, in prompt order.
+            sampling_summary: Optional statistical summary injected into the
+                prompt when the shared evidence has been sampled.
 
-        return "\n\n".join(sections)
+        """
+        self._controls = list(controls)
+        self._sampling_summary = sampling_summary
+
+    @override
+    def build_prompt(
+        self,
+        groups: Sequence[ItemGroup[SecurityEvidenceModel]],
+    ) -> str:
+        """Build a multi-control assessment prompt from shared evidence.
+
+        Args:
+            groups: A single group whose items are the shared technical
+                evidence and whose content is the shared document context.
 
-    def _build_control_section(self) -> str:
-        """Build the control guidance and attributes section."""
-        cia_str = ", ".join(self._control.cia)
-        return (
-            f"**CONTROL UNDER ASSESSMENT:**\n"
-            f"{self._control.guidance_text}\n"
-            f"- Type: {self._control.control_type} | CIA: {cia_str}\n"
-            f"- Cybersecurity concept: {self._control.cybersecurity_concept} | "
-            f"Capability: {self._control.operational_capability}\n"
-            f"- Security domain: {self._control.iso_security_domain}"
+        Returns:
+            Complete prompt string for LLM assessment.
+
+        """
+        controls = "\n\n".join(
+            f"### {control_ref}\n{_describe_control(control)}"
+            for control_ref, control in self._controls
+        )
+        return _build_prompt(
+            framework_context=_MULTI_CONTROL_FRAMEWORK_CONTEXT,
+            controls_section=f"**CONTROLS UNDER ASSESSMENT:**\n{controls}",
+            sampling_summary=self._sampling_summary,
+            group=groups[0],
+            instructions=_MULTI_CONTROL_INSTRUCTIONS,
         )
 
-    def _build_evidence_section(self, items: Sequence[SecurityEvidenceModel]) -> str:
-        """Build the technical evidence section from security evidence items."""
-        parts: list[str] = ["**TECHNICAL EVIDENCE:**"]
-        for item in items:
-            polarity_marker = " [NEGATIVE]" if item.polarity == "negative" else ""
-            entry = (
-                f"- [{item.evidence_type}]{polarity_marker} "
-                f"(domain: {item.security_domain}, "
-                f"confidence: {item.confidence:.1f}): "
-                f"{item.description}"
-            )
-            if item.evidence:
-                snippets = "; ".join(e.content for e in item.evidence if e.content)
-                if snippets:
-                    entry += f"\n  Snippets: {snippets}"
-            parts.append(entry)
-        return "\n".join(parts)
-
-
-_FRAMEWORK_CONTEXT = """\
-You are assessing a single ISO 27001:2022 Annex A control. \
+
+def _build_prompt(
+    *,
+    framework_context: str,
+    controls_section: str,
+    sampling_summary: str | None,
+    group: ItemGroup[SecurityEvidenceModel],
+    instructions: str,
+) -> str:
+    """Assemble the prompt sections shared by both builders."""
+    sections: list[str] = [framework_context, controls_section]
+
+    if sampling_summary is not None:
+        sections.append(sampling_summary)
+
+    if group.items:
+        sections.append(_build_evidence_section(group.items))
+
+    if group.content is not None:
+        sections.append(f"**DOCUMENT CONTEXT:**\n{group.content}")
+
+    sections.append(instructions)
+
+    return "\n\n".join(sections)
+
+
+def _describe_control(control: ControlContext) -> str:
+    """Describe a control's guidance and Annex A attributes."""
+    cia_str = ", ".join(control.cia)
+    return (
+        f"{control.guidance_text}\n"
+        f"- Type: {control.control_type} | CIA: {cia_str}\n"
+        f"- Cybersecurity concept: {control.cybersecurity_concept} | "
+        f"Capability: {control.operational_capability}\n"
+        f"- Security domain: {control.iso_security_domain}"
+    )
+
+
+def _build_evidence_section(items: Sequence[SecurityEvidenceModel]) -> str:
+    """Build the technical evidence section from security evidence items."""
+    parts: list[str] = ["**TECHNICAL EVIDENCE:**"]
+    for item in items:
+        polarity_marker = " [NEGATIVE]" if item.polarity == "negative" else ""
+        entry = (
+            f"- [{item.evidence_type}]{polarity_marker} "
+            f"(domain: {item.security_domain}, "
+            f"confidence: {item.confidence:.1f}): "
+            f"{item.description}"
+        )
+        if item.evidence:
+            snippets = "; ".join(e.content for e in item.evidence if e.content)
+            if snippets:
+                entry += f"\n  Snippets: {snippets}"
+        parts.append(entry)
+    return "\n".join(parts)
+
+
+_FRAMEWORK_BACKGROUND = """\
 ISO 27001 is an information security management system standard. \
 Annex A defines 93 controls across organisational, people, physical, and technological categories.
 
@@ -137,7 +208,18 @@ Polarity indicates quality — positive = good practice, negative = gap or weakn
 - **Document** (policies, procedures, inspection reports): human-produced text provided as context.\
 """
 
-_INSTRUCTIONS = """\
+_FRAMEWORK_CONTEXT = (
+    "You are assessing a single ISO 27001:2022 Annex A control. "
+    + _FRAMEWORK_BACKGROUND
+)
+
+_MULTI_CONTROL_FRAMEWORK_CONTEXT = (
+    "You are assessing several ISO 27001:2022 Annex A controls against the same "
+    "evidence. Assess each control on its own merits; the verdict for one control "
+    "must not influence another. " + _FRAMEWORK_BACKGROUND
+)
+
+_ASSESSMENT_GUIDANCE = """\
 **ASSESSMENT INSTRUCTIONS:**
 - Code/config evidence takes priority over document claims. If code contradicts a policy, the code is ground truth.
 - 'compliant': evidence demonstrates the control IS implemented (not just planned or stated in policy).
@@ -161,7 +243,12 @@ Each action should be specific and fall into one of these categories:
 - **Technical implementation**: code changes, configuration updates, tool deployments
 - **Document creation/update**: policies, procedures, guidelines, risk registers
 - **Evidence gathering**: attestations, audit logs, third-party certifications
-When the control is 'compliant', recommended_actions must be an empty list.
+When the control is 'compliant', recommended_actions must be an empty list.\
+"""
+
+_INSTRUCTIONS = (
+    _ASSESSMENT_GUIDANCE
+    + """
 
 **RESPONSE FORMAT:**
 Respond with valid JSON:
@@ -171,3 +258,24 @@ Respond with valid JSON:
   "gap_description": "Actionable gap description, or null if compliant.",
   "recommended_actions": ["Action 1", "Action 2"]
 }"""
+)
+
+_MULTI_CONTROL_INSTRUCTIONS = (
+    _ASSESSMENT_GUIDANCE
+    + """
+
+**RESPONSE FORMAT:**
+Respond with valid JSON holding exactly one assessment per control above, \
+each identified by its control reference (e.g. "A.8.24"):
+{
+  "assessments": [
+    {
+      "control_ref": "A.x.y",
+      "status": "compliant" | "partial" | "non_compliant",
+      "rationale": "Narrative referencing specific evidence that informed the verdict.",
+      "gap_description": "Actionable gap description, or null if compliant.",
+      "recommended_actions": ["Action 1", "Action 2"]
+    }
+  ]
+}"""
+)
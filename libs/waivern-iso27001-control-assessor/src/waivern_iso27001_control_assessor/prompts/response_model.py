@@ -1,4 +1,4 @@
-"""Structured LLM response model for ISO 27001 control assessment."""
+"""Structured LLM response models for ISO 27001 control assessment."""
 
 from typing import Literal
 
@@ -42,3 +42,23 @@ class ISO27001LLMResponse(BaseModel):
             "Empty list when status is 'compliant'."
         ),
     )
+
+
+class ISO27001ControlLLMResponse(ISO27001LLMResponse):
+    """One control's verdict within a multi-control response."""
+
+    control_ref: str = Field(
+        description="Reference of the assessed control, exactly as given (e.g. 'A.8.24')",
+    )
+
+
+class ISO27001MultiControlLLMResponse(BaseModel):
+    """Structured response from the LLM for several controls sharing evidence.
+
+    Controls missing from ``assessments`` are re-assessed with a
+    single-control prompt.
+    """
+
+    assessments: list[ISO27001ControlLLMResponse] = Field(
+        description="One assessment per control under assessment",
+    )
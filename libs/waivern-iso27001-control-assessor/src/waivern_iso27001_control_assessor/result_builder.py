@@ -1,9 +1,12 @@
 """Result builder for ISO 27001 control assessment output."""
 
 import logging
+from collections.abc import Sequence
+from dataclasses import dataclass
 from datetime import UTC, datetime
 
-from waivern_core.message import Message
+from waivern_core import JsonValue
+from waivern_core.message import Message, boundary_typed_content
 from waivern_core.schemas import BaseAnalysisOutputMetadata, Schema
 from waivern_rulesets.iso27001_domains import ISO27001DomainsRule
 from waivern_schemas.iso27001_assessment import (
@@ -21,9 +24,27 @@ from waivern_schemas.iso27001_assessment import (
     OperationalCapability,
 )
 
+from .prior_assessments import FINGERPRINT_CONTEXT_KEY, REUSED_CONTEXT_KEY
+
 logger = logging.getLogger(__name__)
 
 
+@dataclass(frozen=True)
+class AssessedControl:
+    """One control's verdict, ready to be written as a finding."""
+
+    rule: ISO27001DomainsRule
+    verdict: AssessmentVerdict
+    llm_enabled: bool
+    """Whether the verdict was produced by the LLM."""
+
+    fingerprint: str | None = None
+    """Fingerprint of the inputs an LLM-produced verdict was assessed on."""
+
+    reused: bool = False
+    """Whether the verdict was reused from a previous run."""
+
+
 class ISO27001ResultBuilder:
     """Builds output messages for ISO 27001 control assessments."""
 
@@ -37,12 +58,7 @@ class ISO27001ResultBuilder:
         self._domain_ruleset = domain_ruleset
 
     def build_output_message(
-        self,
-        rule: ISO27001DomainsRule,
-        *,
-        verdict: AssessmentVerdict,
-        llm_enabled: bool,
-        output_schema: Schema,
+        self, assessed: AssessedControl, *, output_schema: Schema
     ) -> Message:
         """Build a validated output message for a single control assessment.
 
@@ -51,75 +67,122 @@ class ISO27001ResultBuilder:
         the schema.
 
         Args:
-            rule: The matched ISO 27001 rule (source of control attributes).
-            verdict: Grouped assessment result (status, evidence_status, rationale, gap).
-            llm_enabled: Whether this assessment used the LLM.
+            assessed: The control's rule (source of control attributes),
+                verdict and how the verdict was produced.
             output_schema: Schema for output validation.
 
         Returns:
             Validated output message.
 
         """
-        finding = ISO27001AssessmentModel(
-            metadata=ISO27001AssessmentMetadata(source=rule.control_ref),
-            control_ref=rule.control_ref,
-            status=verdict.status,
-            evidence_status=verdict.evidence_status,
-            rationale=verdict.rationale,
-            gap_description=verdict.gap_description,
-            recommended_actions=verdict.recommended_actions,
-            control_type=ControlType(rule.control_type),
-            cia=[CIAProperty(c) for c in rule.cia],
-            cybersecurity_concept=CybersecurityConcept(rule.cybersecurity_concept),
-            operational_capability=OperationalCapability(rule.operational_capability),
-            iso_security_domain=ISOSecurityDomain(rule.iso_security_domain),
+        return self._build_message(
+            [assessed],
+            message_id=f"iso27001_assessment_{assessed.rule.control_ref}",
+            output_schema=output_schema,
         )
 
+    def build_batch_output_message(
+        self, assessed: Sequence[AssessedControl], *, output_schema: Schema
+    ) -> Message:
+        """Build a validated output message holding one finding per control.
+
+        The summary counts every control; LLM validation is reported as
+        enabled if any verdict was produced by the LLM.
+
+        Args:
+            assessed: Verdicts of the assessed controls, in output order.
+            output_schema: Schema for output validation.
+
+        Returns:
+            Validated output message.
+
+        """
+        return self._build_message(
+            assessed,
+            message_id=f"iso27001_assessment_{len(assessed)}_controls",
+            output_schema=output_schema,
+        )
+
+    def _build_message(
+        self,
+        assessed: Sequence[AssessedControl],
+        *,
+        message_id: str,
+        output_schema: Schema,
+    ) -> Message:
+        findings = [self._build_finding(control) for control in assessed]
+        statuses = [control.verdict.status for control in assessed]
+        evidence_statuses = [control.verdict.evidence_status for control in assessed]
+
         summary = ISO27001AssessmentSummary(
-            total_controls=1,
-            compliant_count=1 if verdict.status == ControlStatus.COMPLIANT else 0,
-            partial_count=1 if verdict.status == ControlStatus.PARTIAL else 0,
-            non_compliant_count=1
-            if verdict.status == ControlStatus.NON_COMPLIANT
-            else 0,
-            not_assessed_count=1 if verdict.status == ControlStatus.NOT_ASSESSED else 0,
-            automated_count=(
-                1 if verdict.evidence_status == EvidenceStatus.AUTOMATED else 0
+            total_controls=len(assessed),
+            compliant_count=statuses.count(ControlStatus.COMPLIANT),
+            partial_count=statuses.count(ControlStatus.PARTIAL),
+            non_compliant_count=statuses.count(ControlStatus.NON_COMPLIANT),
+            not_assessed_count=statuses.count(ControlStatus.NOT_ASSESSED),
+            automated_count=evidence_statuses.count(EvidenceStatus.AUTOMATED),
+            requires_attestation_count=evidence_statuses.count(
+                EvidenceStatus.REQUIRES_ATTESTATION
             ),
-            requires_attestation_count=(
-                1
-                if verdict.evidence_status == EvidenceStatus.REQUIRES_ATTESTATION
-                else 0
-            ),
-            insufficient_evidence_count=(
-                1
-                if verdict.evidence_status == EvidenceStatus.INSUFFICIENT_EVIDENCE
-                else 0
+            insufficient_evidence_count=evidence_statuses.count(
+                EvidenceStatus.INSUFFICIENT_EVIDENCE
             ),
         )
 
         output = ISO27001AssessmentOutput(
-            findings=[finding],
+            findings=findings,
             summary=summary,
             analysis_metadata=BaseAnalysisOutputMetadata(
                 ruleset_used=self._domain_ruleset,
-                llm_validation_enabled=llm_enabled,
+                llm_validation_enabled=any(control.llm_enabled for control in assessed),
             ),
         )
 
         result_data = output.model_dump(mode="json", exclude_none=True)
         output_message = Message(
-            id=f"iso27001_assessment_{rule.control_ref}_{datetime.now(UTC).isoformat()}",
+            id=f"{message_id}_{datetime.now(UTC).isoformat()}",
             content=result_data,
             schema=output_schema,
+            typed_content=boundary_typed_content(output),
         )
         output_message.validate()
 
-        logger.info(
-            "ISO27001Assessor [%s]: evidence_status=%s, status=%s",
-            rule.control_ref,
-            verdict.evidence_status.value,
-            verdict.status.value,
-        )
+        for control in assessed:
+            logger.info(
+                "ISO27001Assessor [%s]: evidence_status=%s, status=%s",
+                control.rule.control_ref,
+                control.verdict.evidence_status.value,
+                control.verdict.status.value,
+            )
 
         return output_message
+
+    def _build_finding(self, assessed: AssessedControl) -> ISO27001AssessmentModel:
+        """Build the finding for one control, with its five ISO 27001 attributes.
+
+        LLM-produced verdicts record their input fingerprint in the metadata
+        context, so a later run can reuse them (see ``PriorAssessments``).
+        """
+        rule, verdict = assessed.rule, assessed.verdict
+        context: dict[str, JsonValue] = {}
+        if assessed.fingerprint is not None:
+            context[FINGERPRINT_CONTEXT_KEY] = assessed.fingerprint
+        if assessed.reused:
+            context[REUSED_CONTEXT_KEY] = True
+
+        return ISO27001AssessmentModel(
+            metadata=ISO27001AssessmentMetadata(
+                source=rule.control_ref, context=context
+            ),
+            control_ref=rule.control_ref,
+            status=verdict.status,
+            evidence_status=verdict.evidence_status,
+            rationale=verdict.rationale,
+            gap_description=verdict.gap_description,
+            recommended_actions=verdict.recommended_actions,
+            control_type=ControlType(rule.control_type),
+            cia=[CIAProperty(c) for c in rule.cia],
+            cybersecurity_concept=CybersecurityConcept(rule.cybersecurity_concept),
+            operational_capability=OperationalCapability(rule.operational_capability),
+            iso_security_domain=ISOSecurityDomain(rule.iso_security_domain),
+        )
@@ -2,12 +2,12 @@
 
 from typing import Any, Self, override
 
-from pydantic import BaseModel, ConfigDict, Field
+from pydantic import BaseModel, ConfigDict, Field, field_validator
 from waivern_core import BaseComponentConfiguration
 from waivern_core.config_validation import validate_or_raise
 from waivern_core.errors import ProcessorConfigError
 from waivern_rulesets.iso27001_domains import ISO27001DomainsRule
-from waivern_schemas.iso27001_assessment import EvidenceStatus
+from waivern_schemas.iso27001_assessment import AssessmentVerdict, EvidenceStatus
 from waivern_schemas.security_document_context import SecurityDocumentContextModel
 from waivern_schemas.security_evidence import SecurityEvidenceModel
 
@@ -36,6 +36,39 @@ class EvidenceSamplingConfig(BaseModel):
     )
 
 
+class PromptCoalescingConfig(BaseModel):
+    """Configuration for assessing controls that share evidence in one prompt.
+
+    When enabled, controls selecting exactly the same evidence and document
+    context are assessed together: the evidence is sent once with the
+    guidance of every control, and the LLM returns a verdict per control.
+    Groups that would exceed the token budget, and controls the coalesced
+    response does not cover, fall back to single-control prompts.
+
+    Disabled by default — each control gets its own prompt.
+    """
+
+    model_config = ConfigDict(frozen=True, extra="forbid")
+
+    enabled: bool = Field(
+        default=False,
+        description="Assess controls sharing the same evidence in one prompt",
+    )
+    max_controls_per_prompt: int = Field(
+        default=8,
+        ge=2,
+        description="Maximum controls assessed by one prompt",
+    )
+    max_prompt_tokens: int = Field(
+        default=50_000,
+        ge=1,
+        description=(
+            "Estimated prompt tokens above which controls are assessed "
+            "with single-control prompts instead"
+        ),
+    )
+
+
 class ISO27001AssessorConfig(BaseComponentConfiguration):
     """Configuration for ISO27001Assessor.
 
@@ -79,6 +112,63 @@ class ISO27001AssessorConfig(BaseComponentConfiguration):
         return validate_or_raise(cls, properties, ProcessorConfigError)
 
 
+class ISO27001BatchAssessorConfig(BaseComponentConfiguration):
+    """Configuration for ISO27001BatchAssessor.
+
+    One instance assesses a set of controls against the same inputs. When
+    control_refs is omitted, every control in the domain ruleset is assessed.
+    """
+
+    domain_ruleset: str = Field(
+        default="local/iso27001_domains/1.0.0",
+        description="Ruleset URI for ISO 27001 domain rules",
+    )
+    control_refs: list[str] | None = Field(
+        default=None,
+        min_length=1,
+        description=(
+            "ISO 27001:2022 Annex A control references to assess "
+            "(default: every control in the ruleset)"
+        ),
+    )
+    evidence_sampling: EvidenceSamplingConfig = Field(
+        default_factory=EvidenceSamplingConfig,
+        description="Stratified evidence sampling configuration",
+    )
+    coalescing: PromptCoalescingConfig = Field(
+        default_factory=PromptCoalescingConfig,
+        description="Multi-control prompt coalescing configuration",
+    )
+
+    @field_validator("control_refs")
+    @classmethod
+    def validate_unique_control_refs(cls, refs: list[str] | None) -> list[str] | None:
+        """Validate that each control is listed once."""
+        if refs is None:
+            return None
+        duplicates = sorted({ref for ref in refs if refs.count(ref) > 1})
+        if duplicates:
+            raise ValueError(f"Duplicate control_refs found: {duplicates}")
+        return refs
+
+    @classmethod
+    @override
+    def from_properties(cls, properties: dict[str, Any]) -> Self:
+        """Create configuration from runbook properties.
+
+        Args:
+            properties: Raw properties from runbook configuration
+
+        Returns:
+            Validated configuration object
+
+        Raises:
+            ProcessorConfigError: If validation fails
+
+        """
+        return validate_or_raise(cls, properties, ProcessorConfigError)
+
+
 class ISO27001PrepareState(BaseModel):
     """Intermediate state for the distributed processor prepare/finalise split.
 
@@ -92,3 +182,71 @@ class ISO27001PrepareState(BaseModel):
     evidence: list[SecurityEvidenceModel]
     documents: list[SecurityDocumentContextModel]
     run_id: str
+    fingerprint: str | None = Field(
+        default=None,
+        description="Fingerprint of the inputs of an AUTOMATED assessment",
+    )
+    reused_verdict: AssessmentVerdict | None = Field(
+        default=None,
+        description="Previous run's verdict, reused because the fingerprint matched",
+    )
+
+
+class ControlPrepareState(BaseModel):
+    """What ``ISO27001BatchAssessor.finalise()`` needs to know about one control.
+
+    Holds no evidence: the evidence a control was assessed on travels in its
+    LLM request, so the persisted state stays small however many controls
+    share the inputs.
+    """
+
+    rule: ISO27001DomainsRule
+    evidence_status: EvidenceStatus
+    request_id: str | None = Field(
+        description="ID of the control's LLM request, or None if none was made",
+    )
+    evidence_set: int | None = Field(
+        default=None,
+        description=(
+            "Index into ISO27001BatchPrepareState.evidence_sets when the "
+            "request is coalesced with other controls'"
+        ),
+    )
+    verdict: AssessmentVerdict | None = Field(
+        default=None,
+        description="Verdict resolved in an earlier dispatch round",
+    )
+    llm_enabled: bool = Field(
+        default=False,
+        description="Whether the earlier round's verdict came from the LLM",
+    )
+    fingerprint: str | None = Field(
+        default=None,
+        description="Fingerprint of the inputs of an AUTOMATED assessment",
+    )
+    reused: bool = Field(
+        default=False,
+        description="Whether the verdict was reused from a previous run",
+    )
+
+
+class SharedEvidence(BaseModel):
+    """Evidence and documents shared by the controls of a coalesced request.
+
+    Kept so that controls the coalesced request fails to assess can be
+    re-assessed with single-control prompts in a fallback round.
+    """
+
+    evidence: list[SecurityEvidenceModel]
+    documents: list[SecurityDocumentContextModel]
+
+
+class ISO27001BatchPrepareState(BaseModel):
+    """Intermediate state for the multi-control prepare/finalise split."""
+
+    controls: list[ControlPrepareState]
+    run_id: str
+    evidence_sets: list[SharedEvidence] = Field(
+        default_factory=list,
+        description="Evidence of each coalesced request, for the fallback round",
+    )
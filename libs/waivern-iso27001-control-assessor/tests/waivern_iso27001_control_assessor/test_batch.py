@@ -0,0 +1,408 @@
+"""Tests for ISO27001BatchAssessor.
+
+Verifies that assessing several controls in one batch gives each control the
+same evidence selection and verdict as the single-control assessor, and that
+dispatch results are matched back to their controls.
+"""
+
+import pytest
+from waivern_core.dispatch import PrepareResult
+from waivern_core.errors import ProcessorConfigError
+from waivern_core.message import Message
+from waivern_llm.types import LLMDispatchResult, LLMRequest
+from waivern_schemas.iso27001_assessment import ControlStatus, EvidenceStatus
+
+from waivern_iso27001_control_assessor import (
+    ISO27001Assessor,
+    ISO27001AssessorConfig,
+    ISO27001BatchAssessor,
+    ISO27001BatchAssessorConfig,
+)
+from waivern_iso27001_control_assessor.prompts import (
+    ISO27001MultiControlLLMResponse,
+    ISO27001MultiControlPromptBuilder,
+)
+from waivern_iso27001_control_assessor.types import ISO27001BatchPrepareState
+
+from .test_helpers import (
+    OUTPUT_SCHEMA,
+    make_document_finding,
+    make_document_message,
+    make_evidence_finding,
+    make_evidence_message,
+    parse_output,
+)
+
+CONTROL_REFS = ["A.8.24", "A.5.15", "A.8.5", "A.5.1"]
+"""Automated (A.8.24, A.8.5), attestation-required (A.5.15) and
+insufficient-evidence (A.5.1) controls, given ``_make_inputs()``."""
+
+
+def _make_batch_assessor(
+    control_refs: list[str] | None = None,
+    coalescing: dict[str, object] | None = None,
+) -> ISO27001BatchAssessor:
+    """Build a batch assessor for the given control references."""
+    properties: dict[str, object] = {}
+    if control_refs is not None:
+        properties["control_refs"] = control_refs
+    if coalescing is not None:
+        properties["coalescing"] = coalescing
+    config = ISO27001BatchAssessorConfig.from_properties(properties)
+    return ISO27001BatchAssessor(config=config)
+
+
+def _make_inputs() -> list[Message]:
+    """Evidence and documents spanning several security domains."""
+    return [
+        make_evidence_message(
+            [
+                make_evidence_finding(security_domain="encryption"),
+                make_evidence_finding(
+                    security_domain="authentication", evidence_type="CONFIG"
+                ),
+                make_evidence_finding(security_domain="access_control"),
+                make_evidence_finding(
+                    security_domain="encryption", evidence_type="CONFIG"
+                ),
+            ]
+        ),
+        make_document_message(
+            [
+                make_document_finding(["authentication"], "auth.md"),
+                make_document_finding(["encryption"], "crypto.md"),
+            ]
+        ),
+    ]
+
+
+def _llm_result(request_id: str, status: str, rationale: str) -> LLMDispatchResult:
+    return LLMDispatchResult(
+        request_id=request_id,
+        model_name="claude-sonnet-4-5-20250929",
+        responses=[
+            {
+                "status": status,
+                "rationale": rationale,
+                "gap_description": None,
+                "recommended_actions": [],
+            }
+        ],
+        skipped=[],
+    )
+
+
+def _coalesced_result(
+    request_id: str, verdicts: dict[str, str] | None
+) -> LLMDispatchResult:
+    """Result of a coalesced request; None means the prompt was skipped."""
+    responses: list[dict[str, object]] = []
+    if verdicts is not None:
+        responses.append(
+            {
+                "assessments": [
+                    {
+                        "control_ref": control_ref,
+                        "status": status,
+                        "rationale": f"{control_ref} is {status}.",
+                        "gap_description": None,
+                        "recommended_actions": [],
+                    }
+                    for control_ref, status in verdicts.items()
+                ]
+            }
+        )
+    return LLMDispatchResult(
+        request_id=request_id,
+        model_name="claude-sonnet-4-5-20250929",
+        responses=responses,
+        skipped=[],
+    )
+
+
+SHARED_CONTROL_REFS = ["A.5.15", "A.8.2", "A.8.24"]
+"""A.5.15 and A.8.2 both select the access_control evidence; A.8.24 selects
+the encryption evidence on its own."""
+
+
+def _make_shared_inputs() -> list[Message]:
+    """Evidence and documents giving A.5.15 and A.8.2 identical selections."""
+    return [
+        make_evidence_message(
+            [
+                make_evidence_finding(security_domain="access_control"),
+                make_evidence_finding(security_domain="encryption"),
+            ]
+        ),
+        make_document_message(
+            [make_document_finding(["access_control"], "access_policy.md")]
+        ),
+    ]
+
+
+class TestBatchPrepare:
+    """Tests for prepare() across several controls."""
+
+    def test_requests_only_automated_controls_in_configured_order(self) -> None:
+        assessor = _make_batch_assessor(CONTROL_REFS)
+
+        result = assessor.prepare(inputs=_make_inputs(), output_schema=OUTPUT_SCHEMA)
+
+        controls = result.state.controls
+        assert [c.rule.control_ref for c in controls] == CONTROL_REFS
+        assert [c.evidence_status for c in controls] == [
+            EvidenceStatus.AUTOMATED,
+            EvidenceStatus.REQUIRES_ATTESTATION,
+            EvidenceStatus.AUTOMATED,
+            EvidenceStatus.INSUFFICIENT_EVIDENCE,
+        ]
+        assert [r.request_id for r in result.requests] == [
+            c.request_id for c in controls if c.request_id is not None
+        ]
+        assert controls[1].request_id is None
+
+    def test_selects_same_evidence_as_single_control_assessor(self) -> None:
+        """Each control's request carries what ISO27001Assessor would send."""
+        batch = _make_batch_assessor(CONTROL_REFS).prepare(
+            inputs=_make_inputs(), output_schema=OUTPUT_SCHEMA
+        )
+        batch_requests = {r.name: r for r in batch.requests}
+
+        for control_ref in CONTROL_REFS:
+            single = ISO27001Assessor(
+                config=ISO27001AssessorConfig.from_properties(
+                    {"control_ref": control_ref}
+                )
+            ).prepare(inputs=_make_inputs(), output_schema=OUTPUT_SCHEMA)
+
+            batch_request = batch_requests.get(f"assessment:{control_ref}")
+            if not single.requests:
+                assert batch_request is None
+                continue
+
+            single_request = single.requests[0]
+            assert isinstance(single_request, LLMRequest)
+            assert isinstance(batch_request, LLMRequest)
+            assert batch_request.groups == single_request.groups
+
+    def test_omitted_control_refs_assesses_every_control(self) -> None:
+        assessor = _make_batch_assessor()
+
+        result = assessor.prepare(inputs=_make_inputs(), output_schema=OUTPUT_SCHEMA)
+
+        control_refs = [c.rule.control_ref for c in result.state.controls]
+        assert len(control_refs) > len(CONTROL_REFS)
+        assert set(CONTROL_REFS) <= set(control_refs)
+
+    def test_unknown_control_ref_raises(self) -> None:
+        assessor = _make_batch_assessor(["A.8.24", "A.99.1"])
+
+        with pytest.raises(ValueError, match="A.99.1"):
+            assessor.prepare(inputs=_make_inputs(), output_schema=OUTPUT_SCHEMA)
+
+
+class TestBatchFinalise:
+    """Tests for finalise() — one finding per control."""
+
+    def test_matches_results_to_controls_by_request_id(self) -> None:
+        assessor = _make_batch_assessor(["A.8.24", "A.5.15", "A.8.5"])
+        prepared = assessor.prepare(inputs=_make_inputs(), output_schema=OUTPUT_SCHEMA)
+        crypto, _access, auth = prepared.state.controls
+        assert crypto.request_id is not None
+        assert auth.request_id is not None
+
+        # Results arrive in a different order from the requests
+        results = [
+            _llm_result(auth.request_id, "partial", "MFA is optional."),
+            _llm_result(crypto.request_id, "compliant", "AES-256 throughout."),
+        ]
+        outcome = assessor.finalise(prepared.state, results, OUTPUT_SCHEMA)
+        assert isinstance(outcome, tuple)
+        message, sidecars = outcome
+
+        output = parse_output(message)
+        assert sidecars == []
+        assert [(f.control_ref, f.status, f.rationale) for f in output.findings] == [
+            ("A.8.24", ControlStatus.COMPLIANT, "AES-256 throughout."),
+            ("A.5.15", ControlStatus.NOT_ASSESSED, output.findings[1].rationale),
+            ("A.8.5", ControlStatus.PARTIAL, "MFA is optional."),
+        ]
+        assert "Awaiting document evidence" in output.findings[1].rationale
+        assert output.summary.total_controls == 3
+        assert output.summary.compliant_count == 1
+        assert output.summary.partial_count == 1
+        assert output.summary.not_assessed_count == 1
+        assert output.summary.requires_attestation_count == 1
+        assert output.analysis_metadata.llm_validation_enabled is True
+
+    def test_control_without_result_is_not_assessed(self) -> None:
+        assessor = _make_batch_assessor(["A.8.24"])
+        prepared = assessor.prepare(inputs=_make_inputs(), output_schema=OUTPUT_SCHEMA)
+
+        outcome = assessor.finalise(prepared.state, [], OUTPUT_SCHEMA)
+        assert isinstance(outcome, tuple)
+
+        finding = parse_output(outcome[0]).findings[0]
+        assert finding.status == ControlStatus.NOT_ASSESSED
+        assert finding.rationale == "No LLM dispatch result received."
+
+
+class TestCoalescing:
+    """Tests for multi-control prompt coalescing and its fallback round."""
+
+    def _prepare(
+        self, coalescing: dict[str, object] | None = None
+    ) -> tuple[ISO27001BatchAssessor, PrepareResult[ISO27001BatchPrepareState]]:
+        assessor = _make_batch_assessor(
+            SHARED_CONTROL_REFS, coalescing or {"enabled": True}
+        )
+        prepared = assessor.prepare(
+            inputs=_make_shared_inputs(), output_schema=OUTPUT_SCHEMA
+        )
+        return assessor, prepared
+
+    def test_controls_sharing_evidence_get_one_request(self) -> None:
+        _assessor, prepared = self._prepare()
+
+        access, privileged, crypto = prepared.state.controls
+        assert access.request_id == privileged.request_id
+        assert crypto.request_id != access.request_id
+        assert len(prepared.requests) == 2
+
+        coalesced = next(
+            r for r in prepared.requests if r.request_id == access.request_id
+        )
+        assert isinstance(coalesced, LLMRequest)
+        assert isinstance(coalesced.prompt_builder, ISO27001MultiControlPromptBuilder)
+        assert coalesced.response_model is ISO27001MultiControlLLMResponse
+        assert coalesced.groups[0].group_id == "A.5.15+A.8.2"
+
+    def test_disabled_by_default(self) -> None:
+        assessor = _make_batch_assessor(SHARED_CONTROL_REFS)
+
+        prepared = assessor.prepare(
+            inputs=_make_shared_inputs(), output_schema=OUTPUT_SCHEMA
+        )
+
+        assert len(prepared.requests) == 3
+
+    def test_over_budget_group_uses_single_control_requests(self) -> None:
+        _assessor, prepared = self._prepare({"enabled": True, "max_prompt_tokens": 1})
+
+        assert len(prepared.requests) == 3
+        assert prepared.state.evidence_sets == []
+
+    def test_coalesced_response_resolves_each_control(self) -> None:
+        assessor, prepared = self._prepare()
+        access, _privileged, crypto = prepared.state.controls
+        assert access.request_id is not None
+        assert crypto.request_id is not None
+
+        results = [
+            _coalesced_result(
+                access.request_id, {"A.8.2": "partial", "A.5.15": "compliant"}
+            ),
+            _llm_result(crypto.request_id, "compliant", "AES-256 throughout."),
+        ]
+        outcome = assessor.finalise(prepared.state, results, OUTPUT_SCHEMA)
+        assert isinstance(outcome, tuple)
+
+        output = parse_output(outcome[0])
+        assert [(f.control_ref, f.status) for f in output.findings] == [
+            ("A.5.15", ControlStatus.COMPLIANT),
+            ("A.8.2", ControlStatus.PARTIAL),
+            ("A.8.24", ControlStatus.COMPLIANT),
+        ]
+        assert output.findings[1].rationale == "A.8.2 is partial."
+
+    def test_controls_missing_from_response_fall_back_to_own_prompts(self) -> None:
+        assessor, prepared = self._prepare()
+        access, _privileged, crypto = prepared.state.controls
+        assert access.request_id is not None
+        assert crypto.request_id is not None
+
+        first = assessor.finalise(
+            prepared.state,
+            [
+                _coalesced_result(access.request_id, {"A.5.15": "compliant"}),
+                _llm_result(crypto.request_id, "compliant", "AES-256 throughout."),
+            ],
+            OUTPUT_SCHEMA,
+        )
+
+        assert isinstance(first, PrepareResult)
+        assert [r.name for r in first.requests] == ["assessment:A.8.2"]
+        fallback = first.requests[0]
+        second = assessor.finalise(
+            first.state,
+            [_llm_result(fallback.request_id, "non_compliant", "No PAM tooling.")],
+            OUTPUT_SCHEMA,
+        )
+
+        assert isinstance(second, tuple)
+        output = parse_output(second[0])
+        assert [(f.control_ref, f.status) for f in output.findings] == [
+            ("A.5.15", ControlStatus.COMPLIANT),
+            ("A.8.2", ControlStatus.NON_COMPLIANT),
+            ("A.8.24", ControlStatus.COMPLIANT),
+        ]
+
+    def test_skipped_coalesced_prompt_falls_back_for_every_control(self) -> None:
+        """An oversized coalesced prompt comes back with no responses."""
+        assessor, prepared = self._prepare()
+        access, _privileged, crypto = prepared.state.controls
+        assert access.request_id is not None
+        assert crypto.request_id is not None
+
+        outcome = assessor.finalise(
+            prepared.state,
+            [
+                _coalesced_result(access.request_id, None),
+                _llm_result(crypto.request_id, "compliant", "AES-256 throughout."),
+            ],
+            OUTPUT_SCHEMA,
+        )
+
+        assert isinstance(outcome, PrepareResult)
+        assert [r.name for r in outcome.requests] == [
+            "assessment:A.5.15",
+            "assessment:A.8.2",
+        ]
+        assert outcome.state.evidence_sets == []
+
+    def test_round_trip_serialisation_keeps_shared_evidence(self) -> None:
+        assessor, prepared = self._prepare()
+
+        restored = assessor.deserialise_prepare_result(prepared.model_dump(mode="json"))
+
+        assert restored.state == prepared.state
+        assert len(restored.state.evidence_sets) == 1
+
+
+class TestBatchDeserialise:
+    """Tests for deserialise_prepare_result() round-trip fidelity."""
+
+    def test_round_trip_serialisation(self) -> None:
+        assessor = _make_batch_assessor(CONTROL_REFS)
+        original = assessor.prepare(inputs=_make_inputs(), output_schema=OUTPUT_SCHEMA)
+
+        restored = assessor.deserialise_prepare_result(original.model_dump(mode="json"))
+
+        assert restored.state == original.state
+        assert [r.request_id for r in restored.requests] == [
+            r.request_id for r in original.requests
+        ]
+
+
+class TestBatchConfig:
+    """Tests for ISO27001BatchAssessorConfig validation."""
+
+    def test_duplicate_control_refs_rejected(self) -> None:
+        with pytest.raises(ProcessorConfigError, match="Duplicate control_refs"):
+            ISO27001BatchAssessorConfig.from_properties(
+                {"control_refs": ["A.8.24", "A.8.24"]}
+            )
+
+    def test_empty_control_refs_rejected(self) -> None:
+        with pytest.raises(ProcessorConfigError):
+            ISO27001BatchAssessorConfig.from_properties({"control_refs": []})
@@ -0,0 +1,39 @@
+"""Tests for indexing an assessor's input messages by security domain."""
+
+from unittest.mock import patch
+
+from waivern_schemas.security_evidence import (
+    SecurityEvidenceModel,
+    SecurityEvidenceOutput,
+)
+
+from waivern_iso27001_control_assessor.evidence_index import EvidenceIndex
+
+from .test_helpers import make_evidence_finding, make_evidence_message
+
+
+class TestEvidenceIndexFromMessages:
+    """Tests for deserialising input messages into an EvidenceIndex."""
+
+    def test_typed_evidence_is_not_validated_again(self) -> None:
+        """Findings of a message carrying its typed model are indexed as-is."""
+        message = make_evidence_message([make_evidence_finding()])
+        output = SecurityEvidenceOutput.model_validate(message.content)
+        message.typed_content = output
+
+        with patch.object(
+            SecurityEvidenceModel, "model_validate", side_effect=AssertionError
+        ):
+            index = EvidenceIndex.from_messages([message])
+
+        evidence, _ = index.materialise(((0,), ()))
+        assert evidence == [output.findings[0]]
+
+    def test_untyped_evidence_is_validated(self) -> None:
+        """Findings loaded from a store are validated into models."""
+        message = make_evidence_message([make_evidence_finding("encryption")])
+
+        index = EvidenceIndex.from_messages([message])
+
+        evidence, _ = index.materialise(((0,), ()))
+        assert evidence[0].security_domain == "encryption"
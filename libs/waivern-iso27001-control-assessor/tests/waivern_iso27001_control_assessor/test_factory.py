@@ -1,4 +1,4 @@
-"""Tests for ISO27001AssessorFactory and ISO27001Assessor contract compliance."""
+"""Tests for the ISO 27001 assessor factories and assessor contract compliance."""
 
 import pytest
 from waivern_core import ComponentConfig, ComponentFactory
@@ -9,6 +9,8 @@ from waivern_core.testing import AnalyserContractTests, ComponentFactoryContract
 from waivern_iso27001_control_assessor import (
     ISO27001Assessor,
     ISO27001AssessorFactory,
+    ISO27001BatchAssessor,
+    ISO27001BatchAssessorFactory,
 )
 
 
@@ -55,3 +57,44 @@ class TestISO27001AssessorFactory:
             ProcessorConfigError, match="Invalid ISO27001AssessorConfig"
         ):
             factory.create({"unknown_field": "value"})
+
+
+class TestISO27001BatchAssessorContract(AnalyserContractTests[ISO27001BatchAssessor]):
+    """Contract tests for ISO27001BatchAssessor class-level declarations."""
+
+    @pytest.fixture
+    def processor_class(self) -> type[ISO27001BatchAssessor]:
+        return ISO27001BatchAssessor
+
+
+class TestISO27001BatchAssessorFactoryContract(
+    ComponentFactoryContractTests[ISO27001BatchAssessor],
+):
+    """Contract tests for ISO27001BatchAssessorFactory."""
+
+    @pytest.fixture
+    def factory(self) -> ComponentFactory[ISO27001BatchAssessor]:
+        return ISO27001BatchAssessorFactory(ServiceContainer())
+
+    @pytest.fixture
+    def valid_config(self) -> ComponentConfig:
+        return {
+            "domain_ruleset": "local/iso27001_domains/1.0.0",
+            "control_refs": ["A.5.1", "A.8.24"],
+        }
+
+
+class TestISO27001BatchAssessorFactory:
+    """Batch factory-specific behaviour tests."""
+
+    def test_can_create_without_control_refs(self) -> None:
+        factory = ISO27001BatchAssessorFactory(ServiceContainer())
+
+        assert factory.can_create({}) is True
+
+    def test_can_create_returns_false_for_unknown_control_ref(self) -> None:
+        factory = ISO27001BatchAssessorFactory(ServiceContainer())
+
+        result = factory.can_create({"control_refs": ["A.5.1", "A.99.1"]})
+
+        assert result is False
@@ -0,0 +1,215 @@
+"""Tests for incremental re-assessment against a previous run's verdicts.
+
+Verifies that an AUTOMATED control whose evidence, documents and rule are
+unchanged since the previous run reuses that run's verdict without an LLM
+request, and that any change to its inputs sends it to the LLM again.
+"""
+
+from waivern_analysers_shared.utilities import RulesetManager
+from waivern_core.message import Message
+from waivern_llm.types import LLMDispatchResult
+from waivern_rulesets.iso27001_domains import ISO27001DomainsRule
+from waivern_schemas.iso27001_assessment import ControlStatus, EvidenceStatus
+from waivern_schemas.security_evidence import SecurityEvidenceModel
+
+from waivern_iso27001_control_assessor import (
+    ISO27001Assessor,
+    ISO27001AssessorConfig,
+    ISO27001BatchAssessor,
+    ISO27001BatchAssessorConfig,
+)
+from waivern_iso27001_control_assessor.control_assessment import (
+    assessment_fingerprint,
+)
+from waivern_iso27001_control_assessor.prior_assessments import (
+    FINGERPRINT_CONTEXT_KEY,
+    REUSED_CONTEXT_KEY,
+)
+from waivern_iso27001_control_assessor.types import EvidenceSamplingConfig
+
+from .test_helpers import (
+    OUTPUT_SCHEMA,
+    make_document_finding,
+    make_document_message,
+    make_evidence_finding,
+    make_evidence_message,
+    parse_output,
+)
+
+_DOMAIN_RULESET = "local/iso27001_domains/1.0.0"
+
+
+def _make_assessor(control_ref: str) -> ISO27001Assessor:
+    config = ISO27001AssessorConfig.from_properties({"control_ref": control_ref})
+    return ISO27001Assessor(config=config)
+
+
+def _make_batch_assessor(control_refs: list[str]) -> ISO27001BatchAssessor:
+    config = ISO27001BatchAssessorConfig.from_properties({"control_refs": control_refs})
+    return ISO27001BatchAssessor(config=config)
+
+
+def _llm_result(request_id: str, status: str, rationale: str) -> LLMDispatchResult:
+    return LLMDispatchResult(
+        request_id=request_id,
+        model_name="claude-sonnet-4-5-20250929",
+        responses=[
+            {
+                "status": status,
+                "rationale": rationale,
+                "gap_description": None,
+                "recommended_actions": [],
+            }
+        ],
+        skipped=[],
+    )
+
+
+def _encryption_inputs(description: str = "Test evidence") -> list[Message]:
+    finding = make_evidence_finding(security_domain="encryption")
+    finding["description"] = description
+    return [
+        make_evidence_message([finding]),
+        make_document_message([make_document_finding(["encryption"], "crypto.md")]),
+    ]
+
+
+def _first_run(control_ref: str = "A.8.24") -> Message:
+    """Assess ``control_ref`` on ``_encryption_inputs()`` as a compliant control."""
+    assessor = _make_assessor(control_ref)
+    prepared = assessor.prepare(_encryption_inputs(), OUTPUT_SCHEMA)
+    outcome = assessor.finalise(
+        prepared.state,
+        [
+            _llm_result(
+                prepared.requests[0].request_id, "compliant", "Encryption is in place."
+            )
+        ],
+        OUTPUT_SCHEMA,
+    )
+    assert isinstance(outcome, tuple)
+    return outcome[0]
+
+
+class TestFingerprint:
+    """Tests for assessment_fingerprint()."""
+
+    def _fingerprint(self, evidence: list[SecurityEvidenceModel]) -> str:
+        ruleset = RulesetManager.get_ruleset(_DOMAIN_RULESET, ISO27001DomainsRule)
+        rule = next(r for r in ruleset.get_rules() if r.control_ref == "A.8.24")
+        return assessment_fingerprint(
+            rule,
+            evidence,
+            [],
+            domain_ruleset=_DOMAIN_RULESET,
+            sampling=EvidenceSamplingConfig(),
+        )
+
+    def test_ignores_item_ids(self) -> None:
+        """Evidence ids are regenerated every run, so they are not fingerprinted."""
+        first = SecurityEvidenceModel.model_validate(make_evidence_finding())
+        second = first.model_copy(update={"id": "another-id"})
+
+        assert self._fingerprint([first]) == self._fingerprint([second])
+
+    def test_changes_with_evidence(self) -> None:
+        """Any change to the evidence content changes the fingerprint."""
+        first = SecurityEvidenceModel.model_validate(make_evidence_finding())
+        second = first.model_copy(update={"description": "Changed evidence"})
+
+        assert self._fingerprint([first]) != self._fingerprint([second])
+
+
+class TestAssessorReuse:
+    """Tests for ISO27001Assessor with a previous run's assessment as input."""
+
+    def test_fresh_verdict_records_fingerprint(self) -> None:
+        """LLM verdicts carry the fingerprint a later run compares against."""
+        finding = parse_output(_first_run()).findings[0]
+
+        assert FINGERPRINT_CONTEXT_KEY in finding.metadata.context
+        assert REUSED_CONTEXT_KEY not in finding.metadata.context
+
+    def test_unchanged_evidence_reuses_previous_verdict(self) -> None:
+        """Same evidence as the previous run → no request, same verdict."""
+        previous = _first_run()
+        assessor = _make_assessor("A.8.24")
+
+        prepared = assessor.prepare([*_encryption_inputs(), previous], OUTPUT_SCHEMA)
+        assert prepared.requests == []
+
+        outcome = assessor.finalise(prepared.state, [], OUTPUT_SCHEMA)
+        assert isinstance(outcome, tuple)
+        finding = parse_output(outcome[0]).findings[0]
+        assert finding.status == ControlStatus.COMPLIANT
+        assert finding.evidence_status == EvidenceStatus.AUTOMATED
+        assert finding.rationale == "Encryption is in place."
+        assert finding.metadata.context[REUSED_CONTEXT_KEY] is True
+        assert (
+            finding.metadata.context[FINGERPRINT_CONTEXT_KEY]
+            == parse_output(previous)
+            .findings[0]
+            .metadata.context[FINGERPRINT_CONTEXT_KEY]
+        )
+
+    def test_changed_evidence_is_assessed_again(self) -> None:
+        """Changed evidence → the control gets an LLM request as usual."""
+        previous = _first_run()
+        assessor = _make_assessor("A.8.24")
+
+        prepared = assessor.prepare(
+            [*_encryption_inputs("TLS 1.0 still enabled"), previous], OUTPUT_SCHEMA
+        )
+
+        assert len(prepared.requests) == 1
+        assert prepared.state.reused_verdict is None
+
+    def test_previous_not_assessed_verdict_is_not_reused(self) -> None:
+        """A control the previous run could not assess is assessed again."""
+        assessor = _make_assessor("A.8.24")
+        prepared = assessor.prepare(_encryption_inputs(), OUTPUT_SCHEMA)
+        outcome = assessor.finalise(prepared.state, [], OUTPUT_SCHEMA)
+        assert isinstance(outcome, tuple)
+
+        prepared = assessor.prepare([*_encryption_inputs(), outcome[0]], OUTPUT_SCHEMA)
+
+        assert len(prepared.requests) == 1
+
+
+class TestBatchAssessorReuse:
+    """Tests for ISO27001BatchAssessor with a previous run's assessment as input."""
+
+    def test_only_changed_controls_are_requested(self) -> None:
+        """Controls unchanged since the previous run skip the LLM."""
+        previous = _first_run("A.8.24")
+        assessor = _make_batch_assessor(["A.8.24", "A.8.5"])
+        inputs = [
+            *_encryption_inputs(),
+            make_evidence_message(
+                [make_evidence_finding(security_domain="authentication")]
+            ),
+            previous,
+        ]
+
+        prepared = assessor.prepare(inputs, OUTPUT_SCHEMA)
+
+        assert [request.name for request in prepared.requests] == ["assessment:A.8.5"]
+        outcome = assessor.finalise(
+            prepared.state,
+            [
+                _llm_result(
+                    prepared.requests[0].request_id, "partial", "MFA is partial."
+                )
+            ],
+            OUTPUT_SCHEMA,
+        )
+        assert isinstance(outcome, tuple)
+        findings = {
+            finding.control_ref: finding
+            for finding in parse_output(outcome[0]).findings
+        }
+        assert findings["A.8.24"].status == ControlStatus.COMPLIANT
+        assert findings["A.8.24"].metadata.context[REUSED_CONTEXT_KEY] is True
+        assert findings["A.8.5"].status == ControlStatus.PARTIAL
+        assert REUSED_CONTEXT_KEY not in findings["A.8.5"].metadata.context
+        assert FINGERPRINT_CONTEXT_KEY in findings["A.8.5"].metadata.context
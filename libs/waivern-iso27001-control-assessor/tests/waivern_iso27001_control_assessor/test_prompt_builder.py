@@ -1,10 +1,11 @@
-"""Tests for ISO27001PromptBuilder — prompt content verification."""
+"""Tests for the ISO 27001 prompt builders — prompt content verification."""
 
 from waivern_llm import ItemGroup
 from waivern_schemas.security_evidence import SecurityEvidenceModel
 
 from waivern_iso27001_control_assessor.prompts.prompt_builder import (
     ControlContext,
+    ISO27001MultiControlPromptBuilder,
     ISO27001PromptBuilder,
 )
 
@@ -163,3 +164,38 @@ class TestPromptContent:
         prompt = builder.build_prompt([_make_group(items=[_make_evidence()])])
 
         assert summary in prompt
+
+
+# =============================================================================
+# Multi-control prompt content
+# =============================================================================
+
+
+class TestMultiControlPromptContent:
+    """Tests for prompt content produced by ISO27001MultiControlPromptBuilder."""
+
+    def test_prompt_includes_each_control_and_shared_evidence_once(self) -> None:
+        second = ControlContext(
+            guidance_text="A.8.21 Security of network services.",
+            control_type="preventive",
+            cia=["confidentiality"],
+            cybersecurity_concept="protect",
+            operational_capability="system_and_network_protection",
+            iso_security_domain="protection",
+        )
+        builder = ISO27001MultiControlPromptBuilder(
+            [("A.8.24", _DEFAULT_CONTROL), ("A.8.21", second)]
+        )
+
+        prompt = builder.build_prompt(
+            [_make_group(items=[_make_evidence()], content="Crypto policy v2")]
+        )
+
+        assert "### A.8.24" in prompt
+        assert "### A.8.21" in prompt
+        assert GUIDANCE_TEXT in prompt
+        assert "A.8.21 Security of network services." in prompt
+        assert prompt.count("AES-256 encryption used for data at rest") == 1
+        assert prompt.count("Crypto policy v2") == 1
+        assert '"assessments"' in prompt
+        assert '"control_ref"' in prompt
@@ -10,11 +10,13 @@ from __future__ import annotations
 
 import asyncio
 import logging
+import time
 from collections.abc import Sequence
 from datetime import UTC, datetime
 from typing import TYPE_CHECKING, Any, cast
 
 from pydantic import BaseModel
+from waivern_core.metrics import MetricsRegistry
 
 from waivern_llm.batch_job import BatchJob
 from waivern_llm.batch_planner import BatchPlanner
@@ -22,7 +24,10 @@ from waivern_llm.batch_types import BatchRequest
 from waivern_llm.cache import CacheEntry
 from waivern_llm.errors import LLMServiceError, PendingBatchError
 from waivern_llm.providers.protocol import BatchLLMProvider, LLMProvider
-from waivern_llm.token_estimation import calculate_max_payload_tokens
+from waivern_llm.token_estimation import (
+    calculate_max_payload_tokens,
+    estimate_tokens,
+)
 from waivern_llm.types import (
     LLMDispatchResult,
     LLMRequest,
@@ -56,6 +61,7 @@ class LLMDispatcher:
         *,
         batch_mode: bool = False,
         sync_concurrency: int | None = None,
+        metrics: MetricsRegistry | None = None,
     ) -> None:
         """Initialise the dispatcher.
 
@@ -65,6 +71,8 @@ class LLMDispatcher:
             batch_mode: Use batch API for async processing.
             sync_concurrency: Max concurrent LLM calls in sync mode.
                 None means unlimited (all calls fire concurrently).
+            metrics: Registry to record requests, cache lookups, errors,
+                estimated tokens and latencies in, if any.
 
         """
         self._provider = provider
@@ -72,6 +80,7 @@ class LLMDispatcher:
         self._cache: LLMCache = cast("LLMCache", store)
         self._batch_mode = batch_mode
         self._sync_concurrency = sync_concurrency
+        self._metrics = _DispatcherMetrics(metrics or MetricsRegistry())
 
     @property
     def request_type(self) -> type[LLMRequest[Any]]:
@@ -247,7 +256,10 @@ class LLMDispatcher:
     async def _get_cached_entry(self, run_id: str, cache_key: str) -> CacheEntry | None:
         cached_data = await self._cache.cache_get(run_id, cache_key)
         if cached_data is not None:
-            return CacheEntry.model_validate(cached_data)
+            entry = CacheEntry.model_validate(cached_data)
+            self._metrics.cache_lookups.inc(result=entry.status)
+            return entry
+        self._metrics.cache_lookups.inc(result="miss")
         return None
 
     async def _execute_sync(
@@ -267,13 +279,9 @@ class LLMDispatcher:
         async def _invoke(miss: _CacheMiss) -> tuple[_CacheMiss, BaseModel]:
             if semaphore is not None:
                 async with semaphore:
-                    response = await self._provider.invoke_structured(
-                        miss.prompt, miss.response_model
-                    )
+                    response = await self._invoke_structured(miss)
             else:
-                response = await self._provider.invoke_structured(
-                    miss.prompt, miss.response_model
-                )
+                response = await self._invoke_structured(miss)
             return miss, response
 
         results = await asyncio.gather(
@@ -301,6 +309,24 @@ class LLMDispatcher:
             await self._cache.cache_set(run_id, miss.cache_key, entry.model_dump())
             request_responses[miss.request_id].append(response_dict)
 
+    async def _invoke_structured(self, miss: _CacheMiss) -> BaseModel:
+        """Make one provider call, recording it in the dispatcher's metrics."""
+        metrics = self._metrics
+        metrics.requests.inc(mode="sync")
+        metrics.prompt_tokens.inc(estimate_tokens(miss.prompt), mode="sync")
+        start = time.perf_counter()
+        outcome = "success"
+        try:
+            return await self._provider.invoke_structured(
+                miss.prompt, miss.response_model
+            )
+        except Exception as exc:
+            outcome = "rate_limited" if _is_rate_limited(exc) else "error"
+            metrics.errors.inc(kind=outcome)
+            raise
+        finally:
+            metrics.latency.observe(time.perf_counter() - start, outcome=outcome)
+
     async def _execute_batch(
         self,
         run_id: str,
@@ -320,6 +346,10 @@ class LLMDispatcher:
             for miss in cache_misses
         ]
 
+        self._metrics.requests.inc(len(batch_requests), mode="batch")
+        self._metrics.prompt_tokens.inc(
+            sum(estimate_tokens(miss.prompt) for miss in cache_misses), mode="batch"
+        )
         submission = await provider.submit_batch(batch_requests)
 
         for miss in cache_misses:
@@ -345,6 +375,53 @@ class LLMDispatcher:
         pending_batch_ids.append(submission.batch_id)
 
 
+_HTTP_TOO_MANY_REQUESTS = 429
+
+
+def _is_rate_limited(exc: BaseException) -> bool:
+    """Tell whether a provider error was caused by an HTTP 429 response.
+
+    Providers wrap SDK exceptions in ``LLMConnectionError``, so the cause
+    chain is searched. SDK exceptions carry the HTTP status as
+    ``status_code`` (``code`` for Google).
+    """
+    error: BaseException | None = exc
+    while error is not None:
+        status = getattr(error, "status_code", None) or getattr(error, "code", None)
+        if status == _HTTP_TOO_MANY_REQUESTS or "RateLimit" in type(error).__name__:
+            return True
+        error = error.__cause__
+    return False
+
+
+class _DispatcherMetrics:
+    """Internal: the metric families an ``LLMDispatcher`` records in."""
+
+    __slots__ = ("cache_lookups", "errors", "latency", "prompt_tokens", "requests")
+
+    def __init__(self, registry: MetricsRegistry) -> None:
+        self.requests = registry.counter(
+            "waivern_llm_requests_total", "LLM calls made (cache misses), by mode."
+        )
+        self.cache_lookups = registry.counter(
+            "waivern_llm_cache_lookups_total",
+            "LLM response cache lookups, by result (completed, pending, failed "
+            "or miss).",
+        )
+        self.errors = registry.counter(
+            "waivern_llm_errors_total",
+            "Failed LLM calls, by kind (rate_limited or error).",
+        )
+        self.prompt_tokens = registry.counter(
+            "waivern_llm_prompt_tokens_total",
+            "Estimated prompt tokens sent to the LLM provider, by mode.",
+        )
+        self.latency = registry.histogram(
+            "waivern_llm_request_duration_seconds",
+            "Latency of synchronous LLM calls, by outcome.",
+        )
+
+
 class _CacheMiss:
     """Internal: tracks a cache miss pending execution."""
 
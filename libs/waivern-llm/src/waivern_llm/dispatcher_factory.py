@@ -12,10 +12,11 @@ from typing import TYPE_CHECKING, Any
 
 from waivern_artifact_store.base import ArtifactStore
 from waivern_core.errors import ServiceConfigError
+from waivern_core.metrics import MetricsRegistry
 
 from waivern_llm.di.configuration import LLMServiceConfiguration
 from waivern_llm.dispatcher import LLMDispatcher
-from waivern_llm.providers import create_provider
+from waivern_llm.providers import LLMProvider, create_provider
 from waivern_llm.types import LLMRequest
 
 if TYPE_CHECKING:
@@ -30,6 +31,10 @@ class LLMDispatcherFactory:
     Satisfies the ``DispatcherFactory[LLMRequest, LLMDispatchResult]``
     protocol, resolving dependencies lazily from the ``ServiceContainer``.
 
+    The provider is created once per configuration and shared by every
+    dispatcher the factory creates, so a long-lived process keeps its
+    provider clients (and their connection pools) warm between runs.
+
     """
 
     def __init__(
@@ -47,6 +52,7 @@ class LLMDispatcherFactory:
         """
         self._container = container
         self._config = config
+        self._provider: tuple[LLMServiceConfiguration, LLMProvider] | None = None
 
     @property
     def request_type(self) -> type[LLMRequest[Any]]:
@@ -93,9 +99,9 @@ class LLMDispatcherFactory:
     def create(self) -> LLMDispatcher | None:
         """Create an LLMDispatcher instance.
 
-        Resolves ArtifactStore from the container for caching, creates
-        the appropriate provider based on configuration, and returns
-        an LLMDispatcher.
+        Resolves ArtifactStore from the container for caching (and a
+        MetricsRegistry, if one is registered), creates the appropriate
+        provider based on configuration, and returns an LLMDispatcher.
 
         Returns:
             LLMDispatcher instance, or None if unavailable.
@@ -108,7 +114,7 @@ class LLMDispatcherFactory:
 
         try:
             store = self._container.get_service(ArtifactStore)
-            provider = create_provider(config)
+            provider = self._get_provider(config)
 
             logger.info(
                 f"LLM dispatcher created (provider={config.provider}, "
@@ -120,8 +126,26 @@ class LLMDispatcherFactory:
                 store=store,
                 batch_mode=config.batch_mode,
                 sync_concurrency=config.sync_concurrency,
+                metrics=self._get_metrics(),
             )
 
         except Exception as e:
             logger.warning(f"Failed to create LLM dispatcher: {e}")
             return None
+
+    def _get_metrics(self) -> MetricsRegistry | None:
+        """Return the container's metrics registry; metrics are optional."""
+        try:
+            return self._container.get_service(MetricsRegistry)
+        except (KeyError, ValueError):
+            return None
+
+    def _get_provider(self, config: LLMServiceConfiguration) -> LLMProvider:
+        """Return the cached provider for ``config``, creating it on first use.
+
+        A changed configuration (e.g. a different model in the environment)
+        replaces the cached provider.
+        """
+        if self._provider is None or self._provider[0] != config:
+            self._provider = (config, create_provider(config))
+        return self._provider[1]
@@ -10,8 +10,10 @@ from unittest.mock import AsyncMock, Mock
 
 from pydantic import BaseModel
 from waivern_artifact_store.in_memory import AsyncInMemoryStore
+from waivern_core.metrics import Counter, MetricsRegistry
 
 from waivern_llm.dispatcher import LLMDispatcher
+from waivern_llm.errors import LLMConnectionError
 from waivern_llm.types import BatchingMode, ItemGroup, LLMRequest
 
 # =============================================================================
@@ -764,3 +766,46 @@ class TestLLMDispatcherSyncConcurrency:
         assert provider.invoke_structured.call_count == 3
         assert len(results[0].responses) == 3
         assert peak_concurrency == 3
+
+
+# =============================================================================
+# Metrics
+# =============================================================================
+
+
+class _RateLimitError(Exception):
+    """Stand-in for an SDK's HTTP 429 exception."""
+
+    status_code = 429
+
+
+class TestLLMDispatcherMetrics:
+    """Tests for recording dispatch activity in a metrics registry."""
+
+    async def test_calls_cache_hits_and_rate_limits_are_counted(self) -> None:
+        """Misses count as requests, repeats as cache hits, 429s as rate limits."""
+        metrics = MetricsRegistry()
+        store = AsyncInMemoryStore()
+        provider = _create_mock_provider(MockResponse(valid=True, reason="ok"))
+        dispatcher = LLMDispatcher(provider=provider, store=store, metrics=metrics)
+
+        await dispatcher.dispatch([_create_request()])
+        await dispatcher.dispatch([_create_request()])
+        provider.invoke_structured.side_effect = LLMConnectionError("failed")
+        provider.invoke_structured.side_effect.__cause__ = _RateLimitError()
+        failing = _create_request()
+        failing.prompt_builder = _create_unique_prompt_builder()
+        await dispatcher.dispatch([failing])
+
+        def counter(name: str) -> Counter:
+            return metrics.counter(name, "")
+
+        assert counter("waivern_llm_requests_total").value(mode="sync") == 2
+        lookups = counter("waivern_llm_cache_lookups_total")
+        assert lookups.value(result="completed") == 1
+        assert lookups.value(result="miss") == 2
+        errors = counter("waivern_llm_errors_total")
+        assert errors.value(kind="rate_limited") == 1
+        latency = metrics.histogram("waivern_llm_request_duration_seconds", "")
+        assert latency.count(outcome="success") == 1
+        assert latency.count(outcome="rate_limited") == 1
@@ -131,3 +131,22 @@ class TestLLMDispatcherFactoryCreate:
         dispatcher = factory.create()
 
         assert dispatcher is None
+
+    def test_create_reuses_provider_across_dispatchers(
+        self, monkeypatch: pytest.MonkeyPatch
+    ) -> None:
+        """Should share one provider (and its client) between created dispatchers."""
+        create_provider = Mock()
+        monkeypatch.setattr(
+            "waivern_llm.dispatcher_factory.create_provider", create_provider
+        )
+        container = _create_mock_container()
+        config = LLMServiceConfiguration(provider="anthropic", api_key="test-key")
+
+        factory = LLMDispatcherFactory(container, config)
+        first = factory.create()
+        second = factory.create()
+
+        assert first is not None
+        assert second is not None
+        create_provider.assert_called_once_with(config)
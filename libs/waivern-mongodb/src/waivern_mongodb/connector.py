@@ -55,6 +55,12 @@ class MongoDBConnector(Connector):
         """Return the name of the connector."""
         return _CONNECTOR_NAME
 
+    @classmethod
+    @override
+    def get_resource_pool(cls) -> str | None:
+        """Run in the ``db_io`` pool."""
+        return "db_io"
+
     @classmethod
     @override
     def get_supported_output_schemas(cls) -> list[Schema]:
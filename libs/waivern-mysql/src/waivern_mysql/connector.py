@@ -83,6 +83,12 @@ class MySQLConnector(Connector):
         """Return the name of the connector."""
         return _CONNECTOR_NAME
 
+    @classmethod
+    @override
+    def get_resource_pool(cls) -> str | None:
+        """Run in the ``db_io`` pool."""
+        return "db_io"
+
     def _load_producer(self, schema: Schema) -> ModuleType:
         """Dynamically import producer module.
 
@@ -13,8 +13,10 @@ from waivern_orchestration.errors import (
     OrchestrationError,
     RunbookParseError,
     SchemaCompatibilityError,
+    UndeclaredResourcePoolError,
 )
 from waivern_orchestration.executor import DAGExecutor
+from waivern_orchestration.memory import MemoryProfile
 from waivern_orchestration.models import (
     ArtifactDefinition,
     ExecuteConfig,
@@ -27,7 +29,16 @@ from waivern_orchestration.models import (
 )
 from waivern_orchestration.parser import parse_runbook, parse_runbook_from_dict
 from waivern_orchestration.path_resolver import resolve_child_runbook_path
+from waivern_orchestration.plan_cache import PlanCache
 from waivern_orchestration.planner import ExecutionPlan, Planner
+from waivern_orchestration.retention import (
+    RetentionPlan,
+    RetentionPolicy,
+    RetentionResult,
+    apply_retention,
+    plan_retention,
+    reused_runs,
+)
 from waivern_orchestration.schema import RunbookSchemaGenerator
 
 __all__ = [
@@ -47,9 +58,18 @@ __all__ = [
     "parse_runbook_from_dict",
     # Planner
     "ExecutionPlan",
+    "PlanCache",
     "Planner",
     # Executor
     "DAGExecutor",
+    "MemoryProfile",
+    # Retention
+    "RetentionPlan",
+    "RetentionPolicy",
+    "RetentionResult",
+    "apply_retention",
+    "plan_retention",
+    "reused_runs",
     # Schema
     "RunbookSchemaGenerator",
     # Path Resolution
@@ -66,4 +86,5 @@ __all__ = [
     "OrchestrationError",
     "RunbookParseError",
     "SchemaCompatibilityError",
+    "UndeclaredResourcePoolError",
 ]
@@ -120,6 +120,26 @@ class ExecutionDAG:
         """
         return self._reverse_graph.get(artifact_id, set())
 
+    def get_downstream(self, artifact_ids: set[str]) -> set[str]:
+        """Get every artifact that depends on any of these, transitively.
+
+        Args:
+            artifact_ids: The artifact IDs to start from.
+
+        Returns:
+            Set of downstream artifact IDs, excluding ``artifact_ids``
+            themselves unless one depends on another.
+
+        """
+        downstream: set[str] = set()
+        to_visit = [dep for aid in artifact_ids for dep in self.get_dependents(aid)]
+        while to_visit:
+            dep = to_visit.pop()
+            if dep not in downstream:
+                downstream.add(dep)
+                to_visit.extend(self.get_dependents(dep))
+        return downstream
+
     def get_depth(self) -> int:
         """Get the depth (number of levels) in the DAG.
 
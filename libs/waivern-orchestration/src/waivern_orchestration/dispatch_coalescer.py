@@ -0,0 +1,183 @@
+"""Coalescing of dispatch requests from concurrently running processors.
+
+Each distributed artifact submits its requests as soon as its ``prepare()``
+finishes, rather than once every sibling at the same DAG level has prepared,
+so one slow sibling no longer delays dispatch for the rest. Requests of the
+same type submitted close together are still dispatched as one batch,
+keeping the dispatcher's consolidation benefits.
+
+A pending batch is dispatched as soon as one of these holds:
+
+- ``window`` seconds have passed since its first request;
+- it holds at least ``max_requests`` requests;
+- every participant is waiting on a dispatch, so no further request can
+  arrive (when all siblings prepare together this dispatches immediately,
+  exactly as a per-level consolidation would).
+"""
+
+from __future__ import annotations
+
+import asyncio
+import logging
+from collections.abc import Awaitable, Callable, Sequence
+from dataclasses import dataclass, field
+
+from waivern_core.dispatch import DispatchRequest, DispatchResult
+
+logger = logging.getLogger(__name__)
+
+type DispatchBatch = Callable[
+    [type[DispatchRequest], list[DispatchRequest]],
+    Awaitable[Sequence[DispatchResult]],
+]
+"""Dispatches a batch of requests of one type and returns their results."""
+
+DEFAULT_WINDOW_SECONDS = 0.05
+"""Longest a request waits for others to share its batch."""
+
+DEFAULT_MAX_REQUESTS = 1000
+"""Batch size that is dispatched without waiting for the window."""
+
+
+@dataclass
+class _PendingBatch:
+    """Requests of one type waiting to be dispatched together."""
+
+    requests: list[DispatchRequest] = field(default_factory=list)
+    waiters: list[tuple[frozenset[str], asyncio.Future[list[DispatchResult]]]] = field(
+        default_factory=list
+    )
+    timer: asyncio.TimerHandle | None = None
+
+
+class DispatchCoalescer:
+    """Batches requests submitted by concurrent participants per request type.
+
+    Participants ``join`` before they start, ``submit`` their requests (any
+    number of times) and ``leave`` when they will submit nothing more.
+    """
+
+    def __init__(
+        self,
+        dispatch: DispatchBatch,
+        *,
+        window: float = DEFAULT_WINDOW_SECONDS,
+        max_requests: int = DEFAULT_MAX_REQUESTS,
+    ) -> None:
+        """Initialise the coalescer.
+
+        Args:
+            dispatch: Dispatches one batch. Exceptions it raises are raised
+                to every participant whose requests were in the batch.
+            window: Seconds a batch waits for more requests.
+            max_requests: Batch size dispatched without waiting.
+
+        """
+        self._dispatch = dispatch
+        self._window = window
+        self._max_requests = max_requests
+        self._running = 0
+        self._batches: dict[type[DispatchRequest], _PendingBatch] = {}
+        self._in_flight: set[asyncio.Task[None]] = set()
+
+    def join(self) -> None:
+        """Register a participant that may submit requests."""
+        self._running += 1
+
+    def leave(self) -> None:
+        """Unregister a participant that will submit no more requests."""
+        self._running -= 1
+        self._flush_if_all_waiting()
+
+    async def submit(
+        self, requests: Sequence[DispatchRequest]
+    ) -> Sequence[DispatchResult]:
+        """Dispatch ``requests`` in the next batch of their type.
+
+        All requests must share one concrete type.
+
+        Returns:
+            The results for ``requests``, in dispatch order.
+
+        """
+        request_type = type(requests[0])
+        batch = self._batches.get(request_type)
+        if batch is None:
+            batch = _PendingBatch()
+            batch.timer = asyncio.get_running_loop().call_later(
+                self._window, self._flush, request_type
+            )
+            self._batches[request_type] = batch
+
+        future: asyncio.Future[list[DispatchResult]] = (
+            asyncio.get_running_loop().create_future()
+        )
+        batch.requests.extend(requests)
+        batch.waiters.append((frozenset(r.request_id for r in requests), future))
+
+        self._running -= 1
+        try:
+            if len(batch.requests) >= self._max_requests:
+                self._flush(request_type)
+            else:
+                self._flush_if_all_waiting()
+            return await future
+        finally:
+            self._running += 1
+
+    def _flush_if_all_waiting(self) -> None:
+        if self._running == 0:
+            for request_type in list(self._batches):
+                self._flush(request_type)
+
+    def _flush(self, request_type: type[DispatchRequest]) -> None:
+        batch = self._batches.pop(request_type, None)
+        if batch is None:
+            return  # Already dispatched (e.g. by size before the timer fired)
+        if batch.timer is not None:
+            batch.timer.cancel()
+
+        logger.debug(
+            "Dispatching %d %s requests from %d artifacts",
+            len(batch.requests),
+            request_type.__name__,
+            len(batch.waiters),
+        )
+        task = asyncio.create_task(self._dispatch_batch(request_type, batch))
+        self._in_flight.add(task)
+        task.add_done_callback(self._in_flight.discard)
+
+    async def _dispatch_batch(
+        self, request_type: type[DispatchRequest], batch: _PendingBatch
+    ) -> None:
+        try:
+            results = await self._dispatch(request_type, batch.requests)
+        except asyncio.CancelledError:
+            for _, future in batch.waiters:
+                future.cancel()
+            raise
+        except Exception as exc:
+            for _, future in batch.waiters:
+                if not future.done():
+                    future.set_exception(exc)
+            return
+
+        owner = {
+            request_id: index
+            for index, (request_ids, _) in enumerate(batch.waiters)
+            for request_id in request_ids
+        }
+        routed: list[list[DispatchResult]] = [[] for _ in batch.waiters]
+        for result in results:
+            index = owner.get(result.request_id)
+            if index is None:
+                logger.warning(
+                    "Dropping %s result for unknown request '%s'",
+                    request_type.__name__,
+                    result.request_id,
+                )
+                continue
+            routed[index].append(result)
+        for (_, future), own_results in zip(batch.waiters, routed, strict=True):
+            if not future.done():
+                future.set_result(own_results)
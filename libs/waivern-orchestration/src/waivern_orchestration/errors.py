@@ -45,6 +45,10 @@ class InvalidOutputMappingError(OrchestrationError):
     """Raised when output mapping references non-existent child artifact."""
 
 
+class UndeclaredResourcePoolError(OrchestrationError):
+    """Raised when an artifact names a resource pool the runbook does not declare."""
+
+
 class RunNotFoundError(OrchestrationError):
     """Raised when attempting to resume a non-existent run."""
 
@@ -11,6 +11,11 @@ The executor supports resuming failed or interrupted runs::
 
     result = await executor.execute(plan, runbook_path=path, resume_run_id="...")
 
+With ``rerun_stale=True`` the plan passed in is a fresh plan of the (possibly
+edited) runbook. Artifacts whose fingerprint (definition and schemas) differs
+from the one recorded in the run's state are re-executed together with their
+transitive dependents; every other completed artifact is reused.
+
 Execution Flow
 ~~~~~~~~~~~~~~
 
@@ -35,8 +40,11 @@ Design Decisions
 ~~~~~~~~~~~~~~~~
 
 **Plan persistence**: The ExecutionPlan is persisted at run start and loaded on
-resume. This ensures stable artifact IDs across resume cycles, even for child
-runbooks with non-deterministic namespace generation.
+resume, so a plain resume finishes the run as it was planned even if the runbook,
+its child runbooks or the installed component schemas changed in between. Child
+runbook namespaces are derived from the invoking artifact and the child path, so
+a replanned runbook keeps its artifact IDs; ``rerun_stale`` relies on this to
+match fresh fingerprints against the recorded ones.
 
 **Concurrent execution prevention**: ``status: "running"`` in run metadata acts
 as a lock. Attempting to resume an already-running run raises ``RunAlreadyActiveError``.
@@ -48,24 +56,48 @@ typically take seconds to minutes, making this acceptable.
 **Store as single source of truth**: ``ExecutionResult`` contains only artifact IDs,
 not artifact content. Consumers load artifacts from the store using ``run_id``.
 This avoids memory duplication and ensures the store is always authoritative.
+
+**Resource pools**: Every unit of work (an artifact, or a distributed
+processor's prepare or finalise) takes a slot from the pool of its resource
+class when ``config.resource_pools`` declares one (``db_io``, ``cpu``, ``llm``,
+...), and from the shared ``max_concurrency`` slots otherwise.
+
+**Memory admission**: With ``config.memory_budget`` set, every unit of work
+also reserves its estimated memory before taking a slot; see
+``waivern_orchestration.memory``.
+
+**Metrics**: Given a ``MetricsRegistry``, the executor records artifacts
+waiting for and holding slots per pool (every slot has a worker thread, so
+waiting units are the thread pool's queue), artifact outcomes, items
+processed and produced per component, and artifact durations. The changes
+recorded during a run are saved with the run as system data ``"metrics"``.
+
+**Typed content between components**: Under the ``boundary`` validation
+policy, the typed model a producer attaches to its output is kept in a
+per-run map keyed by artifact ID (stores never hold it), and reattached when
+a downstream artifact loads that output as an input. Consumers then read the
+model instead of re-parsing and re-validating the content. Only outputs that
+a dependent still has to load are kept, until the last of them has.
 """
 
 from __future__ import annotations
 
 import asyncio
+import contextlib
 import logging
 import time
 import uuid
-from collections import defaultdict
-from collections.abc import Mapping, Sequence
+from collections import Counter
+from collections.abc import AsyncIterator, Sequence
 from concurrent.futures import ThreadPoolExecutor
+from contextlib import AbstractAsyncContextManager
 from dataclasses import dataclass, replace
 from dataclasses import field as dataclass_field
 from graphlib import TopologicalSorter
 from pathlib import Path
 from typing import Any, cast
 
-from waivern_artifact_store.base import ArtifactStore
+from waivern_artifact_store.base import ArtifactStore, artifact_items_field
 from waivern_artifact_store.errors import ArtifactNotFoundError
 from waivern_artifact_store.llm_cache import LLMCache
 from waivern_core import ExecutionContext, Message, MessageExtensions, Schema
@@ -78,12 +110,16 @@ from waivern_core.dispatch import (
     PrepareResult,
 )
 from waivern_core.errors import PendingProcessingError
+from waivern_core.metrics import MetricsRegistry
+from waivern_core.schemas import SchemaRegistry
 from waivern_core.services import ComponentRegistry
 
+from waivern_orchestration.dispatch_coalescer import DispatchCoalescer
 from waivern_orchestration.errors import (
     RunAlreadyActiveError,
     RunNotFoundError,
 )
+from waivern_orchestration.memory import MemoryAdmission, MemoryBudget, MemoryProfile
 from waivern_orchestration.models import (
     ArtifactDefinition,
     ExecutionResult,
@@ -101,6 +137,92 @@ logger = logging.getLogger(__name__)
 _REMOVED_FINDINGS_SCHEMA_NAME = "removed_findings"
 
 
+class _ExecutorMetrics:
+    """The metric families a ``DAGExecutor`` records in."""
+
+    __slots__ = (
+        "duration",
+        "in_flight",
+        "items_processed",
+        "items_produced",
+        "outcomes",
+    )
+
+    def __init__(self, registry: MetricsRegistry) -> None:
+        self.in_flight = registry.gauge(
+            "waivern_artifacts_in_flight",
+            "Units of work waiting for admission or running, by state and pool.",
+        )
+        self.outcomes = registry.counter(
+            "waivern_artifacts_total",
+            "Artifacts that reached an outcome (completed, failed, skipped or "
+            "pending).",
+        )
+        self.items_processed = registry.counter(
+            "waivern_items_processed_total", "Input items processed, by component."
+        )
+        self.items_produced = registry.counter(
+            "waivern_items_produced_total", "Output items produced, by component."
+        )
+        self.duration = registry.histogram(
+            "waivern_artifact_duration_seconds",
+            "Time to produce an artifact, by component and status.",
+        )
+
+
+def _input_refs(definition: ArtifactDefinition) -> list[str]:
+    """Return the artifact IDs an artifact loads as inputs, in order."""
+    inputs = definition.inputs
+    if inputs is None:
+        return []
+    return [inputs] if isinstance(inputs, str) else inputs
+
+
+class _TypedContents:
+    """Typed models of persisted artifacts, held for the dependents that load them.
+
+    An artifact's model is only kept while dependents that have not run yet
+    will load it, and is released when the last of them loads it (or is
+    skipped), so models do not stay resident alongside their content for
+    the rest of the run.
+    """
+
+    def __init__(self, pending_loads: dict[str, int]) -> None:
+        self._pending_loads = pending_loads
+        self._models: dict[str, object] = {}
+
+    @classmethod
+    def for_plan(cls, plan: ExecutionPlan, state: ExecutionState) -> _TypedContents:
+        """Count the input loads of every artifact still to run in ``plan``."""
+        done = state.completed | state.skipped | state.failed
+        pending_loads: Counter[str] = Counter()
+        for artifact_id, definition in plan.runbook.artifacts.items():
+            if artifact_id not in done:
+                pending_loads.update(_input_refs(definition))
+        return cls(dict(pending_loads))
+
+    def __contains__(self, artifact_id: str) -> bool:
+        return artifact_id in self._models
+
+    def remember(self, artifact_id: str, model: object | None) -> None:
+        """Keep ``model`` for an artifact's dependents; None clears the entry."""
+        if model is None or not self._pending_loads.get(artifact_id):
+            self._models.pop(artifact_id, None)
+        else:
+            self._models[artifact_id] = model
+
+    def take(self, artifact_id: str) -> object | None:
+        """Return the model for one dependent's load, releasing it after the last."""
+        model = self._models.get(artifact_id)
+        remaining = self._pending_loads.get(artifact_id, 0) - 1
+        if remaining > 0:
+            self._pending_loads[artifact_id] = remaining
+        else:
+            self._pending_loads.pop(artifact_id, None)
+            self._models.pop(artifact_id, None)
+        return model
+
+
 @dataclass
 class _ExecutionContext:
     """Internal context for a single execution run."""
@@ -110,7 +232,15 @@ class _ExecutionContext:
     state: ExecutionState
     semaphore: asyncio.Semaphore
     thread_pool: ThreadPoolExecutor
+    typed_contents: _TypedContents
+    """Typed models of this run's persisted artifacts, by artifact ID."""
     pending_batch_artifacts: set[str] = dataclass_field(default_factory=set)
+    memory: MemoryAdmission | None = None
+    """Memory admission control, when ``config.memory_budget`` is set."""
+    pools: dict[str, asyncio.Semaphore] = dataclass_field(default_factory=dict)
+    """Semaphores of the pools declared in ``config.resource_pools``."""
+    persist_lock: asyncio.Lock = dataclass_field(default_factory=asyncio.Lock)
+    """Serialises state updates from concurrently finishing distributed artifacts."""
 
 
 @dataclass
@@ -128,6 +258,10 @@ class _DistributedEntry:
     processor: DistributedProcessor[Any]
     inputs: list[Message]
     output_schema: Schema
+    component: str | None = None
+    """Memory profile key, e.g. ``processor:personal_data``."""
+    pool: str | None = None
+    """Resource pool to run prepare and finalise in."""
     prepare_result: PrepareResult[Any] | None = None
     finalise_output: tuple[Message, list[Message]] | None = None
     start_time: float = 0.0
@@ -148,19 +282,35 @@ class _ArtifactSaveContext:
     source: str
     execution_context: ExecutionContext
     store: ArtifactStore
+    typed_contents: _TypedContents
+    """The run's typed models, updated as each Message is persisted."""
 
 
 class DAGExecutor:
     """Executes artifacts in parallel using asyncio with ThreadPoolExecutor bridge."""
 
-    def __init__(self, registry: ComponentRegistry) -> None:
+    def __init__(
+        self,
+        registry: ComponentRegistry,
+        *,
+        memory_profile: MemoryProfile | None = None,
+        metrics: MetricsRegistry | None = None,
+    ) -> None:
         """Initialise executor with component registry.
 
         Args:
             registry: ComponentRegistry for accessing services and component factories.
+            memory_profile: Peak memory history per component type, used to
+                estimate artifacts under ``config.memory_budget``. Without
+                one, estimates are learned within each run only.
+            metrics: Registry to record execution metrics in. Each run's
+                metrics are then also saved with the run.
 
         """
         self._registry = registry
+        self._memory_profile = memory_profile
+        self._metrics_registry = metrics
+        self._metrics = _ExecutorMetrics(metrics or MetricsRegistry())
 
     async def execute(
         self,
@@ -168,6 +318,7 @@ class DAGExecutor:
         *,
         runbook_path: Path | None = None,
         resume_run_id: str | None = None,
+        rerun_stale: bool = False,
     ) -> ExecutionResult:
         """Execute artifacts in parallel according to the DAG.
 
@@ -180,6 +331,9 @@ class DAGExecutor:
             plan: Validated ExecutionPlan from Planner.
             runbook_path: Path to runbook file (for new run metadata).
             resume_run_id: If provided, resume from this existing run.
+            rerun_stale: When resuming, adopt ``plan`` as the run's plan and
+                re-execute the artifacts whose definitions changed since the
+                run's recorded plan, plus everything downstream of them.
 
         Returns:
             ExecutionResult containing artifact results and skipped artifacts.
@@ -191,28 +345,41 @@ class DAGExecutor:
         """
         start_time = time.monotonic()
         config = plan.runbook.config
+        checkpoint = (
+            self._metrics_registry.checkpoint()
+            if self._metrics_registry is not None
+            else None
+        )
 
         # Get ArtifactStore from container (singleton - shared with exporter)
         store = self._registry.container.get_service(ArtifactStore)
 
         # Initialise run context (new or resume)
-        run_ctx = await self._initialise_run(plan, store, runbook_path, resume_run_id)
+        run_ctx = await self._initialise_run(
+            plan, store, runbook_path, resume_run_id, rerun_stale=rerun_stale
+        )
 
         # Save metadata with status='running' before starting execution
         await run_ctx.save_metadata(store)
 
-        # Create thread pool for sync->async bridging
-        logger.debug(
-            "Creating ThreadPoolExecutor with max_workers=%d", config.max_concurrency
-        )
+        # Create thread pool for sync->async bridging, with a worker for
+        # every slot so pools never contend for threads
+        max_workers = config.max_concurrency + sum(config.resource_pools.values())
+        logger.debug("Creating ThreadPoolExecutor with max_workers=%d", max_workers)
 
-        with ThreadPoolExecutor(max_workers=config.max_concurrency) as thread_pool:
+        with ThreadPoolExecutor(max_workers=max_workers) as thread_pool:
             ctx = _ExecutionContext(
                 run_id=run_ctx.metadata.run_id,
                 store=store,
                 state=run_ctx.state,
                 semaphore=asyncio.Semaphore(config.max_concurrency),
                 thread_pool=thread_pool,
+                typed_contents=_TypedContents.for_plan(plan, run_ctx.state),
+                memory=self._create_memory_admission(plan),
+                pools={
+                    name: asyncio.Semaphore(limit)
+                    for name, limit in config.resource_pools.items()
+                },
             )
 
             try:
@@ -225,6 +392,9 @@ class DAGExecutor:
 
         logger.debug("ThreadPoolExecutor shutdown complete")
 
+        if ctx.memory is not None and self._memory_profile is not None:
+            self._memory_profile.save()
+
         # Persist final state (safety net — state may already have been saved
         # incrementally, but pending-only runs skip the per-artifact save)
         await run_ctx.save_state(store)
@@ -246,6 +416,13 @@ class DAGExecutor:
             await llm_cache.cache_clear(run_ctx.metadata.run_id)
         await run_ctx.save_metadata(store)
 
+        if self._metrics_registry is not None:
+            await store.save_system_data(
+                run_ctx.metadata.run_id,
+                "metrics",
+                self._metrics_registry.snapshot(since=checkpoint),
+            )
+
         total_duration = time.monotonic() - start_time
         return ExecutionResult(
             run_id=run_ctx.metadata.run_id,
@@ -257,12 +434,133 @@ class DAGExecutor:
             total_duration_seconds=total_duration,
         )
 
+    def _create_memory_admission(self, plan: ExecutionPlan) -> MemoryAdmission | None:
+        """Create admission control for ``config.memory_budget``, if set.
+
+        Components never observed get an equal share of the budget, so a
+        run without history behaves as if limited by ``max_concurrency``.
+        """
+        config = plan.runbook.config
+        if config.memory_budget is None:
+            return None
+        budget_bytes = config.memory_budget * 1024 * 1024
+        logger.debug("Admitting artifacts within %d MiB", config.memory_budget)
+        return MemoryAdmission(
+            MemoryBudget(budget_bytes),
+            self._memory_profile or MemoryProfile(),
+            default_estimate=budget_bytes // config.max_concurrency,
+        )
+
+    def _admitted(
+        self,
+        ctx: _ExecutionContext,
+        *,
+        pool: str | None = None,
+        component: str | None = None,
+        item_count: int | None = None,
+    ) -> AbstractAsyncContextManager[object]:
+        """Return the guard every unit of work runs under.
+
+        That is a concurrency slot in ``pool`` (the shared ``max_concurrency``
+        slots unless the pool is declared in ``config.resource_pools``) and,
+        under a memory budget, a memory reservation for ``component`` (see
+        ``waivern_orchestration.memory``). LLM dispatch through the
+        ``DispatchCoalescer`` runs outside this guard, so pools do not bound
+        LLM request concurrency.
+        """
+        slot = ctx.pools.get(pool, ctx.semaphore) if pool else ctx.semaphore
+        pool_label = pool if pool in ctx.pools else "default"
+        if ctx.memory is None:
+            return self._tracked(slot, pool_label)
+        return self._tracked(ctx.memory.admit(component, item_count, slot), pool_label)
+
+    @contextlib.asynccontextmanager
+    async def _tracked(
+        self, guard: AbstractAsyncContextManager[object], pool: str
+    ) -> AsyncIterator[None]:
+        """Count a unit of work as waiting until ``guard`` admits it, then running."""
+        in_flight = self._metrics.in_flight
+        in_flight.inc(state="waiting", pool=pool)
+        admitted = False
+        try:
+            async with guard:
+                in_flight.dec(state="waiting", pool=pool)
+                in_flight.inc(state="running", pool=pool)
+                admitted = True
+                yield
+        finally:
+            if admitted:
+                in_flight.dec(state="running", pool=pool)
+            else:
+                in_flight.dec(state="waiting", pool=pool)
+
+    def _resource_pool(
+        self, definition: ArtifactDefinition, ctx: _ExecutionContext
+    ) -> str | None:
+        """Return the pool an artifact runs in, if the runbook declares pools.
+
+        The artifact's ``resource_pool`` wins over its component's default.
+        """
+        if not ctx.pools:
+            return None
+        if definition.resource_pool is not None:
+            return definition.resource_pool
+        try:
+            if definition.source is not None:
+                factory = self._registry.connector_factories[definition.source.type]
+            elif definition.process is not None and definition.reuse is None:
+                factory = self._registry.processor_factories[definition.process.type]
+            else:
+                return None
+        except KeyError:
+            return None  # Reported when the artifact is produced
+        return factory.component_class.get_resource_pool()
+
+    async def _input_item_count(
+        self, definition: ArtifactDefinition, ctx: _ExecutionContext
+    ) -> int | None:
+        """Sum the item counts of an artifact's stored inputs, if all are known.
+
+        Only counted when memory admission needs the count before the inputs
+        are loaded: reading metadata loads a whole unchunked artifact, so
+        metrics count the loaded inputs instead.
+        """
+        if definition.inputs is None or ctx.memory is None:
+            return None
+        refs = (
+            [definition.inputs]
+            if isinstance(definition.inputs, str)
+            else definition.inputs
+        )
+        total = 0
+        for ref in refs:
+            metadata = await ctx.store.get_artifact_metadata(ctx.run_id, ref)
+            if metadata.item_count is None:
+                return None
+            total += metadata.item_count
+        return total
+
+    @staticmethod
+    def _message_item_count(messages: Sequence[Message]) -> int | None:
+        """Sum the item counts of in-memory input messages, if all are known."""
+        if not messages:
+            return None
+        total = 0
+        for message in messages:
+            field = artifact_items_field(message.content)
+            if field is None:
+                return None
+            total += len(cast("list[Any]", message.content[field]))
+        return total
+
     async def _initialise_run(
         self,
         plan: ExecutionPlan,
         store: ArtifactStore,
         runbook_path: Path | None,
         resume_run_id: str | None,
+        *,
+        rerun_stale: bool = False,
     ) -> RunContext:
         """Initialise RunContext for a new or resumed run.
 
@@ -271,6 +569,8 @@ class DAGExecutor:
             store: The artifact store.
             runbook_path: Path to runbook file (for new run metadata).
             resume_run_id: If provided, resume from this existing run.
+            rerun_stale: When resuming, adopt ``plan`` and invalidate stale
+                artifacts.
 
         Returns:
             RunContext ready for execution.
@@ -281,7 +581,12 @@ class DAGExecutor:
 
         """
         if resume_run_id is not None:
-            return await self._resume_run(store, runbook_path, resume_run_id)
+            run_ctx = await self._resume_run(store, runbook_path, resume_run_id)
+            if rerun_stale:
+                await self._adopt_plan(run_ctx, plan, store)
+                await run_ctx.save_state(store)
+                await run_ctx.save_plan(store)
+            return run_ctx
         else:
             run_ctx = RunContext.new(plan, runbook_path)
             await run_ctx.save_all(store)
@@ -317,6 +622,36 @@ class DAGExecutor:
 
         return run_ctx
 
+    async def _adopt_plan(
+        self, run_ctx: RunContext, plan: ExecutionPlan, store: ArtifactStore
+    ) -> None:
+        """Replace a resumed run's plan, invalidating stale artifacts.
+
+        Artifacts whose fingerprint changed are re-executed together with
+        their transitive dependents, whose inputs will change with them.
+        Stale pending artifacts are prepared again: their persisted
+        PrepareResult and the batch jobs only they were waiting on were
+        built from the old definition.
+        """
+        state = run_ctx.state
+        run_id = run_ctx.metadata.run_id
+        fingerprints = plan.artifact_fingerprints()
+        stale = state.stale_artifacts(fingerprints)
+        invalid = stale | plan.dag.get_downstream(stale)
+        abandoned, orphaned_batches = state.adopt_plan(fingerprints, invalid)
+        for artifact_id in sorted(abandoned):
+            await store.delete_prepared(run_id, artifact_id)
+        for batch_id in sorted(orphaned_batches):
+            await store.delete_batch_job(run_id, batch_id)
+        run_ctx.plan = plan
+
+        logger.info(
+            "Re-running %d stale artifact(s) of run %s, reusing %d",
+            len(invalid),
+            run_ctx.metadata.run_id,
+            len(state.completed),
+        )
+
     async def _execute_dag(
         self,
         plan: ExecutionPlan,
@@ -324,14 +659,15 @@ class DAGExecutor:
     ) -> None:
         """Execute artifacts in topological order with parallel batches.
 
-        Each level of the DAG is processed in three phases:
+        Each level of the DAG is processed in two phases:
         1. **Classification** — split ready artifacts into regular,
            distributed, and resuming groups
         2. **Concurrent execution** — ``_produce`` for regular artifacts
-           and ``_run_prepare`` for distributed artifacts run together
-           in ``asyncio.gather``
-        3. **Dispatch and finalise** — distributed entries go through
-           dispatch → finalise (possibly multi-round)
+           and ``_run_distributed`` (prepare → dispatch → finalise, possibly
+           multi-round) for distributed artifacts run together in
+           ``asyncio.gather``. Distributed artifacts share a
+           ``DispatchCoalescer``, so each dispatches as soon as it has
+           prepared while requests submitted together are still batched.
 
         The loop exits when no more progress is possible. If pending batch
         artifacts exist at that point, the run is marked interrupted.
@@ -368,10 +704,16 @@ class DAGExecutor:
                 resuming_entries,
             ) = await self._classify_artifacts(ready, plan, ctx)
 
-            # ── Regular + Phase 1 (concurrent) ──
+            # ── Regular + distributed pipelines (concurrent) ──
+            distributed_pipeline = [*resuming_entries, *distributed_entries]
+            coalescer = DispatchCoalescer(self._dispatch_batch)
+            for _ in distributed_pipeline:
+                coalescer.join()
+
             regular_tasks = [self._produce(aid, plan, ctx) for aid in regular_aids]
-            prepare_tasks = [
-                self._run_prepare(entry, ctx) for entry in distributed_entries
+            distributed_tasks = [
+                self._run_distributed(entry, plan, ctx, sorter, coalescer)
+                for entry in distributed_pipeline
             ]
 
             logger.debug(
@@ -380,9 +722,9 @@ class DAGExecutor:
                 len(distributed_entries),
                 len(resuming_entries),
             )
-            regular_batch, prepare_batch = await asyncio.gather(
+            regular_batch, _ = await asyncio.gather(
                 asyncio.gather(*regular_tasks, return_exceptions=True),
-                asyncio.gather(*prepare_tasks, return_exceptions=True),
+                asyncio.gather(*distributed_tasks),
             )
 
             # ── Handle regular results ──
@@ -390,32 +732,6 @@ class DAGExecutor:
                 await self._handle_artifact_result(aid, regular_result, plan, ctx)
                 sorter.done(aid)
 
-            # ── Collect Phase 1 results ──
-            phase2_entries: list[_DistributedEntry] = list(resuming_entries)
-            for entry, prepare_result in zip(
-                distributed_entries, prepare_batch, strict=True
-            ):
-                if isinstance(prepare_result, BaseException):
-                    message = self._create_error_message_for_exception(
-                        entry.artifact_id, prepare_result, plan, ctx
-                    )
-                    await ctx.store.save_artifact(
-                        ctx.run_id, entry.artifact_id, message
-                    )
-                    await self._mark_failed_and_skip_dependents(
-                        entry.artifact_id, plan, ctx
-                    )
-                    sorter.done(entry.artifact_id)
-                else:
-                    entry.prepare_result = prepare_result
-                    phase2_entries.append(entry)
-
-            # ── Phase 2→3: Dispatch and Finalise (with multi-round) ──
-            if phase2_entries:
-                await self._finalise_distributed_artifacts(
-                    phase2_entries, plan, ctx, sorter
-                )
-
         logger.debug("DAG execution complete.")
 
     def _partition_ready_artifacts(
@@ -486,6 +802,8 @@ class DAGExecutor:
                         processor=processor,
                         inputs=[],
                         output_schema=output_schema,
+                        component=self._determine_source(definition),
+                        pool=self._resource_pool(definition, ctx),
                         prepare_result=prepare_result,
                         start_time=time.monotonic(),
                     )
@@ -518,6 +836,8 @@ class DAGExecutor:
                             processor=processor_instance,
                             inputs=inputs,
                             output_schema=output_schema,
+                            component=self._determine_source(definition),
+                            pool=self._resource_pool(definition, ctx),
                             start_time=time.monotonic(),
                         )
                     )
@@ -567,6 +887,11 @@ class DAGExecutor:
     ) -> list[Message]:
         """Load input messages for an artifact from the store.
 
+        Under the ``boundary`` validation policy, inputs produced earlier in
+        this run get their producer's typed model back (see
+        ``_remember_typed_content``), so consumers need not re-validate them.
+        Each load counts towards releasing the model.
+
         Args:
             definition: The artifact definition with input references.
             ctx: The execution context with store and run_id.
@@ -578,13 +903,23 @@ class DAGExecutor:
             ValueError: If the artifact has no inputs defined.
 
         """
-        inputs = definition.inputs
-        if inputs is None:
+        if definition.inputs is None:
             msg = "Cannot load inputs: artifact has no inputs defined"
             raise ValueError(msg)
 
-        input_refs = [inputs] if isinstance(inputs, str) else inputs
-        return [await ctx.store.get_artifact(ctx.run_id, ref) for ref in input_refs]
+        input_refs = _input_refs(definition)
+        messages = [await ctx.store.get_artifact(ctx.run_id, ref) for ref in input_refs]
+        typed_contents = [ctx.typed_contents.take(ref) for ref in input_refs]
+        if SchemaRegistry.get_validation_policy() != "boundary":
+            return messages
+
+        # Copies, since a store may hand out the very Message it holds
+        return [
+            replace(message, typed_content=typed_content)
+            if typed_content is not None
+            else message
+            for message, typed_content in zip(messages, typed_contents, strict=True)
+        ]
 
     async def _run_prepare(
         self,
@@ -598,7 +933,10 @@ class DAGExecutor:
         (called from ``asyncio.gather``, not wrapped by ``_produce``).
 
         """
-        async with ctx.semaphore:
+        item_count = self._message_item_count(entry.inputs)
+        async with self._admitted(
+            ctx, pool=entry.pool, component=entry.component, item_count=item_count
+        ):
             loop = asyncio.get_running_loop()
             return await loop.run_in_executor(
                 ctx.thread_pool,
@@ -627,7 +965,10 @@ class DAGExecutor:
             msg = f"Cannot finalise '{entry.artifact_id}': no prepare_result"
             raise RuntimeError(msg)
 
-        async with ctx.semaphore:
+        item_count = self._message_item_count(entry.inputs)
+        async with self._admitted(
+            ctx, pool=entry.pool, component=entry.component, item_count=item_count
+        ):
             loop = asyncio.get_running_loop()
             return await loop.run_in_executor(
                 ctx.thread_pool,
@@ -637,87 +978,85 @@ class DAGExecutor:
                 entry.output_schema,
             )
 
-    async def _finalise_distributed_artifacts(
+    async def _run_distributed(  # noqa: PLR0913 - pipeline needs sorter and coalescer
         self,
-        entries: list[_DistributedEntry],
+        entry: _DistributedEntry,
         plan: ExecutionPlan,
         ctx: _ExecutionContext,
         sorter: TopologicalSorter[str],
+        coalescer: DispatchCoalescer,
         *,
         max_rounds: int = 3,
     ) -> None:
-        """Orchestrate Phase 2–3 with multi-round loop for distributed entries.
+        """Drive one distributed artifact through prepare, dispatch and finalise.
 
-        Drives the dispatch → finalise cycle until all entries produce a
-        ``(primary, sidecars)`` tuple or max rounds is exceeded:
-        1. Filter out entries already marked pending by dispatch
-        2. Dispatch all entries with requests (Phase 2)
-        3. Finalise each entry (Phase 3)
+        Runs independently of its siblings at the same DAG level:
+        1. ``prepare()`` unless the entry is resuming with a ``PrepareResult``
+        2. Submit requests to ``coalescer``, which batches them with
+           siblings' requests submitted at about the same time (Phase 2)
+        3. ``finalise()`` with this artifact's results (Phase 3)
         4. ``(primary, sidecars)`` tuple → save artifact, mark completed,
-           clean up, notify sorter
-        5. PrepareResult → queue for another round
-        6. Repeat until no entries remain or max rounds exceeded
+           notify sorter
+        5. PrepareResult → dispatch again, up to ``max_rounds`` rounds
+
+        A ``PendingProcessingError`` from dispatch persists the entry as
+        pending; any other failure fails the artifact and skips dependents.
+        Leaves ``coalescer`` when done.
 
         Args:
-            entries: Distributed entries with ``prepare_result`` populated.
+            entry: Distributed entry, with ``prepare_result`` if resuming.
             plan: The execution plan (for failure handling and metadata).
             ctx: The execution context.
             sorter: The topological sorter (to notify on completion).
+            coalescer: Request coalescer shared with this level's siblings.
             max_rounds: Maximum dispatch-finalise cycles (default 3).
 
         """
-        active_entries = [
-            e for e in entries if e.artifact_id not in ctx.pending_batch_artifacts
-        ]
-
-        for _round in range(max_rounds):
-            if not active_entries:
+        try:
+            if entry.artifact_id in ctx.pending_batch_artifacts:
                 return
-
-            # Phase 2: dispatch
-            results_by_artifact = await self._dispatch_all(active_entries, plan, ctx)
-
-            # Phase 3: finalise each non-pending entry
-            next_round: list[_DistributedEntry] = []
-            for entry in active_entries:
-                if entry.artifact_id in ctx.pending_batch_artifacts:
-                    continue
-                if entry.artifact_id not in results_by_artifact:
-                    continue
+            if entry.prepare_result is None:
+                try:
+                    entry.prepare_result = await self._run_prepare(entry, ctx)
+                except Exception as exc:
+                    await self._fail_distributed(entry, exc, plan, ctx, sorter)
+                    return
+
+            for _round in range(max_rounds):
+                requests = entry.prepare_result.requests
+                results: Sequence[DispatchResult] = []
+                if requests:
+                    try:
+                        results = await coalescer.submit(requests)
+                    except PendingProcessingError as pending:
+                        async with ctx.persist_lock:
+                            await self._persist_pending_entries(
+                                [entry], ctx, pending.batch_ids
+                            )
+                        return
+                    except Exception as exc:
+                        logger.exception(
+                            "Dispatch failed for request type %s of artifact %s",
+                            type(requests[0]).__name__,
+                            entry.artifact_id,
+                        )
+                        await self._fail_distributed(entry, exc, plan, ctx, sorter)
+                        return
 
                 try:
-                    result = await self._run_finalise(
-                        entry, results_by_artifact[entry.artifact_id], ctx
-                    )
+                    result = await self._run_finalise(entry, results, ctx)
                 except Exception as exc:
-                    message = self._create_error_message_for_exception(
-                        entry.artifact_id, exc, plan, ctx
-                    )
-                    await ctx.store.save_artifact(
-                        ctx.run_id, entry.artifact_id, message
-                    )
-                    await self._mark_failed_and_skip_dependents(
-                        entry.artifact_id, plan, ctx
-                    )
-                    continue
+                    await self._fail_distributed(entry, exc, plan, ctx, sorter)
+                    return
 
                 if isinstance(result, tuple):
                     entry.finalise_output = result
-                    await self._save_distributed_artifact(
-                        entry,
-                        results_by_artifact[entry.artifact_id],
-                        plan,
-                        ctx,
-                    )
+                    async with ctx.persist_lock:
+                        await self._save_distributed_artifact(entry, results, plan, ctx)
                     sorter.done(entry.artifact_id)
-                else:
-                    entry.prepare_result = result
-                    next_round.append(entry)
-
-            active_entries = next_round
+                    return
+                entry.prepare_result = result
 
-        # Entries still active after max rounds → fail
-        for entry in active_entries:
             logger.warning(
                 "Artifact '%s' exceeded max dispatch rounds (%d)",
                 entry.artifact_id,
@@ -727,11 +1066,26 @@ class DAGExecutor:
                 f"Artifact '{entry.artifact_id}' exceeded max dispatch rounds "
                 f"({max_rounds})"
             )
-            message = self._create_error_message_for_exception(
-                entry.artifact_id, exc, plan, ctx
-            )
+            await self._fail_distributed(entry, exc, plan, ctx, sorter)
+        finally:
+            coalescer.leave()
+
+    async def _fail_distributed(
+        self,
+        entry: _DistributedEntry,
+        exc: BaseException,
+        plan: ExecutionPlan,
+        ctx: _ExecutionContext,
+        sorter: TopologicalSorter[str],
+    ) -> None:
+        """Save an error message for a distributed artifact and skip dependents."""
+        message = self._create_error_message_for_exception(
+            entry.artifact_id, exc, plan, ctx
+        )
+        async with ctx.persist_lock:
             await ctx.store.save_artifact(ctx.run_id, entry.artifact_id, message)
             await self._mark_failed_and_skip_dependents(entry.artifact_id, plan, ctx)
+        sorter.done(entry.artifact_id)
 
     async def _save_distributed_artifact(
         self,
@@ -759,6 +1113,12 @@ class DAGExecutor:
         await ctx.store.delete_prepared(ctx.run_id, entry.artifact_id)
         ctx.state.mark_completed(entry.artifact_id)
         await ctx.state.save(ctx.store)
+        self._record_success(
+            entry.component,
+            self._message_item_count(entry.inputs),
+            primary,
+            save_ctx.execution_context.duration_seconds,
+        )
 
     def _build_save_ctx_for_distributed(
         self,
@@ -794,6 +1154,7 @@ class DAGExecutor:
             source=source,
             execution_context=execution_context,
             store=ctx.store,
+            typed_contents=ctx.typed_contents,
         )
 
     async def _persist_with_sidecars(
@@ -815,11 +1176,13 @@ class DAGExecutor:
         for sidecar in sidecars:
             sidecar_artifact_id = f"{save_ctx.artifact_id}.{sidecar.schema.name}"
             enriched_sidecar = self._enrich_for_persistence(sidecar, save_ctx)
+            self._remember_typed_content(sidecar_artifact_id, sidecar, save_ctx)
             await save_ctx.store.save_artifact(
                 save_ctx.run_id, sidecar_artifact_id, enriched_sidecar
             )
 
         self._stamp_back_reference(primary, sidecars, save_ctx.artifact_id)
+        self._remember_typed_content(save_ctx.artifact_id, primary, save_ctx)
 
         enriched_primary = self._enrich_for_persistence(primary, save_ctx)
         await save_ctx.store.save_artifact(
@@ -831,14 +1194,32 @@ class DAGExecutor:
     def _enrich_for_persistence(
         message: Message, save_ctx: _ArtifactSaveContext
     ) -> Message:
-        """Stamp identity (run_id, source, ExecutionContext) onto a Message."""
+        """Stamp identity (run_id, source, ExecutionContext) onto a Message.
+
+        The typed model is dropped: a store that keeps messages would
+        otherwise hold it alongside the content. ``_remember_typed_content``
+        keeps it for consumers within the run instead.
+        """
         return replace(
             message,
             run_id=save_ctx.run_id,
             source=save_ctx.source,
             extensions=MessageExtensions(execution=save_ctx.execution_context),
+            typed_content=None,
         )
 
+    @staticmethod
+    def _remember_typed_content(
+        artifact_id: str, message: Message, save_ctx: _ArtifactSaveContext
+    ) -> None:
+        """Keep the typed model of a Message about to be persisted, if any.
+
+        Kept only if dependents will load the artifact. A Message without
+        one (e.g. its content was changed after the model was dumped, see
+        ``_stamp_back_reference``) clears any earlier entry.
+        """
+        save_ctx.typed_contents.remember(artifact_id, message.typed_content)
+
     def _stamp_back_reference(
         self,
         primary: Message,
@@ -865,135 +1246,66 @@ class DAGExecutor:
             cast("dict[str, Any]", summary)["removed_findings_artifact_id"] = (
                 f"{primary_artifact_id}.{sidecar.schema.name}"
             )
+            # Content no longer matches the typed model it was dumped from
+            primary.typed_content = None
             return
 
-    async def _dispatch_all(
+    async def _dispatch_batch(
         self,
-        entries: list[_DistributedEntry],
-        plan: ExecutionPlan,
-        ctx: _ExecutionContext,
-    ) -> Mapping[str, Sequence[DispatchResult]]:
-        """Group requests by type, dispatch each group, and route results back.
-
-        Orchestrates Phase 2 of the distributed processor lifecycle:
-        1. Collect all requests from entries and build request-to-artifact mapping
-        2. Group requests by concrete type (e.g., all LLMRequest together)
-        3. Resolve a dispatcher per group and dispatch
-        4. Route results back to artifacts via request_id
+        request_type: type[DispatchRequest],
+        requests: list[DispatchRequest],
+    ) -> Sequence[DispatchResult]:
+        """Dispatch a coalesced batch of requests of one type.
 
-        Short-circuited entries (empty requests) get empty result sequences
-        without going through dispatch.
-
-        Args:
-            entries: Distributed entries with ``prepare_result`` populated.
-            plan: The execution plan (needed for failure handling).
-            ctx: The execution context with store, state, and registry access.
+        Called by the ``DispatchCoalescer``, which routes the results back
+        to the artifacts that submitted the requests via ``request_id``.
 
-        Returns:
-            Mapping from artifact_id to its dispatch results. Artifacts
-            that were marked pending (PendingBatchError) or failed are
-            excluded from the returned mapping.
+        Raises:
+            PendingProcessingError: If the dispatcher queued the requests
+                for asynchronous processing (e.g. a provider batch).
 
         """
-        results_by_artifact: dict[str, list[DispatchResult]] = {
-            entry.artifact_id: [] for entry in entries
-        }
-
-        # Map request_id → artifact_id for result routing
-        request_to_artifact: dict[str, str] = {}
-        # Group requests by concrete type for consolidated dispatch
-        requests_by_type: dict[type[DispatchRequest], list[DispatchRequest]] = (
-            defaultdict(list)
-        )
-        # Track which entries are affected by each request type group
-        entries_by_type: dict[type[DispatchRequest], list[_DistributedEntry]] = (
-            defaultdict(list)
-        )
-
-        for entry in entries:
-            if entry.prepare_result is None or not entry.prepare_result.requests:
-                continue
-
-            request_type = type(entry.prepare_result.requests[0])
-            for request in entry.prepare_result.requests:
-                request_to_artifact[request.request_id] = entry.artifact_id
-                requests_by_type[request_type].append(request)
-
-            if entry not in entries_by_type[request_type]:
-                entries_by_type[request_type].append(entry)
-
-        # Dispatch each type group
-        for request_type, requests in requests_by_type.items():
-            affected_entries = entries_by_type[request_type]
-            try:
-                dispatcher = self._registry.get_dispatcher_for(request_type)
-                group_results: Sequence[DispatchResult] = await dispatcher.dispatch(
-                    requests
-                )
-            except PendingProcessingError:
-                await self._persist_pending_entries(affected_entries, ctx)
-                continue
-            except DispatcherUnavailableError as exc:
-                # Dispatcher not configured (e.g., missing API key).
-                # Produce soft-failure results so processors can degrade
-                # gracefully in finalise() rather than failing the artifact.
-                logger.warning(
-                    "Dispatcher unavailable for %s: %s",
-                    request_type.__name__,
-                    exc,
-                )
-                group_results = [
-                    DispatcherNotConfigured(
-                        request_id=req.request_id,
-                        name=req.name,
-                        reason=str(exc),
-                    )
-                    for req in requests
-                ]
-            except Exception as exc:
-                affected_ids = [e.artifact_id for e in affected_entries]
-                logger.exception(
-                    "Dispatch failed for request type %s affecting artifacts %s",
-                    request_type.__name__,
-                    affected_ids,
+        try:
+            dispatcher = self._registry.get_dispatcher_for(request_type)
+            return await dispatcher.dispatch(requests)
+        except DispatcherUnavailableError as exc:
+            # Dispatcher not configured (e.g., missing API key).
+            # Produce soft-failure results so processors can degrade
+            # gracefully in finalise() rather than failing the artifact.
+            logger.warning(
+                "Dispatcher unavailable for %s: %s",
+                request_type.__name__,
+                exc,
+            )
+            return [
+                DispatcherNotConfigured(
+                    request_id=req.request_id,
+                    name=req.name,
+                    reason=str(exc),
                 )
-                for entry in affected_entries:
-                    message = self._create_error_message_for_exception(
-                        entry.artifact_id, exc, plan, ctx
-                    )
-                    await ctx.store.save_artifact(
-                        ctx.run_id, entry.artifact_id, message
-                    )
-                    await self._mark_failed_and_skip_dependents(
-                        entry.artifact_id, plan, ctx
-                    )
-                    results_by_artifact.pop(entry.artifact_id, None)
-                continue
-
-            # Route results back to artifacts via request_id
-            for result in group_results:
-                artifact_id = request_to_artifact[result.request_id]
-                results_by_artifact[artifact_id].append(result)
-
-        return results_by_artifact
+                for req in requests
+            ]
 
     async def _persist_pending_entries(
         self,
         entries: list[_DistributedEntry],
         ctx: _ExecutionContext,
+        batch_ids: Sequence[str] = (),
     ) -> None:
         """Persist PrepareResult for entries affected by PendingBatchError.
 
         Serialises each entry's PrepareResult, saves to store, marks the
-        artifact as pending, and adds to the pending tracking set.
+        artifact as pending on ``batch_ids``, and adds to the pending
+        tracking set.
 
         """
         for entry in entries:
             if entry.prepare_result is not None:
                 data = entry.prepare_result.model_dump(mode="json")
                 await ctx.store.save_prepared(ctx.run_id, entry.artifact_id, data)
-            ctx.state.mark_pending(entry.artifact_id)
+            ctx.state.mark_pending(entry.artifact_id, batch_ids)
             ctx.pending_batch_artifacts.add(entry.artifact_id)
+            self._metrics.outcomes.inc(state="pending")
         await ctx.state.save(ctx.store)
 
     async def _handle_artifact_result(
@@ -1024,6 +1336,7 @@ class DAGExecutor:
         else:
             # Success - message already saved in _produce()
             ctx.state.mark_completed(artifact_id)
+            self._metrics.outcomes.inc(state="completed")
             await ctx.state.save(ctx.store)
 
     def _create_error_message_for_exception(
@@ -1058,6 +1371,7 @@ class DAGExecutor:
     ) -> None:
         """Mark artifact as failed, persist state, and skip all dependents."""
         ctx.state.mark_failed(artifact_id)
+        self._metrics.outcomes.inc(state="failed")
         await ctx.state.save(ctx.store)
         await self._skip_dependents(artifact_id, plan, ctx)
 
@@ -1085,7 +1399,19 @@ class DAGExecutor:
         # Get schemas from pre-resolved schemas
         _input_schema, output_schema = plan.artifact_schemas[artifact_id]
 
-        async with ctx.semaphore:
+        # Reused artifacts are only loaded, so they are not profiled
+        component = None if definition.reuse else self._determine_source(definition)
+        try:
+            item_count = await self._input_item_count(definition, ctx)
+        except ArtifactNotFoundError:
+            item_count = None  # Reported by _process_from_inputs below
+
+        async with self._admitted(
+            ctx,
+            pool=self._resource_pool(definition, ctx),
+            component=component,
+            item_count=item_count,
+        ):
             try:
                 sidecars: list[Message] = []
                 match definition:
@@ -1098,9 +1424,15 @@ class DAGExecutor:
                             source, output_schema, ctx.thread_pool
                         )
                     case _:
-                        message, sidecars = await self._process_from_inputs(
+                        (
+                            message,
+                            sidecars,
+                            loaded_items,
+                        ) = await self._process_from_inputs(
                             definition, output_schema, ctx
                         )
+                        if item_count is None:
+                            item_count = loaded_items
 
                 # Determine source component type
                 source = self._determine_source(definition)
@@ -1116,9 +1448,11 @@ class DAGExecutor:
                         alias=alias,
                     ),
                     store=ctx.store,
+                    typed_contents=ctx.typed_contents,
                 )
 
                 message = await self._persist_with_sidecars(message, sidecars, save_ctx)
+                self._record_success(component, item_count, message, duration)
 
                 logger.debug(
                     "Artifact %s completed successfully (%.2fs)", artifact_id, duration
@@ -1128,6 +1462,10 @@ class DAGExecutor:
 
             except Exception as e:
                 duration = time.monotonic() - start_time
+                if component is not None:
+                    self._metrics.duration.observe(
+                        duration, component=component, status="error"
+                    )
                 logger.debug(
                     "Artifact %s failed: %s (%.2fs)", artifact_id, str(e), duration
                 )
@@ -1147,6 +1485,24 @@ class DAGExecutor:
                     source=self._determine_source(definition),
                 )
 
+    def _record_success(
+        self,
+        component: str | None,
+        input_items: int | None,
+        message: Message,
+        duration: float,
+    ) -> None:
+        """Record the items and duration of an artifact produced by ``component``."""
+        if component is None:
+            return  # Reused from a previous run, not produced
+        metrics = self._metrics
+        metrics.duration.observe(duration, component=component, status="success")
+        if input_items is not None:
+            metrics.items_processed.inc(input_items, component=component)
+        output_items = self._message_item_count([message])
+        if output_items is not None:
+            metrics.items_produced.inc(output_items, component=component)
+
     async def _skip_dependents(
         self,
         artifact_id: str,
@@ -1167,7 +1523,12 @@ class DAGExecutor:
 
         # Mark all collected dependents as skipped and persist
         if dependents_to_skip:
+            # Skipped artifacts never load their inputs
+            for dep in dependents_to_skip:
+                for ref in _input_refs(plan.runbook.artifacts[dep]):
+                    ctx.typed_contents.take(ref)
             ctx.state.mark_skipped(dependents_to_skip)
+            self._metrics.outcomes.inc(len(dependents_to_skip), state="skipped")
             await ctx.state.save(ctx.store)
 
     async def _mark_remaining_as_skipped(
@@ -1179,6 +1540,7 @@ class DAGExecutor:
         remaining = ctx.state.remaining_actionable(set(plan.runbook.artifacts.keys()))
         if remaining:
             ctx.state.mark_skipped(remaining)
+            self._metrics.outcomes.inc(len(remaining), state="skipped")
             await ctx.state.save(ctx.store)
 
     async def _run_connector(
@@ -1187,12 +1549,20 @@ class DAGExecutor:
         output_schema: Schema,
         thread_pool: ThreadPoolExecutor,
     ) -> Message:
-        """Run a connector in the thread pool."""
+        """Run a connector in the thread pool.
+
+        Under the ``boundary`` validation policy, connector output is where
+        external data enters the run, so it is validated here (in the pool).
+        """
         factory = self._registry.connector_factories[source.type]
+        validate_output = SchemaRegistry.get_validation_policy() == "boundary"
 
         def sync_extract() -> Message:
             connector = factory.create(source.properties)
-            return connector.extract(output_schema)
+            message = connector.extract(output_schema)
+            if validate_output:
+                message.validate(boundary=True)
+            return message
 
         loop = asyncio.get_running_loop()
         return await loop.run_in_executor(thread_pool, sync_extract)
@@ -1233,7 +1603,7 @@ class DAGExecutor:
         definition: ArtifactDefinition,
         output_schema: Schema,
         ctx: _ExecutionContext,
-    ) -> tuple[Message, list[Message]]:
+    ) -> tuple[Message, list[Message], int | None]:
         """Produce a derived artifact from its inputs.
 
         Args:
@@ -1242,22 +1612,26 @@ class DAGExecutor:
             ctx: The execution context containing store, run_id, and thread pool.
 
         Returns:
-            ``(primary, sidecars)`` — passthrough produces an empty sidecars list.
+            ``(primary, sidecars, input_items)`` — passthrough produces an
+            empty sidecars list; ``input_items`` counts the loaded inputs'
+            items, if all are known.
 
         """
         input_messages = await self._load_inputs(definition, ctx)
+        input_items = self._message_item_count(input_messages)
 
         if definition.process is not None:
-            return await self._run_processor(
+            message, sidecars = await self._run_processor(
                 definition.process,
                 input_messages,
                 output_schema,
                 ctx.thread_pool,
             )
+            return message, sidecars, input_items
 
         # Passthrough: use first input (or merge for fan-in)
         if len(input_messages) == 1:
-            return input_messages[0], []
+            return input_messages[0], [], input_items
 
         # Fan-in: merge messages - deferred to Phase 2
         raise NotImplementedError("Fan-in message merge not yet implemented")
@@ -1275,15 +1649,25 @@ class DAGExecutor:
             source_artifact: The artifact ID in the source run.
             ctx: The execution context.
 
+        Under the ``boundary`` validation policy the reused content is
+        validated, since it was produced outside this run.
+
         Returns:
             The loaded message (metadata will be updated by caller).
 
         Raises:
             ArtifactNotFoundError: If the artifact doesn't exist in the source run.
+            MessageValidationError: If reused content fails boundary validation.
 
         """
         logger.debug("Reusing artifact '%s' from run '%s'", source_artifact, from_run)
-        return await ctx.store.get_artifact(from_run, source_artifact)
+        message = await ctx.store.get_artifact(from_run, source_artifact)
+        if SchemaRegistry.get_validation_policy() == "boundary":
+            loop = asyncio.get_running_loop()
+            await loop.run_in_executor(
+                ctx.thread_pool, lambda: message.validate(boundary=True)
+            )
+        return message
 
     def _determine_source(self, definition: ArtifactDefinition) -> str:
         """Determine the source component type for an artifact.
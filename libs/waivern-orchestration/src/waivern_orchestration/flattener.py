@@ -6,8 +6,13 @@ into the parent's artifact structure. This is a plan-time operation that:
 2. Validates input mappings and schema compatibility
 3. Namespaces child artifacts to avoid collisions
 4. Creates aliases for output mapping
+
+Child runbook files are parsed up front, level by level and concurrently
+within a level, and each file is parsed once however often it is referenced.
 """
 
+from collections.abc import Mapping
+from concurrent.futures import ThreadPoolExecutor
 from pathlib import Path
 
 from waivern_core.schemas import Schema
@@ -17,6 +22,7 @@ from waivern_orchestration.errors import (
     CircularRunbookError,
     InvalidOutputMappingError,
     MissingInputMappingError,
+    OrchestrationError,
     SchemaCompatibilityError,
 )
 from waivern_orchestration.models import ArtifactDefinition, ChildRunbookConfig, Runbook
@@ -33,6 +39,16 @@ _QueueItem = tuple[
     str, ArtifactDefinition, Path | None, frozenset[Path], dict[str, str]
 ]
 
+_MAX_PARSE_WORKERS = 8
+
+
+def _try_parse_runbook(path: Path) -> Runbook | None:
+    """Parse a child runbook for prefetching; errors surface later in flatten()."""
+    try:
+        return parse_runbook(path)
+    except OrchestrationError:
+        return None
+
 
 class ChildRunbookFlattener:
     """Flattens child runbooks into parent artifact structure at plan time."""
@@ -52,6 +68,74 @@ class ChildRunbookFlattener:
         self._aliases: dict[str, str] = {}
         self._runbook: Runbook | None = None
 
+        # Parsed child runbooks by resolved path (reset per prefetch call)
+        self._parsed_children: dict[Path, Runbook] = {}
+        self._prefetched_for: Runbook | None = None
+
+    def prefetch(
+        self, runbook: Runbook, runbook_path: Path | None
+    ) -> Mapping[Path, Runbook]:
+        """Parse every child runbook reachable from ``runbook``.
+
+        Child runbooks are discovered breadth first; the files of one level
+        are parsed concurrently. A following ``flatten()`` of the same
+        runbook uses the parsed models instead of re-reading the files.
+
+        Args:
+            runbook: The parent runbook.
+            runbook_path: Path to the runbook file (for resolving child paths).
+
+        Returns:
+            Parsed child runbooks by resolved path. Children that cannot be
+            resolved or parsed are omitted; ``flatten()`` raises for them.
+
+        """
+        self._parsed_children = {}
+        self._prefetched_for = runbook
+        if runbook_path is None:
+            return {}
+
+        template_paths = runbook.config.template_paths
+        attempted: set[Path] = set()
+        frontier = self._child_paths(runbook, runbook_path, template_paths)
+        if not frontier:
+            return {}
+
+        with ThreadPoolExecutor(max_workers=_MAX_PARSE_WORKERS) as pool:
+            while frontier:
+                paths = [
+                    path for path in dict.fromkeys(frontier) if path not in attempted
+                ]
+                attempted.update(paths)
+                frontier = []
+                for path, child in zip(
+                    paths, pool.map(_try_parse_runbook, paths), strict=True
+                ):
+                    if child is None:
+                        continue
+                    self._parsed_children[path] = child
+                    frontier.extend(self._child_paths(child, path, template_paths))
+
+        return dict(self._parsed_children)
+
+    @staticmethod
+    def _child_paths(
+        runbook: Runbook, runbook_path: Path, template_paths: list[str] | None
+    ) -> list[Path]:
+        """Resolve the paths of the child runbooks ``runbook`` references directly."""
+        paths: list[Path] = []
+        for definition in runbook.artifacts.values():
+            if definition.child_runbook is None:
+                continue
+            try:
+                child_path = resolve_child_runbook_path(
+                    definition.child_runbook.path, runbook_path, template_paths
+                )
+            except OrchestrationError:
+                continue  # Reported by flatten() with full context
+            paths.append(child_path.resolve())
+        return paths
+
     def flatten(
         self,
         runbook: Runbook,
@@ -81,6 +165,9 @@ class ChildRunbookFlattener:
         self._aliases = {}
         self._runbook = runbook
 
+        if self._prefetched_for is not runbook:
+            self.prefetch(runbook, runbook_path)
+
         # Initial ancestor set includes the root runbook
         initial_ancestors: frozenset[Path] = frozenset()
         if runbook_path:
@@ -155,8 +242,10 @@ class ChildRunbookFlattener:
                 f"Circular runbook reference detected: {child_path}"
             )
 
-        # Parse child runbook
-        child_runbook = parse_runbook(child_path)
+        # Parse child runbook (normally already parsed by prefetch)
+        child_runbook = self._parsed_children.get(resolved_child)
+        if child_runbook is None:
+            child_runbook = parse_runbook(child_path)
 
         # Resolve input_mapping values through context and aliases
         resolved_input_mapping = self._resolve_input_mapping(
@@ -169,8 +258,10 @@ class ChildRunbookFlattener:
         # Validate output mapping and get alias mappings
         output_names = self._get_output_names(artifact_id, child_config, child_runbook)
 
-        # Generate unique namespace for child artifacts
-        namespace = generate_namespace(child_runbook.name)
+        # Namespace child artifacts by this invocation, stable across replans
+        namespace = generate_namespace(
+            child_runbook.name, artifact_id, child_config.path
+        )
 
         # Build input remapping for child artifacts
         child_input_remapping = dict(resolved_input_mapping)
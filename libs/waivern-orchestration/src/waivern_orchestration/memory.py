@@ -0,0 +1,286 @@
+"""Memory-aware admission control for the DAG executor.
+
+``max_concurrency`` bounds how many artifacts run at once, regardless of
+their size. With ``config.memory_budget`` set, each artifact must also
+reserve its estimated memory from the budget before it runs; artifacts
+that do not fit wait until running ones release theirs.
+
+Estimates come from a ``MemoryProfile``: the peak RSS growth last observed
+for each component type, scaled by the number of input items. Components
+never observed before get an equal share of the budget, which reproduces
+plain count-based concurrency until history exists.
+
+RSS is process-wide, so an observation made while other artifacts run
+includes their growth too. That errs towards overestimating, which only
+costs concurrency.
+"""
+
+from __future__ import annotations
+
+import asyncio
+import contextlib
+import json
+import logging
+import os
+import sys
+from collections.abc import AsyncIterator
+from contextlib import AbstractAsyncContextManager
+from pathlib import Path
+
+if sys.platform != "win32":
+    import resource
+
+logger = logging.getLogger(__name__)
+
+_PROFILE_VERSION = 1
+
+MIN_ESTIMATE_BYTES = 16 * 1024 * 1024
+"""Floor for scaled estimates, covering fixed per-component overhead."""
+
+
+def current_rss() -> int | None:
+    """Return this process's resident set size in bytes, if measurable.
+
+    Reads ``/proc/self/statm``, so this is only available on Linux.
+    """
+    try:
+        with open("/proc/self/statm", encoding="ascii") as statm:
+            resident_pages = int(statm.read().split()[1])
+    except (OSError, ValueError, IndexError):
+        return None
+    return resident_pages * os.sysconf("SC_PAGE_SIZE")
+
+
+def peak_rss() -> int | None:
+    """Return this process's peak resident set size in bytes, if measurable."""
+    if sys.platform == "win32":
+        return None
+    max_rss = resource.getrusage(resource.RUSAGE_SELF).ru_maxrss
+    # Linux reports kilobytes, macOS bytes
+    return max_rss if sys.platform == "darwin" else max_rss * 1024
+
+
+class RssProbe:
+    """Measures how much an artifact grew the process's memory."""
+
+    def __init__(self) -> None:
+        """Take the starting measurements."""
+        self._start_rss = current_rss()
+        self._start_peak = peak_rss()
+
+    def observed_bytes(self) -> int | None:
+        """Return the growth attributable to work since the probe was created.
+
+        If the process peak rose, the work reached a new high-water mark:
+        its growth is that peak minus the starting RSS. Otherwise only the
+        net RSS growth is known, a lower bound.
+        """
+        end_rss = current_rss()
+        end_peak = peak_rss()
+        if self._start_rss is None or end_rss is None:
+            return None
+        if (
+            self._start_peak is not None
+            and end_peak is not None
+            and end_peak > self._start_peak
+        ):
+            return max(end_peak - self._start_rss, 0)
+        return max(end_rss - self._start_rss, 0)
+
+
+class MemoryProfile:
+    """Peak memory observed per component type, optionally persisted as JSON.
+
+    Components are keyed like artifact sources, e.g. ``connector:filesystem``
+    or ``processor:personal_data``.
+    """
+
+    def __init__(self, path: Path | None = None) -> None:
+        """Initialise the profile, loading it from ``path`` if it exists.
+
+        Args:
+            path: File to persist observations in across runs, or None to
+                keep them in memory only.
+
+        """
+        self._path = path
+        self._entries: dict[str, tuple[int, int | None]] = {}
+        self._recorded: set[str] = set()
+        if path is not None:
+            self._entries = self._load(path)
+
+    @staticmethod
+    def _load(path: Path) -> dict[str, tuple[int, int | None]]:
+        try:
+            data = json.loads(path.read_text(encoding="utf-8"))
+        except (OSError, ValueError):
+            return {}
+        if not isinstance(data, dict) or data.get("version") != _PROFILE_VERSION:
+            return {}
+        entries: dict[str, tuple[int, int | None]] = {}
+        for component, entry in data.get("components", {}).items():
+            with contextlib.suppress(KeyError, TypeError, ValueError):
+                items = entry["items"]
+                entries[component] = (
+                    int(entry["peak_bytes"]),
+                    int(items) if items is not None else None,
+                )
+        return entries
+
+    def estimate(self, component: str, item_count: int | None) -> int | None:
+        """Estimate the memory an artifact of ``component`` needs.
+
+        Args:
+            component: Component key.
+            item_count: Number of input items, if known.
+
+        Returns:
+            Estimated bytes, or None if the component was never observed.
+
+        """
+        entry = self._entries.get(component)
+        if entry is None:
+            return None
+        peak_bytes, observed_items = entry
+        if item_count is None or not observed_items:
+            return peak_bytes
+        return max(peak_bytes * item_count // observed_items, MIN_ESTIMATE_BYTES)
+
+    def record(self, component: str, peak_bytes: int, item_count: int | None) -> None:
+        """Record the memory an artifact of ``component`` was observed to use.
+
+        The first observation replaces any history loaded from disk, so the
+        profile follows changes in component behaviour. Later observations
+        only replace it if they need more memory: growth is hidden whenever
+        the process already reached a higher peak, so smaller figures are
+        less trustworthy.
+        """
+        current = self._entries.get(component)
+        if current is not None and component in self._recorded:
+            current_bytes, current_items = current
+            if item_count and current_items:
+                larger = peak_bytes * current_items > current_bytes * item_count
+            else:
+                larger = peak_bytes > current_bytes
+            if not larger:
+                return
+        self._recorded.add(component)
+        self._entries[component] = (peak_bytes, item_count)
+
+    def save(self) -> None:
+        """Write the profile atomically, if it has a path.
+
+        The profile is only a hint: failure to write it is logged, not raised.
+        """
+        if self._path is None:
+            return
+        data = {
+            "version": _PROFILE_VERSION,
+            "components": {
+                component: {"peak_bytes": peak_bytes, "items": items}
+                for component, (peak_bytes, items) in sorted(self._entries.items())
+            },
+        }
+        partial = self._path.with_name(f"{self._path.name}.{os.getpid()}.partial")
+        try:
+            self._path.parent.mkdir(parents=True, exist_ok=True)
+            partial.write_text(json.dumps(data, indent=2), encoding="utf-8")
+            partial.replace(self._path)
+        except OSError as e:
+            logger.debug("Cannot write memory profile %s: %s", self._path, e)
+            with contextlib.suppress(OSError):
+                partial.unlink(missing_ok=True)
+
+
+class MemoryBudget:
+    """Admits work while the sum of its reservations fits within a budget."""
+
+    def __init__(self, budget_bytes: int) -> None:
+        """Initialise the budget.
+
+        Args:
+            budget_bytes: Total bytes that running work may reserve.
+
+        """
+        self._budget_bytes = budget_bytes
+        self._reserved = 0
+        self._condition = asyncio.Condition()
+
+    @property
+    def budget_bytes(self) -> int:
+        """Total bytes that running work may reserve."""
+        return self._budget_bytes
+
+    @contextlib.asynccontextmanager
+    async def reserve(self, nbytes: int) -> AsyncIterator[None]:
+        """Wait until ``nbytes`` fits in the budget and hold it until exit.
+
+        A reservation larger than the whole budget is admitted once nothing
+        else is running, so oversized work runs alone rather than never.
+        """
+        nbytes = min(nbytes, self._budget_bytes)
+        async with self._condition:
+            await self._condition.wait_for(
+                lambda: self._reserved + nbytes <= self._budget_bytes
+            )
+            self._reserved += nbytes
+        try:
+            yield
+        finally:
+            async with self._condition:
+                self._reserved -= nbytes
+                self._condition.notify_all()
+
+
+class MemoryAdmission:
+    """Admits artifacts against a memory budget using a memory profile."""
+
+    def __init__(
+        self, budget: MemoryBudget, profile: MemoryProfile, *, default_estimate: int
+    ) -> None:
+        """Initialise admission control.
+
+        Args:
+            budget: Budget that running artifacts reserve from.
+            profile: Observations to estimate from and record into.
+            default_estimate: Bytes reserved for components never observed.
+
+        """
+        self._budget = budget
+        self._profile = profile
+        self._default_estimate = default_estimate
+
+    def estimate(self, component: str | None, item_count: int | None) -> int:
+        """Return the bytes to reserve for an artifact of ``component``."""
+        if component is None:
+            return self._default_estimate
+        estimate = self._profile.estimate(component, item_count)
+        return self._default_estimate if estimate is None else estimate
+
+    @contextlib.asynccontextmanager
+    async def admit(
+        self,
+        component: str | None,
+        item_count: int | None,
+        slot: AbstractAsyncContextManager[object],
+    ) -> AsyncIterator[None]:
+        """Reserve memory, then take a concurrency ``slot``, then measure.
+
+        Memory is reserved first so waiting for memory never holds a slot.
+        The memory growth of work that completes is recorded in the profile.
+
+        Args:
+            component: Component key, or None for work not worth profiling.
+            item_count: Number of input items, if known.
+            slot: Concurrency limiter (the executor's semaphore).
+
+        """
+        nbytes = self.estimate(component, item_count)
+        async with self._budget.reserve(nbytes), slot:
+            probe = RssProbe()
+            yield
+            observed = probe.observed_bytes()
+            if component is not None and observed is not None:
+                self._profile.record(
+                    component, max(observed, MIN_ESTIMATE_BYTES), item_count
+                )
@@ -2,7 +2,7 @@
 
 from typing import Any, Literal, Self
 
-from pydantic import BaseModel, Field, model_validator
+from pydantic import BaseModel, Field, PositiveInt, model_validator
 from waivern_core import JsonValue
 
 # =============================================================================
@@ -61,6 +61,18 @@ class RunbookConfig(BaseModel):
     max_concurrency: int = 10
     max_child_depth: int = 3
     cost_limit: float | None = None
+    memory_budget: int | None = Field(default=None, gt=0)
+    """Memory (MiB) that concurrently running artifacts may use, by estimate.
+
+    Unset means concurrency is bounded by ``max_concurrency`` alone.
+    """
+    resource_pools: dict[str, PositiveInt] = Field(default_factory=dict)
+    """Concurrency limit per resource pool, e.g. ``{"db_io": 4, "llm": 32}``.
+
+    Artifacts in a declared pool (their component's default, or their own
+    ``resource_pool``) run against its limit instead of ``max_concurrency``,
+    so I/O-bound and CPU-bound stages overlap without contending.
+    """
     template_paths: list[str] = Field(default_factory=list)
     """Directories to search for child runbooks."""
 
@@ -166,6 +178,8 @@ class ArtifactDefinition(BaseModel):
     # Behaviour
     output: bool = False
     optional: bool = False
+    resource_pool: str | None = None
+    """Resource pool to run in, overriding the component's default."""
 
     # Phase 2: child runbook execution
     execute: ExecuteConfig | None = None
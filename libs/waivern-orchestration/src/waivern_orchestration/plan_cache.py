@@ -0,0 +1,174 @@
+"""On-disk cache of execution plans.
+
+Planning a composite runbook expands every child runbook and resolves the
+schemas of every artifact, importing each component it references. The
+result depends only on the parsed runbooks (after environment variable
+substitution) and on the installed components, so it is stored keyed by a
+hash of those and reused while they are unchanged.
+
+Components are identified by their entry points, the Python environment
+fingerprint and the contents of their packages' code and schema files. The
+last covers editable installs, whose code changes in place without
+reinstalling anything.
+"""
+
+from __future__ import annotations
+
+import contextlib
+import hashlib
+import importlib.util
+import json
+import logging
+import os
+from collections.abc import Mapping
+from pathlib import Path
+from typing import Any
+
+from waivern_core import JsonValue
+from waivern_core.services.manifest import environment_fingerprint
+
+from waivern_orchestration.models import Runbook
+
+logger = logging.getLogger(__name__)
+
+_PLAN_CACHE_FORMAT = 1
+"""Bump when ExecutionPlan serialisation or planning semantics change."""
+
+_MAX_ENTRIES = 256
+"""Least recently used plans beyond this many are removed on save."""
+
+_COMPONENT_FILE_SUFFIXES = frozenset({".py", ".json"})
+"""Component package files a plan can depend on: code and JSON schemas."""
+
+
+def _component_files_digest(components: Mapping[str, Mapping[str, str]]) -> str:
+    """Hash the code and schema files of every component's top-level package.
+
+    Packages are located with ``importlib.util.find_spec``, which does not
+    import them.
+    """
+    packages = sorted(
+        {
+            reference.partition(":")[0].partition(".")[0]
+            for references in components.values()
+            for reference in references.values()
+        }
+    )
+    digest = hashlib.sha256()
+    for package in packages:
+        digest.update(f"\0{package}\0".encode())
+        for path in _package_files(package):
+            try:
+                content = path.read_bytes()
+            except OSError:
+                continue
+            digest.update(f"{path}\0{len(content)}\0".encode())
+            digest.update(content)
+    return digest.hexdigest()
+
+
+def _package_files(package: str) -> list[Path]:
+    """List a top-level package's code and schema files, in a stable order."""
+    try:
+        spec = importlib.util.find_spec(package)
+    except (ImportError, ValueError):
+        return []
+    if spec is None:
+        return []
+    if spec.submodule_search_locations is None:
+        return [Path(spec.origin)] if spec.origin else []
+    return sorted(
+        path
+        for location in spec.submodule_search_locations
+        for path in Path(location).rglob("*")
+        if path.suffix in _COMPONENT_FILE_SUFFIXES and path.is_file()
+    )
+
+
+class PlanCache:
+    """Directory of serialised execution plans, one JSON file per key."""
+
+    def __init__(self, directory: Path) -> None:
+        """Initialise the cache.
+
+        Args:
+            directory: Directory holding the cached plans.
+
+        """
+        self._directory = directory
+
+    @property
+    def directory(self) -> Path:
+        """Directory holding the cached plans."""
+        return self._directory
+
+    @staticmethod
+    def compute_key(
+        runbook: Runbook,
+        children: Mapping[Path, Runbook],
+        components: Mapping[str, Mapping[str, str]],
+    ) -> str:
+        """Hash everything a plan is derived from.
+
+        Args:
+            runbook: The parsed root runbook.
+            children: Parsed child runbooks by resolved path.
+            components: Entry point references of the installed components.
+
+        Returns:
+            Hex digest identifying the plan.
+
+        """
+        digest = hashlib.sha256()
+        digest.update(f"plan-cache-{_PLAN_CACHE_FORMAT}\0".encode())
+        digest.update(runbook.model_dump_json().encode())
+        for path in sorted(children):
+            digest.update(f"\0{path}\0".encode())
+            digest.update(children[path].model_dump_json().encode())
+        digest.update(json.dumps(components, sort_keys=True).encode())
+        digest.update(environment_fingerprint().encode())
+        digest.update(_component_files_digest(components).encode())
+        return digest.hexdigest()
+
+    def _path_for(self, key: str) -> Path:
+        return self._directory / f"{key}.json"
+
+    def load(self, key: str) -> dict[str, Any] | None:
+        """Return the serialised plan for ``key``, or None if absent or unreadable."""
+        path = self._path_for(key)
+        try:
+            data = json.loads(path.read_text(encoding="utf-8"))
+        except (OSError, ValueError):
+            return None
+        if not isinstance(data, dict):
+            return None
+
+        with contextlib.suppress(OSError):
+            os.utime(path)  # Mark as recently used
+        return data  # type: ignore[return-value]
+
+    def save(self, key: str, plan_data: dict[str, JsonValue]) -> None:
+        """Store a serialised plan atomically and prune old entries.
+
+        The cache is an optimisation: failures are logged, not raised.
+        """
+        path = self._path_for(key)
+        partial = path.with_name(f"{path.name}.{os.getpid()}.partial")
+        try:
+            self._directory.mkdir(parents=True, exist_ok=True)
+            partial.write_text(json.dumps(plan_data), encoding="utf-8")
+            partial.replace(path)
+            self._prune()
+        except OSError as e:
+            logger.debug("Cannot write plan cache entry %s: %s", path, e)
+            with contextlib.suppress(OSError):
+                partial.unlink(missing_ok=True)
+
+    def _prune(self) -> None:
+        entries = sorted(
+            self._directory.glob("*.json"),
+            key=lambda entry: entry.stat().st_mtime_ns,
+            reverse=True,
+        )
+        for entry in entries[_MAX_ENTRIES:]:
+            entry.unlink(missing_ok=True)
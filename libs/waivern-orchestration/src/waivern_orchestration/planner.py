@@ -4,9 +4,12 @@ The Planner is responsible for:
 1. Parsing runbooks and building the execution DAG
 2. Validating references and schema compatibility
 3. Delegating child runbook flattening to ChildRunbookFlattener
-4. Producing an immutable ExecutionPlan
+4. Producing an immutable ExecutionPlan (reused from a PlanCache if given)
 """
 
+import hashlib
+import json
+import logging
 from dataclasses import dataclass, field
 from pathlib import Path
 from typing import Any, Self, cast
@@ -21,12 +24,24 @@ from waivern_orchestration.errors import (
     ComponentNotFoundError,
     MissingArtifactError,
     SchemaCompatibilityError,
+    UndeclaredResourcePoolError,
 )
 from waivern_orchestration.flattener import ChildRunbookFlattener
 from waivern_orchestration.models import ArtifactDefinition, Runbook
 from waivern_orchestration.parser import parse_runbook, parse_runbook_from_dict
+from waivern_orchestration.plan_cache import PlanCache
 from waivern_orchestration.utils import parse_schema_string
 
+logger = logging.getLogger(__name__)
+
+_UNFINGERPRINTED_FIELDS = frozenset(
+    {"name", "description", "contact", "output", "resource_pool"}
+)
+"""Artifact fields that do not affect what the artifact produces.
+
+``output`` only selects what is exported, so toggling it re-runs nothing.
+"""
+
 
 @dataclass(frozen=True)
 class ExecutionPlan:
@@ -74,6 +89,35 @@ class ExecutionPlan:
             "aliases": cast(dict[str, JsonValue], self.aliases),
         }
 
+    def artifact_fingerprints(self) -> dict[str, str]:
+        """Fingerprint how each artifact is produced.
+
+        Covers the artifact definition (minus documentation fields) and
+        its resolved schemas. Upstream changes are deliberately not folded
+        in: callers propagate invalidation along the DAG instead.
+
+        Returns:
+            Artifact ID -> hex digest.
+
+        """
+        fingerprints: dict[str, str] = {}
+        for aid, definition in self.runbook.artifacts.items():
+            inputs, output = self.artifact_schemas[aid]
+            payload = {
+                "definition": definition.model_dump(
+                    mode="json", exclude=set(_UNFINGERPRINTED_FIELDS)
+                ),
+                "inputs": (
+                    [f"{s.name}/{s.version}" for s in inputs]
+                    if inputs is not None
+                    else None
+                ),
+                "output": f"{output.name}/{output.version}",
+            }
+            encoded = json.dumps(payload, sort_keys=True).encode()
+            fingerprints[aid] = hashlib.sha256(encoded).hexdigest()
+        return fingerprints
+
     @classmethod
     def from_dict(cls, data: dict[str, Any]) -> Self:
         """Deserialise from persisted dict.
@@ -115,16 +159,20 @@ class ExecutionPlan:
 class Planner:
     """Plans runbook execution by validating and resolving all dependencies upfront."""
 
-    def __init__(self, registry: ComponentRegistry) -> None:
+    def __init__(
+        self, registry: ComponentRegistry, *, plan_cache: PlanCache | None = None
+    ) -> None:
         """Initialise Planner with component registry.
 
         Args:
             registry: ComponentRegistry for accessing component factories.
+            plan_cache: Optional cache of plans for unchanged runbook files.
 
         """
         self._registry = registry
         self._runbook_path: Path | None = None
         self._flattener = ChildRunbookFlattener(registry)
+        self._plan_cache = plan_cache
 
     def plan(self, runbook_path: Path) -> ExecutionPlan:
         """Plan execution from a runbook file.
@@ -146,7 +194,9 @@ class Planner:
         """
         self._runbook_path = runbook_path
         runbook = parse_runbook(runbook_path)
-        return self._create_plan(runbook)
+        if self._plan_cache is None:
+            return self._create_plan(runbook)
+        return self._plan_with_cache(runbook, runbook_path, self._plan_cache)
 
     def plan_from_dict(self, data: dict[str, Any]) -> ExecutionPlan:
         """Plan execution from a runbook dictionary.
@@ -171,6 +221,42 @@ class Planner:
         runbook = parse_runbook_from_dict(data)
         return self._create_plan(runbook)
 
+    def _plan_with_cache(
+        self, runbook: Runbook, runbook_path: Path, plan_cache: PlanCache
+    ) -> ExecutionPlan:
+        """Reuse the cached plan for these runbook files, or plan and cache it.
+
+        The key covers the parsed root and child runbooks and the installed
+        components, so any edit (or changed environment variable) replans.
+
+        Args:
+            runbook: Parsed root runbook.
+            runbook_path: Path to the root runbook file.
+            plan_cache: Cache to read from and write to.
+
+        Returns:
+            Validated, immutable ExecutionPlan.
+
+        """
+        children = self._flattener.prefetch(runbook, runbook_path)
+        key = PlanCache.compute_key(
+            runbook, children, self._registry.entry_point_references()
+        )
+
+        cached = plan_cache.load(key)
+        if cached is not None:
+            try:
+                plan = ExecutionPlan.from_dict(cached)
+            except Exception as e:
+                logger.debug("Ignoring unreadable cached plan %s: %s", key, e)
+            else:
+                logger.info("Reusing cached execution plan for %s", runbook_path)
+                return plan
+
+        plan = self._create_plan(runbook)
+        plan_cache.save(key, plan.to_dict())
+        return plan
+
     def _create_plan(self, runbook: Runbook) -> ExecutionPlan:
         """Create an execution plan from a parsed runbook.
 
@@ -224,11 +310,19 @@ class Planner:
 
         Raises:
             MissingArtifactError: If a referenced artifact doesn't exist.
+            UndeclaredResourcePoolError: If an artifact names a resource pool
+                that ``config.resource_pools`` does not declare.
 
         """
         artifact_ids = set(runbook.artifacts.keys())
 
         for artifact_id, definition in runbook.artifacts.items():
+            pool = definition.resource_pool
+            if pool is not None and pool not in runbook.config.resource_pools:
+                raise UndeclaredResourcePoolError(
+                    f"Artifact '{artifact_id}' uses resource pool '{pool}', "
+                    f"which is not declared in config.resource_pools"
+                )
             if definition.inputs is not None:
                 # Normalise inputs to a list
                 inputs = (
@@ -0,0 +1,225 @@
+"""Run retention: decide which stored runs to keep and delete the rest.
+
+Every ``wct run`` leaves a run directory behind (artifacts, LLM cache,
+batch jobs, prepared state). ``RetentionPolicy`` describes which runs are
+worth keeping; ``plan_retention`` applies it to the runs in a store and
+``apply_retention`` deletes the others and collects shared data (such as
+content-addressed blobs) that only they referenced.
+
+A run is kept if any of these hold:
+- it is among the ``keep_last`` most recently started runs
+- it started less than ``max_age`` ago
+- it is still running (unless ``keep_running`` is disabled)
+- it is listed as protected, e.g. because a runbook reuses its artifacts
+- a kept run reuses its artifacts (``ReuseConfig.from_run`` in its plan)
+
+Runs without readable metadata cannot be listed or resumed and are deleted.
+"""
+
+from __future__ import annotations
+
+import logging
+from collections.abc import Iterable, Mapping
+from dataclasses import dataclass, field
+from datetime import UTC, datetime, timedelta
+from pathlib import Path
+
+from pydantic import ValidationError
+from waivern_artifact_store.base import ArtifactStore
+from waivern_artifact_store.errors import ArtifactStoreError
+from waivern_core import JsonValue
+
+from waivern_orchestration.models import Runbook
+from waivern_orchestration.parser import parse_runbook
+from waivern_orchestration.path_resolver import resolve_child_runbook_path
+from waivern_orchestration.run_metadata import RunMetadata
+
+logger = logging.getLogger(__name__)
+
+
+@dataclass(frozen=True, slots=True)
+class RetentionPolicy:
+    """Which runs to keep when pruning a store.
+
+    At least one of ``keep_last`` and ``max_age`` must be set, so an empty
+    policy never deletes every run.
+    """
+
+    keep_last: int | None = None
+    """Keep this many of the most recently started runs."""
+
+    max_age: timedelta | None = None
+    """Keep runs started less than this long ago."""
+
+    keep_running: bool = True
+    """Keep runs whose status is still 'running' (they may be executing)."""
+
+    def __post_init__(self) -> None:
+        """Validate the policy.
+
+        Raises:
+            ValueError: If no keep rule is set or a value is negative.
+
+        """
+        if self.keep_last is None and self.max_age is None:
+            raise ValueError("Retention policy needs keep_last or max_age")
+        if self.keep_last is not None and self.keep_last < 0:
+            raise ValueError(f"keep_last must not be negative, got {self.keep_last}")
+        if self.max_age is not None and self.max_age < timedelta(0):
+            raise ValueError(f"max_age must not be negative, got {self.max_age}")
+
+
+@dataclass(slots=True)
+class RetentionPlan:
+    """Outcome of applying a policy to a store, before anything is deleted."""
+
+    keep: dict[str, str] = field(default_factory=dict)
+    """Kept run IDs with the reason each is kept."""
+
+    delete: list[str] = field(default_factory=list)
+    """Run IDs to delete."""
+
+
+@dataclass(frozen=True, slots=True)
+class RetentionResult:
+    """What ``apply_retention`` removed."""
+
+    deleted_runs: list[str]
+    removed_items: int
+    """Shared items (e.g. blobs) collected after deleting runs."""
+
+
+def reused_runs(runbook: Runbook, runbook_path: Path | None = None) -> set[str]:
+    """Return the run IDs a runbook reuses artifacts from.
+
+    Args:
+        runbook: Parsed (or flattened) runbook.
+        runbook_path: File ``runbook`` was parsed from. When given, the child
+            runbooks it composes are followed (transitively), since their
+            reuse sources are needed the next time it runs.
+
+    Returns:
+        ``from_run`` of every artifact with a ``reuse`` configuration.
+
+    Raises:
+        OrchestrationError: If a child runbook cannot be found or parsed, so
+            its reuse sources would go unprotected.
+
+    """
+    template_paths = runbook.config.template_paths
+    runs: set[str] = set()
+    visited: set[Path] = set()
+    to_visit: list[tuple[Runbook, Path | None]] = [(runbook, runbook_path)]
+    while to_visit:
+        current, current_path = to_visit.pop()
+        for definition in current.artifacts.values():
+            if definition.reuse is not None:
+                runs.add(definition.reuse.from_run)
+            if definition.child_runbook is None or current_path is None:
+                continue
+            child_path = resolve_child_runbook_path(
+                definition.child_runbook.path, current_path, template_paths
+            ).resolve()
+            if child_path not in visited:
+                visited.add(child_path)
+                to_visit.append((parse_runbook(child_path), child_path))
+    return runs
+
+
+async def plan_retention(
+    store: ArtifactStore,
+    policy: RetentionPolicy,
+    *,
+    protected_runs: Iterable[str] = (),
+    now: datetime | None = None,
+) -> RetentionPlan:
+    """Decide which runs in a store to keep.
+
+    Args:
+        store: Store holding the runs.
+        policy: Keep rules to apply.
+        protected_runs: Run IDs that must be kept (e.g. reuse sources of
+            runbooks that will run again).
+        now: Reference time for ``max_age`` (defaults to the current time).
+
+    Returns:
+        Plan naming the runs to keep (with reasons) and to delete.
+
+    """
+    now = now or datetime.now(UTC)
+    all_runs = await store.list_runs()
+    metadata = _parse_metadata(await store.list_run_metadata())
+
+    plan = RetentionPlan()
+    by_recency = sorted(metadata.values(), key=lambda m: m.started_at, reverse=True)
+    if policy.keep_last is not None:
+        for run in by_recency[: policy.keep_last]:
+            plan.keep.setdefault(run.run_id, "recent")
+    for run in by_recency:
+        if policy.max_age is not None and now - run.started_at < policy.max_age:
+            plan.keep.setdefault(run.run_id, "within max age")
+        if policy.keep_running and run.status == "running":
+            plan.keep.setdefault(run.run_id, "running")
+    for run_id in protected_runs:
+        if run_id in all_runs:
+            plan.keep.setdefault(run_id, "protected")
+
+    await _keep_reuse_sources(store, plan, metadata.keys())
+
+    plan.delete = [run_id for run_id in all_runs if run_id not in plan.keep]
+    return plan
+
+
+async def apply_retention(store: ArtifactStore, plan: RetentionPlan) -> RetentionResult:
+    """Delete the runs a plan marks for deletion, then collect garbage.
+
+    Args:
+        store: Store holding the runs.
+        plan: Plan from ``plan_retention``.
+
+    Returns:
+        Deleted run IDs and the number of shared items collected.
+
+    """
+    for run_id in plan.delete:
+        logger.debug("Deleting run %s", run_id)
+        await store.delete_run(run_id)
+    removed = await store.collect_garbage()
+    return RetentionResult(deleted_runs=list(plan.delete), removed_items=removed)
+
+
+def _parse_metadata(
+    raw: Mapping[str, Mapping[str, JsonValue]],
+) -> dict[str, RunMetadata]:
+    """Validate stored metadata, dropping runs whose metadata is invalid."""
+    metadata: dict[str, RunMetadata] = {}
+    for run_id, data in raw.items():
+        try:
+            metadata[run_id] = RunMetadata.model_validate(data)
+        except ValidationError:
+            logger.debug("Ignoring run %s - invalid metadata", run_id)
+    return metadata
+
+
+async def _keep_reuse_sources(
+    store: ArtifactStore, plan: RetentionPlan, known_runs: Iterable[str]
+) -> None:
+    """Keep runs that kept runs reuse artifacts from (transitively)."""
+    known = set(known_runs)
+    to_visit = list(plan.keep)
+    while to_visit:
+        run_id = to_visit.pop()
+        for source in await _plan_reuse_sources(store, run_id):
+            if source in known and source not in plan.keep:
+                plan.keep[source] = f"reused by {run_id}"
+                to_visit.append(source)
+
+
+async def _plan_reuse_sources(store: ArtifactStore, run_id: str) -> set[str]:
+    """Return the runs a stored run's plan reuses artifacts from."""
+    try:
+        plan_data = await store.load_system_data(run_id, "plan")
+        runbook = Runbook.model_validate(plan_data["runbook"])
+    except (ArtifactStoreError, KeyError, ValidationError):
+        return set()
+    return reused_runs(runbook)
@@ -30,7 +30,7 @@ class RunContext:
     Each field has different update frequencies:
     - metadata: 2-3 times per run (start, end)
     - state: after every artifact transition
-    - plan: once at run start (never updated)
+    - plan: once at run start (replaced only by a stale-aware resume)
     """
 
     metadata: RunMetadata
@@ -63,6 +63,7 @@ class RunContext:
             runbook_path=runbook_path or Path(""),
         )
         state = ExecutionState.fresh(run_id=run_id, artifact_ids=artifact_ids)
+        state.fingerprints = plan.artifact_fingerprints()
 
         return cls(metadata=metadata, state=state, plan=plan)
 
@@ -142,7 +143,8 @@ class RunContext:
     async def save_plan(self, store: ArtifactStore) -> None:
         """Persist plan only.
 
-        Called once at run start. The plan is never updated after that.
+        Called at run start, and again when a resume adopts a replanned
+        runbook (``rerun_stale``).
 
         Args:
             store: The artifact store to save to.
@@ -7,6 +7,7 @@ capability.
 
 from __future__ import annotations
 
+from collections.abc import Mapping, Sequence
 from datetime import UTC, datetime
 from typing import Self
 
@@ -28,6 +29,12 @@ class ExecutionState(BaseModel):
     - not_started → {pending, completed, failed, skipped}
     - pending → {completed, failed, skipped}
     - completed, failed, skipped → terminal (no outgoing transitions)
+
+    The exceptions are ``invalidate`` and ``adopt_plan``, which return
+    terminal artifacts to not_started when their inputs or definitions have
+    changed (``wct run --watch``, ``wct run --resume --rerun-stale``).
+    ``adopt_plan`` also returns pending artifacts whose definitions changed
+    to not_started, abandoning their in-flight batches.
     """
 
     run_id: str
@@ -51,6 +58,22 @@ class ExecutionState(BaseModel):
     last_checkpoint: datetime = Field(default_factory=lambda: datetime.now(UTC))
     """Last state save timestamp (UTC)."""
 
+    fingerprints: dict[str, str] = Field(default_factory=dict)
+    """Artifact ID -> fingerprint of its definition in the run's plan.
+
+    Empty for runs persisted before fingerprints were recorded.
+    """
+
+    planned_fingerprints: dict[str, str] = Field(default_factory=dict)
+    """Artifact ID -> fingerprint in an adopted plan, not yet executed.
+
+    Moved to ``fingerprints`` when the artifact completes, so an artifact
+    that never ran under its new definition is still found stale.
+    """
+
+    pending_batches: dict[str, list[str]] = Field(default_factory=dict)
+    """Pending artifact ID -> IDs of the batch jobs its results are owed by."""
+
     @classmethod
     def fresh(cls, run_id: str, artifact_ids: set[str]) -> Self:
         """Create initial state with all artifacts in not_started.
@@ -85,18 +108,23 @@ class ExecutionState(BaseModel):
             self.not_started.discard(artifact_id)
         elif artifact_id in self.pending:
             self.pending.discard(artifact_id)
+            self.pending_batches.pop(artifact_id, None)
         else:
             return
         self.completed.add(artifact_id)
+        fingerprint = self.planned_fingerprints.pop(artifact_id, None)
+        if fingerprint is not None:
+            self.fingerprints[artifact_id] = fingerprint
         self.last_checkpoint = datetime.now(UTC)
 
-    def mark_pending(self, artifact_id: str) -> None:
+    def mark_pending(self, artifact_id: str, batch_ids: Sequence[str] = ()) -> None:
         """Move artifact from not_started to pending.
 
         No-op if artifact is not in not_started (idempotent, no pollution).
 
         Args:
             artifact_id: The artifact ID to mark as pending.
+            batch_ids: Batch jobs the artifact's results are owed by, if known.
 
         """
         if artifact_id in self.not_started:
@@ -104,6 +132,8 @@ class ExecutionState(BaseModel):
         else:
             return
         self.pending.add(artifact_id)
+        if batch_ids:
+            self.pending_batches[artifact_id] = list(batch_ids)
         self.last_checkpoint = datetime.now(UTC)
 
     def mark_failed(self, artifact_id: str) -> None:
@@ -119,6 +149,7 @@ class ExecutionState(BaseModel):
             self.not_started.discard(artifact_id)
         elif artifact_id in self.pending:
             self.pending.discard(artifact_id)
+            self.pending_batches.pop(artifact_id, None)
         else:
             return
         self.failed.add(artifact_id)
@@ -140,10 +171,115 @@ class ExecutionState(BaseModel):
         to_skip = from_not_started | from_pending
         self.not_started -= from_not_started
         self.pending -= from_pending
+        for artifact_id in from_pending:
+            self.pending_batches.pop(artifact_id, None)
         self.skipped |= to_skip
         if to_skip:
             self.last_checkpoint = datetime.now(UTC)
 
+    def invalidate(self, artifact_ids: set[str]) -> None:
+        """Move artifacts in a terminal state back to not_started.
+
+        Used to re-execute artifacts whose inputs changed while reusing the
+        rest of the run. Pending artifacts are left alone: their results
+        are still owed by an in-flight batch.
+
+        Args:
+            artifact_ids: Set of artifact IDs to re-execute.
+
+        """
+        to_reset = artifact_ids & (self.completed | self.failed | self.skipped)
+        self.completed -= to_reset
+        self.failed -= to_reset
+        self.skipped -= to_reset
+        self.not_started |= to_reset
+        if to_reset:
+            self.last_checkpoint = datetime.now(UTC)
+
+    def stale_artifacts(self, fingerprints: Mapping[str, str]) -> set[str]:
+        """Find artifacts whose definition differs from the one recorded.
+
+        Artifacts without a recorded fingerprint (new to the plan, or from a
+        run persisted before fingerprints were recorded) count as stale.
+
+        Args:
+            fingerprints: Fingerprints of the artifacts in a new plan.
+
+        Returns:
+            Set of artifact IDs from ``fingerprints`` that are stale.
+
+        """
+        return {
+            artifact_id
+            for artifact_id, fingerprint in fingerprints.items()
+            if self.fingerprints.get(artifact_id) != fingerprint
+        }
+
+    def adopt_plan(
+        self, fingerprints: Mapping[str, str], stale: set[str]
+    ) -> tuple[set[str], set[str]]:
+        """Switch to tracking the artifacts of a new plan for the same run.
+
+        Artifacts no longer in the plan are dropped, new ones start in
+        not_started, and ``stale`` ones return to not_started (see
+        ``invalidate``), including pending ones: their in-flight results
+        were requested under the old definition. The fingerprints of
+        artifacts that are neither new nor stale are recorded now, those of
+        the others when they complete.
+
+        Args:
+            fingerprints: Fingerprints of the artifacts in the new plan.
+            stale: Artifact IDs to re-execute, including downstream ones.
+
+        Returns:
+            The pending artifacts that were abandoned (their prepared state
+            is obsolete), and the batch jobs no remaining pending artifact
+            is owed results by.
+
+        """
+        artifact_ids = set(fingerprints)
+        for tracked in (
+            self.completed,
+            self.not_started,
+            self.pending,
+            self.failed,
+            self.skipped,
+        ):
+            tracked.intersection_update(artifact_ids)
+        known = (
+            self.completed
+            | self.not_started
+            | self.pending
+            | self.failed
+            | self.skipped
+        )
+        added = artifact_ids - known
+        self.not_started |= added
+
+        abandoned = stale & self.pending
+        self.pending -= abandoned
+        self.not_started |= abandoned
+        batches = {
+            artifact_id: self.pending_batches.pop(artifact_id)
+            for artifact_id in set(self.pending_batches)
+            if artifact_id not in self.pending
+        }
+        owed = {batch_id for ids in self.pending_batches.values() for batch_id in ids}
+        orphaned = {batch_id for ids in batches.values() for batch_id in ids} - owed
+
+        self.invalidate(stale)
+        unexecuted = (stale & artifact_ids) | added
+        self.fingerprints = {
+            artifact_id: fingerprint
+            for artifact_id, fingerprint in fingerprints.items()
+            if artifact_id not in unexecuted
+        }
+        self.planned_fingerprints = {
+            artifact_id: fingerprints[artifact_id] for artifact_id in unexecuted
+        }
+        self.last_checkpoint = datetime.now(UTC)
+        return abandoned, orphaned
+
     def remaining_actionable(self, all_artifact_ids: set[str]) -> set[str]:
         """Compute artifact IDs that are not in any terminal or pending state.
 
@@ -1,6 +1,6 @@
 """Shared utilities for waivern-orchestration."""
 
-import uuid
+import hashlib
 
 from waivern_core.schemas import Schema
 
@@ -44,28 +44,37 @@ def parse_schema_string(schema_str: str) -> Schema:
 NAMESPACE_SEPARATOR = "__"
 """Separator used in namespaced artifact IDs.
 
-Namespaced IDs follow the format: {runbook_name}__{uuid}__{artifact_id}
+Namespaced IDs follow the format: {runbook_name}__{hash}__{artifact_id}
 Example: my_child__abc12345__data
 """
 
 
-def generate_namespace(runbook_name: str) -> str:
-    """Generate a unique namespace for child runbook artifacts.
+def generate_namespace(
+    runbook_name: str, parent_artifact_id: str, child_path: str
+) -> str:
+    """Generate a namespace for child runbook artifacts.
 
-    The namespace combines a sanitised runbook name with a short UUID
-    to ensure uniqueness across multiple invocations of the same child.
+    The namespace combines a sanitised runbook name with a short hash of
+    the invoking artifact and the child path. Artifact IDs are unique at
+    each level (nested invocations pass an already namespaced ID), so
+    every invocation of the same child gets its own namespace, and the
+    same invocation gets the same namespace every time the runbook is
+    planned. Stable IDs let a replanned runbook reuse the artifacts of an
+    earlier run (``--rerun-stale``).
 
     Args:
         runbook_name: Name of the child runbook.
+        parent_artifact_id: ID of the artifact with the child_runbook directive.
+        child_path: Child runbook path as written in the directive.
 
     Returns:
-        Unique namespace string (e.g., "my_child__abc12345").
+        Namespace string (e.g., "my_child__abc12345").
 
     """
-    short_uuid = str(uuid.uuid4())[:8]
+    digest = hashlib.sha256(f"{parent_artifact_id}\0{child_path}".encode()).hexdigest()
     # Clean runbook name for use in identifier
     clean_name = runbook_name.replace(" ", "_").replace("-", "_").lower()
-    return f"{clean_name}{NAMESPACE_SEPARATOR}{short_uuid}"
+    return f"{clean_name}{NAMESPACE_SEPARATOR}{digest[:8]}"
 
 
 def create_namespaced_id(namespace: str, artifact_id: str) -> str:
@@ -103,7 +112,7 @@ def parse_namespaced_id(artifact_id: str) -> tuple[str | None, str]:
         return None, artifact_id
 
     parts = artifact_id.split(NAMESPACE_SEPARATOR)
-    # Format is: {runbook_name}__{uuid}__{artifact_id}
+    # Format is: {runbook_name}__{hash}__{artifact_id}
     # So parts[0] is runbook_name, parts[-1] is artifact_id
     return parts[0], parts[-1]
 
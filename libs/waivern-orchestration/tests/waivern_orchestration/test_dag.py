@@ -65,6 +65,22 @@ class TestExecutionDAGDependencies:
 
         assert dag.get_dependents("A") == {"B", "C"}
 
+    def test_dag_downstream_is_transitive(self) -> None:
+        """A → B → C and D → C: downstream of A is {B, C}, excluding D."""
+        artifacts = {
+            "A": ArtifactDefinition(source=SourceConfig(type="filesystem")),
+            "B": ArtifactDefinition(inputs="A", process=ProcessConfig(type="analyser")),
+            "D": ArtifactDefinition(source=SourceConfig(type="mysql")),
+            "C": ArtifactDefinition(
+                inputs=["B", "D"], process=ProcessConfig(type="merger")
+            ),
+        }
+
+        dag = ExecutionDAG(artifacts)
+
+        assert dag.get_downstream({"A"}) == {"B", "C"}
+        assert dag.get_downstream({"C"}) == set()
+
 
 class TestExecutionDAGExecutionOrder:
     """Tests for topological execution order."""
@@ -0,0 +1,111 @@
+"""Tests for DispatchCoalescer request batching."""
+
+import asyncio
+from collections.abc import Sequence
+
+from waivern_core.dispatch import DispatchRequest, DispatchResult
+
+from waivern_orchestration.dispatch_coalescer import DispatchCoalescer
+
+# =============================================================================
+# Helpers
+# =============================================================================
+
+
+class RecordingDispatch:
+    """Dispatch function that records each batch and echoes results."""
+
+    def __init__(self, error: Exception | None = None) -> None:
+        self.batches: list[list[str]] = []
+        self._error = error
+
+    async def __call__(
+        self, request_type: type[DispatchRequest], requests: list[DispatchRequest]
+    ) -> Sequence[DispatchResult]:
+        self.batches.append([r.name for r in requests])
+        if self._error is not None:
+            raise self._error
+        return [DispatchResult(request_id=r.request_id, name=r.name) for r in requests]
+
+
+async def _participate(
+    coalescer: DispatchCoalescer, name: str, *, delay: float = 0
+) -> list[str | None]:
+    """Submit one request after ``delay`` and return the result names."""
+    try:
+        await asyncio.sleep(delay)
+        results = await coalescer.submit([DispatchRequest(name=name)])
+        return [r.name for r in results]
+    finally:
+        coalescer.leave()
+
+
+# =============================================================================
+# Batching
+# =============================================================================
+
+
+class TestDispatchCoalescer:
+    """Tests for when batches are dispatched and how results are routed."""
+
+    async def test_requests_submitted_together_share_one_batch(self) -> None:
+        dispatch = RecordingDispatch()
+        coalescer = DispatchCoalescer(dispatch, window=10)
+        for _ in range(3):
+            coalescer.join()
+
+        results = await asyncio.wait_for(
+            asyncio.gather(*(_participate(coalescer, n) for n in "abc")), timeout=2
+        )
+
+        # All participants waiting → dispatched without waiting for the window
+        assert dispatch.batches == [["a", "b", "c"]]
+        assert results == [["a"], ["b"], ["c"]]
+
+    async def test_window_dispatches_without_waiting_for_slow_participant(
+        self,
+    ) -> None:
+        dispatch = RecordingDispatch()
+        coalescer = DispatchCoalescer(dispatch, window=0.01)
+        coalescer.join()
+        coalescer.join()
+
+        await asyncio.gather(
+            _participate(coalescer, "fast"), _participate(coalescer, "slow", delay=0.2)
+        )
+
+        assert dispatch.batches == [["fast"], ["slow"]]
+
+    async def test_full_batch_is_dispatched_immediately(self) -> None:
+        dispatch = RecordingDispatch()
+        coalescer = DispatchCoalescer(dispatch, window=10, max_requests=2)
+        for _ in range(3):
+            coalescer.join()
+
+        await asyncio.wait_for(
+            asyncio.gather(
+                _participate(coalescer, "a"),
+                _participate(coalescer, "b"),
+                _participate(coalescer, "c", delay=0.05),
+            ),
+            timeout=2,
+        )
+
+        assert dispatch.batches == [["a", "b"], ["c"]]
+
+    async def test_dispatch_error_is_raised_to_every_participant(self) -> None:
+        dispatch = RecordingDispatch(error=RuntimeError("provider down"))
+        coalescer = DispatchCoalescer(dispatch, window=10)
+        coalescer.join()
+        coalescer.join()
+
+        outcomes = await asyncio.gather(
+            _participate(coalescer, "a"),
+            _participate(coalescer, "b"),
+            return_exceptions=True,
+        )
+
+        assert len(dispatch.batches) == 1
+        for outcome in outcomes:
+            assert isinstance(outcome, RuntimeError)
+            assert str(outcome) == "provider down"
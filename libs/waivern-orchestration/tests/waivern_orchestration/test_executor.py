@@ -5,22 +5,25 @@ For child runbook handling tests, see test_executor_child_runbooks.py.
 """
 
 import asyncio
+from pathlib import Path
 from typing import Any
 from unittest.mock import MagicMock
 
 from waivern_artifact_store import ArtifactStore
 from waivern_core import Message
-from waivern_core.schemas import Schema
+from waivern_core.schemas import Schema, SchemaRegistry
 
-from waivern_orchestration.executor import DAGExecutor
+from waivern_orchestration.executor import DAGExecutor, _TypedContents
 from waivern_orchestration.models import (
     ArtifactDefinition,
     ProcessConfig,
     SourceConfig,
 )
+from waivern_orchestration.state import ExecutionState
 
 from .test_helpers import (
     create_mock_connector_factory,
+    create_mock_processor_factory,
     create_mock_registry,
     create_simple_plan,
     create_test_message,
@@ -475,6 +478,147 @@ class TestDAGExecutorProcess:
         assert "nonexistent_processor" in (processed_msg.execution_error or "")
 
 
+class TestDAGExecutorTypedContent:
+    """Tests for carrying producers' typed models to downstream processors."""
+
+    def _run_chain(self, findings_message: Message) -> MagicMock:
+        """Run source -> findings -> summary and return the summary's processor."""
+        source_schema = Schema("standard_input", "1.0.0")
+        findings_schema = Schema("personal_data_finding", "1.0.0")
+        summary_schema = Schema("summary", "1.0.0")
+
+        connector_factory = create_mock_connector_factory(
+            "filesystem", [source_schema], create_test_message({"files": []})
+        )
+        analyser_factory = create_mock_processor_factory(
+            "analyser", [source_schema], [findings_schema], (findings_message, [])
+        )
+        summary = create_test_message({"summary": {}}, summary_schema)
+        summariser_factory = create_mock_processor_factory(
+            "summariser", [findings_schema], [summary_schema], (summary, [])
+        )
+
+        artifacts = {
+            "source": ArtifactDefinition(
+                source=SourceConfig(type="filesystem", properties={})
+            ),
+            "findings": ArtifactDefinition(
+                inputs="source", process=ProcessConfig(type="analyser", properties={})
+            ),
+            "summary": ArtifactDefinition(
+                inputs="findings",
+                process=ProcessConfig(type="summariser", properties={}),
+            ),
+        }
+        plan = create_simple_plan(
+            artifacts,
+            {
+                "source": (None, source_schema),
+                "findings": ([source_schema], findings_schema),
+                "summary": ([findings_schema], summary_schema),
+            },
+        )
+        registry = create_mock_registry(
+            with_container=True,
+            connector_factories={"filesystem": connector_factory},
+            processor_factories={
+                "analyser": analyser_factory,
+                "summariser": summariser_factory,
+            },
+        )
+
+        result = asyncio.run(DAGExecutor(registry).execute(plan))
+
+        assert result.completed == {"source", "findings", "summary"}
+        return summariser_factory.create.return_value
+
+    def test_downstream_processor_receives_typed_model_under_boundary_policy(
+        self, tmp_path: Path
+    ) -> None:
+        """An input produced in this run comes with its producer's typed model."""
+        SchemaRegistry.set_validation_policy("boundary")
+        # Connector output is validated at the boundary, so it needs a schema
+        schema_dir = tmp_path / "standard_input" / "1.0.0"
+        schema_dir.mkdir(parents=True)
+        (schema_dir / "standard_input.json").write_text('{"type": "object"}')
+        SchemaRegistry.register_search_path(tmp_path)
+        model = object()
+        findings = Message(
+            id="findings",
+            content={"findings": []},
+            schema=Schema("personal_data_finding", "1.0.0"),
+            typed_content=model,
+        )
+
+        summariser = self._run_chain(findings)
+
+        inputs = summariser.process.call_args.args[0]
+        assert inputs[0].typed_content is model
+
+    def test_downstream_processor_receives_no_typed_model_under_full_policy(
+        self,
+    ) -> None:
+        """Under the full policy inputs are loaded as stored, without a model."""
+        SchemaRegistry.set_validation_policy("full")
+        findings = Message(
+            id="findings",
+            content={"findings": []},
+            schema=Schema("personal_data_finding", "1.0.0"),
+            typed_content=object(),
+        )
+
+        summariser = self._run_chain(findings)
+
+        inputs = summariser.process.call_args.args[0]
+        assert inputs[0].typed_content is None
+
+
+class TestTypedContents:
+    """Tests for releasing typed models once their dependents have loaded them."""
+
+    @staticmethod
+    def _typed_contents() -> _TypedContents:
+        """Typed models for a run where left and right both read source."""
+        source = ArtifactDefinition(source=SourceConfig(type="filesystem"))
+        artifacts = {
+            "source": source,
+            "findings": source,
+            "left": ArtifactDefinition(inputs="source"),
+            "right": ArtifactDefinition(inputs="source"),
+        }
+        plan = create_simple_plan(artifacts)
+        state = ExecutionState.fresh("run-1", set(artifacts))
+        return _TypedContents.for_plan(plan, state)
+
+    def test_model_without_dependents_is_not_kept(self) -> None:
+        typed_contents = self._typed_contents()
+
+        typed_contents.remember("findings", object())
+
+        assert "findings" not in typed_contents
+
+    def test_model_is_released_after_last_dependent_loads_it(self) -> None:
+        typed_contents = self._typed_contents()
+        model = object()
+        typed_contents.remember("source", model)
+
+        assert typed_contents.take("source") is model
+        assert "source" in typed_contents
+        assert typed_contents.take("source") is model
+        assert "source" not in typed_contents
+
+    def test_completed_dependents_do_not_hold_models(self) -> None:
+        source = ArtifactDefinition(source=SourceConfig(type="filesystem"))
+        artifacts = {"source": source, "left": ArtifactDefinition(inputs="source")}
+        state = ExecutionState.fresh("run-1", set(artifacts))
+        state.mark_completed("left")
+        typed_contents = _TypedContents.for_plan(create_simple_plan(artifacts), state)
+
+        typed_contents.remember("source", object())
+
+        assert "source" not in typed_contents
+
+
 # =============================================================================
 # Artifact Metadata (run_id, source, extensions)
 # =============================================================================
@@ -3,7 +3,7 @@
 After the Distributed Processor Protocol migration, PendingProcessingError is no
 longer special-cased on the regular (non-distributed) path. Regular processors are
 synchronous — any exception is treated as failure. The distributed path handles
-batch pending via PendingBatchError in _dispatch_all.
+batch pending via PendingBatchError in _run_distributed.
 """
 
 from waivern_core.errors import PendingProcessingError
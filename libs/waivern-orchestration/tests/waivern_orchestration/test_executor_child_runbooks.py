@@ -156,7 +156,7 @@ class TestExecutorOriginTracking:
     """Tests for origin tracking in artifact results.
 
     When child runbooks are flattened, their artifacts are namespaced with
-    the format: {runbook_name}__{uuid}__{artifact_id}
+    the format: {runbook_name}__{hash}__{artifact_id}
 
     The executor should:
     - Set origin='parent' for regular artifacts (no __ in ID)
@@ -7,6 +7,8 @@ Verifies end-to-end through execute() that the executor correctly:
 - Resumes pending artifacts from interrupted runs
 """
 
+import time
+from collections.abc import Sequence
 from pathlib import Path
 from typing import override
 
@@ -298,6 +300,88 @@ class TestDistributedDispatch:
         dispatched_requests = dispatcher.dispatch.call_args[0][0]
         assert len(dispatched_requests) == 2
 
+    async def test_slow_sibling_does_not_delay_dispatch(self) -> None:
+        """An artifact dispatches once prepared, not when its siblings are.
+
+        Arrange: two distributed processors at the same level; b's
+        prepare() takes far longer than the coalescing window.
+        Assert: a's request is dispatched on its own, before b's.
+        """
+        source_schema = Schema("standard_input", "1.0.0")
+        output_schema = Schema("findings", "1.0.0")
+        source_message = create_test_message({"files": []})
+        final_message = create_test_message(
+            {"findings": ["done"]}, schema=output_schema
+        )
+
+        req_a = DispatchRequest(name="req_a")
+        req_b = DispatchRequest(name="req_b")
+
+        class SlowPrepareProcessor(StubDistributedProcessor):
+            def prepare(self, inputs, output_schema):  # type: ignore[override]
+                time.sleep(0.3)
+                return super().prepare(inputs, output_schema)
+
+        proc_a = StubDistributedProcessor(
+            prepare_result=PrepareResult(state=StubState(), requests=[req_a]),
+            finalise_results=[(final_message, [])],
+        )
+        proc_b = SlowPrepareProcessor(
+            prepare_result=PrepareResult(state=StubState(), requests=[req_b]),
+            finalise_results=[(final_message, [])],
+        )
+
+        dispatched: list[list[str]] = []
+
+        async def dispatch(requests: Sequence[DispatchRequest]) -> list[DispatchResult]:
+            dispatched.append([r.name for r in requests])
+            return [DispatchResult(request_id=r.request_id) for r in requests]
+
+        dispatcher = create_mock_dispatcher([])
+        dispatcher.dispatch.side_effect = dispatch
+
+        artifacts = {
+            "source": ArtifactDefinition(
+                source=SourceConfig(type="src", properties={})
+            ),
+            "a": ArtifactDefinition(
+                inputs="source",
+                process=ProcessConfig(type="proc_a", properties={}),
+            ),
+            "b": ArtifactDefinition(
+                inputs="source",
+                process=ProcessConfig(type="proc_b", properties={}),
+            ),
+        }
+        plan = create_simple_plan(
+            artifacts,
+            {
+                "source": (None, source_schema),
+                "a": ([source_schema], output_schema),
+                "b": ([source_schema], output_schema),
+            },
+        )
+
+        registry = create_mock_registry(
+            with_container=True,
+            connector_factories={
+                "src": create_mock_connector_factory(
+                    "src", [source_schema], source_message
+                )
+            },
+            processor_factories={
+                "proc_a": create_distributed_processor_factory("proc_a", proc_a),
+                "proc_b": create_distributed_processor_factory("proc_b", proc_b),
+            },
+        )
+        registry.get_dispatcher_for.return_value = dispatcher
+        executor = DAGExecutor(registry)
+
+        exec_result = await executor.execute(plan)
+
+        assert {"source", "a", "b"} == exec_result.completed
+        assert dispatched == [["req_a"], ["req_b"]]
+
     async def test_results_routed_back_to_correct_artifacts(self) -> None:
         """Dispatch results are routed to the correct artifact via request_id.
 
@@ -4,14 +4,16 @@ import asyncio
 import threading
 import time
 from typing import Any
-from unittest.mock import MagicMock
+from unittest.mock import MagicMock, patch
 
 from waivern_artifact_store.base import ArtifactStore
 from waivern_artifact_store.in_memory import AsyncInMemoryStore
+from waivern_core.metrics import MetricsRegistry
 from waivern_core.schemas import Schema
 from waivern_core.services import ComponentRegistry, ServiceContainer, ServiceDescriptor
 
 from waivern_orchestration.executor import DAGExecutor
+from waivern_orchestration.memory import MemoryProfile
 from waivern_orchestration.models import (
     ArtifactDefinition,
     RunbookConfig,
@@ -102,6 +104,158 @@ class TestDAGExecutorConcurrency:
             f"Expected max 2 concurrent, but observed {max_concurrent_observed}"
         )
 
+    def test_memory_budget_queues_artifacts_that_do_not_fit(self) -> None:
+        """Artifacts estimated to fill the memory budget run one at a time."""
+        current_concurrent = 0
+        max_concurrent_observed = 0
+        lock = threading.Lock()
+
+        output_schema = Schema("standard_input", "1.0.0")
+        message = create_test_message({"files": []})
+
+        def tracking_extract(*args: Any, **kwargs: Any) -> Any:
+            nonlocal current_concurrent, max_concurrent_observed
+            with lock:
+                current_concurrent += 1
+                max_concurrent_observed = max(
+                    max_concurrent_observed, current_concurrent
+                )
+            time.sleep(0.01)
+            with lock:
+                current_concurrent -= 1
+            return message
+
+        connector_factory = create_mock_connector_factory(
+            "source", [output_schema], message
+        )
+        connector_factory.create.return_value.extract.side_effect = tracking_extract
+
+        artifacts = {
+            f"data_{i}": ArtifactDefinition(
+                source=SourceConfig(type="source", properties={})
+            )
+            for i in range(3)
+        }
+        plan = create_simple_plan(
+            artifacts,
+            {f"data_{i}": (None, output_schema) for i in range(3)},
+            runbook_config=RunbookConfig(max_concurrency=3, memory_budget=64),
+        )
+
+        # Previously observed to need the whole budget
+        profile = MemoryProfile()
+        profile.record("connector:source", 64 * 1024 * 1024, None)
+
+        registry = create_mock_registry(
+            with_container=True, connector_factories={"source": connector_factory}
+        )
+        executor = DAGExecutor(registry, memory_profile=profile)
+
+        result = asyncio.run(executor.execute(plan))
+
+        assert len(result.completed) == 3
+        assert max_concurrent_observed == 1
+
+
+# =============================================================================
+# Resource Pools
+# =============================================================================
+
+
+class TestDAGExecutorResourcePools:
+    """Tests for per-resource-class concurrency pools."""
+
+    def test_busy_pool_does_not_block_other_work(self) -> None:
+        """Artifacts in a full pool do not hold the shared slots."""
+        output_schema = Schema("standard_input", "1.0.0")
+        message = create_test_message({"files": []})
+        cpu_done = threading.Event()
+        db_saw_cpu_done: list[bool] = []
+
+        def db_extract(*args: Any, **kwargs: Any) -> Any:
+            # Finishes only once the shared-pool artifact has run alongside
+            db_saw_cpu_done.append(cpu_done.wait(timeout=2))
+            return message
+
+        def cpu_extract(*args: Any, **kwargs: Any) -> Any:
+            cpu_done.set()
+            return message
+
+        db_factory = create_mock_connector_factory("db", [output_schema], message)
+        db_factory.component_class.get_resource_pool.return_value = "db_io"
+        db_factory.create.return_value.extract.side_effect = db_extract
+        cpu_factory = create_mock_connector_factory("cpu", [output_schema], message)
+        cpu_factory.component_class.get_resource_pool.return_value = None
+        cpu_factory.create.return_value.extract.side_effect = cpu_extract
+
+        artifacts = {
+            "db_data": ArtifactDefinition(source=SourceConfig(type="db")),
+            "cpu_data": ArtifactDefinition(source=SourceConfig(type="cpu")),
+        }
+        plan = create_simple_plan(
+            artifacts,
+            {aid: (None, output_schema) for aid in artifacts},
+            runbook_config=RunbookConfig(
+                max_concurrency=1, resource_pools={"db_io": 1}
+            ),
+        )
+        registry = create_mock_registry(
+            with_container=True,
+            connector_factories={"db": db_factory, "cpu": cpu_factory},
+        )
+
+        result = asyncio.run(DAGExecutor(registry).execute(plan))
+
+        assert len(result.completed) == 2
+        assert db_saw_cpu_done == [True]
+
+    def test_artifact_resource_pool_overrides_component_default(self) -> None:
+        """Artifacts naming a pool are limited by that pool."""
+        current_concurrent = 0
+        max_concurrent_observed = 0
+        lock = threading.Lock()
+
+        output_schema = Schema("standard_input", "1.0.0")
+        message = create_test_message({"files": []})
+
+        def tracking_extract(*args: Any, **kwargs: Any) -> Any:
+            nonlocal current_concurrent, max_concurrent_observed
+            with lock:
+                current_concurrent += 1
+                max_concurrent_observed = max(
+                    max_concurrent_observed, current_concurrent
+                )
+            time.sleep(0.01)
+            with lock:
+                current_concurrent -= 1
+            return message
+
+        connector_factory = create_mock_connector_factory(
+            "source", [output_schema], message
+        )
+        connector_factory.component_class.get_resource_pool.return_value = None
+        connector_factory.create.return_value.extract.side_effect = tracking_extract
+
+        artifacts = {
+            f"data_{i}": ArtifactDefinition(
+                source=SourceConfig(type="source"), resource_pool="api"
+            )
+            for i in range(3)
+        }
+        plan = create_simple_plan(
+            artifacts,
+            {aid: (None, output_schema) for aid in artifacts},
+            runbook_config=RunbookConfig(max_concurrency=3, resource_pools={"api": 1}),
+        )
+        registry = create_mock_registry(
+            with_container=True, connector_factories={"source": connector_factory}
+        )
+
+        result = asyncio.run(DAGExecutor(registry).execute(plan))
+
+        assert len(result.completed) == 3
+        assert max_concurrent_observed == 1
+
 
 # =============================================================================
 # Observability
@@ -274,6 +428,82 @@ class TestDAGExecutorObservability:
         timestamp = datetime.fromisoformat(result.start_timestamp)
         assert timestamp.tzinfo is not None
 
+    def test_metrics_are_recorded_and_saved_with_the_run(self) -> None:
+        """Outcomes and items are recorded; the run's metrics are stored with it."""
+        output_schema = Schema("standard_input", "1.0.0")
+        message = create_test_message({"data": [1, 2, 3]})
+        connector_factory = create_mock_connector_factory(
+            "filesystem", [output_schema], message
+        )
+        artifacts = {
+            "data": ArtifactDefinition(
+                source=SourceConfig(type="filesystem", properties={})
+            )
+        }
+        plan = create_simple_plan(artifacts, {"data": (None, output_schema)})
+        registry = create_mock_registry(
+            with_container=True, connector_factories={"filesystem": connector_factory}
+        )
+        metrics = MetricsRegistry()
+        metrics.counter("waivern_artifacts_total", "").inc(5, state="completed")
+        executor = DAGExecutor(registry, metrics=metrics)
+
+        result = asyncio.run(executor.execute(plan))
+
+        outcomes = metrics.counter("waivern_artifacts_total", "")
+        assert outcomes.value(state="completed") == 6
+        produced = metrics.counter("waivern_items_produced_total", "")
+        assert produced.value(component="connector:filesystem") == 3
+        in_flight = metrics.gauge("waivern_artifacts_in_flight", "")
+        assert in_flight.value(state="running", pool="default") == 0
+
+        store = registry.container.get_service(ArtifactStore)
+        saved = asyncio.run(store.load_system_data(result.run_id, "metrics"))
+        assert saved["waivern_artifacts_total"] == {
+            "type": "counter",
+            "help": outcomes.documentation,
+            "samples": [{"labels": {"state": "completed"}, "value": 1}],
+        }
+
+    def test_metrics_count_inputs_without_reading_them_twice(self) -> None:
+        """Without a memory budget, input items are counted from the loaded inputs."""
+        store = AsyncInMemoryStore()
+        store_factory = MagicMock()
+        store_factory.create.return_value = store
+        container = ServiceContainer()
+        container.register(ServiceDescriptor(ArtifactStore, store_factory, "singleton"))
+        output_schema = Schema("standard_input", "1.0.0")
+        message = create_test_message({"data": [1, 2, 3]})
+        connector_factory = create_mock_connector_factory(
+            "filesystem", [output_schema], message
+        )
+        artifacts = {
+            "data": ArtifactDefinition(
+                source=SourceConfig(type="filesystem", properties={})
+            ),
+            "copy": ArtifactDefinition(inputs="data"),
+        }
+        plan = create_simple_plan(
+            artifacts,
+            {"data": (None, output_schema), "copy": ([output_schema], output_schema)},
+        )
+        registry = create_mock_registry(
+            connector_factories={"filesystem": connector_factory}
+        )
+        registry.container = container
+        metrics = MetricsRegistry()
+        executor = DAGExecutor(registry, metrics=metrics)
+
+        with patch.object(
+            store, "get_artifact_metadata", wraps=store.get_artifact_metadata
+        ) as get_metadata:
+            result = asyncio.run(executor.execute(plan))
+
+        assert result.completed == {"data", "copy"}
+        get_metadata.assert_not_called()
+        processed = metrics.counter("waivern_items_processed_total", "")
+        assert processed.value(component="unknown") == 3
+
 
 # =============================================================================
 # Timeout Behaviour
@@ -5,6 +5,8 @@ validation and skip logic for completed artifacts.
 """
 
 from pathlib import Path
+from typing import Any
+from unittest.mock import MagicMock
 
 import pytest
 from waivern_artifact_store import ArtifactStore
@@ -884,3 +886,187 @@ class TestInterruptResumeLifecycle:
 
         # validated: regular processor ran on resume
         validator_factory.create.assert_called()
+
+
+# =============================================================================
+# Stale-Aware Resume Tests (rerun_stale)
+# =============================================================================
+
+
+class TestRerunStale:
+    """Tests for resuming a run against a replanned runbook."""
+
+    @staticmethod
+    def _plan(analyser_properties: dict[str, Any]) -> ExecutionPlan:
+        """Plan source → findings → report, and an independent other_data."""
+        schema = Schema("standard_input", "1.0.0")
+        artifacts = {
+            "data": ArtifactDefinition(source=SourceConfig(type="src", properties={})),
+            "other_data": ArtifactDefinition(
+                source=SourceConfig(type="src", properties={"other": True})
+            ),
+            "findings": ArtifactDefinition(
+                inputs="data",
+                process=ProcessConfig(type="analyser", properties=analyser_properties),
+            ),
+            "report": ArtifactDefinition(
+                inputs="findings", process=ProcessConfig(type="analyser")
+            ),
+        }
+        schemas = {
+            "data": (None, schema),
+            "other_data": (None, schema),
+            "findings": ([schema], schema),
+            "report": ([schema], schema),
+        }
+        return create_simple_plan(artifacts, schemas)
+
+    @staticmethod
+    def _registry() -> MagicMock:
+        schema = Schema("standard_input", "1.0.0")
+        message = create_test_message({"files": []})
+        return create_mock_registry(
+            with_container=True,
+            connector_factories={
+                "src": create_mock_connector_factory("src", [schema], message)
+            },
+            processor_factories={
+                "analyser": create_mock_processor_factory(
+                    "analyser", [schema], [schema], (message, [])
+                )
+            },
+        )
+
+    async def test_changed_artifact_and_dependents_rerun(self) -> None:
+        registry = self._registry()
+        executor = DAGExecutor(registry)
+        first = await executor.execute(self._plan({"mode": "fast"}))
+        registry.connector_factories["src"].create.reset_mock()
+        processor = registry.processor_factories["analyser"].create.return_value
+        processor.process.reset_mock()
+
+        result = await executor.execute(
+            self._plan({"mode": "thorough"}),
+            resume_run_id=first.run_id,
+            rerun_stale=True,
+        )
+
+        assert result.completed == {"data", "other_data", "findings", "report"}
+        # Sources unchanged: reused. findings changed, report depends on it.
+        registry.connector_factories["src"].create.assert_not_called()
+        assert processor.process.call_count == 2
+
+    async def test_unchanged_plan_reruns_nothing(self) -> None:
+        registry = self._registry()
+        executor = DAGExecutor(registry)
+        first = await executor.execute(self._plan({"mode": "fast"}))
+        registry.processor_factories["analyser"].create.reset_mock()
+
+        await executor.execute(
+            self._plan({"mode": "fast"}),
+            resume_run_id=first.run_id,
+            rerun_stale=True,
+        )
+
+        registry.processor_factories["analyser"].create.assert_not_called()
+
+    async def test_adopted_plan_and_fingerprints_are_persisted(self) -> None:
+        registry = self._registry()
+        store = registry.container.get_service(ArtifactStore)
+        executor = DAGExecutor(registry)
+        first = await executor.execute(self._plan({"mode": "fast"}))
+        new_plan = self._plan({"mode": "thorough"})
+
+        await executor.execute(new_plan, resume_run_id=first.run_id, rerun_stale=True)
+
+        state = await ExecutionState.load(store, first.run_id)
+        assert state.fingerprints == new_plan.artifact_fingerprints()
+        persisted = await store.load_system_data(first.run_id, "plan")
+        assert persisted == new_plan.to_dict()
+
+    async def test_stale_pending_artifact_is_prepared_again(self) -> None:
+        """A pending artifact whose definition changed drops its old batch.
+
+        Run 1 leaves ``findings`` pending on a batch. Its definition then
+        changes, so the resume prepares it again from the new definition
+        instead of finalising the PrepareResult built from the old one, and
+        stops tracking the batch only it was waiting on.
+        """
+        source_schema = Schema("standard_input", "1.0.0")
+        output_schema = Schema("findings", "1.0.0")
+
+        def plan(properties: dict[str, Any]) -> ExecutionPlan:
+            return create_simple_plan(
+                {
+                    "source": ArtifactDefinition(
+                        source=SourceConfig(type="src", properties={})
+                    ),
+                    "findings": ArtifactDefinition(
+                        inputs="source",
+                        process=ProcessConfig(type="dist_proc", properties=properties),
+                    ),
+                },
+                {
+                    "source": (None, source_schema),
+                    "findings": ([source_schema], output_schema),
+                },
+            )
+
+        def processor() -> StubDistributedProcessor:
+            return StubDistributedProcessor(
+                prepare_result=PrepareResult(
+                    state=StubState(value="state"), requests=[request]
+                ),
+                finalise_results=[
+                    (create_test_message({"findings": []}, schema=output_schema), [])
+                ],
+            )
+
+        request = DispatchRequest(name="batch_req")
+        pending = PendingProcessingError("Batch pending")
+        pending.batch_ids = ["batch-1"]
+        first_processor = processor()
+        registry = create_mock_registry(
+            with_container=True,
+            connector_factories={
+                "src": create_mock_connector_factory(
+                    "src", [source_schema], create_test_message({"files": []})
+                )
+            },
+            processor_factories={
+                "dist_proc": create_distributed_processor_factory(
+                    "dist_proc", first_processor
+                )
+            },
+        )
+        registry.get_dispatcher_for.return_value = create_mock_dispatcher(
+            [], side_effect=pending
+        )
+        store = registry.container.get_service(ArtifactStore)
+        executor = DAGExecutor(registry)
+
+        first = await executor.execute(plan({"mode": "fast"}))
+        await store.save_batch_job(first.run_id, "batch-1", {"status": "submitted"})
+        assert await store.prepared_exists(first.run_id, "findings")
+
+        second_processor = processor()
+        registry.processor_factories["dist_proc"] = (
+            create_distributed_processor_factory("dist_proc", second_processor)
+        )
+        registry.get_dispatcher_for.return_value = create_mock_dispatcher(
+            [DispatchResult(request_id=request.request_id)]
+        )
+        new_plan = plan({"mode": "thorough"})
+
+        result = await executor.execute(
+            new_plan, resume_run_id=first.run_id, rerun_stale=True
+        )
+
+        assert result.completed == {"source", "findings"}
+        assert "prepare" in second_processor.call_log
+        assert "deserialise_prepare_result" not in second_processor.call_log
+        assert not await store.prepared_exists(first.run_id, "findings")
+        assert await store.list_batch_jobs(first.run_id) == []
+        state = await ExecutionState.load(store, first.run_id)
+        assert state.fingerprints == new_plan.artifact_fingerprints()
+        assert state.pending_batches == {}
@@ -1,7 +1,7 @@
 """Tests for sidecar persistence and back-reference stamping in DAGExecutor.
 
 Covers both code paths (sync ``_run_processor`` and distributed
-``_finalise_distributed_artifacts``) and the audit-trail back-reference
+``_run_distributed``) and the audit-trail back-reference
 stamping into the primary's ``analysis_metadata.validation_summary``.
 """
 
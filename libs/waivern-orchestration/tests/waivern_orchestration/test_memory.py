@@ -0,0 +1,143 @@
+"""Tests for memory-aware admission control."""
+
+import asyncio
+from pathlib import Path
+
+from waivern_orchestration.memory import (
+    MIN_ESTIMATE_BYTES,
+    MemoryAdmission,
+    MemoryBudget,
+    MemoryProfile,
+)
+
+MiB = 1024 * 1024
+
+# =============================================================================
+# MemoryProfile
+# =============================================================================
+
+
+class TestMemoryProfile:
+    """Tests for estimating memory from observations."""
+
+    def test_unobserved_component_has_no_estimate(self) -> None:
+        assert MemoryProfile().estimate("processor:analyser", 10) is None
+
+    def test_estimate_scales_with_item_count(self) -> None:
+        profile = MemoryProfile()
+        profile.record("processor:analyser", 100 * MiB, 10)
+
+        assert profile.estimate("processor:analyser", 30) == 300 * MiB
+        assert profile.estimate("processor:analyser", None) == 100 * MiB
+
+    def test_scaled_estimate_has_a_floor(self) -> None:
+        profile = MemoryProfile()
+        profile.record("processor:analyser", 100 * MiB, 1000)
+
+        assert profile.estimate("processor:analyser", 1) == MIN_ESTIMATE_BYTES
+
+    def test_smaller_later_observation_within_a_run_is_ignored(self) -> None:
+        profile = MemoryProfile()
+        profile.record("processor:analyser", 100 * MiB, 10)
+        profile.record("processor:analyser", 20 * MiB, 10)
+
+        assert profile.estimate("processor:analyser", 10) == 100 * MiB
+
+    def test_observations_persist_across_runs(self, tmp_path: Path) -> None:
+        path = tmp_path / "memory-profile.json"
+        profile = MemoryProfile(path)
+        profile.record("connector:filesystem", 64 * MiB, 5)
+        profile.save()
+
+        reloaded = MemoryProfile(path)
+
+        assert reloaded.estimate("connector:filesystem", 5) == 64 * MiB
+
+    def test_first_observation_replaces_loaded_history(self, tmp_path: Path) -> None:
+        path = tmp_path / "memory-profile.json"
+        profile = MemoryProfile(path)
+        profile.record("connector:filesystem", 64 * MiB, None)
+        profile.save()
+
+        reloaded = MemoryProfile(path)
+        reloaded.record("connector:filesystem", 32 * MiB, None)
+
+        assert reloaded.estimate("connector:filesystem", None) == 32 * MiB
+
+    def test_corrupt_profile_is_ignored(self, tmp_path: Path) -> None:
+        path = tmp_path / "memory-profile.json"
+        path.write_text("not json")
+
+        assert MemoryProfile(path).estimate("connector:filesystem", None) is None
+
+
+# =============================================================================
+# MemoryBudget
+# =============================================================================
+
+
+class TestMemoryBudget:
+    """Tests for admitting work within a budget."""
+
+    async def test_work_that_does_not_fit_waits_for_release(self) -> None:
+        budget = MemoryBudget(100)
+        events: list[str] = []
+
+        async def work(name: str, nbytes: int) -> None:
+            async with budget.reserve(nbytes):
+                events.append(f"start {name}")
+                await asyncio.sleep(0.01)
+                events.append(f"end {name}")
+
+        await asyncio.gather(work("a", 60), work("b", 30), work("c", 60))
+
+        # a and b fit together; c waits until a is released
+        assert events.index("start c") > events.index("end a")
+        assert events.index("start b") < events.index("end a")
+
+    async def test_oversized_work_runs_alone(self) -> None:
+        budget = MemoryBudget(100)
+        running = 0
+        max_running = 0
+
+        async def work(nbytes: int) -> None:
+            nonlocal running, max_running
+            async with budget.reserve(nbytes):
+                running += 1
+                max_running = max(max_running, running)
+                await asyncio.sleep(0.01)
+                running -= 1
+
+        await asyncio.wait_for(asyncio.gather(work(500), work(10)), timeout=2)
+
+        assert max_running == 1
+
+
+# =============================================================================
+# MemoryAdmission
+# =============================================================================
+
+
+class TestMemoryAdmission:
+    """Tests for estimating and recording admitted work."""
+
+    def test_unobserved_component_gets_default_estimate(self) -> None:
+        admission = MemoryAdmission(
+            MemoryBudget(400 * MiB), MemoryProfile(), default_estimate=100 * MiB
+        )
+
+        assert admission.estimate("processor:analyser", 10) == 100 * MiB
+        assert admission.estimate(None, None) == 100 * MiB
+
+    async def test_admitted_work_is_recorded_in_profile(self) -> None:
+        profile = MemoryProfile()
+        admission = MemoryAdmission(
+            MemoryBudget(400 * MiB), profile, default_estimate=100 * MiB
+        )
+
+        async with admission.admit("processor:analyser", 10, asyncio.Semaphore(1)):
+            pass
+
+        # Growth is measured where supported, never below the floor
+        estimate = profile.estimate("processor:analyser", 10)
+        assert estimate is None or estimate >= MIN_ESTIMATE_BYTES
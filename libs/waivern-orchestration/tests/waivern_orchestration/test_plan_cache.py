@@ -0,0 +1,184 @@
+"""Tests for plan caching and child runbook prefetching in the Planner.
+
+Fixtures for these tests are defined in conftest.py.
+"""
+
+from pathlib import Path
+from unittest.mock import MagicMock, patch
+
+import pytest
+
+from waivern_orchestration.parser import parse_runbook
+from waivern_orchestration.plan_cache import PlanCache
+from waivern_orchestration.planner import Planner
+
+from .test_helpers import write_runbook
+
+# =============================================================================
+# Helpers
+# =============================================================================
+
+COMPONENTS = {"waivern.connectors": {"filesystem": "pkg:FilesystemFactory"}}
+
+
+def _write_child(path: Path, description: str = "Child") -> None:
+    write_runbook(
+        path,
+        {
+            "name": "Child",
+            "description": description,
+            "inputs": {"source_data": {"input_schema": "standard_input/1.0.0"}},
+            "outputs": {"findings": {"artifact": "analysis"}},
+            "artifacts": {
+                "analysis": {
+                    "inputs": "source_data",
+                    "process": {"type": "analyser", "properties": {}},
+                },
+            },
+        },
+    )
+
+
+def _write_parent(path: Path, child_count: int) -> None:
+    artifacts: dict[str, object] = {
+        "data": {"source": {"type": "filesystem", "properties": {}}},
+    }
+    for index in range(child_count):
+        artifacts[f"child_{index}"] = {
+            "inputs": "data",
+            "child_runbook": {
+                "path": "./child.yaml",
+                "input_mapping": {"source_data": "data"},
+                "output": "findings",
+            },
+        }
+    write_runbook(
+        path,
+        {"name": "Parent", "description": "Parent", "artifacts": artifacts},
+    )
+
+
+@pytest.fixture
+def cached_registry(basic_registry: MagicMock) -> MagicMock:
+    basic_registry.entry_point_references.return_value = COMPONENTS
+    return basic_registry
+
+
+# =============================================================================
+# Plan Cache
+# =============================================================================
+
+
+class TestPlannerPlanCache:
+    """Tests for reusing cached plans."""
+
+    def test_unchanged_runbooks_reuse_cached_plan(
+        self, tmp_path: Path, cached_registry: MagicMock
+    ) -> None:
+        _write_child(tmp_path / "child.yaml")
+        _write_parent(tmp_path / "parent.yaml", child_count=1)
+        cache = PlanCache(tmp_path / "plans")
+
+        first = Planner(cached_registry, plan_cache=cache).plan(
+            tmp_path / "parent.yaml"
+        )
+        with patch.object(cache, "save", wraps=cache.save) as save:
+            second = Planner(cached_registry, plan_cache=cache).plan(
+                tmp_path / "parent.yaml"
+            )
+
+        save.assert_not_called()
+        assert set(second.artifact_schemas) == set(first.artifact_schemas)
+        assert second.aliases == first.aliases
+
+    def test_edited_child_runbook_replans(
+        self, tmp_path: Path, cached_registry: MagicMock
+    ) -> None:
+        _write_child(tmp_path / "child.yaml")
+        _write_parent(tmp_path / "parent.yaml", child_count=1)
+        cache = PlanCache(tmp_path / "plans")
+        first = Planner(cached_registry, plan_cache=cache).plan(
+            tmp_path / "parent.yaml"
+        )
+
+        _write_child(tmp_path / "child.yaml", description="Edited child")
+        with patch.object(cache, "save", wraps=cache.save) as save:
+            second = Planner(cached_registry, plan_cache=cache).plan(
+                tmp_path / "parent.yaml"
+            )
+
+        save.assert_called_once()
+        # Child artifact IDs are derived from the parent, so they are stable
+        assert set(second.artifact_schemas) == set(first.artifact_schemas)
+
+    def test_changed_components_replan(
+        self, tmp_path: Path, cached_registry: MagicMock
+    ) -> None:
+        _write_child(tmp_path / "child.yaml")
+        _write_parent(tmp_path / "parent.yaml", child_count=1)
+        cache = PlanCache(tmp_path / "plans")
+        Planner(cached_registry, plan_cache=cache).plan(tmp_path / "parent.yaml")
+
+        cached_registry.entry_point_references.return_value = {
+            "waivern.connectors": {"filesystem": "other_pkg:FilesystemFactory"}
+        }
+        with patch.object(cache, "save", wraps=cache.save) as save:
+            Planner(cached_registry, plan_cache=cache).plan(tmp_path / "parent.yaml")
+
+        save.assert_called_once()
+
+    def test_edited_component_schema_file_changes_key(
+        self, tmp_path: Path, monkeypatch: pytest.MonkeyPatch
+    ) -> None:
+        # An editable install: the package is imported from its source tree
+        package = tmp_path / "src" / "editable_component"
+        (package / "schema_producers").mkdir(parents=True)
+        (package / "__init__.py").write_text("")
+        schema_file = package / "schema_producers" / "findings.json"
+        schema_file.write_text('{"version": "1.0.0"}')
+        monkeypatch.syspath_prepend(str(tmp_path / "src"))
+        components = {"waivern.processors": {"analyser": "editable_component:F"}}
+        _write_child(tmp_path / "child.yaml")
+        runbook = parse_runbook(tmp_path / "child.yaml")
+        first = PlanCache.compute_key(runbook, {}, components)
+
+        schema_file.write_text('{"version": "1.1.0"}')
+
+        assert PlanCache.compute_key(runbook, {}, components) != first
+
+    def test_corrupt_cache_entry_is_replanned(
+        self, tmp_path: Path, cached_registry: MagicMock
+    ) -> None:
+        _write_child(tmp_path / "child.yaml")
+        _write_parent(tmp_path / "parent.yaml", child_count=1)
+        cache = PlanCache(tmp_path / "plans")
+        Planner(cached_registry, plan_cache=cache).plan(tmp_path / "parent.yaml")
+        for entry in (tmp_path / "plans").glob("*.json"):
+            entry.write_text('{"runbook": {}}')
+
+        plan = Planner(cached_registry, plan_cache=cache).plan(tmp_path / "parent.yaml")
+
+        assert "data" in plan.artifact_schemas
+
+
+# =============================================================================
+# Child Runbook Prefetching
+# =============================================================================
+
+
+class TestChildRunbookPrefetch:
+    """Tests for parsing child runbooks once, up front."""
+
+    def test_child_referenced_many_times_is_parsed_once(
+        self, tmp_path: Path, basic_registry: MagicMock
+    ) -> None:
+        _write_child(tmp_path / "child.yaml")
+        _write_parent(tmp_path / "parent.yaml", child_count=5)
+
+        with patch(
+            "waivern_orchestration.flattener.parse_runbook", wraps=parse_runbook
+        ) as parse:
+            plan = Planner(basic_registry).plan(tmp_path / "parent.yaml")
+
+        assert parse.call_count == 1
+        assert len(plan.aliases) == 5
@@ -473,3 +473,28 @@ class TestExecutionPlan:
 
         with pytest.raises(AttributeError):
             plan.runbook = None  # type: ignore[misc]
+
+    def test_fingerprints_ignore_export_and_documentation_fields(self) -> None:
+        """Toggling output or editing a description does not make artifacts stale."""
+        connector_factory = create_mock_connector_factory(
+            "filesystem", [Schema("standard_input", "1.0.0")]
+        )
+        planner = Planner(
+            create_mock_registry(connector_factories={"filesystem": connector_factory})
+        )
+
+        def fingerprint(**fields: object) -> str:
+            artifact = {"source": {"type": "filesystem", "properties": {}}} | fields
+            plan = planner.plan_from_dict(
+                {"name": "Test", "description": "Test", "artifacts": {"data": artifact}}
+            )
+            return plan.artifact_fingerprints()["data"]
+
+        baseline = fingerprint()
+
+        assert fingerprint(output=True) == baseline
+        assert fingerprint(description="Exported data") == baseline
+        assert (
+            fingerprint(source={"type": "filesystem", "properties": {"path": "."}})
+            != baseline
+        )
@@ -11,6 +11,7 @@ from waivern_orchestration import (
     CycleDetectedError,
     MissingArtifactError,
     SchemaCompatibilityError,
+    UndeclaredResourcePoolError,
 )
 from waivern_orchestration.planner import Planner
 
@@ -134,6 +135,34 @@ class TestPlannerDependencyErrors:
         with pytest.raises(CycleDetectedError):
             planner.plan_from_dict(runbook_data)
 
+    def test_plan_undeclared_resource_pool(self) -> None:
+        """Artifact naming an undeclared resource pool raises an error."""
+        connector_factory = create_mock_connector_factory(
+            "filesystem", [Schema("standard_input", "1.0.0")]
+        )
+
+        registry = create_mock_registry(
+            connector_factories={"filesystem": connector_factory}
+        )
+        planner = Planner(registry)
+
+        runbook_data = {
+            "name": "Test",
+            "description": "Test",
+            "config": {"resource_pools": {"db_io": 4}},
+            "artifacts": {
+                "source": {
+                    "source": {"type": "filesystem", "properties": {}},
+                    "resource_pool": "db_oi",
+                },
+            },
+        }
+
+        with pytest.raises(UndeclaredResourcePoolError) as exc_info:
+            planner.plan_from_dict(runbook_data)
+
+        assert "db_oi" in str(exc_info.value)
+
 
 # =============================================================================
 # Schema Compatibility Errors
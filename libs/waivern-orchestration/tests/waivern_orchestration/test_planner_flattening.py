@@ -297,6 +297,55 @@ class TestBasicFlattening:
         assert hasattr(plan, "aliases")
         assert "child_findings" in plan.aliases
 
+    def test_child_artifact_ids_are_stable_across_plans(
+        self, tmp_path: Path, basic_registry: ComponentRegistry
+    ) -> None:
+        """Replanning gives child artifacts the same IDs; invocations differ."""
+        write_runbook(
+            tmp_path / "child.yaml",
+            {
+                "name": "Child",
+                "description": "Child",
+                "inputs": {"data": {"input_schema": "standard_input/1.0.0"}},
+                "outputs": {"result": {"artifact": "processed"}},
+                "artifacts": {
+                    "processed": {
+                        "inputs": "data",
+                        "process": {"type": "analyser", "properties": {}},
+                    },
+                },
+            },
+        )
+        child_invocation = {
+            "inputs": "source",
+            "child_runbook": {
+                "path": "./child.yaml",
+                "input_mapping": {"data": "source"},
+                "output": "result",
+            },
+        }
+        parent_path = tmp_path / "parent.yaml"
+        write_runbook(
+            parent_path,
+            {
+                "name": "Parent",
+                "description": "Parent",
+                "artifacts": {
+                    "source": {"source": {"type": "filesystem", "properties": {}}},
+                    "first": child_invocation,
+                    "second": child_invocation,
+                },
+            },
+        )
+        planner = Planner(basic_registry)
+
+        first_plan = planner.plan(parent_path)
+        second_plan = planner.plan(parent_path)
+
+        assert set(first_plan.artifact_schemas) == set(second_plan.artifact_schemas)
+        assert first_plan.aliases == second_plan.aliases
+        assert first_plan.aliases["first"] != first_plan.aliases["second"]
+
 
 # =============================================================================
 # Multiple Outputs Tests
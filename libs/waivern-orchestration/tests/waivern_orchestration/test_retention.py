@@ -0,0 +1,198 @@
+"""Tests for run retention planning and pruning."""
+
+from datetime import UTC, datetime, timedelta
+from pathlib import Path
+
+import pytest
+from waivern_artifact_store.in_memory import AsyncInMemoryStore
+from waivern_core.schemas import Schema
+
+from waivern_orchestration.errors import ChildRunbookNotFoundError
+from waivern_orchestration.models import ArtifactDefinition, ReuseConfig, SourceConfig
+from waivern_orchestration.parser import parse_runbook
+from waivern_orchestration.retention import (
+    RetentionPolicy,
+    apply_retention,
+    plan_retention,
+    reused_runs,
+)
+from waivern_orchestration.run_context import RunContext
+from waivern_orchestration.run_metadata import RunStatus
+
+from .test_helpers import create_simple_plan, write_runbook
+
+NOW = datetime(2026, 1, 31, 12, 0, tzinfo=UTC)
+
+
+async def _save_run(
+    store: AsyncInMemoryStore,
+    run_id: str,
+    *,
+    age: timedelta,
+    status: RunStatus = "completed",
+    reuse_from: str | None = None,
+) -> None:
+    """Persist metadata, state and plan for a run started ``age`` before NOW."""
+    if reuse_from is not None:
+        definition = ArtifactDefinition(
+            reuse=ReuseConfig(from_run=reuse_from, artifact="findings")
+        )
+    else:
+        definition = ArtifactDefinition(source=SourceConfig(type="fs", properties={}))
+    plan = create_simple_plan(
+        {"findings": definition}, {"findings": (None, Schema("std", "1.0.0"))}
+    )
+    ctx = RunContext.new(plan, runbook_path=Path("runbook.yaml"))
+    ctx.metadata.run_id = run_id
+    ctx.metadata.started_at = NOW - age
+    ctx.metadata.status = status
+    ctx.state.run_id = run_id
+    await ctx.save_all(store)
+
+
+class TestRetentionPolicy:
+    """Tests for policy validation."""
+
+    def test_policy_without_keep_rule_is_rejected(self) -> None:
+        with pytest.raises(ValueError, match="keep_last or max_age"):
+            RetentionPolicy()
+
+    def test_negative_keep_last_is_rejected(self) -> None:
+        with pytest.raises(ValueError, match="keep_last"):
+            RetentionPolicy(keep_last=-1)
+
+
+def _write_parent_with_child(tmp_path: Path, child_file: str) -> Path:
+    """Write a runbook reusing from run-parent that composes ``child_file``."""
+    parent_path = tmp_path / "parent.yaml"
+    write_runbook(
+        parent_path,
+        {
+            "name": "Parent",
+            "description": "Composes a child runbook",
+            "artifacts": {
+                "previous": {
+                    "reuse": {"from_run": "run-parent", "artifact": "findings"}
+                },
+                "child_results": {
+                    "inputs": "previous",
+                    "child_runbook": {
+                        "path": child_file,
+                        "input_mapping": {"source_data": "previous"},
+                        "output": "findings",
+                    },
+                },
+            },
+        },
+    )
+    return parent_path
+
+
+class TestReusedRuns:
+    """Tests for collecting the reuse sources of a runbook."""
+
+    def test_reuse_sources_of_child_runbooks_are_included(self, tmp_path: Path) -> None:
+        write_runbook(
+            tmp_path / "child.yaml",
+            {
+                "name": "Child",
+                "description": "Reuses a previous run",
+                "inputs": {"source_data": {"input_schema": "standard_input/1.0.0"}},
+                "outputs": {"findings": {"artifact": "reused"}},
+                "artifacts": {
+                    "reused": {
+                        "reuse": {"from_run": "run-child", "artifact": "findings"}
+                    }
+                },
+            },
+        )
+        parent_path = _write_parent_with_child(tmp_path, "./child.yaml")
+
+        runs = reused_runs(parse_runbook(parent_path), parent_path)
+
+        assert runs == {"run-parent", "run-child"}
+
+    def test_missing_child_runbook_is_an_error(self, tmp_path: Path) -> None:
+        parent_path = _write_parent_with_child(tmp_path, "./missing.yaml")
+
+        with pytest.raises(ChildRunbookNotFoundError):
+            reused_runs(parse_runbook(parent_path), parent_path)
+
+
+class TestPlanRetention:
+    """Tests for deciding which runs to keep."""
+
+    async def test_keeps_most_recent_runs(self) -> None:
+        store = AsyncInMemoryStore()
+        for day in range(4):
+            await _save_run(store, f"run-{day}", age=timedelta(days=day))
+
+        plan = await plan_retention(store, RetentionPolicy(keep_last=2), now=NOW)
+
+        assert set(plan.keep) == {"run-0", "run-1"}
+        assert plan.delete == ["run-2", "run-3"]
+
+    async def test_keeps_runs_within_max_age(self) -> None:
+        store = AsyncInMemoryStore()
+        await _save_run(store, "young", age=timedelta(hours=2))
+        await _save_run(store, "old", age=timedelta(days=10))
+
+        plan = await plan_retention(
+            store, RetentionPolicy(max_age=timedelta(days=1)), now=NOW
+        )
+
+        assert plan.keep == {"young": "within max age"}
+        assert plan.delete == ["old"]
+
+    async def test_keeps_running_runs_unless_disabled(self) -> None:
+        store = AsyncInMemoryStore()
+        await _save_run(store, "active", age=timedelta(days=10), status="running")
+
+        kept = await plan_retention(store, RetentionPolicy(keep_last=0), now=NOW)
+        pruned = await plan_retention(
+            store, RetentionPolicy(keep_last=0, keep_running=False), now=NOW
+        )
+
+        assert kept.keep == {"active": "running"}
+        assert pruned.delete == ["active"]
+
+    async def test_keeps_reuse_sources_of_kept_runs_transitively(self) -> None:
+        store = AsyncInMemoryStore()
+        await _save_run(store, "base", age=timedelta(days=30))
+        await _save_run(store, "middle", age=timedelta(days=20), reuse_from="base")
+        await _save_run(store, "latest", age=timedelta(days=1), reuse_from="middle")
+        await _save_run(store, "unrelated", age=timedelta(days=25))
+
+        plan = await plan_retention(store, RetentionPolicy(keep_last=1), now=NOW)
+
+        assert plan.keep == {
+            "latest": "recent",
+            "middle": "reused by latest",
+            "base": "reused by middle",
+        }
+        assert plan.delete == ["unrelated"]
+
+    async def test_keeps_protected_runs(self) -> None:
+        store = AsyncInMemoryStore()
+        await _save_run(store, "pinned", age=timedelta(days=30))
+
+        plan = await plan_retention(
+            store, RetentionPolicy(keep_last=0), protected_runs=["pinned"], now=NOW
+        )
+
+        assert plan.keep == {"pinned": "protected"}
+
+
+class TestApplyRetention:
+    """Tests for deleting runs according to a plan."""
+
+    async def test_deletes_planned_runs_only(self) -> None:
+        store = AsyncInMemoryStore()
+        await _save_run(store, "keep", age=timedelta(days=1))
+        await _save_run(store, "drop", age=timedelta(days=9))
+        plan = await plan_retention(store, RetentionPolicy(keep_last=1), now=NOW)
+
+        result = await apply_retention(store, plan)
+
+        assert result.deleted_runs == ["drop"]
+        assert await store.list_runs() == ["keep"]
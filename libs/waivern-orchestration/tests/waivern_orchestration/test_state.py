@@ -324,3 +324,98 @@ class TestExecutionStateRemainingActionable:
         remaining = state.remaining_actionable({"a", "b"})
 
         assert remaining == set()
+
+
+# =============================================================================
+# Invalidation Tests
+# =============================================================================
+
+
+class TestExecutionStateInvalidate:
+    """Tests for the invalidate() method."""
+
+    def test_invalidate_returns_terminal_artifacts_to_not_started(self) -> None:
+        state = ExecutionState.fresh("run-1", {"a", "b", "c", "d"})
+        state.mark_completed("a")
+        state.mark_failed("b")
+        state.mark_skipped({"c"})
+        state.mark_completed("d")
+
+        state.invalidate({"a", "b", "c"})
+
+        assert state.not_started == {"a", "b", "c"}
+        assert state.completed == {"d"}
+        assert state.failed == set()
+        assert state.skipped == set()
+
+    def test_invalidate_leaves_pending_artifacts_alone(self) -> None:
+        state = ExecutionState.fresh("run-1", {"a"})
+        state.mark_pending("a")
+
+        state.invalidate({"a"})
+
+        assert state.pending == {"a"}
+        assert state.not_started == set()
+
+    def test_invalidate_ignores_unknown_artifact(self) -> None:
+        state = ExecutionState.fresh("run-1", {"a"})
+        state.mark_completed("a")
+
+        state.invalidate({"unknown"})
+
+        assert state.completed == {"a"}
+        assert state.not_started == set()
+
+
+# =============================================================================
+# Fingerprint Tests (stale_artifacts, adopt_plan)
+# =============================================================================
+
+
+class TestExecutionStateFingerprints:
+    """Tests for detecting and adopting changed artifact definitions."""
+
+    def test_stale_artifacts_are_changed_or_unrecorded(self) -> None:
+        state = ExecutionState.fresh("run-1", {"a", "b"})
+        state.fingerprints = {"a": "fp-a", "b": "fp-b"}
+
+        stale = state.stale_artifacts({"a": "fp-a", "b": "fp-b2", "c": "fp-c"})
+
+        assert stale == {"b", "c"}
+
+    def test_adopt_plan_tracks_new_artifacts_and_drops_removed(self) -> None:
+        state = ExecutionState.fresh("run-1", {"a", "b", "removed"})
+        for artifact_id in ("a", "b", "removed"):
+            state.mark_completed(artifact_id)
+
+        state.adopt_plan({"a": "fp-a", "b": "fp-b", "new": "fp-new"}, stale={"b"})
+
+        assert state.completed == {"a"}
+        assert state.not_started == {"b", "new"}
+        assert state.fingerprints == {"a": "fp-a"}
+        assert state.planned_fingerprints == {"b": "fp-b", "new": "fp-new"}
+
+    def test_fingerprint_is_recorded_when_stale_artifact_completes(self) -> None:
+        state = ExecutionState.fresh("run-1", {"a"})
+        state.mark_completed("a")
+        state.fingerprints = {"a": "fp-a"}
+
+        state.adopt_plan({"a": "fp-a2"}, stale={"a"})
+        assert state.stale_artifacts({"a": "fp-a2"}) == {"a"}
+        state.mark_completed("a")
+
+        assert state.fingerprints == {"a": "fp-a2"}
+        assert state.planned_fingerprints == {}
+
+    def test_adopt_plan_abandons_stale_pending_artifacts(self) -> None:
+        state = ExecutionState.fresh("run-1", {"a", "b"})
+        state.mark_pending("a", ["batch-shared", "batch-a"])
+        state.mark_pending("b", ["batch-shared"])
+
+        abandoned, orphaned = state.adopt_plan({"a": "fp-a", "b": "fp-b"}, stale={"a"})
+
+        assert abandoned == {"a"}
+        assert orphaned == {"batch-a"}
+        assert state.not_started == {"a"}
+        assert state.pending == {"b"}
+        assert state.pending_batches == {"b": ["batch-shared"]}
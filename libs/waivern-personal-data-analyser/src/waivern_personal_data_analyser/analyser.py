@@ -17,12 +17,8 @@ from waivern_core.message import Message
 from waivern_core.schemas import Schema
 from waivern_llm.types import LLMDispatchResult, LLMRequest
 from waivern_rulesets.personal_data_indicator import PersonalDataIndicatorRule
-from waivern_schemas.connector_types import BaseMetadata
 from waivern_schemas.personal_data_indicator import PersonalDataIndicatorModel
-from waivern_schemas.standard_input import (
-    StandardInputDataItemModel,
-    StandardInputDataModel,
-)
+from waivern_schemas.standard_input import StandardInputItem, StandardInputView
 
 from .pattern_matcher import PersonalDataPatternMatcher
 from .result_builder import PersonalDataResultBuilder
@@ -67,6 +63,12 @@ class PersonalDataAnalyser(Analyser):
         """Return the name of the analyser."""
         return "personal_data_analyser"
 
+    @classmethod
+    @override
+    def get_resource_pool(cls) -> str | None:
+        """Run in the ``cpu`` pool: findings come from regex pattern matching."""
+        return "cpu"
+
     @classmethod
     @override
     def get_input_requirements(cls) -> list[list[InputRequirement]]:
@@ -225,9 +227,7 @@ class PersonalDataAnalyser(Analyser):
                     continue
         return None
 
-    def _load_reader(
-        self, schema: Schema
-    ) -> SchemaReader[StandardInputDataModel[BaseMetadata]]:
+    def _load_reader(self, schema: Schema) -> SchemaReader[StandardInputView]:
         """Dynamically import reader module.
 
         Python's import system automatically caches modules in sys.modules,
@@ -248,9 +248,7 @@ class PersonalDataAnalyser(Analyser):
             f"waivern_personal_data_analyser.schema_readers.{module_name}"
         )
 
-    def _merge_input_data_items(
-        self, inputs: list[Message]
-    ) -> list[StandardInputDataItemModel[BaseMetadata]]:
+    def _merge_input_data_items(self, inputs: list[Message]) -> list[StandardInputItem]:
         """Merge data items from multiple input messages (fan-in).
 
         Args:
@@ -261,7 +259,7 @@ class PersonalDataAnalyser(Analyser):
 
         """
         # Python's importlib caches modules, so repeated calls are cheap
-        all_data_items: list[StandardInputDataItemModel[BaseMetadata]] = []
+        all_data_items: list[StandardInputItem] = []
         for message in inputs:
             reader = self._load_reader(message.schema)
             input_data = reader.read(message.content)
@@ -269,7 +267,7 @@ class PersonalDataAnalyser(Analyser):
         return all_data_items
 
     def _find_patterns_in_data_items(
-        self, data_items: list[StandardInputDataItemModel[BaseMetadata]]
+        self, data_items: list[StandardInputItem]
     ) -> list[PersonalDataIndicatorModel]:
         """Run pattern matching on all data items.
 
@@ -9,7 +9,7 @@ from datetime import UTC, datetime
 from pprint import pformat
 
 from waivern_analysers_shared.llm_validation import ValidationResult
-from waivern_core.message import Message
+from waivern_core.message import Message, boundary_typed_content
 from waivern_core.schemas import BaseAnalysisOutputMetadata, Schema
 from waivern_schemas.personal_data_indicator import (
     PersonalDataIndicatorModel,
@@ -73,6 +73,7 @@ class PersonalDataResultBuilder:
             id=f"personal_data_analysis_{datetime.now(UTC).isoformat()}",
             content=result_data,
             schema=output_schema,
+            typed_content=boundary_typed_content(output_model),
         )
 
         output_message.validate()
@@ -135,6 +136,7 @@ class PersonalDataResultBuilder:
             id=f"personal_data_removed_findings_{datetime.now(UTC).isoformat()}",
             content=payload.model_dump(mode="json"),
             schema=_REMOVED_FINDINGS_SCHEMA,
+            typed_content=boundary_typed_content(payload),
         )
         sidecar.validate()
         return sidecar
@@ -2,40 +2,24 @@
 
 from typing import Any
 
-from waivern_schemas.connector_types import BaseMetadata
-from waivern_schemas.source_code import SourceCodeDataModel
-from waivern_schemas.standard_input import (
-    StandardInputDataItemModel,
-    StandardInputDataModel,
-)
+from waivern_schemas.source_code import SourceCodeView
+from waivern_schemas.standard_input import StandardInputView
 
 
-def read(content: dict[str, Any]) -> StandardInputDataModel[BaseMetadata]:
-    """Transform source_code v1.0.0 dict to StandardInputDataModel.
+def read(content: dict[str, Any]) -> StandardInputView:
+    """Adapt source_code v1.0.0 content to a standard_input view.
 
-    Converts each source code file to a StandardInputDataItemModel,
-    mapping raw_content → content and file_path → metadata.source.
+    Each source code file becomes one item, mapping raw_content → content
+    and file_path → metadata.source. Items read directly from ``content``;
+    file contents are neither copied nor re-validated.
 
     Args:
         content: Validated source_code v1.0.0 data
 
     Returns:
-        StandardInputDataModel with one item per source code file
+        StandardInputView with one item per source code file
 
     """
-    source_code_data = SourceCodeDataModel.model_validate(content)
-    data_items = [
-        StandardInputDataItemModel[BaseMetadata](
-            content=file_data.raw_content,
-            metadata=BaseMetadata(
-                source=file_data.file_path,
-                connector_type="source_code_analyser",
-            ),
-        )
-        for file_data in source_code_data.data
-    ]
-    return StandardInputDataModel[BaseMetadata](
-        schemaVersion="1.0.0",
-        name=source_code_data.name,
-        data=data_items,
+    return SourceCodeView(content).as_standard_input(
+        connector_type="source_code_analyser"
     )
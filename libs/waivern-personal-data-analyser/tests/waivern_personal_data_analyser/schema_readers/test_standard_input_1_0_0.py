@@ -2,7 +2,7 @@
 
 from typing import Any
 
-from waivern_schemas.standard_input import StandardInputDataModel
+from waivern_schemas.standard_input import StandardInputView
 
 from waivern_personal_data_analyser.schema_readers import standard_input_1_0_0
 
@@ -29,8 +29,8 @@ class TestStandardInputReader:
 
         result = standard_input_1_0_0.read(input_data)
 
-        # Assert returns Pydantic model, not dict
-        assert isinstance(result, StandardInputDataModel)
+        # Assert returns read-only view, not dict
+        assert isinstance(result, StandardInputView)
         assert result.schemaVersion == "1.0.0"
         assert result.name == "test_dataset"
         assert len(result.data) == 2
@@ -134,5 +134,5 @@ class TestStandardInputReader:
 
         assert result.schemaVersion == "1.0.0"
         assert result.name == "empty_dataset"
-        assert result.data == []
+        assert list(result.data) == []
         assert len(result.data) == 0
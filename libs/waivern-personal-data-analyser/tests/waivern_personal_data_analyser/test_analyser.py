@@ -19,6 +19,10 @@ class TestPersonalDataAnalyserMetadata:
         """The registered name is the stable identifier used by runbooks."""
         assert PersonalDataAnalyser.get_name() == "personal_data_analyser"
 
+    def test_runs_in_cpu_pool(self) -> None:
+        """Pattern matching is CPU-bound, so a declared ``cpu`` pool limits it."""
+        assert PersonalDataAnalyser.get_resource_pool() == "cpu"
+
     def test_get_input_requirements_covers_standard_input_and_source_code(self) -> None:
         """Both standard_input and source_code are advertised as valid inputs."""
         requirements = PersonalDataAnalyser.get_input_requirements()
@@ -59,6 +59,12 @@ class ProcessingPurposeAnalyser(Analyser):
         """Return the name of the analyser."""
         return "processing_purpose_analyser"
 
+    @classmethod
+    @override
+    def get_resource_pool(cls) -> str | None:
+        """Run in the ``cpu`` pool: purposes are detected by pattern matching."""
+        return "cpu"
+
     @classmethod
     @override
     def get_input_requirements(cls) -> list[list[InputRequirement]]:
@@ -16,6 +16,9 @@ class TestProcessingPurposeAnalyserIdentity:
     def test_get_name_returns_correct_analyser_name(self) -> None:
         assert ProcessingPurposeAnalyser.get_name() == "processing_purpose_analyser"
 
+    def test_runs_in_cpu_pool(self) -> None:
+        assert ProcessingPurposeAnalyser.get_resource_pool() == "cpu"
+
     def test_from_properties_creates_instance_with_defaults(self) -> None:
         config = ProcessingPurposeAnalyserConfig.from_properties({})
 
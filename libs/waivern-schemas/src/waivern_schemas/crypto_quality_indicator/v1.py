@@ -8,6 +8,7 @@ from waivern_core.schemas import (
     BaseFindingMetadata,
     BaseFindingModel,
     BaseSchemaOutput,
+    InternedStr,
 )
 
 
@@ -40,7 +41,7 @@ class CryptoQualityIndicatorModel(BaseFindingModel[CryptoQualityIndicatorMetadat
     - require_review: bool | None - Whether this finding requires human review
     """
 
-    algorithm: str = Field(
+    algorithm: InternedStr = Field(
         description="Canonical algorithm name (e.g., 'md5', 'bcrypt')"
     )
     quality_rating: Literal["strong", "weak", "deprecated"] = Field(
@@ -8,6 +8,7 @@ from waivern_core.schemas import (
     BaseFindingMetadata,
     BaseFindingModel,
     BaseSchemaOutput,
+    InternedStr,
 )
 
 
@@ -40,10 +41,10 @@ class DataCollectionIndicatorModel(BaseFindingModel[DataCollectionIndicatorMetad
     - require_review: bool | None - Whether this finding requires human review
     """
 
-    collection_type: str = Field(
+    collection_type: InternedStr = Field(
         description="Type of data collection (e.g. 'form_data', 'cookies')",
     )
-    data_source: str = Field(
+    data_source: InternedStr = Field(
         description="Source of the data (e.g. 'http_post', 'browser_cookies')",
     )
 
@@ -8,6 +8,7 @@ from waivern_core.schemas import (
     BaseFindingMetadata,
     BaseFindingModel,
     BaseSchemaOutput,
+    InternedStr,
 )
 
 
@@ -36,7 +37,7 @@ class DataSubjectIndicatorModel(BaseFindingModel[DataSubjectIndicatorMetadata]):
     - require_review: bool | None - Whether this finding requires human review
     """
 
-    subject_category: str = Field(description="Data subject category detected")
+    subject_category: InternedStr = Field(description="Data subject category detected")
     confidence_score: int = Field(
         ge=0, le=100, description="Confidence score for the detection (0-100)"
     )
@@ -8,6 +8,7 @@ from waivern_core.schemas import (
     BaseFindingMetadata,
     BaseFindingModel,
     BaseSchemaOutput,
+    InternedStr,
 )
 
 
@@ -40,15 +41,15 @@ class GDPRDataCollectionFindingModel(
     """
 
     # Original indicator data (propagated)
-    collection_type: str = Field(
+    collection_type: InternedStr = Field(
         description="Collection type slug from indicator (e.g., 'form_data', 'cookies')"
     )
-    data_source: str = Field(
+    data_source: InternedStr = Field(
         description="Data source from indicator (e.g., 'http_post', 'mysql')"
     )
 
     # GDPR classification (from ruleset mapping)
-    gdpr_purpose_category: str = Field(
+    gdpr_purpose_category: InternedStr = Field(
         description="GDPR purpose category from classification (e.g., 'context_dependent')"
     )
     article_references: tuple[str, ...] = Field(
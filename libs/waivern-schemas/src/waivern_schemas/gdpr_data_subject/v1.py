@@ -8,6 +8,7 @@ from waivern_core.schemas import (
     BaseFindingMetadata,
     BaseFindingModel,
     BaseSchemaOutput,
+    InternedStr,
 )
 
 
@@ -39,7 +40,7 @@ class GDPRDataSubjectFindingModel(BaseFindingModel[GDPRDataSubjectFindingMetadat
     """
 
     # GDPR classification (from ruleset mapping)
-    data_subject_category: str = Field(
+    data_subject_category: InternedStr = Field(
         description="Normalised GDPR data subject category (e.g., 'employee', 'customer')"
     )
     article_references: tuple[str, ...] = Field(
@@ -8,6 +8,7 @@ from waivern_core.schemas import (
     BaseFindingMetadata,
     BaseFindingModel,
     BaseSchemaOutput,
+    InternedStr,
 )
 
 
@@ -43,12 +44,12 @@ class GDPRPersonalDataFindingModel(BaseFindingModel[GDPRPersonalDataFindingMetad
     """
 
     # Original indicator information
-    indicator_type: str = Field(
+    indicator_type: InternedStr = Field(
         description="Original personal data indicator category (e.g., 'email', 'health')"
     )
 
     # GDPR classification fields
-    privacy_category: str = Field(
+    privacy_category: InternedStr = Field(
         description="Privacy category for reporting (e.g., 'identification_data', 'health_data')"
     )
     special_category: bool = Field(
@@ -8,6 +8,7 @@ from waivern_core.schemas import (
     BaseFindingMetadata,
     BaseFindingModel,
     BaseSchemaOutput,
+    InternedStr,
 )
 
 
@@ -41,12 +42,12 @@ class GDPRProcessingPurposeFindingModel(
     """
 
     # Original indicator data (propagated)
-    processing_purpose: str = Field(
+    processing_purpose: InternedStr = Field(
         description="Processing purpose name from indicator (e.g., 'Analytics', 'Payment Processing')"
     )
 
     # GDPR classification (from ruleset mapping)
-    purpose_category: str = Field(
+    purpose_category: InternedStr = Field(
         description="Normalised GDPR purpose category (e.g., 'analytics', 'operational')"
     )
     article_references: tuple[str, ...] = Field(
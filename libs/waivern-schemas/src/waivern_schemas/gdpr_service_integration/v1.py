@@ -8,6 +8,7 @@ from waivern_core.schemas import (
     BaseFindingMetadata,
     BaseFindingModel,
     BaseSchemaOutput,
+    InternedStr,
 )
 
 
@@ -40,15 +41,15 @@ class GDPRServiceIntegrationFindingModel(
     """
 
     # Original indicator data (propagated)
-    service_category: str = Field(
+    service_category: InternedStr = Field(
         description="Service category slug from indicator (e.g., 'cloud_infrastructure', 'communication')"
     )
-    service_integration_purpose: str = Field(
+    service_integration_purpose: InternedStr = Field(
         description="Purpose category from the service integration detection rule (e.g., 'operational', 'analytics')"
     )
 
     # GDPR classification (from ruleset mapping)
-    gdpr_purpose_category: str = Field(
+    gdpr_purpose_category: InternedStr = Field(
         description="GDPR purpose category from classification (e.g., 'operational', 'context_dependent')"
     )
     article_references: tuple[str, ...] = Field(
@@ -8,6 +8,7 @@ from waivern_core.schemas import (
     BaseFindingMetadata,
     BaseFindingModel,
     BaseSchemaOutput,
+    InternedStr,
 )
 
 
@@ -37,7 +38,7 @@ class PersonalDataIndicatorModel(BaseFindingModel[PersonalDataIndicatorMetadata]
     - require_review: bool | None - Whether this finding requires human review
     """
 
-    category: str = Field(
+    category: InternedStr = Field(
         description="Category of personal data (e.g., 'email', 'phone', 'health')"
     )
 
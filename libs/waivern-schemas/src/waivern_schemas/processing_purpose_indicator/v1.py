@@ -8,6 +8,7 @@ from waivern_core.schemas import (
     BaseFindingMetadata,
     BaseFindingModel,
     BaseSchemaOutput,
+    InternedStr,
 )
 
 
@@ -42,7 +43,7 @@ class ProcessingPurposeIndicatorModel(
     - require_review: bool | None - Whether this finding requires human review
     """
 
-    purpose: str = Field(description="Processing purpose name (from ruleset)")
+    purpose: InternedStr = Field(description="Processing purpose name (from ruleset)")
 
     @override
     def __str__(self) -> str:
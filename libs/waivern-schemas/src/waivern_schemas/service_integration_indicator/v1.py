@@ -8,6 +8,7 @@ from waivern_core.schemas import (
     BaseFindingMetadata,
     BaseFindingModel,
     BaseSchemaOutput,
+    InternedStr,
 )
 
 
@@ -42,10 +43,10 @@ class ServiceIntegrationIndicatorModel(
     - require_review: bool | None - Whether this finding requires human review
     """
 
-    service_category: str = Field(
+    service_category: InternedStr = Field(
         description="Category of service integration (e.g. 'cloud_infrastructure', 'payment_processing')",
     )
-    purpose_category: str = Field(
+    purpose_category: InternedStr = Field(
         description="Purpose category for compliance (e.g. 'operational', 'analytics')",
     )
 
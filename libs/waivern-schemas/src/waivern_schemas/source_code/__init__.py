@@ -8,7 +8,10 @@ from waivern_schemas.source_code.v1 import (
     SourceCodeDataModel,
     SourceCodeFileDataModel,
     SourceCodeFileMetadataModel,
+    SourceCodeFileView,
+    SourceCodeItemView,
     SourceCodeSchema,
+    SourceCodeView,
 )
 
 __all__ = [
@@ -16,5 +19,8 @@ __all__ = [
     "SourceCodeDataModel",
     "SourceCodeFileDataModel",
     "SourceCodeFileMetadataModel",
+    "SourceCodeFileView",
+    "SourceCodeItemView",
     "SourceCodeSchema",
+    "SourceCodeView",
 ]
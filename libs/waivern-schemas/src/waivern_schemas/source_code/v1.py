@@ -6,7 +6,9 @@ and Pydantic models for runtime validation and type safety.
 
 from __future__ import annotations
 
+from collections.abc import Mapping, Sequence
 from dataclasses import dataclass
+from functools import partial
 from typing import Any, ClassVar, override
 
 from pydantic import BaseModel, Field
@@ -17,6 +19,10 @@ from waivern_core.schemas import (
     SchemaRegistry,
 )
 
+from waivern_schemas.connector_types import BaseMetadata
+from waivern_schemas.standard_input import StandardInputView
+from waivern_schemas.views import LazyItemSequence
+
 # Pydantic models for runtime validation and type safety
 
 
@@ -71,6 +77,132 @@ class SourceCodeDataModel(BaseSchemaOutput):
     )
 
 
+# Read-only views over validated content
+
+
+class SourceCodeFileView:
+    """Read-only view over one source_code file dict.
+
+    Exposes the fields pattern matching needs without validating or copying
+    ``raw_content``.
+    """
+
+    __slots__ = ("_file",)
+
+    def __init__(self, file: Mapping[str, Any]) -> None:
+        """Initialise the view.
+
+        Args:
+            file: File dict that has passed source_code schema validation.
+
+        """
+        self._file = file
+
+    @property
+    def file_path(self) -> str:
+        """Path of the source file."""
+        return self._file["file_path"]
+
+    @property
+    def language(self) -> str:
+        """Detected programming language."""
+        return self._file["language"]
+
+    @property
+    def raw_content(self) -> str:
+        """Full source code."""
+        return self._file["raw_content"]
+
+
+class SourceCodeItemView:
+    """standard_input item view over one source_code file dict.
+
+    Maps ``raw_content`` to ``content`` and ``file_path`` to
+    ``metadata.source``, so standard_input consumers can scan source files
+    without a converted copy of the input.
+    """
+
+    __slots__ = ("_connector_type", "_file", "_metadata")
+
+    def __init__(self, file: Mapping[str, Any], connector_type: str) -> None:
+        """Initialise the view.
+
+        Args:
+            file: File dict that has passed source_code schema validation.
+            connector_type: Value reported as ``metadata.connector_type``.
+
+        """
+        self._file = file
+        self._connector_type = connector_type
+        self._metadata: BaseMetadata | None = None
+
+    @property
+    def content(self) -> str:
+        """Full source code of the file."""
+        return self._file["raw_content"]
+
+    @property
+    def metadata(self) -> BaseMetadata:
+        """Metadata identifying the file as the item source."""
+        if self._metadata is None:
+            self._metadata = BaseMetadata.model_construct(
+                source=self._file["file_path"],
+                connector_type=self._connector_type,
+                context={},
+            )
+        return self._metadata
+
+
+@dataclass(frozen=True, slots=True)
+class SourceCodeView:
+    """Read-only view of source_code data over validated message content.
+
+    Skips SourceCodeDataModel validation and never copies file contents;
+    ``data`` wraps each file lazily on access.
+    """
+
+    content: Mapping[str, Any]
+
+    @property
+    def schemaVersion(self) -> str:
+        """Schema version identifier."""
+        return self.content["schemaVersion"]
+
+    @property
+    def name(self) -> str:
+        """Name of the source code analysis."""
+        return self.content["name"]
+
+    @property
+    def source(self) -> str:
+        """Source path or identifier."""
+        return self.content["source"]
+
+    @property
+    def data(self) -> Sequence[SourceCodeFileView]:
+        """Analysed source code files."""
+        return LazyItemSequence(self.content["data"], SourceCodeFileView)
+
+    def as_standard_input(self, connector_type: str) -> StandardInputView:
+        """Adapt to a standard_input view with one item per source file.
+
+        Args:
+            connector_type: Value reported as each item's
+                ``metadata.connector_type``.
+
+        Returns:
+            View whose items read directly from this content's file dicts.
+
+        """
+        return StandardInputView(
+            name=self.name,
+            data=LazyItemSequence(
+                self.content["data"],
+                partial(SourceCodeItemView, connector_type=connector_type),
+            ),
+        )
+
+
 # JSON Schema class
 
 
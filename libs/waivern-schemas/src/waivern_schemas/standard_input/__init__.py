@@ -6,9 +6,15 @@ Re-exports from the current version (v1).
 from waivern_schemas.standard_input.v1 import (
     StandardInputDataItemModel,
     StandardInputDataModel,
+    StandardInputItem,
+    StandardInputItemView,
+    StandardInputView,
 )
 
 __all__ = [
     "StandardInputDataItemModel",
     "StandardInputDataModel",
+    "StandardInputItem",
+    "StandardInputItemView",
+    "StandardInputView",
 ]
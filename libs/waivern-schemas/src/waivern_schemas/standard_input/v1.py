@@ -9,11 +9,14 @@ To use the schema, instantiate it with:
 
 from __future__ import annotations
 
-from typing import Any
+from collections.abc import Mapping, Sequence
+from dataclasses import dataclass, field
+from typing import Any, Protocol
 
 from pydantic import BaseModel, Field
 
 from waivern_schemas.connector_types import BaseMetadata
+from waivern_schemas.views import LazyItemSequence
 
 
 class StandardInputDataItemModel[MetadataT: BaseMetadata](BaseModel):
@@ -39,3 +42,98 @@ class StandardInputDataModel[MetadataT: BaseMetadata](BaseModel):
     metadata: dict[str, Any] = Field(
         default_factory=dict, description="Additional metadata"
     )
+
+
+# Read-only views over validated content
+
+
+class StandardInputItem(Protocol):
+    """Read-only shape shared by data item models and views."""
+
+    @property
+    def content(self) -> str:
+        """The actual content/data."""
+        ...
+
+    @property
+    def metadata(self) -> BaseMetadata:
+        """Metadata about the data item."""
+        ...
+
+
+class StandardInputItemView:
+    """Read-only view over one standard_input data item dict.
+
+    ``content`` is returned as-is from the dict. ``metadata`` is built on first
+    access without validation and carries the base fields only (source,
+    connector_type, context); connector-specific fields stay in the dict.
+    """
+
+    __slots__ = ("_item", "_metadata")
+
+    def __init__(self, item: Mapping[str, Any]) -> None:
+        """Initialise the view.
+
+        Args:
+            item: Data item dict that has passed schema validation.
+
+        """
+        self._item = item
+        self._metadata: BaseMetadata | None = None
+
+    @property
+    def content(self) -> str:
+        """The actual content/data."""
+        return self._item["content"]
+
+    @property
+    def metadata(self) -> BaseMetadata:
+        """Metadata about the data item."""
+        if self._metadata is None:
+            raw = self._item["metadata"]
+            self._metadata = BaseMetadata.model_construct(
+                source=raw["source"],
+                connector_type=raw["connector_type"],
+                context=raw.get("context", {}),
+            )
+        return self._metadata
+
+
+@dataclass(frozen=True, slots=True)
+class StandardInputView:
+    """Read-only view of standard_input data over validated message content.
+
+    Mirrors StandardInputDataModel's fields but skips Pydantic validation and
+    never copies data items; ``data`` wraps each item lazily on access. Use
+    ``from_content`` for standard_input content, or build one directly to
+    adapt another schema's items (see ``SourceCodeView.as_standard_input``).
+    """
+
+    name: str
+    data: Sequence[StandardInputItem]
+    schemaVersion: str = "1.0.0"
+    description: str | None = None
+    contentEncoding: str | None = None
+    source: str | None = None
+    metadata: Mapping[str, Any] = field(default_factory=dict[str, Any])
+
+    @classmethod
+    def from_content(cls, content: Mapping[str, Any]) -> StandardInputView:
+        """Create a view over standard_input content.
+
+        Args:
+            content: Dict that has passed standard_input schema validation.
+
+        Returns:
+            View reading fields and items directly from ``content``.
+
+        """
+        return cls(
+            name=content["name"],
+            data=LazyItemSequence(content["data"], StandardInputItemView),
+            schemaVersion=content["schemaVersion"],
+            description=content.get("description"),
+            contentEncoding=content.get("contentEncoding"),
+            source=content.get("source"),
+            metadata=content.get("metadata", {}),
+        )
@@ -0,0 +1,63 @@
+"""Shared helpers for read-only schema content views.
+
+Views wrap message content that has already been validated against its JSON
+schema. They read fields straight from the underlying dict instead of
+building Pydantic models, so adapting an input costs no copies of large
+string fields (file contents, extracted text) and no re-validation.
+"""
+
+from __future__ import annotations
+
+from collections.abc import Callable, Iterator, Sequence
+from typing import Any, overload, override
+
+
+class LazyItemSequence[T](Sequence[T]):
+    """Sequence that wraps items of an underlying list on access.
+
+    Each access builds a fresh lightweight wrapper; the underlying list is
+    never copied.
+    """
+
+    __slots__ = ("_factory", "_items")
+
+    def __init__(self, items: Sequence[Any], factory: Callable[[Any], T]) -> None:
+        """Initialise the sequence.
+
+        Args:
+            items: Underlying raw items (typically dicts from message content).
+            factory: Builds the view for a single raw item.
+
+        """
+        self._items = items
+        self._factory = factory
+
+    @override
+    def __len__(self) -> int:
+        """Return the number of underlying items."""
+        return len(self._items)
+
+    @overload
+    def __getitem__(self, index: int) -> T: ...
+
+    @overload
+    def __getitem__(self, index: slice) -> LazyItemSequence[T]: ...
+
+    @override
+    def __getitem__(self, index: int | slice) -> T | LazyItemSequence[T]:
+        """Return the view for an item, or a lazy sequence for a slice."""
+        if isinstance(index, slice):
+            return LazyItemSequence(self._items[index], self._factory)
+        return self._factory(self._items[index])
+
+    @override
+    def __iter__(self) -> Iterator[T]:
+        """Iterate views over the underlying items in order."""
+        factory = self._factory
+        for item in self._items:
+            yield factory(item)
+
+    @override
+    def __repr__(self) -> str:
+        """Return a summary without materialising items."""
+        return f"LazyItemSequence(len={len(self._items)})"
@@ -4,7 +4,7 @@ import logging
 from datetime import UTC, datetime
 from pprint import pformat
 
-from waivern_core.message import Message
+from waivern_core.message import Message, boundary_typed_content
 from waivern_core.schemas import BaseAnalysisOutputMetadata, Schema
 from waivern_schemas.security_evidence import (
     DomainBreakdown,
@@ -80,6 +80,7 @@ class SecurityControlResultBuilder:
             id=f"security_control_analysis_{datetime.now(UTC).isoformat()}",
             content=result_data,
             schema=output_schema,
+            typed_content=boundary_typed_content(output_model),
         )
 
         output_message.validate()
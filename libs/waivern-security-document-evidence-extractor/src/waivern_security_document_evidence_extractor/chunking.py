@@ -0,0 +1,112 @@
+"""Section-aware splitting of long documents and merging of their classifications.
+
+``split_document`` cuts a document into chunks small enough to classify with
+bounded latency, preferring to cut at section headings, then at paragraph
+breaks, then at line breaks. Chunks are contiguous ``(start, end)`` offsets
+into the content, so concatenating them gives back the document.
+
+``merge_chunk_responses`` reduces the chunk classifications back into one
+classification per document.
+"""
+
+import re
+from collections.abc import Sequence
+from itertools import pairwise
+
+from waivern_schemas.security_domain import SecurityDomain
+
+from .types import DomainClassificationResponse
+
+_CHARS_PER_TOKEN = 4
+"""Inverse of the ``estimate_tokens`` heuristic (~0.25 tokens per character)."""
+
+_BOUNDARIES = (
+    # Section headings: Markdown headings and numbered headings ("2.3 Scope")
+    re.compile(r"^(?=#{1,6}\s|\d+(?:\.\d+)*\.?[ \t]+[A-Z])", re.MULTILINE),
+    # Paragraph breaks
+    re.compile(r"\n[ \t]*\n"),
+    # Line breaks
+    re.compile(r"\n"),
+)
+"""Places a document may be cut, coarsest first."""
+
+
+def split_document(content: str, max_chunk_tokens: int) -> list[tuple[int, int]]:
+    """Split a document into chunks of at most ``max_chunk_tokens``.
+
+    The document is first cut at every boundary of the coarsest kind that
+    yields pieces within the limit (text without any boundary is cut
+    mid-line as a last resort). Consecutive pieces are then packed back
+    together into chunks as large as the limit allows, so a chunk only
+    ends where a piece does.
+
+    Args:
+        content: Full document text.
+        max_chunk_tokens: Estimated token limit per chunk.
+
+    Returns:
+        ``(start, end)`` offsets of the chunks, in document order. A
+        document within the limit is a single chunk.
+
+    """
+    max_chars = max_chunk_tokens * _CHARS_PER_TOKEN
+    if len(content) <= max_chars:
+        return [(0, len(content))]
+
+    chunks: list[tuple[int, int]] = []
+    chunk_start = chunk_end = 0
+    for start, end in _split(content, 0, len(content), max_chars, level=0):
+        if end - chunk_start > max_chars:
+            chunks.append((chunk_start, chunk_end))
+            chunk_start = start
+        chunk_end = end
+    chunks.append((chunk_start, chunk_end))
+    return chunks
+
+
+def _split(
+    content: str, start: int, end: int, max_chars: int, *, level: int
+) -> list[tuple[int, int]]:
+    """Cut ``content[start:end]`` into pieces of at most ``max_chars``."""
+    if end - start <= max_chars:
+        return [(start, end)]
+    if level == len(_BOUNDARIES):
+        return [
+            (cut, min(cut + max_chars, end)) for cut in range(start, end, max_chars)
+        ]
+
+    cuts = [
+        match.end()
+        for match in _BOUNDARIES[level].finditer(content, start, end)
+        if start < match.end() < end
+    ]
+    pieces: list[tuple[int, int]] = []
+    for piece_start, piece_end in pairwise([start, *cuts, end]):
+        pieces.extend(
+            _split(content, piece_start, piece_end, max_chars, level=level + 1)
+        )
+    return pieces
+
+
+def merge_chunk_responses(
+    responses: Sequence[DomainClassificationResponse],
+) -> DomainClassificationResponse:
+    """Merge the classifications of a document's chunks, in document order.
+
+    The document addresses every domain any of its chunks addresses, so a
+    chunk of general preamble does not make a domain-specific document
+    cross-cutting; the document is only cross-cutting if every chunk is.
+    Chunk summaries are concatenated.
+    """
+    if len(responses) == 1:
+        return responses[0]
+
+    domains: dict[SecurityDomain, None] = {}
+    for response in responses:
+        domains.update(dict.fromkeys(response.security_domains))
+    return DomainClassificationResponse(
+        security_domains=list(domains),
+        summary="\n\n".join(
+            response.summary for response in responses if response.summary
+        ),
+    )
@@ -24,9 +24,11 @@ from waivern_schemas.standard_input import (
     StandardInputDataModel,
 )
 
+from .chunking import merge_chunk_responses, split_document
 from .prompts.prompt_builder import DomainClassificationPromptBuilder
 from .result_builder import build_output_message
 from .types import (
+    DocumentChunk,
     DocumentItem,
     DomainClassificationResponse,
     SecurityDocEvidencePrepareState,
@@ -49,6 +51,12 @@ class SecurityDocumentEvidenceExtractor(Processor):
     configured, ``finalise()`` receives a ``DispatcherNotConfigured``
     result and falls back to default responses (empty domains, raw
     content as summary).
+
+    Each document is classified by its own LLM request, so results are
+    matched to documents by request_id and the dispatcher runs the
+    requests concurrently. With ``chunking`` enabled, a document too long
+    for one request is split at section boundaries and classified chunk by
+    chunk; the chunk classifications are merged into one finding.
     """
 
     def __init__(self, config: SecurityDocumentEvidenceExtractorConfig) -> None:
@@ -58,6 +66,7 @@ class SecurityDocumentEvidenceExtractor(Processor):
             config: Validated configuration object.
 
         """
+        self._config = config
 
     @classmethod
     @override
@@ -65,6 +74,12 @@ class SecurityDocumentEvidenceExtractor(Processor):
         """Return the name of the processor."""
         return "security_document_evidence_extractor"
 
+    @classmethod
+    @override
+    def get_resource_pool(cls) -> str | None:
+        """Run in the ``llm`` pool: documents are classified by an LLM."""
+        return "llm"
+
     @classmethod
     @override
     def get_input_requirements(cls) -> list[list[InputRequirement]]:
@@ -87,7 +102,8 @@ class SecurityDocumentEvidenceExtractor(Processor):
         1. Validate inputs and extract run_id
         2. Parse and merge input data items (fan-in)
         3. Create DocumentItem + content pairs
-        4. Build an LLMRequest for domain classification
+        4. Split each document into chunks (one chunk unless it is long)
+        5. Build an LLMRequest for domain classification per chunk
 
         """
         if not inputs:
@@ -99,32 +115,59 @@ class SecurityDocumentEvidenceExtractor(Processor):
         data_items = self._merge_input_data_items(inputs)
         document_items, document_contents = self._build_document_pairs(data_items)
 
+        requests: list[DispatchRequest] = []
+        document_chunks: list[list[DocumentChunk]] = []
+        for item, content in zip(document_items, document_contents, strict=True):
+            spans = self._split(content)
+            chunks: list[DocumentChunk] = []
+            for part, (start, end) in enumerate(spans, start=1):
+                request = self._build_llm_request(
+                    item, content[start:end], run_id, part=part, parts=len(spans)
+                )
+                requests.append(request)
+                chunks.append(
+                    DocumentChunk(request_id=request.request_id, start=start, end=end)
+                )
+            if len(chunks) > 1:
+                logger.debug(
+                    "Classifying %s in %d chunks", item.metadata.source, len(chunks)
+                )
+            document_chunks.append(chunks)
+
         return PrepareResult(
             state=SecurityDocEvidencePrepareState(
                 document_items=document_items,
                 document_contents=document_contents,
+                document_chunks=document_chunks,
                 run_id=run_id,
             ),
-            requests=[
-                self._build_llm_request(document_items, document_contents, run_id)
-            ],
+            requests=requests,
         )
 
+    def _split(self, content: str) -> list[tuple[int, int]]:
+        """Return the chunk offsets of a document's content."""
+        chunking = self._config.chunking
+        if not chunking.enabled:
+            return [(0, len(content))]
+        return split_document(content, chunking.max_chunk_tokens)
+
     def _build_llm_request(
         self,
-        document_items: list[DocumentItem],
-        document_contents: list[str],
+        item: DocumentItem,
+        content: str,
         run_id: str,
+        *,
+        part: int,
+        parts: int,
     ) -> LLMRequest[DocumentItem]:
-        """Build an LLMRequest for domain classification."""
-        groups = [
-            ItemGroup(items=[item], content=content, group_id=item.metadata.source)
-            for item, content in zip(document_items, document_contents, strict=True)
-        ]
+        """Build an LLMRequest classifying one chunk of a document."""
+        group_id = (
+            item.metadata.source if parts == 1 else f"{item.metadata.source}#{part}"
+        )
         return LLMRequest(
-            name="classification",
-            groups=groups,
-            prompt_builder=DomainClassificationPromptBuilder(),
+            name=f"classification:{group_id}",
+            groups=[ItemGroup(items=[item], content=content, group_id=group_id)],
+            prompt_builder=DomainClassificationPromptBuilder(part, parts),
             response_model=DomainClassificationResponse,
             batching_mode=BatchingMode.INDEPENDENT,
             run_id=run_id,
@@ -138,11 +181,14 @@ class SecurityDocumentEvidenceExtractor(Processor):
     ) -> tuple[Message, list[Message]]:
         """Produce classified document output from state and dispatch results.
 
+        Results are matched to document chunks by request_id.
+
         1. If LLM result with responses: validate as DomainClassificationResponse.
         2. If LLM result with empty responses or no dispatch result: fall back
            to default responses (empty domains, content as summary). The
            output's ``llm_classification_enabled`` flag reflects whether real
            LLM responses were actually used.
+        3. The chunk responses of each document are merged into one.
         """
         responses, llm_used = self._extract_llm_responses(state, results)
 
@@ -160,12 +206,18 @@ class SecurityDocumentEvidenceExtractor(Processor):
         state: SecurityDocEvidencePrepareState,
         results: Sequence[DispatchResult],
     ) -> tuple[list[DomainClassificationResponse], bool]:
-        """Extract classification responses from LLM dispatch results.
+        """Extract one classification response per document from dispatch results.
 
         Returns ``(responses, llm_used)`` where ``llm_used`` is ``True`` only
         when real LLM responses were parsed — a missing or empty dispatch
-        result degrades to defaults with ``llm_used=False``.
+        result degrades to defaults with ``llm_used=False``. A document none
+        of whose chunks were classified gets the default response for its
+        whole content; an unclassified chunk of an otherwise classified
+        document contributes its raw text to the summary. Chunks sharing a
+        request (a state persisted before chunking, see
+        ``deserialise_prepare_result``) take its responses in order.
         """
+        request_responses: dict[str, list[DomainClassificationResponse]] = {}
         for result in results:
             match result:
                 case DispatcherNotConfigured() as nc:
@@ -178,23 +230,44 @@ class SecurityDocumentEvidenceExtractor(Processor):
                         self._build_default_responses(state.document_contents),
                         False,
                     )
-                case LLMDispatchResult() as llm_result:
-                    if not llm_result.responses:
-                        return (
-                            self._build_default_responses(state.document_contents),
-                            False,
-                        )
-                    return (
-                        [
-                            DomainClassificationResponse.model_validate(r)
-                            for r in llm_result.responses
-                        ],
-                        True,
-                    )
+                case LLMDispatchResult() as llm_result if llm_result.responses:
+                    request_responses[llm_result.request_id] = [
+                        DomainClassificationResponse.model_validate(response)
+                        for response in llm_result.responses
+                    ]
                 case _:
                     continue
 
-        return self._build_default_responses(state.document_contents), False
+        positions: dict[str, int] = {}
+        responses: list[DomainClassificationResponse] = []
+        for content, chunks in zip(
+            state.document_contents, state.document_chunks, strict=True
+        ):
+            chunk_responses: list[DomainClassificationResponse | None] = []
+            for chunk in chunks:
+                position = positions.get(chunk.request_id, 0)
+                positions[chunk.request_id] = position + 1
+                received = request_responses.get(chunk.request_id, [])
+                chunk_responses.append(
+                    received[position] if position < len(received) else None
+                )
+            if all(response is None for response in chunk_responses):
+                responses.extend(self._build_default_responses([content]))
+                continue
+            defaults = self._build_default_responses(
+                [content[chunk.start : chunk.end] for chunk in chunks]
+            )
+            responses.append(
+                merge_chunk_responses(
+                    [
+                        default if response is None else response
+                        for response, default in zip(
+                            chunk_responses, defaults, strict=True
+                        )
+                    ]
+                )
+            )
+        return responses, bool(request_responses)
 
     def _build_default_responses(
         self,
@@ -214,13 +287,39 @@ class SecurityDocumentEvidenceExtractor(Processor):
         Called on the resume path where a persisted PrepareResult must be
         restored. Handles LLMRequest reconstruction with correct field types.
 
+        A state persisted before documents were chunked has no
+        ``document_chunks``; each of its documents is one whole-document
+        chunk of its single request.
+
         """
-        state = SecurityDocEvidencePrepareState.model_validate(raw["state"])
+        raw_requests: list[dict[str, Any]] = raw.get("requests", [])
+        state = SecurityDocEvidencePrepareState.model_validate(
+            self._with_document_chunks(raw["state"], raw_requests)
+        )
         requests: list[DispatchRequest] = [
-            LLMRequest[DocumentItem].model_validate(r) for r in raw.get("requests", [])
+            LLMRequest[DocumentItem].model_validate(r) for r in raw_requests
         ]
         return PrepareResult(state=state, requests=requests)
 
+    @staticmethod
+    def _with_document_chunks(
+        state: dict[str, Any], requests: list[dict[str, Any]]
+    ) -> dict[str, Any]:
+        """Default the chunks of a state persisted before chunking.
+
+        Such a state was prepared with one request classifying every
+        document, whose result holds one response per document in order.
+        """
+        if "document_chunks" in state or not requests:
+            return state
+        request_id = requests[0]["request_id"]
+        return state | {
+            "document_chunks": [
+                [{"request_id": request_id, "start": 0, "end": len(content)}]
+                for content in state["document_contents"]
+            ]
+        }
+
     # ── Private helpers ──────────────────────────────────────────────────
 
     def _load_reader(
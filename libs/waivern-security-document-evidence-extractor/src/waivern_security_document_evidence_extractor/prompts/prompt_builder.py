@@ -37,8 +37,22 @@ class DomainClassificationPromptBuilder(PromptBuilder[DocumentItem]):
     Uses INDEPENDENT batching mode — receives a single group per batch
     where group.content carries the document text and group.items carries
     the document item.
+
+    A long document is classified in chunks, one prompt per chunk; the
+    prompt then tells the LLM which part of the document it is reading.
     """
 
+    def __init__(self, part: int = 1, parts: int = 1) -> None:
+        """Initialise the prompt builder.
+
+        Args:
+            part: 1-based number of the chunk the prompt classifies.
+            parts: Number of chunks the document was split into.
+
+        """
+        self._part = part
+        self._parts = parts
+
     @override
     def build_prompt(
         self,
@@ -64,10 +78,18 @@ class DomainClassificationPromptBuilder(PromptBuilder[DocumentItem]):
 
         filename = items[0].metadata.source if items else "unknown"
 
+        part = ""
+        if self._parts > 1:
+            part = (
+                f"\n**PART:** {self._part} of {self._parts} (the document was "
+                "split at section boundaries because of its length; classify "
+                "and summarise this part only)\n"
+            )
+
         return f"""You are an information security domain classifier. Your task is to read a policy document and determine which security domains it addresses.
 
 **DOCUMENT:** {filename}
-
+{part}
 **CONTENT:**
 {content or "(empty)"}
 
@@ -6,7 +6,7 @@ Constructs SecurityDocumentContextOutput from classification results.
 import logging
 from datetime import UTC, datetime
 
-from waivern_core.message import Message
+from waivern_core.message import Message, boundary_typed_content
 from waivern_core.schemas import BaseAnalysisOutputMetadata, Schema
 from waivern_schemas.security_document_context import (
     SecurityDocumentContextMetadata,
@@ -60,6 +60,7 @@ def build_output_message(
         id=f"security_document_context_{datetime.now(UTC).isoformat()}",
         content=result_data,
         schema=output_schema,
+        typed_content=boundary_typed_content(output_model),
     )
 
     message.validate()
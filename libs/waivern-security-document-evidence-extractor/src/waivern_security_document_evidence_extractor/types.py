@@ -3,7 +3,7 @@
 import uuid
 from typing import Any, Self, override
 
-from pydantic import BaseModel, Field
+from pydantic import BaseModel, ConfigDict, Field
 from waivern_core import BaseComponentConfiguration
 from waivern_core.config_validation import validate_or_raise
 from waivern_core.errors import ProcessorConfigError
@@ -11,6 +11,31 @@ from waivern_schemas.security_document_context import SecurityDocumentContextMet
 from waivern_schemas.security_domain import SecurityDomain
 
 
+class DocumentChunkingConfig(BaseModel):
+    """Configuration for classifying long documents in chunks.
+
+    When enabled, documents estimated above ``max_chunk_tokens`` are split
+    at section boundaries and each chunk is classified by its own LLM
+    request; the chunk classifications are then merged into one finding
+    per document. Without chunking, a document too large for the model's
+    context window is skipped by the LLM service.
+
+    Enabled by default — documents within the limit are unaffected.
+    """
+
+    model_config = ConfigDict(frozen=True, extra="forbid")
+
+    enabled: bool = Field(
+        default=True,
+        description="Split long documents into separately classified chunks",
+    )
+    max_chunk_tokens: int = Field(
+        default=20_000,
+        ge=500,
+        description="Estimated tokens above which a document is split",
+    )
+
+
 class SecurityDocumentEvidenceExtractorConfig(BaseComponentConfiguration):
     """Configuration for SecurityDocumentEvidenceExtractor.
 
@@ -18,6 +43,11 @@ class SecurityDocumentEvidenceExtractorConfig(BaseComponentConfiguration):
     no ruleset config needed.
     """
 
+    chunking: DocumentChunkingConfig = Field(
+        default_factory=DocumentChunkingConfig,
+        description="Chunked classification of long documents",
+    )
+
     @classmethod
     @override
     def from_properties(cls, properties: dict[str, Any]) -> Self:
@@ -53,6 +83,14 @@ class DocumentItem(BaseModel):
     )
 
 
+class DocumentChunk(BaseModel):
+    """One separately classified part of a document."""
+
+    request_id: str = Field(description="ID of the chunk's classification request")
+    start: int = Field(description="Offset of the chunk in the document content")
+    end: int = Field(description="Offset just past the chunk's last character")
+
+
 class SecurityDocEvidencePrepareState(BaseModel):
     """Intermediate state produced by prepare(), consumed by finalise().
 
@@ -62,6 +100,9 @@ class SecurityDocEvidencePrepareState(BaseModel):
 
     document_items: list[DocumentItem]
     document_contents: list[str]
+    document_chunks: list[list[DocumentChunk]] = Field(
+        description="Chunks of each document, in document order",
+    )
     run_id: str
 
 
@@ -0,0 +1,100 @@
+"""Tests for section-aware document splitting and chunk response merging."""
+
+from waivern_schemas.security_domain import SecurityDomain
+
+from waivern_security_document_evidence_extractor.chunking import (
+    merge_chunk_responses,
+    split_document,
+)
+from waivern_security_document_evidence_extractor.types import (
+    DomainClassificationResponse,
+)
+
+
+def _chunks(content: str, max_chunk_tokens: int) -> list[str]:
+    return [
+        content[start:end] for start, end in split_document(content, max_chunk_tokens)
+    ]
+
+
+class TestSplitDocument:
+    """Tests for split_document()."""
+
+    def test_short_document_is_one_chunk(self) -> None:
+        assert _chunks("# Policy\n\nShort.", 500) == ["# Policy\n\nShort."]
+
+    def test_chunks_cover_the_document_within_the_limit(self) -> None:
+        content = "".join(
+            f"## {n} Section\n\n" + "A requirement of the section.\n" * 80
+            for n in range(1, 6)
+        )
+
+        chunks = _chunks(content, 500)
+
+        assert len(chunks) > 1
+        assert "".join(chunks) == content
+        assert all(len(chunk) <= 500 * 4 for chunk in chunks)
+
+    def test_prefers_section_headings(self) -> None:
+        """Each section fits a chunk but two do not: one chunk per section."""
+        section = "Each system has an owner.\n\n" * 40
+        content = f"# Scope\n\n{section}# Roles\n\n{section}# Review\n\n{section}"
+
+        chunks = _chunks(content, 300)
+
+        assert [chunk.split("\n", 1)[0] for chunk in chunks] == [
+            "# Scope",
+            "# Roles",
+            "# Review",
+        ]
+
+    def test_falls_back_to_paragraphs_then_lines(self) -> None:
+        """A section over the limit is cut at paragraph breaks."""
+        content = "# Only section\n\n" + "A paragraph of policy text.\n\n" * 200
+
+        chunks = _chunks(content, 500)
+
+        assert len(chunks) > 1
+        assert all(chunk.endswith("\n\n") for chunk in chunks)
+
+    def test_text_without_boundaries_is_cut_at_the_limit(self) -> None:
+        content = "x" * 5000
+
+        assert [len(chunk) for chunk in _chunks(content, 500)] == [2000, 2000, 1000]
+
+
+class TestMergeChunkResponses:
+    """Tests for merge_chunk_responses()."""
+
+    def test_unions_domains_and_concatenates_summaries(self) -> None:
+        merged = merge_chunk_responses(
+            [
+                DomainClassificationResponse(
+                    security_domains=[SecurityDomain.ACCESS_CONTROL], summary="One."
+                ),
+                DomainClassificationResponse(security_domains=[], summary="Two."),
+                DomainClassificationResponse(
+                    security_domains=[
+                        SecurityDomain.ENCRYPTION,
+                        SecurityDomain.ACCESS_CONTROL,
+                    ],
+                    summary="Three.",
+                ),
+            ]
+        )
+
+        assert merged.security_domains == [
+            SecurityDomain.ACCESS_CONTROL,
+            SecurityDomain.ENCRYPTION,
+        ]
+        assert merged.summary == "One.\n\nTwo.\n\nThree."
+
+    def test_document_is_cross_cutting_only_if_every_chunk_is(self) -> None:
+        merged = merge_chunk_responses(
+            [
+                DomainClassificationResponse(security_domains=[], summary="One."),
+                DomainClassificationResponse(security_domains=[], summary="Two."),
+            ]
+        )
+
+        assert merged.security_domains == []
@@ -1,7 +1,7 @@
 """Tests for SecurityDocumentEvidenceExtractor DistributedProcessor implementation.
 
 Verifies the prepare/finalise/deserialise contract:
-- prepare() parses documents and builds LLMRequest when LLM available
+- prepare() parses documents and builds an LLMRequest per document chunk
 - finalise() maps dispatch results into classified document output
 - deserialise_prepare_result() round-trips through JSON serialisation
 """
@@ -57,8 +57,8 @@ class TestPrepare:
         assert len(llm_request.groups) == 1
         assert llm_request.groups[0].group_id == "enc.docx"
 
-    def test_multiple_documents_build_one_group_per_document(self) -> None:
-        """N documents → single LLMRequest with N ItemGroups, each group_id=filename."""
+    def test_multiple_documents_build_one_request_per_document(self) -> None:
+        """N documents → N LLMRequests with one ItemGroup each, group_id=filename."""
         extractor = _make_extractor()
         msg = make_input_message(
             [
@@ -70,13 +70,13 @@ class TestPrepare:
 
         result = extractor.prepare(inputs=[msg], output_schema=OUTPUT_SCHEMA)
 
-        assert len(result.requests) == 1
-        llm_request = result.requests[0]
-        assert isinstance(llm_request, LLMRequest)
-        assert len(llm_request.groups) == 3
-        assert llm_request.groups[0].group_id == "enc.docx"
-        assert llm_request.groups[1].group_id == "incident.docx"
-        assert llm_request.groups[2].group_id == "isms.md"
+        assert len(result.requests) == 3
+        group_ids: list[str] = []
+        for llm_request in result.requests:
+            assert isinstance(llm_request, LLMRequest)
+            assert len(llm_request.groups) == 1
+            group_ids.append(llm_request.groups[0].group_id)
+        assert group_ids == ["enc.docx", "incident.docx", "isms.md"]
 
     def test_state_captures_documents_and_contents(self) -> None:
         """State contains correct document_items, document_contents, and run_id."""
@@ -205,28 +205,35 @@ class TestFinalise:
         )
 
         prepare_result = extractor.prepare(inputs=[msg], output_schema=OUTPUT_SCHEMA)
-        llm_result = LLMDispatchResult(
-            request_id=prepare_result.requests[0].request_id,
-            model_name="claude-sonnet-4-5-20250929",
-            responses=[
-                {
-                    "security_domains": ["encryption", "data_protection"],
-                    "summary": "Encryption and DLP summary",
-                },
-                {
-                    "security_domains": [],
-                    "summary": "ISMS overview summary",
-                },
-                {
-                    "security_domains": ["encryption"],
-                    "summary": "TLS configuration summary",
-                },
-            ],
-            skipped=[],
-        )
+        responses = [
+            {
+                "security_domains": ["encryption", "data_protection"],
+                "summary": "Encryption and DLP summary",
+            },
+            {
+                "security_domains": [],
+                "summary": "ISMS overview summary",
+            },
+            {
+                "security_domains": ["encryption"],
+                "summary": "TLS configuration summary",
+            },
+        ]
+        # Results arrive in any order; they are matched by request_id
+        llm_results = [
+            LLMDispatchResult(
+                request_id=request.request_id,
+                model_name="claude-sonnet-4-5-20250929",
+                responses=[response],
+                skipped=[],
+            )
+            for request, response in reversed(
+                list(zip(prepare_result.requests, responses, strict=True))
+            )
+        ]
 
         finalise_outcome = extractor.finalise(
-            prepare_result.state, [llm_result], OUTPUT_SCHEMA
+            prepare_result.state, llm_results, OUTPUT_SCHEMA
         )
         assert isinstance(finalise_outcome, tuple)
         result, _sidecars = finalise_outcome
@@ -240,6 +247,128 @@ class TestFinalise:
         ]
 
 
+# =============================================================================
+# Chunking
+# =============================================================================
+
+
+def _long_policy() -> str:
+    """A policy of two sections, each on the order of 1,000 tokens."""
+    return (
+        "# Access control\n\n"
+        + "Access is reviewed every 6 months.\n" * 120
+        + "\n# Cryptography\n\n"
+        + "Data at rest is encrypted with AES-256.\n" * 120
+    )
+
+
+def _make_chunking_extractor(**chunking: object) -> SecurityDocumentEvidenceExtractor:
+    return SecurityDocumentEvidenceExtractor(
+        config=SecurityDocumentEvidenceExtractorConfig.from_properties(
+            {"chunking": {"max_chunk_tokens": 1500, **chunking}}
+        )
+    )
+
+
+class TestChunking:
+    """Tests for chunked classification of long documents."""
+
+    def test_long_document_gets_one_request_per_section(self) -> None:
+        """A document over the limit is split at its section headings."""
+        extractor = _make_chunking_extractor()
+        msg = make_input_message([{"content": _long_policy(), "source": "policy.md"}])
+
+        result = extractor.prepare(inputs=[msg], output_schema=OUTPUT_SCHEMA)
+
+        assert len(result.requests) == 2
+        contents: list[str] = []
+        for part, llm_request in enumerate(result.requests, start=1):
+            assert isinstance(llm_request, LLMRequest)
+            assert llm_request.groups[0].group_id == f"policy.md#{part}"
+            assert llm_request.prompt_builder is not None
+            prompt = llm_request.prompt_builder.build_prompt(llm_request.groups)
+            assert f"**PART:** {part} of 2" in prompt
+            contents.append(llm_request.groups[0].content or "")
+        assert contents[0].startswith("# Access control")
+        assert contents[1].startswith("# Cryptography")
+        assert "".join(contents) == _long_policy()
+
+    def test_chunking_disabled_keeps_one_request(self) -> None:
+        """With chunking disabled a long document is sent whole."""
+        extractor = _make_chunking_extractor(enabled=False)
+        msg = make_input_message([{"content": _long_policy(), "source": "policy.md"}])
+
+        result = extractor.prepare(inputs=[msg], output_schema=OUTPUT_SCHEMA)
+
+        assert len(result.requests) == 1
+        llm_request = result.requests[0]
+        assert isinstance(llm_request, LLMRequest)
+        assert llm_request.prompt_builder is not None
+        prompt = llm_request.prompt_builder.build_prompt(llm_request.groups)
+        assert "**PART:**" not in prompt
+
+    def test_chunk_classifications_merge_into_one_finding(self) -> None:
+        """Domains are unioned and summaries concatenated in document order."""
+        extractor = _make_chunking_extractor()
+        msg = make_input_message([{"content": _long_policy(), "source": "policy.md"}])
+        prepare_result = extractor.prepare(inputs=[msg], output_schema=OUTPUT_SCHEMA)
+        responses = [
+            {"security_domains": ["access_control"], "summary": "Reviews."},
+            {"security_domains": ["encryption"], "summary": "AES-256."},
+        ]
+        llm_results = [
+            LLMDispatchResult(
+                request_id=request.request_id,
+                model_name="claude-sonnet-4-5-20250929",
+                responses=[response],
+                skipped=[],
+            )
+            for request, response in zip(
+                prepare_result.requests, responses, strict=True
+            )
+        ]
+
+        finalise_outcome = extractor.finalise(
+            prepare_result.state, llm_results, OUTPUT_SCHEMA
+        )
+        assert isinstance(finalise_outcome, tuple)
+        result, _sidecars = finalise_outcome
+
+        output = parse_output(result)
+        assert len(output.findings) == 1
+        finding = output.findings[0]
+        assert finding.security_domains == [
+            SecurityDomain.ACCESS_CONTROL,
+            SecurityDomain.ENCRYPTION,
+        ]
+        assert finding.summary == "Reviews.\n\nAES-256."
+        assert finding.content == _long_policy()
+        assert output.analysis_metadata.llm_validation_enabled is True
+
+    def test_unclassified_chunk_contributes_raw_text(self) -> None:
+        """A chunk without a response degrades on its own, not the document."""
+        extractor = _make_chunking_extractor()
+        msg = make_input_message([{"content": _long_policy(), "source": "policy.md"}])
+        prepare_result = extractor.prepare(inputs=[msg], output_schema=OUTPUT_SCHEMA)
+        llm_result = LLMDispatchResult(
+            request_id=prepare_result.requests[1].request_id,
+            model_name="claude-sonnet-4-5-20250929",
+            responses=[{"security_domains": ["encryption"], "summary": "AES-256."}],
+            skipped=[],
+        )
+
+        finalise_outcome = extractor.finalise(
+            prepare_result.state, [llm_result], OUTPUT_SCHEMA
+        )
+        assert isinstance(finalise_outcome, tuple)
+        result, _sidecars = finalise_outcome
+
+        finding = parse_output(result).findings[0]
+        assert finding.security_domains == [SecurityDomain.ENCRYPTION]
+        assert finding.summary.startswith("# Access control")
+        assert finding.summary.endswith("\n\nAES-256.")
+
+
 # =============================================================================
 # Deserialise
 # =============================================================================
@@ -273,6 +402,7 @@ class TestDeserialise:
             == original.state.document_items[0].metadata.source
         )
         assert restored.state.document_contents == original.state.document_contents
+        assert restored.state.document_chunks == original.state.document_chunks
         assert restored.state.run_id == original.state.run_id
 
         # Request metadata (prompt_builder/response_model excluded from serialisation)
@@ -280,3 +410,45 @@ class TestDeserialise:
         assert restored.requests[0].request_id == original.requests[0].request_id
         assert restored.requests[0].batching_mode == original.requests[0].batching_mode
         assert restored.requests[0].run_id == original.requests[0].run_id
+
+    def test_resumes_state_persisted_before_chunking(self) -> None:
+        """A pending state without chunks resumes with one chunk per document.
+
+        Before chunking, prepare() built one request for all documents and
+        persisted no ``document_chunks``; that request's result holds one
+        response per document, in document order.
+        """
+        extractor = _make_extractor()
+        msg = make_input_message(
+            [
+                {"content": "Encryption policy", "source": "enc.docx"},
+                {"content": "Access control policy", "source": "access.docx"},
+            ]
+        )
+        raw = extractor.prepare(inputs=[msg], output_schema=OUTPUT_SCHEMA).model_dump(
+            mode="json"
+        )
+        del raw["state"]["document_chunks"]
+        raw["requests"] = raw["requests"][:1]
+
+        restored = extractor.deserialise_prepare_result(raw)
+        llm_result = LLMDispatchResult(
+            request_id=restored.requests[0].request_id,
+            model_name="claude-sonnet-4-5-20250929",
+            responses=[
+                {"security_domains": ["encryption"], "summary": "Encryption."},
+                {"security_domains": ["access_control"], "summary": "Access."},
+            ],
+            skipped=[],
+        )
+        finalise_outcome = extractor.finalise(
+            restored.state, [llm_result], OUTPUT_SCHEMA
+        )
+        assert isinstance(finalise_outcome, tuple)
+
+        findings = parse_output(finalise_outcome[0]).findings
+        assert [finding.security_domains for finding in findings] == [
+            [SecurityDomain.ENCRYPTION],
+            [SecurityDomain.ACCESS_CONTROL],
+        ]
+        assert [finding.summary for finding in findings] == ["Encryption.", "Access."]
@@ -113,6 +113,7 @@ class SecurityEvidenceNormaliser(Analyser):
                 config.domain_ruleset, SecurityEvidenceDomainMappingRule
             )
         )
+        self._domain_rule_index = self._index_domain_rules(self._domain_mapping_rules)
 
     @classmethod
     @override
@@ -168,6 +169,29 @@ class SecurityEvidenceNormaliser(Analyser):
             f"waivern_security_evidence_normaliser.schema_readers.{module_name}"
         )
 
+    @staticmethod
+    def _index_domain_rules(
+        rules: tuple[SecurityEvidenceDomainMappingRule, ...],
+    ) -> dict[tuple[str, str], SecurityEvidenceDomainMappingRule]:
+        """Index domain mapping rules by (source_type, indicator value).
+
+        Built once per normaliser so each finding group is resolved with one
+        dict lookup instead of a scan over every rule and its values. When
+        several rules cover the same value, the first in ruleset order wins.
+
+        Args:
+            rules: Domain mapping rules in ruleset order.
+
+        Returns:
+            Mapping from (source_type, indicator value) to its rule.
+
+        """
+        index: dict[tuple[str, str], SecurityEvidenceDomainMappingRule] = {}
+        for rule in rules:
+            for value in rule.indicator_values:
+                index.setdefault((rule.source_type, value), rule)
+        return index
+
     def _find_domain_rule(
         self,
         source_type: _SourceType,
@@ -183,10 +207,7 @@ class SecurityEvidenceNormaliser(Analyser):
             The matching rule, or None if no rule covers this value.
 
         """
-        for rule in self._domain_mapping_rules:
-            if rule.source_type == source_type and value in rule.indicator_values:
-                return rule
-        return None
+        return self._domain_rule_index.get((source_type, value))
 
     def _propagate_require_review(
         self, require_review_values: list[bool | None]
@@ -226,33 +247,24 @@ class SecurityEvidenceNormaliser(Analyser):
             One or two SecurityEvidenceModel instances.
 
         """
-        item = SecurityEvidenceModel(
-            metadata=SecurityEvidenceMetadata(source=spec["source_file"]),
-            evidence_type="CODE",
-            security_domain=rule.security_domain,
-            polarity=spec["polarity"],
-            confidence=1.0,
-            description=spec["description"],
-            evidence=spec["evidence_snippets"],
-            require_review=spec["require_review"],
-        )
-        items = [item]
-
+        domains = [rule.security_domain]
         if rule.secondary_domain is not None:
-            items.append(
-                SecurityEvidenceModel(
-                    metadata=SecurityEvidenceMetadata(source=spec["source_file"]),
-                    evidence_type="CODE",
-                    security_domain=rule.secondary_domain,
-                    polarity=spec["polarity"],
-                    confidence=1.0,
-                    description=spec["description"],
-                    evidence=spec["evidence_snippets"],
-                    require_review=spec["require_review"],
-                )
-            )
+            domains.append(rule.secondary_domain)
 
-        return items
+        # Metadata is mutable, so each item gets its own
+        return [
+            SecurityEvidenceModel(
+                metadata=SecurityEvidenceMetadata(source=spec["source_file"]),
+                evidence_type="CODE",
+                security_domain=domain,
+                polarity=spec["polarity"],
+                confidence=1.0,
+                description=spec["description"],
+                evidence=spec["evidence_snippets"],
+                require_review=spec["require_review"],
+            )
+            for domain in domains
+        ]
 
     def _normalise[M](
         self,
@@ -263,9 +275,10 @@ class SecurityEvidenceNormaliser(Analyser):
         """Normalise findings from any indicator type into security evidence items.
 
         Orchestrates the normalisation flow:
-        1. Load and parse each input message into typed finding models
+        1. Load and parse each input message into typed finding models (reusing
+           the producer's typed model when the message carries one)
         2. Group findings by (indicator_value, source_file)
-        3. For each group, find the matching domain mapping rule
+        3. For each group, look up the matching domain mapping rule in the index
         4. Build one or two evidence items per group (primary + optional secondary domain)
 
         Args:
@@ -279,8 +292,11 @@ class SecurityEvidenceNormaliser(Analyser):
         """
         all_findings: list[M] = []
         for msg in inputs:
-            reader = self._load_reader(msg.schema, output_type)
-            output = reader.read(msg.content)
+            # Reuse the producer's typed model when it ran in this process
+            output = msg.get_typed_content(output_type)
+            if output is None:
+                reader = self._load_reader(msg.schema, output_type)
+                output = reader.read(msg.content)
             all_findings.extend(output.findings)
 
         groups: dict[tuple[str, str], list[_FindingValues]] = {}
@@ -289,21 +305,22 @@ class SecurityEvidenceNormaliser(Analyser):
             groups.setdefault(values["group_key"], []).append(values)
 
         evidence_items: list[SecurityEvidenceModel] = []
-        for group_key, group in groups.items():
+        for (_, source_file), group in groups.items():
             first = group[0]
             rule = self._find_domain_rule(
                 first["source_type"], first["indicator_value"]
             )
             if rule is None:
-                _, source_file = group_key
                 logger.debug(
-                    f"No domain mapping rule for {first['source_type']} "
-                    f"'{first['indicator_value']}' "
-                    f"— skipping {len(group)} finding(s) from {source_file}"
+                    "No domain mapping rule for %s '%s' "
+                    "— skipping %d finding(s) from %s",
+                    first["source_type"],
+                    first["indicator_value"],
+                    len(group),
+                    source_file,
                 )
                 continue
 
-            _, source_file = group_key
             require_review = self._propagate_require_review(
                 [v["require_review"] for v in group]
             )
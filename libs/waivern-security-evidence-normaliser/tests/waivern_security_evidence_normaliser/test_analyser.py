@@ -8,8 +8,15 @@ from waivern_core.errors import ProcessorConfigError
 from waivern_core.message import Message
 from waivern_core.schemas import Schema
 from waivern_core.services import ServiceContainer
+from waivern_rulesets.security_evidence_domain_mapping import (
+    SecurityEvidenceDomainMappingRule,
+)
+from waivern_schemas.security_domain import SecurityDomain
 
-from waivern_security_evidence_normaliser.analyser import SecurityEvidenceNormaliser
+from waivern_security_evidence_normaliser.analyser import (
+    SecurityEvidenceNormaliser,
+    _EvidenceItemSpec,  # pyright: ignore[reportPrivateUsage]
+)
 from waivern_security_evidence_normaliser.factory import (
     SecurityEvidenceNormaliserFactory,
 )
@@ -170,6 +177,36 @@ class TestNormalisePersonalData:
         assert "data_protection" in domains
         assert "people_controls" in domains
 
+    def test_secondary_domain_item_does_not_share_metadata_with_primary(
+        self,
+        valid_config: SecurityEvidenceNormaliserConfig,
+    ) -> None:
+        """Editing one item's metadata leaves the other domain's item unchanged."""
+        analyser = SecurityEvidenceNormaliser(valid_config)
+        rule = SecurityEvidenceDomainMappingRule(
+            name="health",
+            description="Health data",
+            source_type="category",
+            indicator_values=("health",),
+            security_domain=SecurityDomain.DATA_PROTECTION,
+            secondary_domain=SecurityDomain.PEOPLE_CONTROLS,
+        )
+
+        primary, secondary = analyser._build_evidence_items(  # pyright: ignore[reportPrivateUsage]
+            rule,
+            _EvidenceItemSpec(
+                source_file="health.php",
+                description="health",
+                polarity="neutral",
+                require_review=None,
+                evidence_snippets=[],
+            ),
+        )
+
+        assert primary.metadata is not secondary.metadata
+        primary.metadata.source = "edited.php"
+        assert secondary.metadata.source == "health.php"
+
     def test_unknown_personal_data_category_is_skipped_silently(
         self, caplog: pytest.LogCaptureFixture
     ) -> None:
@@ -1030,3 +1067,62 @@ class TestNormaliseDataCollection:
         findings = result.content["findings"]
         assert len(findings) == 1
         assert findings[0]["security_domain"] == "vulnerability_management"
+
+
+# =============================================================================
+# Domain rule index
+# =============================================================================
+
+
+class TestDomainRuleIndex:
+    """Tests for indexing domain mapping rules by indicator value."""
+
+    def test_first_rule_in_ruleset_order_wins_for_a_shared_value(self) -> None:
+        """When two rules list the same value, the earlier rule is used."""
+        first = SecurityEvidenceDomainMappingRule(
+            name="first",
+            description="First rule",
+            source_type="category",
+            indicator_values=("email", "phone"),
+            security_domain=SecurityDomain.DATA_PROTECTION,
+        )
+        second = SecurityEvidenceDomainMappingRule(
+            name="second",
+            description="Second rule",
+            source_type="category",
+            indicator_values=("email",),
+            security_domain=SecurityDomain.ACCESS_CONTROL,
+        )
+
+        index = SecurityEvidenceNormaliser._index_domain_rules(  # pyright: ignore[reportPrivateUsage]
+            (first, second)
+        )
+
+        assert index[("category", "email")] is first
+        assert index[("category", "phone")] is first
+
+    def test_same_value_under_another_source_type_is_indexed_separately(
+        self,
+    ) -> None:
+        """Rules only compete for a value within the same source type."""
+        category = SecurityEvidenceDomainMappingRule(
+            name="category",
+            description="Category rule",
+            source_type="category",
+            indicator_values=("payment",),
+            security_domain=SecurityDomain.DATA_PROTECTION,
+        )
+        purpose = SecurityEvidenceDomainMappingRule(
+            name="purpose",
+            description="Purpose rule",
+            source_type="purpose",
+            indicator_values=("payment",),
+            security_domain=SecurityDomain.ACCESS_CONTROL,
+        )
+
+        index = SecurityEvidenceNormaliser._index_domain_rules(  # pyright: ignore[reportPrivateUsage]
+            (category, purpose)
+        )
+
+        assert index[("category", "payment")] is category
+        assert index[("purpose", "payment")] is purpose
@@ -0,0 +1,11 @@
+#!/bin/bash
+
+# Run end-to-end benchmarks on a synthetic estate
+# Usage: bash scripts/bench.sh [--size small|medium|large] [--repeat N] [--update-baseline] [options]
+# Runs the bundled runbooks offline and compares with benchmarks/baselines/<size>.json
+
+set -e
+
+cd "$(dirname "${BASH_SOURCE[0]}")/.."
+
+uv run python -m benchmarks "$@"
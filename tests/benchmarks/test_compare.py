@@ -0,0 +1,190 @@
+"""Tests for comparing benchmark results with a baseline."""
+
+from typing import Any
+
+import pytest
+
+from benchmarks.compare import Change, compare
+
+
+def _results(**scenario: Any) -> dict[str, Any]:
+    measurements: dict[str, Any] = {
+        "wall_seconds": 10.0,
+        "planning_seconds": 1.0,
+        "execution_seconds": 9.0,
+        "peak_rss_bytes": 200 * 1024 * 1024,
+        "store_bytes": 50_000,
+        "llm_calls": 8,
+        "component_seconds": {"personal_data_analyser": 2.0},
+        "artifacts": {"completed": 5, "failed": 0, "skipped": 0},
+    }
+    return {"scenarios": {"lamp_stack_lite": measurements | scenario}}
+
+
+def _regressions(changes: list[Change]) -> list[str]:
+    return [change.measure for change in changes if change.regressed]
+
+
+class TestCompare:
+    """Tests for compare()."""
+
+    def test_identical_results_do_not_regress(self) -> None:
+        """Every measurement is compared and none regresses."""
+        changes = compare(_results(), _results(), tolerance=0.25)
+
+        assert {change.measure for change in changes} == {
+            "wall_seconds",
+            "planning_seconds",
+            "execution_seconds",
+            "peak_rss_bytes",
+            "store_bytes",
+            "llm_calls",
+            "component_seconds[personal_data_analyser]",
+            "artifacts[failed]",
+            "artifacts[skipped]",
+        }
+        assert _regressions(changes) == []
+
+    def test_growth_beyond_tolerance_regresses(self) -> None:
+        """A measurement more than ``tolerance`` over the baseline regresses."""
+        changes = compare(
+            _results(), _results(store_bytes=70_000, llm_calls=12), tolerance=0.25
+        )
+
+        assert _regressions(changes) == ["store_bytes", "llm_calls"]
+
+    def test_growth_within_tolerance_passes(self) -> None:
+        """Growth up to ``tolerance`` is not a regression."""
+        changes = compare(_results(), _results(store_bytes=60_000), tolerance=0.25)
+
+        assert _regressions(changes) == []
+
+    def test_machine_measures_are_not_gated_by_default(self) -> None:
+        """Without ``machine_tolerance`` timings and peak RSS are reported only."""
+        changes = compare(
+            _results(),
+            _results(
+                wall_seconds=30.0,
+                peak_rss_bytes=300 * 1024 * 1024,
+                component_seconds={"personal_data_analyser": 6.0},
+            ),
+            tolerance=0.25,
+        )
+
+        assert _regressions(changes) == []
+        [wall, rss] = [
+            change
+            for change in changes
+            if change.measure in ("wall_seconds", "peak_rss_bytes")
+        ]
+        assert (wall.current, rss.current) == (30.0, 300 * 1024 * 1024)
+        assert not wall.gated
+        assert not rss.gated
+
+    def test_growth_beyond_machine_tolerance_regresses(self) -> None:
+        """With ``machine_tolerance`` timings and peak RSS regress beyond it."""
+        changes = compare(
+            _results(),
+            _results(
+                wall_seconds=16.0,
+                planning_seconds=1.4,
+                peak_rss_bytes=400 * 1024 * 1024,
+            ),
+            tolerance=0.25,
+            machine_tolerance=0.5,
+        )
+
+        assert _regressions(changes) == ["wall_seconds", "peak_rss_bytes"]
+
+    def test_growth_below_noise_floor_passes(self) -> None:
+        """A large relative slowdown of a tiny timing is noise."""
+        changes = compare(
+            _results(planning_seconds=0.01),
+            _results(planning_seconds=0.04),
+            tolerance=0.25,
+            machine_tolerance=0.25,
+        )
+
+        assert _regressions(changes) == []
+
+    def test_slower_component_regresses(self) -> None:
+        """Per-component timings are compared like the overall ones."""
+        changes = compare(
+            _results(),
+            _results(component_seconds={"personal_data_analyser": 3.0}),
+            tolerance=0.25,
+            machine_tolerance=0.25,
+        )
+
+        assert _regressions(changes) == ["component_seconds[personal_data_analyser]"]
+
+    def test_component_growth_below_share_of_wall_time_passes(self) -> None:
+        """A small component's slowdown under 5% of the wall time is noise."""
+        changes = compare(
+            _results(component_seconds={"source_code_analyser": 0.1}),
+            _results(component_seconds={"source_code_analyser": 0.5}),
+            tolerance=0.25,
+            machine_tolerance=0.25,
+        )
+
+        assert _regressions(changes) == []
+
+    def test_any_new_failed_artifact_regresses(self) -> None:
+        """Any failed artifact beyond the baseline regresses, whatever the tolerance."""
+        changes = compare(
+            _results(),
+            _results(artifacts={"completed": 4, "failed": 1, "skipped": 0}),
+            tolerance=10.0,
+            machine_tolerance=10.0,
+        )
+
+        assert _regressions(changes) == ["artifacts[failed]"]
+
+    def test_baseline_missing_measures_is_rejected(self) -> None:
+        """A baseline of artifact outcomes only cannot detect slowdowns."""
+        baseline = {
+            "scenarios": {"lamp_stack_lite": {"artifacts": {"failed": 0, "skipped": 0}}}
+        }
+
+        with pytest.raises(ValueError, match="wall_seconds"):
+            compare(baseline, _results(wall_seconds=100.0), tolerance=0.25)
+
+    def test_component_no_longer_run_is_reported_as_zero(self) -> None:
+        """A component dropped from the scenario is reported, not skipped."""
+        changes = compare(_results(), _results(component_seconds={}), tolerance=0.25)
+
+        [dropped] = [
+            change
+            for change in changes
+            if change.measure == "component_seconds[personal_data_analyser]"
+        ]
+        assert dropped.current == 0.0
+        assert not dropped.regressed
+
+    def test_dropped_component_does_not_regress_when_gated(
+        self,
+    ) -> None:
+        """A component no longer run took no time, which is not a slowdown."""
+        changes = compare(
+            _results(),
+            _results(component_seconds={}),
+            tolerance=0.25,
+            machine_tolerance=0.25,
+        )
+
+        assert _regressions(changes) == []
+
+    def test_scenarios_not_run_are_skipped(self) -> None:
+        """Baseline scenarios missing from the current results are not compared."""
+        current = {"scenarios": {}}
+
+        assert compare(_results(), current, tolerance=0.25) == []
+
+
+class TestChange:
+    """Tests for Change."""
+
+    def test_ratio_of_zero_baseline(self) -> None:
+        """Growth from zero is infinite; staying at zero is unchanged."""
+        assert Change("s", "m", 0, 1, regressed=True).ratio == float("inf")
+        assert Change("s", "m", 0, 0, regressed=False).ratio == 1.0
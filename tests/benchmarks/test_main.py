@@ -0,0 +1,74 @@
+"""Tests for reporting benchmark results against the committed baseline."""
+
+import copy
+import json
+from pathlib import Path
+from typing import Any
+
+from benchmarks.__main__ import BASELINES_DIR, _report
+from benchmarks.estate import PRESETS
+
+
+def _small_results(failed: int = 0) -> dict[str, Any]:
+    return {
+        "size": "small",
+        "estate": PRESETS["small"].as_dict(),
+        "llm_latency": 0.0,
+        "repeat": 1,
+        "scenarios": {
+            "lamp_stack_lite": {
+                "wall_seconds": 10.0,
+                "planning_seconds": 1.0,
+                "execution_seconds": 9.0,
+                "peak_rss_bytes": 0,
+                "store_bytes": 0,
+                "llm_calls": 0,
+                "component_seconds": {},
+                "artifacts": {"completed": 5, "failed": failed, "skipped": 0},
+            }
+        },
+    }
+
+
+class TestReport:
+    """Tests for _report()."""
+
+    def test_missing_baseline_is_an_error(self, tmp_path: Path) -> None:
+        """Without a baseline nothing can be compared, so the run fails."""
+        assert _report(_small_results(), tmp_path / "small.json", 0.25) == 2
+
+    def test_baseline_for_another_estate_is_an_error(self, tmp_path: Path) -> None:
+        """A baseline recorded for another estate cannot be compared."""
+        baseline = tmp_path / "small.json"
+        baseline.write_text(json.dumps(_small_results() | {"llm_latency": 0.2}))
+
+        assert _report(_small_results(), baseline, 0.25) == 2
+
+    def test_incomplete_baseline_is_an_error(self, tmp_path: Path) -> None:
+        """A baseline lacking timings could never flag a slowdown."""
+        results = _small_results()
+        scenario: dict[str, Any] = results["scenarios"]["lamp_stack_lite"]
+        del scenario["wall_seconds"]
+        baseline = tmp_path / "small.json"
+        baseline.write_text(json.dumps(results))
+
+        assert _report(_small_results(), baseline, 0.25) == 2
+
+    def test_committed_small_baseline_detects_regressions(self) -> None:
+        """The committed baseline flags failures, and slowdowns if asked to."""
+        baseline = BASELINES_DIR / "small.json"
+        recorded = json.loads(baseline.read_text())
+        assert recorded["estate"] == PRESETS["small"].as_dict()
+        assert any(scenario["llm_calls"] for scenario in recorded["scenarios"].values())
+
+        slower = copy.deepcopy(recorded)
+        failing = copy.deepcopy(recorded)
+        for scenario in slower["scenarios"].values():
+            scenario["wall_seconds"] *= 2
+        for scenario in failing["scenarios"].values():
+            scenario["artifacts"]["failed"] += 1
+
+        assert _report(recorded, baseline, 0.25) == 0
+        assert _report(slower, baseline, 0.25) == 0
+        assert _report(slower, baseline, 0.25, machine_tolerance=0.5) == 1
+        assert _report(failing, baseline, 0.25) == 1